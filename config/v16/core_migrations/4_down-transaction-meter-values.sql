@@ -0,0 +1,2 @@
+DROP INDEX TRANSACTION_METER_VALUES_SESSION_ID;
+DROP TABLE TRANSACTION_METER_VALUES;
@@ -0,0 +1,6 @@
+CREATE TABLE TRANSACTION_METER_VALUES(
+    ID INTEGER PRIMARY KEY AUTOINCREMENT,
+    SESSION_ID TEXT NOT NULL,
+    METER_VALUE TEXT NOT NULL
+);
+CREATE INDEX TRANSACTION_METER_VALUES_SESSION_ID ON TRANSACTION_METER_VALUES(SESSION_ID);
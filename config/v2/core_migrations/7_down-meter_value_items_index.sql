@@ -0,0 +1 @@
+DROP INDEX METER_VALUE_ITEMS_METER_VALUE_ID;
@@ -0,0 +1 @@
+CREATE INDEX METER_VALUE_ITEMS_METER_VALUE_ID ON METER_VALUE_ITEMS(METER_VALUE_ID);
@@ -0,0 +1 @@
+DROP TABLE OCSP_REFRESH_STATE;
@@ -0,0 +1,6 @@
+-- Time at which the cached OCSP response of a V2G certificate should be refreshed --
+-- CERTIFICATE_KEY is made of the hash algorithm, issuer name hash, issuer key hash and serial number of the certificate
+CREATE TABLE OCSP_REFRESH_STATE(
+    CERTIFICATE_KEY TEXT PRIMARY KEY NOT NULL,
+    NEXT_REFRESH INT64 NOT NULL
+);
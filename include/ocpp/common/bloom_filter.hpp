@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace ocpp {
+
+/// \brief Probabilistic set of strings. A negative answer of may_contain() is exact, a positive answer is a false
+/// positive with a probability of roughly 1% as long as no more than capacity() keys have been inserted.
+class BloomFilter {
+private:
+    std::vector<uint64_t> bits;
+    std::size_t number_of_bits;
+    std::size_t expected_elements;
+    std::size_t number_of_elements;
+
+public:
+    /// \brief Creates a filter sized for \p expected_elements keys
+    explicit BloomFilter(std::size_t expected_elements = 0);
+
+    /// \brief Adds \p key to the filter
+    /// \returns false if the filter already reported \p key as contained before, in this case size() is not increased
+    bool insert(std::string_view key);
+
+    /// \brief Returns false if \p key has definitely not been inserted, true if it might have been
+    bool may_contain(std::string_view key) const;
+
+    /// \brief Removes all keys while keeping the capacity
+    void clear();
+
+    /// \brief Number of distinct keys inserted since construction or the last clear(). Keys inserted more than once
+    /// and false positives are only counted once
+    std::size_t size() const;
+
+    /// \brief Number of keys the filter has been sized for
+    std::size_t capacity() const;
+};
+
+} // namespace ocpp
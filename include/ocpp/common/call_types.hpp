@@ -14,6 +14,7 @@
 #include <string>
 
 #include <ocpp/common/cistring.hpp>
+#include <ocpp/common/json_writer.hpp>
 
 using json = nlohmann::json;
 
@@ -86,6 +87,16 @@ template <class T> struct Call {
         j.push_back(json(c.msg));
     }
 
+    /// \brief Writes the given Call message \p c as JSON text to the given \p writer
+    friend void write_json(JsonWriter& writer, const Call& c) {
+        writer.start_array();
+        writer.value(static_cast<int32_t>(MessageTypeId::CALL));
+        writer.value(c.uniqueId.get());
+        writer.value(c.msg.get_type());
+        write_json(writer, c.msg);
+        writer.end_array();
+    }
+
     /// \brief Conversion from a given json object \p j to a given Call message \p c
     friend void from_json(const json& j, Call& c) {
         // the required parts of the message
@@ -124,6 +135,15 @@ template <class T> struct CallResult {
         j.push_back(json(c.msg));
     }
 
+    /// \brief Writes the given CallResult message \p c as JSON text to the given \p writer
+    friend void write_json(JsonWriter& writer, const CallResult& c) {
+        writer.start_array();
+        writer.value(static_cast<int32_t>(MessageTypeId::CALLRESULT));
+        writer.value(c.uniqueId.get());
+        write_json(writer, c.msg);
+        writer.end_array();
+    }
+
     /// \brief Conversion from a given json object \p j to a given CallResult message \p c
     friend void from_json(const json& j, CallResult& c) {
         // the required parts of the message
@@ -7,8 +7,10 @@
 
 #include <ocpp/common/evse_security.hpp>
 #include <ocpp/common/evse_security_impl.hpp>
+#include <ocpp/common/executor.hpp>
 #include <ocpp/common/message_queue.hpp>
 #include <ocpp/common/ocpp_logging.hpp>
+#include <ocpp/common/timer_service.hpp>
 
 namespace ocpp {
 
@@ -21,7 +23,10 @@ protected:
 
     boost::shared_ptr<boost::asio::io_service::work> work;
     boost::asio::io_service io_service;
-    std::thread io_service_thread;
+    /// \brief Runs the io_service on a pool of threads with a strand per EVSE or connector
+    std::unique_ptr<Executor> executor;
+    /// \brief Runs the timers of the charging station on the io_service
+    std::shared_ptr<TimerService> timer_service;
 
 public:
     /// \brief Constructor for ChargingStationBase
@@ -32,6 +37,9 @@ public:
     explicit ChargingStationBase(const std::shared_ptr<EvseSecurity> evse_security,
                                  const std::optional<SecurityConfiguration> security_configuration = std::nullopt);
     virtual ~ChargingStationBase();
+
+    /// \brief Returns wakeup and lag statistics of the timers of the charging station
+    TimerServiceMetrics get_timer_service_metrics();
 };
 
 } // namespace ocpp
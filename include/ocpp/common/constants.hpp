@@ -4,6 +4,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -26,6 +27,9 @@ constexpr std::int32_t EVSEID_NOT_SET = -1;
 
 constexpr std::chrono::seconds DEFAULT_WAIT_FOR_FUTURE_TIMEOUT = std::chrono::seconds(60);
 
+constexpr std::size_t AUTH_CACHE_MAX_ENTRIES_IN_MEMORY = 1000;
+constexpr std::chrono::seconds AUTH_CACHE_LAST_USED_FLUSH_INTERVAL = std::chrono::seconds(10);
+
 const std::string VARIABLE_ATTRIBUTE_VALUE_SOURCE_INTERNAL = "internal";
 const std::string VARIABLE_ATTRIBUTE_VALUE_SOURCE_CSMS = "csms";
 
@@ -9,19 +9,12 @@
 
 #include <ocpp/common/database/database_connection.hpp>
 #include <ocpp/common/database/database_exceptions.hpp>
+#include <ocpp/common/message_queue_persistence.hpp>
 #include <ocpp/common/types.hpp>
 
 namespace ocpp::common {
 
-struct DBTransactionMessage {
-    json json_message;
-    std::string message_type;
-    int32_t message_attempts;
-    DateTime timestamp;
-    std::string unique_id;
-};
-
-class DatabaseHandlerCommon {
+class DatabaseHandlerCommon : public MessageQueuePersistenceInterface {
 protected:
     std::unique_ptr<DatabaseConnectionInterface> database;
     const fs::path sql_migration_files_path;
@@ -51,25 +44,25 @@ public:
     /// \brief Get messages from messages queue table specified by \p queue_type
     /// \param queue_type , defaults to QueueType::Transaction
     /// \return The transaction messages.
-    virtual std::vector<DBTransactionMessage>
-    get_message_queue_messages(const QueueType queue_type = QueueType::Transaction);
+    std::vector<DBTransactionMessage>
+    get_message_queue_messages(const QueueType queue_type = QueueType::Transaction) override;
 
     /// \brief Insert a new message into messages queue table specified by \p queue_type
     /// \param message  The message to be stored.
     /// \param queue_type , defaults to QueueType::Transaction
-    virtual void insert_message_queue_message(const DBTransactionMessage& message,
-                                              const QueueType queue_type = QueueType::Transaction);
+    void insert_message_queue_message(const DBTransactionMessage& message,
+                                      const QueueType queue_type = QueueType::Transaction) override;
 
     /// \brief Remove a message from the messages queue table specified by \p queue_type
     /// \param unique_id    The unique id of the transaction message
     /// \param queue_type , defaults to QueueType::Transaction
     /// \return True on success.
-    virtual void remove_message_queue_message(const std::string& unique_id,
-                                              const QueueType queue_type = QueueType::Transaction);
+    void remove_message_queue_message(const std::string& unique_id,
+                                      const QueueType queue_type = QueueType::Transaction) override;
 
     /// \brief Deletes all entries from message queue table specified by \p queue_type
     /// \param queue_type , defaults to QueueType::Transaction
-    virtual void clear_message_queue(const QueueType queue_type = QueueType::Transaction);
+    void clear_message_queue(const QueueType queue_type = QueueType::Transaction) override;
 };
 
 } // namespace ocpp::common
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ocpp/common/bloom_filter.hpp>
+
+namespace ocpp::common {
+
+/// \brief In-memory index over the keys of the AUTH_LIST table. It answers lookups of tokens that are not part of the
+/// local authorization list without querying the database; positive answers still need to be confirmed by a query.
+///
+/// The index is (re)built lazily from the database on the first lookup after construction or invalidate(). Removed
+/// keys can not be deleted from the underlying Bloom filter, so the index rebuilds itself once too many of them have
+/// accumulated or more keys than it was sized for have been inserted.
+class LocalAuthorizationListIndex {
+public:
+    /// \brief Returns all keys currently stored in the AUTH_LIST table
+    using KeyLoader = std::function<std::vector<std::string>()>;
+
+private:
+    KeyLoader key_loader;
+    std::mutex mutex;
+    BloomFilter filter;
+    bool valid;
+    std::size_t removed_keys;
+
+    /// \brief Loads all keys using the key_loader and builds a new filter. Has to be called with mutex locked
+    void rebuild();
+
+    /// \brief Replaces the filter by one sized for \p expected_keys holding exactly \p keys
+    void assign(const std::vector<std::string>& keys, std::size_t expected_keys);
+
+public:
+    explicit LocalAuthorizationListIndex(KeyLoader key_loader);
+
+    /// \brief Returns false if \p key is definitely not part of the local authorization list
+    bool may_contain(const std::string& key);
+
+    /// \brief Commits an update of the local authorization list to the database and applies it to the index. Both
+    /// happen under the lock of the index, so a lookup never sees the committed list without the update applied.
+    /// \param inserted_keys Keys that are added or updated
+    /// \param removed_keys Keys that are deleted
+    /// \param commit Commits the update to the database, throws if this fails. The index is invalidated in this case
+    void update(const std::vector<std::string>& inserted_keys, const std::vector<std::string>& removed_keys,
+                const std::function<void()>& commit);
+
+    /// \brief Marks the local authorization list as empty
+    void clear();
+
+    /// \brief Drops the index, it is rebuilt from the database on the next lookup
+    void invalidate();
+};
+
+} // namespace ocpp::common
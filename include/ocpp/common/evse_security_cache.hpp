@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ocpp/common/types.hpp>
+
+namespace ocpp {
+
+/// \brief Thread safe cache of the results of EvseSecurity calls that verify certificate chains or read and parse
+/// certificate files. Results of a certificate chain are keyed by the SHA-256 hash of the chain. Entries expire after
+/// a time to live, because certificates expire or get revoked without any call to the EvseSecurity, and all entries
+/// must be invalidated when the installed certificates change. A result is only stored if the cache has not been
+/// invalidated since get_generation was called before the EvseSecurity call that produced it, so a result computed
+/// with the previously installed certificates can not be stored after the invalidation.
+class EvseSecurityCache {
+public:
+    /// \brief Creates a cache whose entries expire after \p time_to_live. A \p time_to_live of zero disables the cache.
+    /// At most \p max_certificate_chains entries are kept per certificate chain result, the one closest to its expiry
+    /// is dropped first
+    EvseSecurityCache(std::chrono::seconds time_to_live, std::size_t max_certificate_chains);
+
+    /// \brief Returns the generation of the cache, which is incremented by every invalidation. It must be read before
+    /// the EvseSecurity call whose result is passed to one of the setters
+    std::uint64_t get_generation();
+
+    std::optional<CertificateValidationResult> get_verification_result(const std::string& certificate_chain,
+                                                                       LeafCertificateType certificate_type);
+    /// \brief Caches the \p result of verifying the given \p certificate_chain. Unknown results are not cached, since
+    /// they may be caused by a temporary error
+    void set_verification_result(const std::string& certificate_chain, LeafCertificateType certificate_type,
+                                 CertificateValidationResult result, std::uint64_t generation);
+
+    std::optional<std::vector<OCSPRequestData>> get_mo_ocsp_request_data(const std::string& certificate_chain);
+    void set_mo_ocsp_request_data(const std::string& certificate_chain,
+                                  const std::vector<OCSPRequestData>& ocsp_request_data, std::uint64_t generation);
+
+    std::optional<std::vector<CertificateHashDataChain>>
+    get_installed_certificates(const std::vector<CertificateType>& certificate_types);
+    void set_installed_certificates(const std::vector<CertificateType>& certificate_types,
+                                    const std::vector<CertificateHashDataChain>& installed_certificates,
+                                    std::uint64_t generation);
+
+    std::optional<GetCertificateInfoResult> get_leaf_certificate_info(CertificateSigningUseEnum certificate_type,
+                                                                      bool include_ocsp);
+    /// \brief Caches the given \p leaf_certificate_info. Only results with status Accepted are cached
+    void set_leaf_certificate_info(CertificateSigningUseEnum certificate_type, bool include_ocsp,
+                                   const GetCertificateInfoResult& leaf_certificate_info, std::uint64_t generation);
+
+    /// \brief Drops all entries, e.g. because a certificate was installed or deleted
+    void invalidate();
+
+    /// \brief Drops the cached leaf certificate info, e.g. because the OCSP cache or the certificate links changed
+    void invalidate_leaf_certificate_info();
+
+private:
+    template <typename T> struct Entry {
+        T value;
+        std::chrono::time_point<std::chrono::steady_clock> expiry;
+    };
+
+    std::mutex mutex;
+    const std::chrono::seconds time_to_live;
+    const std::size_t max_certificate_chains;
+    // Incremented by every invalidation, including the one of the leaf certificate info only
+    std::uint64_t generation;
+
+    std::map<std::pair<std::string, LeafCertificateType>, Entry<CertificateValidationResult>> verification_results;
+    std::map<std::string, Entry<std::vector<OCSPRequestData>>> mo_ocsp_request_data;
+    std::map<std::vector<CertificateType>, Entry<std::vector<CertificateHashDataChain>>> installed_certificates;
+    std::map<std::pair<CertificateSigningUseEnum, bool>, Entry<GetCertificateInfoResult>> leaf_certificate_info;
+
+    template <typename Key, typename T> std::optional<T> get(std::map<Key, Entry<T>>& entries, const Key& key);
+    template <typename Key, typename T>
+    void set(std::map<Key, Entry<T>>& entries, const Key& key, const T& value, std::size_t max_entries,
+             std::uint64_t generation);
+};
+
+} // namespace ocpp
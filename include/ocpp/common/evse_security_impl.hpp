@@ -3,11 +3,13 @@
 #ifndef OCPP_COMMON_EVSE_SECURITY_IMPL
 #define OCPP_COMMON_EVSE_SECURITY_IMPL
 
+#include <chrono>
 #include <filesystem>
 #include <optional>
 
 #include <evse_security/evse_security.hpp>
 #include <ocpp/common/evse_security.hpp>
+#include <ocpp/common/evse_security_cache.hpp>
 #include <ocpp/common/support_older_cpp_versions.hpp>
 
 namespace ocpp {
@@ -25,12 +27,18 @@ struct SecurityConfiguration {
     fs::path secc_leaf_key_link;
     fs::path cpo_cert_chain_link;
     std::optional<std::string> private_key_password;
+    /// \brief Time for which verification results and parsed certificate files are cached, zero disables the cache
+    std::chrono::seconds certificate_cache_time_to_live = std::chrono::minutes(30);
+    /// \brief Maximum number of certificate chains whose verification results are cached
+    std::size_t certificate_cache_max_chains = 1000;
 };
 
 class EvseSecurityImpl : public EvseSecurity {
 
 private:
     std::unique_ptr<evse_security::EvseSecurity> evse_security;
+    // Contract certificates are verified on every plug-in, the results are reused until a certificate changes
+    EvseSecurityCache cache;
 
 public:
     explicit EvseSecurityImpl(const SecurityConfiguration& file_paths);
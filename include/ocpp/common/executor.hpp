@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/strand.hpp>
+
+namespace ocpp {
+
+/// \brief Handlers posted to the same strand are run in the order they have been posted and never concurrently
+using Strand = boost::asio::strand<boost::asio::io_context::executor_type>;
+
+/// \brief Runs an io_context on a pool of threads. Work belonging to one EVSE or connector is posted to the strand of
+/// its id, so it keeps its order while the work of independent EVSEs is run in parallel. Work of the charging station
+/// as a whole is posted to the station strand, which keeps the ordering of the former single io_context thread.
+class Executor {
+private:
+    boost::asio::io_context& io_context;
+    std::mutex mutex;
+    std::vector<std::thread> threads;
+    std::shared_ptr<Strand> station_strand;
+    std::unordered_map<int32_t, std::shared_ptr<Strand>> strands;
+
+public:
+    /// \brief Starts \p number_of_threads threads (at least one) running \p io_context
+    explicit Executor(boost::asio::io_context& io_context, std::size_t number_of_threads = 1);
+    ~Executor();
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    /// \brief Starts additional threads until the pool has \p number_of_threads threads. The pool is never shrunk
+    /// while the io_context is running
+    void set_number_of_threads(std::size_t number_of_threads);
+
+    /// \brief Returns the number of threads running the io_context
+    std::size_t get_number_of_threads();
+
+    /// \brief Returns the strand of the EVSE or connector \p id, creating it on first use
+    std::shared_ptr<Strand> get_strand(int32_t id);
+
+    /// \brief Returns the strand for work that is not bound to an EVSE or connector
+    std::shared_ptr<Strand> get_station_strand();
+
+    /// \brief Runs \p handler on the strand of the EVSE or connector \p id
+    void post(int32_t id, const std::function<void()>& handler);
+
+    /// \brief Runs \p handler on the station strand
+    void post(const std::function<void()>& handler);
+
+    /// \brief Waits for all threads to return. The io_context has to be stopped before
+    void join();
+};
+
+} // namespace ocpp
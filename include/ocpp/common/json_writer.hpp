@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <ocpp/common/cistring.hpp>
+#include <ocpp/common/types.hpp>
+
+namespace ocpp {
+
+/// \brief Writes JSON text directly into a string buffer without constructing json objects first. The output has the
+/// same format as json::dump() without indentation, so a message written with the generated write_json functions is
+/// equal to the dump of the json object created by its to_json function.
+class JsonWriter {
+public:
+    /// \brief Creates a writer that appends to the given \p buffer
+    explicit JsonWriter(std::string& buffer);
+
+    void start_object();
+    void end_object();
+    void start_array();
+    void end_array();
+
+    /// \brief Writes the \p key of the next member of the current object
+    void key(std::string_view key);
+
+    /// \brief Writes the string \p value
+    /// \throws json::type_error if \p value is not valid UTF-8, like json::dump() does
+    void value(std::string_view value);
+    void value(const std::string& value);
+    void value(const char* value);
+    void value(bool value);
+    void value(int32_t value);
+    void value(int64_t value);
+    /// \brief Writes the shortest representation of \p value that parses back to the same value. Not finite values
+    /// are written as null, like json::dump() does
+    void value(double value);
+    /// \brief Writes the dump of the given json object \p value, used for members that are not generated types like
+    /// CustomData
+    void value(const json& value);
+
+private:
+    std::string& buffer;
+    /// true if the next element is the first one of an object or array, or the value of a key
+    bool first = true;
+
+    void separate();
+};
+
+inline void write_json(JsonWriter& writer, const std::string& value) {
+    writer.value(value);
+}
+
+inline void write_json(JsonWriter& writer, bool value) {
+    writer.value(value);
+}
+
+inline void write_json(JsonWriter& writer, int32_t value) {
+    writer.value(value);
+}
+
+inline void write_json(JsonWriter& writer, double value) {
+    writer.value(value);
+}
+
+inline void write_json(JsonWriter& writer, const json& value) {
+    writer.value(value);
+}
+
+inline void write_json(JsonWriter& writer, const DateTime& value) {
+    writer.value(value.to_rfc3339());
+}
+
+template <size_t L> void write_json(JsonWriter& writer, const CiString<L>& value) {
+    writer.value(value.get());
+}
+
+template <typename T> void write_json(JsonWriter& writer, const std::vector<T>& values) {
+    writer.start_array();
+    for (const auto& value : values) {
+        write_json(writer, value);
+    }
+    writer.end_array();
+}
+
+/// \brief Serializes the given \p value with its write_json function
+/// \returns the JSON text of the \p value
+template <typename T> std::string to_json_string(const T& value) {
+    std::string buffer;
+    JsonWriter writer(buffer);
+    write_json(writer, value);
+    return buffer;
+}
+
+} // namespace ocpp
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ocpp {
+
+/// \brief Copy of the values recorded by a LatencyHistogram
+struct LatencyHistogramSnapshot {
+    uint64_t count = 0;               ///< Number of recorded latencies
+    std::chrono::microseconds sum{0}; ///< Sum of all recorded latencies
+    std::chrono::microseconds max{0}; ///< Largest recorded latency
+    std::vector<uint64_t> buckets;    ///< Number of recorded latencies per bucket of the LatencyHistogram
+
+    /// \brief Returns the mean of all recorded latencies
+    std::chrono::microseconds mean() const;
+
+    /// \brief Returns the upper bound of the bucket holding the given \p quantile (0.0 - 1.0) of the recorded
+    /// latencies. The result is never larger than max
+    std::chrono::microseconds percentile(double quantile) const;
+};
+
+/// \brief Lock-free histogram of latencies with microsecond resolution. Like an HDR histogram, every power of two is
+/// split into SUB_BUCKETS linear buckets, so the relative error of a bucket is at most 1 / SUB_BUCKETS while the whole
+/// range of uint64_t fits into a few hundred counters. Recording is wait-free and can be done from any thread.
+class LatencyHistogram {
+public:
+    static constexpr std::size_t SUB_BUCKET_BITS = 2;
+    static constexpr std::size_t SUB_BUCKETS = std::size_t(1) << SUB_BUCKET_BITS;
+    static constexpr std::size_t NUMBER_OF_BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    /// \brief Records the given \p latency. Negative latencies are recorded as zero
+    void record(std::chrono::microseconds latency);
+
+    /// \brief Returns a copy of the recorded values. Counters are read one by one, so a snapshot taken while values are
+    /// recorded may be off by the values recorded in the meantime
+    LatencyHistogramSnapshot get_snapshot() const;
+
+    /// \brief Returns the index of the bucket the latency of \p microseconds is recorded in
+    static std::size_t get_bucket_index(uint64_t microseconds);
+
+    /// \brief Returns the largest latency recorded in the bucket with the given \p index
+    static std::chrono::microseconds get_bucket_upper_bound(std::size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, NUMBER_OF_BUCKETS> buckets{};
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> max{0};
+};
+
+} // namespace ocpp
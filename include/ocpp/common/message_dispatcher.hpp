@@ -27,10 +27,65 @@ public:
     ///         result of type T.
     virtual std::future<ocpp::EnhancedMessage<T>> dispatch_call_async(const json& call, bool triggered = false) = 0;
 
+    /// \brief Dispatches a Call message. The message is also written into a string once with its generated write_json
+    /// function, which is sent instead of a dump of the json object.
+    /// \param call the OCPP Call message.
+    /// \param triggered indicates if the call was triggered by a TriggerMessage. Default is false.
+    template <class M> void dispatch_call(const Call<M>& call, bool triggered = false) {
+        this->dispatch_serialized_call(call, to_json_string(call), triggered);
+    }
+
+    /// \brief Dispatches a Call message asynchronously. The message is also written into a string once with its
+    /// generated write_json function, which is sent instead of a dump of the json object.
+    /// \param call the OCPP Call message.
+    /// \param triggered indicates if the call was triggered by a TriggerMessage. Default is false.
+    /// \return std::future<ocpp::EnhancedMessage<T>> Future object containing the enhanced message
+    ///         result of type T.
+    template <class M>
+    std::future<ocpp::EnhancedMessage<T>> dispatch_call_async(const Call<M>& call, bool triggered = false) {
+        return this->dispatch_serialized_call_async(call, to_json_string(call), triggered);
+    }
+
+    /// \brief Dispatches a Call message that has also been serialized.
+    /// \param call the OCPP Call message.
+    /// \param serialized_call the serialized OCPP Call message.
+    /// \param triggered indicates if the call was triggered by a TriggerMessage.
+    virtual void dispatch_serialized_call(const json& call, const std::string& serialized_call, bool triggered) {
+        (void)serialized_call;
+        this->dispatch_call(call, triggered);
+    }
+
+    /// \brief Dispatches a Call message that has also been serialized asynchronously.
+    /// \param call the OCPP Call message.
+    /// \param serialized_call the serialized OCPP Call message.
+    /// \param triggered indicates if the call was triggered by a TriggerMessage.
+    /// \return std::future<ocpp::EnhancedMessage<T>> Future object containing the enhanced message
+    ///         result of type T.
+    virtual std::future<ocpp::EnhancedMessage<T>>
+    dispatch_serialized_call_async(const json& call, const std::string& serialized_call, bool triggered) {
+        (void)serialized_call;
+        return this->dispatch_call_async(call, triggered);
+    }
+
     /// \brief Dispatches a CallResult message.
     /// \param call_result the OCPP CallResult message.
     virtual void dispatch_call_result(const json& call_result) = 0;
 
+    /// \brief Dispatches a CallResult message. The message is written directly into a string with its generated
+    /// write_json function instead of being converted to a json object first.
+    /// \param call_result the OCPP CallResult message.
+    template <class M> void dispatch_call_result(const CallResult<M>& call_result) {
+        this->dispatch_serialized_call_result(to_json_string(call_result), call_result.uniqueId);
+    }
+
+    /// \brief Dispatches a CallResult message that has already been serialized.
+    /// \param call_result the serialized OCPP CallResult message.
+    /// \param unique_id the unique id of the CallResult message.
+    virtual void dispatch_serialized_call_result(const std::string& call_result, const MessageId& unique_id) {
+        (void)unique_id;
+        this->dispatch_call_result(json::parse(call_result));
+    }
+
     /// \brief Dispatches a CallError message.
     /// \param call_result the OCPP CallError message.
     virtual void dispatch_call_error(const json& call_error) = 0;
@@ -7,6 +7,7 @@
 #include <condition_variable>
 #include <deque>
 #include <future>
+#include <map>
 #include <mutex>
 #include <queue>
 #include <set>
@@ -16,7 +17,10 @@
 
 #include <ocpp/common/call_types.hpp>
 #include <ocpp/common/database/database_handler_common.hpp>
+#include <ocpp/common/message_queue_persistence.hpp>
+#include <ocpp/common/message_queue_metrics.hpp>
 #include <ocpp/common/types.hpp>
+#include <ocpp/common/utils.hpp>
 #include <ocpp/v16/messages/StopTransaction.hpp>
 #include <ocpp/v16/types.hpp>
 #include <ocpp/v2/messages/TransactionEvent.hpp>
@@ -43,6 +47,31 @@ template <typename M> struct MessageQueueConfig {
         60; // interval for BootNotification.req in case response by CSMS is CALLERROR or CSMS does not respond at all
             // (within specified MessageTimeout)
 
+    /// \brief Maximum number of CALLs of pipelined_message_types that may await their response at the same time. The
+    /// default of 1 only sends a CALL after the previous one has been answered or has timed out
+    int max_pipelined_calls = 1;
+    /// \brief Message types that do not depend on the response to an earlier CALL and may therefore be pipelined.
+    /// Transaction related messages and BootNotification are never pipelined
+    std::set<M> pipelined_message_types;
+
+    /// \brief Weights of the priority classes. If set, the sends are shared between the classes that have a message
+    /// ready to be sent by a weighted round robin instead of sending the message with the oldest timestamp first.
+    /// Classes without a weight get a weight of 1
+    std::map<MessagePriority, int> priority_weights;
+    /// \brief Priority classes of message types. Transaction messages always belong to MessagePriority::Transaction,
+    /// all other message types that are not listed here or are mapped to MessagePriority::Transaction belong to
+    /// MessagePriority::Normal
+    std::map<M, MessagePriority> message_priorities;
+    /// \brief Maximum number of messages of a priority class in the normal message queue. If a class exceeds its
+    /// limit, its oldest messages are dropped
+    std::map<MessagePriority, int> priority_queue_limits;
+
+    /// \brief Minimum interval between the periodic transaction update messages of a transaction that are kept when
+    /// the transaction message queue is compacted, e.g. after an outage. Updates with other triggers or signed meter
+    /// values as well as the last update before another transaction message are always kept. 0 disables the
+    /// compaction
+    int transaction_update_compaction_interval_seconds = 0;
+
     /// \brief Returns true if the given \p message_type shall be queued based on the configuration of
     /// queue_all_messages and message_types_discard_for_queueing
     bool check_queue(const M& message_type) {
@@ -70,6 +99,9 @@ template <typename M> struct ControlMessage {
     DateTime timestamp;                       ///< A timestamp that shows when this message can be sent
     MessageId initial_unique_id;
     bool stall_until_accepted; // if true, message shall be sent only if registration status is accepted
+    /// \brief The message written with write_json when it was pushed, empty if the message has been changed since and
+    /// has to be serialized again
+    std::string serialized_message;
 
     /// \brief Creates a new ControlMessage object from the provided \p message
     explicit ControlMessage(const json& message, const bool stall_until_accepted = false);
@@ -82,6 +114,13 @@ template <typename M> struct ControlMessage {
 
     /// \brief True for transactional messages containing updates (measurements) for a transaction
     bool is_transaction_update_message() const;
+
+    /// \brief True for transaction update messages that only contain periodically sampled measurements without signed
+    /// meter values, so they may be thinned out when the transaction message queue is compacted
+    bool is_periodic_transaction_update_message() const;
+
+    /// \brief Identifies the transaction of a transaction update message
+    std::string get_transaction_key() const;
 };
 
 /// \brief Indicates the transmission priority of a message that is being pushed to the message queue
@@ -108,6 +147,21 @@ inline MessageTransmissionPriority get_message_transmission_priority(bool is_boo
     return MessageTransmissionPriority::Discard;
 };
 
+/// \brief Parses a comma separated list of \<MessagePriority\>:\<value\> pairs like
+/// "High:8,Normal:4,Transaction:2,Low:1", e.g. to configure the priority weights or queue limits of a MessageQueue
+/// \throws StringToEnumException or std::invalid_argument if the list is malformed
+inline std::map<MessagePriority, int> parse_message_priority_values(const std::string& csl) {
+    std::map<MessagePriority, int> values;
+    for (const auto& entry : split_string(csl, ',', true)) {
+        const auto priority_and_value = split_string(entry, ':', true);
+        if (priority_and_value.size() != 2) {
+            throw std::invalid_argument("Expected <MessagePriority>:<value> but got: " + entry);
+        }
+        values[conversions::string_to_message_priority(priority_and_value.at(0))] = std::stoi(priority_and_value.at(1));
+    }
+    return values;
+}
+
 /// \brief Indicates if the given \p message_type is a transaction message type
 /// \param message_type
 /// \return true if MessageType is StartTransaction, StopTransaction, MeterValue or SecurityEventNotification
@@ -163,8 +217,10 @@ bool allowed_to_send_message(const ControlMessage<M>& message, const DateTime& t
 /// \brief contains a message queue that makes sure that OCPPs synchronicity requirements are met
 template <typename M> class MessageQueue {
 private:
+    using MessageIterator = typename std::deque<std::shared_ptr<ControlMessage<M>>>::iterator;
+
     MessageQueueConfig<M> config;
-    std::shared_ptr<ocpp::common::DatabaseHandlerCommon> database_handler;
+    std::shared_ptr<ocpp::common::MessageQueuePersistenceInterface> persistence;
 
     std::thread worker_thread;
     /// message deque for transaction related messages
@@ -175,6 +231,7 @@ private:
     std::recursive_mutex message_mutex;
     std::condition_variable_any cv;
     std::function<bool(json message)> send_callback;
+    std::function<bool(const std::string& message)> serialized_send_callback;
     std::vector<M> external_notify;
     bool paused;
     // Transiently true while the queue is paused, but is waiting to unpause
@@ -209,6 +266,40 @@ private:
     std::function<void(const std::string& new_message_id, const std::string& old_message_id)>
         start_transaction_message_retry_callback;
 
+    // A CALL sent while other CALLs may still await their response
+    struct PipelinedCall {
+        std::shared_ptr<ControlMessage<M>> message;
+        std::chrono::steady_clock::time_point sent_at;
+        std::chrono::steady_clock::time_point deadline;
+    };
+    // Pipelined CALLs awaiting their response. While a pipelined CALL is outstanding, in_flight is only set for the
+    // duration of handling a response or timeout, so messages that are not pipelined keep waiting for all responses
+    std::map<MessageId, PipelinedCall> pipelined_calls;
+    Everest::SteadyTimer pipelined_calls_timeout_timer;
+
+    // Credits of the priority classes in the weighted round robin. Only classes that had a message ready to be sent
+    // when the last message was selected keep their credit
+    std::map<MessagePriority, int> priority_credits;
+
+    MessageQueueMetrics metrics;
+    // point in time the message in flight has been handed to the send_callback, used for the in flight time metric
+    std::chrono::steady_clock::time_point in_flight_sent_at;
+    Everest::SteadyTimer metrics_timer;
+
+    MessageTypeMetrics& get_message_type_metrics(const M& message_type) {
+        return this->metrics.get(this->messagetype_to_string(message_type));
+    }
+
+    void update_queue_size_metrics() {
+        this->metrics.set_queue_sizes(this->normal_message_queue.size(), this->transaction_message_queue.size());
+    }
+
+    void record_in_flight_time() {
+        this->get_message_type_metrics(this->in_flight->messageType)
+            .in_flight_time.record(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - this->in_flight_sent_at));
+    }
+
     MessageId getMessageId(const json::array_t& json_message) {
         return MessageId(json_message.at(MESSAGE_ID).get<std::string>());
     }
@@ -250,12 +341,13 @@ private:
                     message->message, messagetype_to_string(message->messageType), message->message_attempts,
                     message->timestamp, message->uniqueId()};
                 try {
-                    this->database_handler->insert_message_queue_message(db_message, QueueType::Normal);
+                    this->persistence->insert_message_queue_message(db_message, QueueType::Normal);
                 } catch (const QueryExecutionException& e) {
                     EVLOG_warning << "Could not insert message into transaction queue: " << e.what();
                 }
             }
             this->new_message = true;
+            this->check_priority_queue_limit(this->get_message_priority(*message));
             this->check_queue_sizes();
         }
         this->cv.notify_all();
@@ -270,7 +362,7 @@ private:
                                                           message->message_attempts, message->timestamp,
                                                           message->uniqueId()};
             try {
-                this->database_handler->insert_message_queue_message(db_message);
+                this->persistence->insert_message_queue_message(db_message);
             } catch (const QueryExecutionException& e) {
                 EVLOG_warning << "Could not insert message into transaction queue: " << e.what();
             }
@@ -282,6 +374,7 @@ private:
     }
 
     void check_queue_sizes() {
+        this->update_queue_size_metrics();
         if (this->transaction_message_queue.size() + this->normal_message_queue.size() <=
             this->config.queues_total_size_threshold) {
             return;
@@ -290,6 +383,8 @@ private:
                       << this->transaction_message_queue.size() << " transaction and "
                       << this->normal_message_queue.size() << " normal messages in queue";
 
+        this->compact_transaction_message_queue();
+
         while (this->transaction_message_queue.size() + this->normal_message_queue.size() >
                    this->config.queues_total_size_threshold &&
                !this->normal_message_queue.empty()) {
@@ -300,6 +395,7 @@ private:
                    this->config.queues_total_size_threshold &&
                this->drop_update_messages_from_transactional_message_queue()) {
         }
+        this->update_queue_size_metrics();
     }
 
     void drop_messages_from_normal_message_queue() {
@@ -308,11 +404,12 @@ private:
                                                   std::max(this->config.queues_total_size_threshold / 10, 1));
 
         EVLOG_warning << "Dropping " << number_of_dropped_messages << " messages from normal message queue.";
+        this->metrics.add_dropped_messages(QueueType::Normal, number_of_dropped_messages);
 
         for (int i = 0; i < number_of_dropped_messages; i++) {
             if (this->config.queue_all_messages) {
                 try {
-                    database_handler->remove_message_queue_message(
+                    persistence->remove_message_queue_message(
                         this->normal_message_queue.front()->initial_unique_id, QueueType::Normal);
                 } catch (const QueryExecutionException& e) {
                     EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
@@ -320,10 +417,185 @@ private:
                     EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
                 }
             }
+            this->get_message_type_metrics(this->normal_message_queue.front()->messageType).dropped++;
             this->normal_message_queue.pop_front();
         }
     }
 
+    /// \brief Returns the priority class of the given \p message
+    MessagePriority get_message_priority(const ControlMessage<M>& message) {
+        if (is_transaction_message(message)) {
+            return MessagePriority::Transaction;
+        }
+        const auto it = this->config.message_priorities.find(message.messageType);
+        if (it == this->config.message_priorities.end() or it->second == MessagePriority::Transaction) {
+            return MessagePriority::Normal;
+        }
+        return it->second;
+    }
+
+    /// \brief Drops the oldest messages of the given \p priority class from the normal message queue while the class
+    /// exceeds its configured limit. BootNotifications are never dropped
+    void check_priority_queue_limit(MessagePriority priority) {
+        const auto limit = this->config.priority_queue_limits.find(priority);
+        if (limit == this->config.priority_queue_limits.end()) {
+            return;
+        }
+        auto is_droppable = [this, priority](const std::shared_ptr<ControlMessage<M>>& message) {
+            return !is_boot_notification_message(message->messageType) and
+                   this->get_message_priority(*message) == priority;
+        };
+        const int number_of_messages =
+            std::count_if(this->normal_message_queue.begin(), this->normal_message_queue.end(), is_droppable);
+        if (number_of_messages <= limit->second) {
+            return;
+        }
+
+        int number_of_dropped_messages = number_of_messages - std::max(limit->second, 0);
+        EVLOG_warning << "Dropping " << number_of_dropped_messages << " messages of priority " << priority
+                      << " from normal message queue.";
+        this->metrics.add_dropped_messages(QueueType::Normal, number_of_dropped_messages);
+
+        for (auto it = this->normal_message_queue.begin();
+             it != this->normal_message_queue.end() and number_of_dropped_messages > 0;) {
+            if (!is_droppable(*it)) {
+                ++it;
+                continue;
+            }
+            if (this->config.queue_all_messages) {
+                try {
+                    persistence->remove_message_queue_message((*it)->initial_unique_id, QueueType::Normal);
+                } catch (const QueryExecutionException& e) {
+                    EVLOG_warning << "Could not delete message from normal message queue: " << e.what();
+                } catch (const std::exception& e) {
+                    EVLOG_warning << "Could not delete message from normal message queue: " << e.what();
+                }
+            }
+            this->get_message_type_metrics((*it)->messageType).dropped++;
+            it = this->normal_message_queue.erase(it);
+            number_of_dropped_messages--;
+        }
+    }
+
+    /// \brief Selects the next message to send by a smooth weighted round robin over the priority classes. Only the
+    /// first message of a class that is allowed to be sent is a candidate, so the messages of a class keep their order.
+    /// Must be called with the message_mutex held
+    /// \param now the time used to check if a message is allowed to be sent
+    /// \param credits is set to the credits of the priority classes that apply once the selected message is sent
+    /// \returns the queue type and position of the selected message or std::nullopt if no message can be sent
+    std::optional<std::pair<QueueType, MessageIterator>>
+    select_message_by_priority(const DateTime& now, std::map<MessagePriority, int>& credits) {
+        std::map<MessagePriority, std::pair<QueueType, MessageIterator>> candidates;
+        for (auto it = this->normal_message_queue.begin(); it != this->normal_message_queue.end(); ++it) {
+            if (!allowed_to_send_message(**it, now, this->is_registration_status_accepted)) {
+                continue;
+            }
+            // a BootNotification is always prioritized
+            if (candidates.empty() and is_boot_notification_message((*it)->messageType)) {
+                credits = this->priority_credits;
+                return std::make_pair(QueueType::Normal, it);
+            }
+            candidates.emplace(this->get_message_priority(**it), std::make_pair(QueueType::Normal, it));
+        }
+        // Transaction messages must persist the order, so only check the first in the queue
+        if (!this->transaction_message_queue.empty() and
+            allowed_to_send_message(*this->transaction_message_queue.front(), now,
+                                    this->is_registration_status_accepted)) {
+            candidates.emplace(MessagePriority::Transaction,
+                               std::make_pair(QueueType::Transaction, this->transaction_message_queue.begin()));
+        }
+        if (candidates.empty()) {
+            return std::nullopt;
+        }
+
+        credits.clear();
+        int total_weight = 0;
+        std::optional<MessagePriority> selected_priority;
+        // candidates are ordered from the highest to the lowest priority, so ties are won by the higher priority
+        for (const auto& [priority, candidate] : candidates) {
+            const auto weight = this->config.priority_weights.find(priority);
+            const auto priority_weight =
+                weight != this->config.priority_weights.end() ? std::max(weight->second, 1) : 1;
+            const auto credit = this->priority_credits.find(priority);
+            credits[priority] = (credit != this->priority_credits.end() ? credit->second : 0) + priority_weight;
+            total_weight += priority_weight;
+            if (!selected_priority.has_value() or credits[priority] > credits[selected_priority.value()]) {
+                selected_priority = priority;
+            }
+        }
+        credits[selected_priority.value()] -= total_weight;
+        return candidates.at(selected_priority.value());
+    }
+
+    /// \brief Thins out the periodic transaction update messages of every transaction in the transaction message
+    /// queue and the database, so that consecutive kept updates of a transaction are at least
+    /// transaction_update_compaction_interval_seconds apart. Consecutive means not separated by another transaction
+    /// message, the first and the last update of such a run are always kept. Must be called with the message_mutex held
+    void compact_transaction_message_queue() {
+        if (this->config.transaction_update_compaction_interval_seconds <= 0) {
+            return;
+        }
+        const auto interval = std::chrono::seconds(this->config.transaction_update_compaction_interval_seconds);
+
+        std::vector<bool> drop(this->transaction_message_queue.size(), false);
+        // per transaction of the current run: time of the last kept update and index of the last update
+        std::map<std::string, DateTime> last_kept_timestamps;
+        std::map<std::string, std::size_t> last_update_indices;
+        const auto end_run = [&]() {
+            for (const auto& [transaction_key, index] : last_update_indices) {
+                drop.at(index) = false;
+            }
+            last_kept_timestamps.clear();
+            last_update_indices.clear();
+        };
+
+        for (std::size_t i = 0; i < this->transaction_message_queue.size(); i++) {
+            const auto& message = *this->transaction_message_queue.at(i);
+            if (!message.is_transaction_update_message()) {
+                end_run();
+                continue;
+            }
+            const auto transaction_key = message.get_transaction_key();
+            last_update_indices[transaction_key] = i;
+            const auto last_kept = last_kept_timestamps.find(transaction_key);
+            if (last_kept != last_kept_timestamps.end() and message.is_periodic_transaction_update_message() and
+                message.timestamp.to_time_point() - last_kept->second.to_time_point() < interval) {
+                drop.at(i) = true;
+            } else {
+                last_kept_timestamps.insert_or_assign(transaction_key, message.timestamp);
+            }
+        }
+        end_run();
+
+        const auto number_of_dropped_messages = std::count(drop.begin(), drop.end(), true);
+        if (number_of_dropped_messages == 0) {
+            return;
+        }
+
+        std::deque<std::shared_ptr<ControlMessage<M>>> compacted_queue;
+        for (std::size_t i = 0; i < this->transaction_message_queue.size(); i++) {
+            auto& message = this->transaction_message_queue.at(i);
+            if (!drop.at(i)) {
+                compacted_queue.push_back(message);
+                continue;
+            }
+            try {
+                this->persistence->remove_message_queue_message(message->initial_unique_id);
+            } catch (const QueryExecutionException& e) {
+                EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
+            } catch (const std::exception& e) {
+                EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
+            }
+            this->get_message_type_metrics(message->messageType).dropped++;
+        }
+        std::swap(this->transaction_message_queue, compacted_queue);
+
+        this->metrics.add_dropped_messages(QueueType::Transaction, number_of_dropped_messages);
+        this->update_queue_size_metrics();
+        EVLOG_info << "Compacted transaction message queue by " << number_of_dropped_messages
+                   << " periodic transaction update messages";
+    }
+
     /**
      *  Heuristically drops every second update messag.
      *  Drops every first, third, ... update message in between two non-update message; disregards transaction
@@ -342,12 +614,13 @@ private:
                 transaction_message_queue.size() > 1) {
                 EVLOG_debug << "Drop transactional message " << element->initial_unique_id;
                 try {
-                    database_handler->remove_message_queue_message(element->initial_unique_id);
+                    persistence->remove_message_queue_message(element->initial_unique_id);
                 } catch (const QueryExecutionException& e) {
                     EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
                 } catch (const std::exception& e) {
                     EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
                 }
+                this->get_message_type_metrics(element->messageType).dropped++;
                 drop_count++;
                 remove_next_update_message = false;
             } else {
@@ -359,6 +632,7 @@ private:
         std::swap(transaction_message_queue, temporary_swap_queue);
 
         if (drop_count > 0) {
+            this->metrics.add_dropped_messages(QueueType::Transaction, drop_count);
             EVLOG_warning << "Dropped " << drop_count << " transactional update messages to reduce queue size.";
             return true;
         } else {
@@ -371,6 +645,8 @@ private:
     void resume_now(u_int64_t expected_pause_resume_ctr) {
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
         if (this->pause_resume_ctr == expected_pause_resume_ctr) {
+            // thin out the backlog of transaction updates that built up while offline before replaying it
+            this->compact_transaction_message_queue();
             this->paused = false;
             this->resuming = false;
             this->cv.notify_one();
@@ -378,6 +654,124 @@ private:
         }
     }
 
+    /// \brief Adds the \p control_message of a pushed CALL to the transaction or normal message queue
+    void push_control_message(std::shared_ptr<ControlMessage<M>> control_message) {
+        if (!running) {
+            return;
+        }
+
+        if (is_transaction_message(*control_message)) {
+            // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
+            // MeterValues have to be delivered in chronological order
+
+            // intentionally break this message for testing...
+            // message->message[CALL_PAYLOAD]["broken"] = ocpp::create_message_id();
+            this->add_to_transaction_message_queue(control_message);
+        } else {
+            // all other messages are allowed to "jump the queue" to improve user experience
+            // TODO: decide if we only want to allow this for a subset of messages
+            if (!this->paused || this->resuming || this->config.check_queue(control_message->messageType) ||
+                control_message->messageType == M::BootNotification) {
+                this->add_to_normal_message_queue(control_message);
+            }
+        }
+        this->cv.notify_all();
+    }
+
+    /// \brief Adds the \p message of a CALL pushed with the async interface to the transaction or normal message queue
+    std::future<EnhancedMessage<M>> push_control_message_async(std::shared_ptr<ControlMessage<M>> message) {
+        if (!running) {
+            auto enhanced_message = EnhancedMessage<M>();
+            enhanced_message.offline = true;
+            message->promise.set_value(enhanced_message);
+        } else if (is_transaction_message(message->messageType)) {
+            // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
+            // MeterValues have to be delivered in chronological order
+            this->add_to_transaction_message_queue(message);
+        } else {
+            // all other messages are allowed to "jump the queue" to improve user experience
+            // TODO: decide if we only want to allow this for a subset of messages
+            if (this->paused && !this->config.check_queue(message->messageType) && !this->resuming &&
+                message->messageType != M::BootNotification) {
+                // do not add a normal message to the queue if the queue is paused/offline
+                auto enhanced_message = EnhancedMessage<M>();
+                enhanced_message.offline = true;
+                message->promise.set_value(enhanced_message);
+            } else {
+                this->add_to_normal_message_queue(message);
+            }
+        }
+        return message->promise.get_future();
+    }
+
+    /// \brief Sends the in_flight message, the message serialized when it was pushed is preferred over a dump of the
+    /// json message
+    bool send_in_flight_message() {
+        if (!this->in_flight->serialized_message.empty() and this->serialized_send_callback != nullptr) {
+            return this->serialized_send_callback(this->in_flight->serialized_message);
+        }
+        return this->send_callback(this->in_flight->message);
+    }
+
+    /// \brief Returns true if the given \p message may be sent while other CALLs await their response
+    bool is_pipelined(const ControlMessage<M>& message) {
+        return this->config.max_pipelined_calls > 1 and !is_transaction_message(message) and
+               !is_boot_notification_message(message.messageType) and
+               this->config.pipelined_message_types.count(message.messageType);
+    }
+
+    /// \brief Returns true if no ordered CALL is in flight and the pipelining window is not full
+    bool can_send_next_message() {
+        return this->in_flight == nullptr and
+               this->pipelined_calls.size() < static_cast<std::size_t>(std::max(this->config.max_pipelined_calls, 1));
+    }
+
+    /// \brief Moves the pipelined CALL with the given \p unique_id to in_flight, so it can be handled like a CALL that
+    /// has not been pipelined. Must be called with the message_mutex held and in_flight not set
+    /// \returns false if there is no such pipelined CALL
+    bool take_pipelined_call(const MessageId& unique_id) {
+        auto it = this->pipelined_calls.find(unique_id);
+        if (it == this->pipelined_calls.end()) {
+            return false;
+        }
+        this->in_flight = it->second.message;
+        this->in_flight_sent_at = it->second.sent_at;
+        this->pipelined_calls.erase(it);
+        // the window has room for the next message again
+        this->new_message = true;
+        this->schedule_pipelined_calls_timeout();
+        return true;
+    }
+
+    void schedule_pipelined_calls_timeout() {
+        if (this->pipelined_calls.empty()) {
+            this->pipelined_calls_timeout_timer.stop();
+            return;
+        }
+        const auto next = std::min_element(
+            this->pipelined_calls.begin(), this->pipelined_calls.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.second.deadline < rhs.second.deadline; });
+        this->pipelined_calls_timeout_timer.at([this]() { this->handle_pipelined_calls_timeout(); },
+                                               next->second.deadline);
+    }
+
+    void handle_pipelined_calls_timeout() {
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<MessageId> timed_out;
+        for (const auto& [unique_id, pipelined_call] : this->pipelined_calls) {
+            if (pipelined_call.deadline <= now) {
+                timed_out.push_back(unique_id);
+            }
+        }
+        for (const auto& unique_id : timed_out) {
+            if (this->in_flight == nullptr and this->take_pipelined_call(unique_id)) {
+                this->handle_timeout_or_callerror(std::nullopt);
+            }
+        }
+        this->schedule_pipelined_calls_timeout();
+    }
+
     // Computes the current message timeout = interval * attempt + message timeout
     std::chrono::seconds current_message_timeout(unsigned int attempt) {
         return std::chrono::seconds(this->config.message_timeout_seconds +
@@ -388,11 +782,11 @@ public:
     /// \brief Creates a new MessageQueue object with the provided \p configuration and \p send_callback
     MessageQueue(
         const std::function<bool(json message)>& send_callback, const MessageQueueConfig<M>& config,
-        const std::vector<M>& external_notify, std::shared_ptr<common::DatabaseHandlerCommon> database_handler,
+        const std::vector<M>& external_notify, std::shared_ptr<common::MessageQueuePersistenceInterface> persistence,
         const std::function<void(const std::string& new_message_id, const std::string& old_message_id)>
             start_transaction_message_retry_callback =
                 [](const std::string& new_message_id, const std::string& old_message_id) {}) :
-        database_handler(std::move(database_handler)),
+        persistence(std::move(persistence)),
         config(config),
         external_notify(external_notify),
         paused(true),
@@ -407,8 +801,8 @@ public:
     }
 
     MessageQueue(const std::function<bool(json message)>& send_callback, const MessageQueueConfig<M>& config,
-                 std::shared_ptr<common::DatabaseHandlerCommon> databaseHandler) :
-        MessageQueue(send_callback, config, {}, databaseHandler) {
+                 std::shared_ptr<common::MessageQueuePersistenceInterface> persistence) :
+        MessageQueue(send_callback, config, {}, persistence) {
     }
 
     void start() {
@@ -421,7 +815,7 @@ public:
                 using namespace std::chrono_literals;
                 // It's safe to wait on the cv here because we're guaranteed to only lock this->message_mutex once
                 this->cv.wait(lk, [this]() {
-                    return !this->running || (!this->paused && this->new_message && this->in_flight == nullptr);
+                    return !this->running || (!this->paused && this->new_message && this->can_send_next_message());
                 });
                 if (this->transaction_message_queue.empty() && this->normal_message_queue.empty()) {
                     // There is nothing in the message queue, not progressing further
@@ -437,59 +831,76 @@ public:
                     continue;
                 }
 
-                if (this->in_flight != nullptr) {
-                    // There already is a message in flight, not progressing further
+                if (!this->can_send_next_message()) {
+                    // There already is a message in flight or the pipelining window is full, not progressing further
                     continue;
                 } else {
                     EVLOG_debug << "There is no message in flight, checking message queue for a new message.";
                 }
 
-                // prioritize the message with the oldest timestamp
+                // prioritize the message with the oldest timestamp, or share the sends between the priority classes
+                // if priority weights are configured
                 std::shared_ptr<ControlMessage<M>> message = nullptr;
                 QueueType queue_type = QueueType::None;
                 const auto now = DateTime();
-
-                // Find the first allowed normal message
-                auto selected_normal_message_it =
-                    std::find_if(normal_message_queue.begin(), normal_message_queue.end(),
-                                 [&](const std::shared_ptr<ControlMessage<M>>& msg) {
-                                     return allowed_to_send_message(*msg, now, this->is_registration_status_accepted);
-                                 });
-
-                if (selected_normal_message_it != normal_message_queue.end()) {
-                    message = *selected_normal_message_it;
-                    queue_type = QueueType::Normal;
-                }
-
-                auto is_transaction_message_available = [&](const std::shared_ptr<ControlMessage<M>>& msg) {
-                    if (!allowed_to_send_message(*msg, now, this->is_registration_status_accepted)) {
-                        return false;
+                auto selected_normal_message_it = normal_message_queue.end();
+                auto selected_transaction_message_it = transaction_message_queue.end();
+                std::map<MessagePriority, int> priority_credits;
+
+                if (!this->config.priority_weights.empty()) {
+                    const auto selected = this->select_message_by_priority(now, priority_credits);
+                    if (selected.has_value()) {
+                        queue_type = selected->first;
+                        message = *selected->second;
+                        if (queue_type == QueueType::Normal) {
+                            selected_normal_message_it = selected->second;
+                        } else {
+                            selected_transaction_message_it = selected->second;
+                        }
                     }
-                    // no message selected from normal message queue, so select transaction message
-                    if (message == nullptr) {
-                        return true;
+                } else {
+                    // Find the first allowed normal message
+                    selected_normal_message_it = std::find_if(
+                        normal_message_queue.begin(), normal_message_queue.end(),
+                        [&](const std::shared_ptr<ControlMessage<M>>& msg) {
+                            return allowed_to_send_message(*msg, now, this->is_registration_status_accepted);
+                        });
+
+                    if (selected_normal_message_it != normal_message_queue.end()) {
+                        message = *selected_normal_message_it;
+                        queue_type = QueueType::Normal;
                     }
-                    // message from normal message queue is BootNotification, this is prioritized
-                    if (message->messageType == M::BootNotification) {
+
+                    auto is_transaction_message_available = [&](const std::shared_ptr<ControlMessage<M>>& msg) {
+                        if (!allowed_to_send_message(*msg, now, this->is_registration_status_accepted)) {
+                            return false;
+                        }
+                        // no message selected from normal message queue, so select transaction message
+                        if (message == nullptr) {
+                            return true;
+                        }
+                        // message from normal message queue is BootNotification, this is prioritized
+                        if (message->messageType == M::BootNotification) {
+                            return false;
+                        }
+                        // transaction messages is older than normal message, so select transaction message
+                        if (msg->timestamp <= message->timestamp) {
+                            return true;
+                        }
                         return false;
+                    };
+
+                    // Transaction messages must persist the order, so only check the first in the queue
+                    selected_transaction_message_it =
+                        (!transaction_message_queue.empty() and
+                         is_transaction_message_available(transaction_message_queue.front()))
+                            ? transaction_message_queue.begin()
+                            : transaction_message_queue.end();
+
+                    if (selected_transaction_message_it != transaction_message_queue.end()) {
+                        message = *selected_transaction_message_it;
+                        queue_type = QueueType::Transaction;
                     }
-                    // transaction messages is older than normal message, so select transaction message
-                    if (msg->timestamp <= message->timestamp) {
-                        return true;
-                    }
-                    return false;
-                };
-
-                // Transaction messages must persist the order, so only check the first in the queue
-                auto selected_transaction_message_it =
-                    (!transaction_message_queue.empty() and
-                     is_transaction_message_available(transaction_message_queue.front()))
-                        ? transaction_message_queue.begin()
-                        : transaction_message_queue.end();
-
-                if (selected_transaction_message_it != transaction_message_queue.end()) {
-                    message = *selected_transaction_message_it;
-                    queue_type = QueueType::Transaction;
                 }
 
                 if (message == nullptr) {
@@ -510,8 +921,21 @@ public:
                     }
                 }
 
+                const bool pipelined = this->is_pipelined(*message);
+                if (!pipelined and !this->pipelined_calls.empty()) {
+                    // messages that are not pipelined keep their order, they wait until all pipelined CALLs have been
+                    // answered. take_pipelined_call sets new_message again
+                    EVLOG_debug << "Message with id " << message->uniqueId() << " waits for "
+                                << this->pipelined_calls.size() << " pipelined messages";
+                    this->new_message = false;
+                    continue;
+                }
+
                 EVLOG_debug << "Attempting to send message to central system. UID: " << message->uniqueId()
                             << " attempt#: " << message->message_attempts;
+                if (!this->config.priority_weights.empty()) {
+                    this->priority_credits = priority_credits;
+                }
                 this->in_flight = message;
                 this->in_flight->message_attempts += 1;
 
@@ -520,9 +944,12 @@ public:
                     this->in_flight->message.at(3)["transactionId"] =
                         this->message_id_transaction_id_map.at(this->in_flight->message.at(1));
                     this->message_id_transaction_id_map.erase(this->in_flight->message.at(1));
+                    this->in_flight->serialized_message.clear();
                 }
 
-                if (!this->send_callback(this->in_flight->message)) {
+                this->in_flight_sent_at = std::chrono::steady_clock::now();
+                if (!this->send_in_flight_message()) {
+                    this->get_message_type_metrics(this->in_flight->messageType).send_failures++;
                     this->paused = true;
                     EVLOG_error << "Could not send message, this is most likely because the charge point is offline.";
                     if (this->in_flight && is_transaction_message(*this->in_flight)) {
@@ -530,6 +957,7 @@ public:
                                       "connection can be established again.";
                         if (this->in_flight->message.at(CALL_ACTION) == "TransactionEvent") {
                             this->in_flight->message.at(CALL_PAYLOAD)["offline"] = true;
+                            this->in_flight->serialized_message.clear();
                         }
                     } else if (this->config.check_queue(this->in_flight->messageType)) {
                         EVLOG_info << "The message in flight  will be sent again once the connection can be "
@@ -540,14 +968,24 @@ public:
                             EnhancedMessage<M> enhanced_message;
                             enhanced_message.offline = true;
                             this->in_flight->promise.set_value(enhanced_message);
-                            this->normal_message_queue.pop_front();
+                            this->normal_message_queue.erase(selected_normal_message_it);
                         }
                     }
                     this->reset_in_flight();
                 } else {
                     EVLOG_debug << "Successfully sent message. UID: " << this->in_flight->uniqueId();
-                    this->in_flight_timeout_timer.timeout([this]() { this->handle_timeout_or_callerror(std::nullopt); },
-                                                          this->current_message_timeout(message->message_attempts));
+                    this->get_message_type_metrics(this->in_flight->messageType).sent++;
+                    if (pipelined) {
+                        const auto deadline =
+                            std::chrono::steady_clock::now() + this->current_message_timeout(message->message_attempts);
+                        this->pipelined_calls[message->uniqueId()] = {message, this->in_flight_sent_at, deadline};
+                        this->in_flight = nullptr;
+                        this->schedule_pipelined_calls_timeout();
+                    } else {
+                        this->in_flight_timeout_timer.timeout(
+                            [this]() { this->handle_timeout_or_callerror(std::nullopt); },
+                            this->current_message_timeout(message->message_attempts));
+                    }
                     switch (queue_type) {
                     case QueueType::Normal:
                         this->normal_message_queue.erase(selected_normal_message_it);
@@ -559,6 +997,7 @@ public:
                         // do nothing
                         break;
                     }
+                    this->update_queue_size_metrics();
                 }
                 if (this->transaction_message_queue.empty() && this->normal_message_queue.empty()) {
                     this->new_message = false;
@@ -581,7 +1020,7 @@ public:
         std::vector<QueueType> queue_types = {QueueType::Normal, QueueType::Transaction};
         // do for Normal and Transaction queue
         for (const auto queue_type : queue_types) {
-            const auto persisted_messages = database_handler->get_message_queue_messages(queue_type);
+            const auto persisted_messages = persistence->get_message_queue_messages(queue_type);
             if (!persisted_messages.empty()) {
                 for (auto& persisted_message : persisted_messages) {
 
@@ -589,8 +1028,7 @@ public:
                         persisted_message.message_type == "SecurityEventNotification") {
                         try {
                             // remove from database in case SecurityEventNotification.req should not be sent
-                            this->database_handler->remove_message_queue_message(persisted_message.unique_id,
-                                                                                 queue_type);
+                            this->persistence->remove_message_queue_message(persisted_message.unique_id, queue_type);
                         } catch (const QueryExecutionException& e) {
                             EVLOG_warning << "Could not delete message from message queue: " << e.what();
                         } catch (const std::exception& e) {
@@ -617,44 +1055,57 @@ public:
         if (!this->config.queue_all_messages) {
             // make sure to clear normal message queue table in case queue_all_messages is false, since without clearing
             // it here messages would not be removed in handle_call_result or handle_call_timeout_or_error
-            this->database_handler->clear_message_queue(QueueType::Normal);
+            this->persistence->clear_message_queue(QueueType::Normal);
         }
     }
 
     void push_call(const json& message, const bool stall_until_accepted = false) {
+        this->push_control_message(std::make_shared<ControlMessage<M>>(message, stall_until_accepted));
+    }
+
+    /// \brief Pushes a new \p call message that has already been serialized to \p serialized_call onto the message
+    /// queue. The serialized message is sent as long as the queue does not change the message, e.g. by assigning a new
+    /// message id for a retry. Without a serialized send callback the json message is sent
+    void push_serialized_call(const json& call, const std::string& serialized_call,
+                              const bool stall_until_accepted = false) {
+        auto control_message = std::make_shared<ControlMessage<M>>(call, stall_until_accepted);
+        control_message->serialized_message = serialized_call;
+        this->push_control_message(control_message);
+    }
+
+    /// \brief Sends a new \p call_result message over the websocket
+    void push_call_result(const json& call_result) {
         if (!running) {
             return;
         }
-
-        auto control_message = std::make_shared<ControlMessage<M>>(message, stall_until_accepted);
-        if (is_transaction_message(*control_message)) {
-            // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
-            // MeterValues have to be delivered in chronological order
-
-            // intentionally break this message for testing...
-            // message->message[CALL_PAYLOAD]["broken"] = ocpp::create_message_id();
-            this->add_to_transaction_message_queue(control_message);
-        } else {
-            // all other messages are allowed to "jump the queue" to improve user experience
-            // TODO: decide if we only want to allow this for a subset of messages
-            if (!this->paused || this->resuming || this->config.check_queue(control_message->messageType) ||
-                control_message->messageType == M::BootNotification) {
-                this->add_to_normal_message_queue(control_message);
+        this->send_callback(call_result);
+        {
+            std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
+            if (next_message_to_send.has_value()) {
+                if (next_message_to_send.value() == call_result.at(MESSAGE_ID)) {
+                    next_message_to_send.reset();
+                }
             }
         }
+
         this->cv.notify_all();
     }
 
-    /// \brief Sends a new \p call_result message over the websocket
-    void push_call_result(const json& call_result) {
+    /// \brief Sends a new \p call_result message with the given \p unique_id that has already been serialized over the
+    /// websocket. Without a serialized send callback the message is parsed and handed to the send callback
+    void push_serialized_call_result(const std::string& call_result, const MessageId& unique_id) {
         if (!running) {
             return;
         }
-        this->send_callback(call_result);
+        if (this->serialized_send_callback != nullptr) {
+            this->serialized_send_callback(call_result);
+        } else {
+            this->send_callback(json::parse(call_result));
+        }
         {
             std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
             if (next_message_to_send.has_value()) {
-                if (next_message_to_send.value() == call_result.at(MESSAGE_ID)) {
+                if (next_message_to_send.value() == unique_id) {
                     next_message_to_send.reset();
                 }
             }
@@ -685,30 +1136,16 @@ public:
     /// \brief pushes a new \p call message onto the message queue
     /// \returns a future from which the CallResult can be extracted
     std::future<EnhancedMessage<M>> push_call_async(const json& call) {
-        auto message = std::make_shared<ControlMessage<M>>(call);
+        return this->push_control_message_async(std::make_shared<ControlMessage<M>>(call));
+    }
 
-        if (!running) {
-            auto enhanced_message = EnhancedMessage<M>();
-            enhanced_message.offline = true;
-            message->promise.set_value(enhanced_message);
-        } else if (is_transaction_message(message->messageType)) {
-            // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
-            // MeterValues have to be delivered in chronological order
-            this->add_to_transaction_message_queue(message);
-        } else {
-            // all other messages are allowed to "jump the queue" to improve user experience
-            // TODO: decide if we only want to allow this for a subset of messages
-            if (this->paused && !this->config.check_queue(message->messageType) && !this->resuming &&
-                message->messageType != M::BootNotification) {
-                // do not add a normal message to the queue if the queue is paused/offline
-                auto enhanced_message = EnhancedMessage<M>();
-                enhanced_message.offline = true;
-                message->promise.set_value(enhanced_message);
-            } else {
-                this->add_to_normal_message_queue(message);
-            }
-        }
-        return message->promise.get_future();
+    /// \brief pushes a new \p call message that has already been serialized to \p serialized_call onto the message
+    /// queue, see push_serialized_call
+    /// \returns a future from which the CallResult can be extracted
+    std::future<EnhancedMessage<M>> push_serialized_call_async(const json& call, const std::string& serialized_call) {
+        auto message = std::make_shared<ControlMessage<M>>(call);
+        message->serialized_message = serialized_call;
+        return this->push_control_message_async(message);
     }
 
     /// \brief Enhances a received \p json_message with additional meta information, checks if it is a valid CallResult
@@ -744,6 +1181,17 @@ public:
 
             // TODO(kai): we need to do some error handling in the CallError case
             std::unique_lock<std::recursive_mutex> lk(this->message_mutex);
+            if (this->in_flight == nullptr and this->take_pipelined_call(enhanced_message.uniqueId)) {
+                // the lock is kept while handling the response, so no other pipelined CALL is moved to in_flight
+                if (enhanced_message.messageTypeId == MessageTypeId::CALLERROR) {
+                    EVLOG_error << "Received a CALLERROR for message with UID: " << enhanced_message.uniqueId;
+                    enhanced_message.call_message = this->in_flight->message;
+                    this->handle_timeout_or_callerror(enhanced_message);
+                } else {
+                    this->handle_call_result(enhanced_message);
+                }
+                return enhanced_message;
+            }
             if (this->in_flight == nullptr) {
                 EVLOG_error << "Received a CALLRESULT OR CALLERROR without a message in flight, this should not happen";
                 return enhanced_message;
@@ -777,6 +1225,7 @@ public:
             enhanced_message.call_message = this->in_flight->message;
             enhanced_message.messageType = this->string_to_messagetype(
                 this->in_flight->message.at(CALL_ACTION).template get<std::string>() + std::string("Response"));
+            this->record_in_flight_time();
             this->in_flight->promise.set_value(enhanced_message);
 
             const auto queue_type =
@@ -785,8 +1234,7 @@ public:
                 try {
                     // We only remove the message as soon as a response is received. Otherwise we might miss a message
                     // if the charging station just boots after sending, but before receiving the result.
-                    this->database_handler->remove_message_queue_message(this->in_flight->initial_unique_id,
-                                                                         queue_type);
+                    this->persistence->remove_message_queue_message(this->in_flight->initial_unique_id, queue_type);
                 } catch (const QueryExecutionException& e) {
                     EVLOG_warning << "Could not delete message from message queue: " << e.what();
                 } catch (const std::exception& e) {
@@ -810,12 +1258,16 @@ public:
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
         // We got a timeout iff enhanced_message_opt is empty. Otherwise, enhanced_message_opt contains the CallError.
         bool timeout = !enhanced_message_opt.has_value();
+        auto& message_type_metrics = this->get_message_type_metrics(this->in_flight->messageType);
         if (timeout) {
             EVLOG_warning << "Message timeout for: " << this->in_flight->messageType << " ("
                           << this->in_flight->uniqueId() << ")";
+            message_type_metrics.timeouts++;
         } else {
             EVLOG_warning << "CALLERROR for: " << this->in_flight->messageType << " (" << this->in_flight->uniqueId()
                           << ")";
+            message_type_metrics.call_errors++;
+            this->record_in_flight_time();
         }
 
         const auto queue_type = is_transaction_message(*this->in_flight) ? QueueType::Transaction : QueueType::Normal;
@@ -825,6 +1277,7 @@ public:
                 // Generate a new message ID for the retry
                 const auto old_message_id = this->in_flight->message[MESSAGE_ID];
                 this->in_flight->message[MESSAGE_ID] = ocpp::create_message_id();
+                this->in_flight->serialized_message.clear();
                 if (this->config.transaction_message_retry_interval > 0) {
                     // exponential backoff
                     this->in_flight->timestamp =
@@ -848,6 +1301,8 @@ public:
                 } else if (queue_type == QueueType::Normal) {
                     this->normal_message_queue.push_front(this->in_flight);
                 }
+                message_type_metrics.retries++;
+                this->update_queue_size_metrics();
                 if (is_start_transaction_message(*this->in_flight)) {
                     this->start_transaction_message_retry_callback(this->in_flight->message[MESSAGE_ID],
                                                                    old_message_id);
@@ -861,6 +1316,7 @@ public:
             } else {
                 EVLOG_error << "Could not deliver message within the configured amount of attempts, "
                                "dropping message";
+                message_type_metrics.dropped++;
                 if (enhanced_message_opt) {
                     this->in_flight->promise.set_value(enhanced_message_opt.value());
                 } else {
@@ -870,8 +1326,7 @@ public:
                 }
                 try {
                     // also drop the message from the database
-                    this->database_handler->remove_message_queue_message(this->in_flight->initial_unique_id,
-                                                                         queue_type);
+                    this->persistence->remove_message_queue_message(this->in_flight->initial_unique_id, queue_type);
                 } catch (const QueryExecutionException& e) {
                     EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
                 } catch (const std::exception& e) {
@@ -882,12 +1337,15 @@ public:
             EVLOG_warning << "Message is BootNotification.req and will therefore be sent again";
             // Generate a new message ID for the retry
             this->in_flight->message[MESSAGE_ID] = ocpp::create_message_id();
+            this->in_flight->serialized_message.clear();
             // Spec does not define how to handle retries for BootNotification.req: We use the
             // the boot_notification_retry_interval_seconds
             this->in_flight->timestamp =
                 DateTime(this->in_flight->timestamp.to_time_point() +
                          std::chrono::seconds(this->config.boot_notification_retry_interval_seconds));
             this->normal_message_queue.push_front(this->in_flight);
+            message_type_metrics.retries++;
+            this->update_queue_size_metrics();
             this->notify_queue_timer.at(
                 [this]() {
                     this->new_message = true;
@@ -896,6 +1354,7 @@ public:
                 this->in_flight->timestamp.to_time_point());
         } else {
             EVLOG_warning << "Message is not transaction related, dropping it";
+            message_type_metrics.dropped++;
             if (enhanced_message_opt) {
                 this->in_flight->promise.set_value(enhanced_message_opt.value());
             } else {
@@ -913,6 +1372,8 @@ public:
         EVLOG_debug << "stop()";
         // stop the running thread
         this->running = false;
+        this->metrics_timer.stop();
+        this->pipelined_calls_timeout_timer.stop();
         this->cv.notify_one();
         this->worker_thread.join();
         EVLOG_debug << "stop() notified message queue";
@@ -989,6 +1450,32 @@ public:
         return false;
     }
 
+    /// \brief Returns the metrics collected since the message queue has been created
+    MessageQueueMetricsSnapshot get_metrics() {
+        {
+            std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+            this->update_queue_size_metrics();
+        }
+        return this->metrics.get_snapshot();
+    }
+
+    /// \brief Calls the given \p callback with the current metrics every \p interval . A previously set callback is
+    /// replaced, an empty \p callback stops the periodic reporting
+    void set_metrics_callback(const std::function<void(const MessageQueueMetricsSnapshot& metrics)>& callback,
+                              std::chrono::seconds interval) {
+        this->metrics_timer.stop();
+        if (callback == nullptr or interval <= std::chrono::seconds(0)) {
+            return;
+        }
+        this->metrics_timer.interval([this, callback]() { callback(this->get_metrics()); }, interval);
+    }
+
+    /// \brief Sets the \p callback used to send messages that have already been serialized, e.g. by
+    /// push_serialized_call_result
+    void set_serialized_send_callback(const std::function<bool(const std::string& message)>& callback) {
+        this->serialized_send_callback = callback;
+    }
+
     /// \brief Set transaction_message_attempts to given \p transaction_message_attempts
     void update_transaction_message_attempts(const int transaction_message_attempts) {
         this->config.transaction_message_attempts = transaction_message_attempts;
@@ -1038,6 +1525,7 @@ public:
                     if (meter_value_message_id == (*it)->message.at(1)) {
                         EVLOG_debug << "Adding transactionId " << transaction_id << " to MeterValue.req";
                         (*it)->message.at(3)["transactionId"] = transaction_id;
+                        (*it)->serialized_message.clear();
                     }
                 }
             }
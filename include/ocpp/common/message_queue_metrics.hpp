@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <ocpp/common/latency_histogram.hpp>
+#include <ocpp/common/types.hpp>
+
+namespace ocpp {
+
+/// \brief Counters of the CALLs of one message type
+struct MessageTypeMetrics {
+    std::atomic<uint64_t> sent{0};          ///< CALLs handed to the websocket, retries included
+    std::atomic<uint64_t> send_failures{0}; ///< CALLs the websocket could not send, e.g. because it was offline
+    std::atomic<uint64_t> retries{0};       ///< CALLs queued again after a timeout or CALLERROR
+    std::atomic<uint64_t> timeouts{0};      ///< CALLs without a response within the message timeout
+    std::atomic<uint64_t> call_errors{0};   ///< CALLs answered with a CALLERROR
+    std::atomic<uint64_t> dropped{0}; ///< CALLs dropped because of the queue size or after their last attempt
+    LatencyHistogram in_flight_time;  ///< Time between sending a CALL and receiving its CALLRESULT or CALLERROR
+};
+
+/// \brief Copy of the MessageTypeMetrics of one message type
+struct MessageTypeMetricsSnapshot {
+    uint64_t sent = 0;
+    uint64_t send_failures = 0;
+    uint64_t retries = 0;
+    uint64_t timeouts = 0;
+    uint64_t call_errors = 0;
+    uint64_t dropped = 0;
+    LatencyHistogramSnapshot in_flight_time;
+};
+
+/// \brief Copy of the metrics of a MessageQueue
+struct MessageQueueMetricsSnapshot {
+    std::map<std::string, MessageTypeMetricsSnapshot> message_types; ///< Metrics of every message type sent so far
+    std::size_t normal_queue_size = 0;          ///< Number of messages in the normal queue
+    std::size_t transaction_queue_size = 0;     ///< Number of messages in the transaction queue
+    std::size_t max_normal_queue_size = 0;      ///< Largest number of messages that were in the normal queue
+    std::size_t max_transaction_queue_size = 0; ///< Largest number of messages that were in the transaction queue
+    /// \brief Messages dropped from the normal queue to stay below queues_total_size_threshold
+    uint64_t dropped_normal_messages = 0;
+    /// \brief Update messages dropped from the transaction queue to stay below queues_total_size_threshold
+    uint64_t dropped_transaction_messages = 0;
+};
+
+/// \brief Collects the metrics of a MessageQueue. All counters are atomic, so they can be updated and read from any
+/// thread. The mutex only guards adding the entry of a message type that has not been seen before.
+class MessageQueueMetrics {
+private:
+    mutable std::mutex message_types_mutex;
+    std::map<std::string, std::unique_ptr<MessageTypeMetrics>> message_types;
+    std::atomic<std::size_t> normal_queue_size{0};
+    std::atomic<std::size_t> transaction_queue_size{0};
+    std::atomic<std::size_t> max_normal_queue_size{0};
+    std::atomic<std::size_t> max_transaction_queue_size{0};
+    std::atomic<uint64_t> dropped_normal_messages{0};
+    std::atomic<uint64_t> dropped_transaction_messages{0};
+
+public:
+    /// \brief Returns the metrics of the given \p message_type, creating them on first use. The returned reference
+    /// stays valid for the lifetime of this object
+    MessageTypeMetrics& get(const std::string& message_type);
+
+    /// \brief Updates the current and largest size of the queues
+    void set_queue_sizes(std::size_t normal_queue_size, std::size_t transaction_queue_size);
+
+    /// \brief Adds \p number_of_messages to the messages dropped from the queue of the given \p queue_type because the
+    /// queues exceeded their size threshold
+    void add_dropped_messages(QueueType queue_type, uint64_t number_of_messages);
+
+    /// \brief Returns a copy of all metrics
+    MessageQueueMetricsSnapshot get_snapshot() const;
+};
+
+} // namespace ocpp
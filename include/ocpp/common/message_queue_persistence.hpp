@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <ocpp/common/types.hpp>
+
+namespace ocpp::common {
+
+struct DBTransactionMessage {
+    json json_message;
+    std::string message_type;
+    int32_t message_attempts;
+    DateTime timestamp;
+    std::string unique_id;
+};
+
+/// \brief Storage of the messages of a MessageQueue that must survive a restart
+class MessageQueuePersistenceInterface {
+public:
+    virtual ~MessageQueuePersistenceInterface() = default;
+
+    /// \brief Get messages from messages queue specified by \p queue_type in the order they have been inserted
+    /// \param queue_type , defaults to QueueType::Transaction
+    /// \return The transaction messages.
+    virtual std::vector<DBTransactionMessage>
+    get_message_queue_messages(const QueueType queue_type = QueueType::Transaction) = 0;
+
+    /// \brief Insert a new message into messages queue specified by \p queue_type
+    /// \param message  The message to be stored.
+    /// \param queue_type , defaults to QueueType::Transaction
+    virtual void insert_message_queue_message(const DBTransactionMessage& message,
+                                              const QueueType queue_type = QueueType::Transaction) = 0;
+
+    /// \brief Remove a message from the messages queue specified by \p queue_type
+    /// \param unique_id    The unique id of the transaction message
+    /// \param queue_type , defaults to QueueType::Transaction
+    virtual void remove_message_queue_message(const std::string& unique_id,
+                                              const QueueType queue_type = QueueType::Transaction) = 0;
+
+    /// \brief Deletes all entries from message queue specified by \p queue_type
+    /// \param queue_type , defaults to QueueType::Transaction
+    virtual void clear_message_queue(const QueueType queue_type = QueueType::Transaction) = 0;
+};
+
+} // namespace ocpp::common
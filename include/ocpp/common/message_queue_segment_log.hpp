@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <ocpp/common/message_queue_persistence.hpp>
+#include <ocpp/common/support_older_cpp_versions.hpp>
+
+namespace ocpp::common {
+
+/// \brief Persists the messages of a MessageQueue in an append-only log instead of database tables. Every insert,
+/// remove and clear is appended as a checksummed record to the newest segment file of the log directory, so changing
+/// the queue only needs sequential writes. The messages are recovered by a single sequential scan of the segments.
+/// A torn or corrupted record at the end of the log, e.g. caused by a power loss, is discarded. Once the log contains
+/// more records of removed messages than records of queued messages, it is compacted into a new segment that only
+/// contains the queued messages.
+class MessageQueueSegmentLog : public MessageQueuePersistenceInterface {
+public:
+    /// \brief Opens the log in the given \p directory, creates the directory if it does not exist and recovers the
+    /// queued messages
+    /// \param max_segment_size A new segment is started once the current one reaches this size in bytes
+    /// \param sync_appends If true, every record is synced to the storage before the call returns
+    /// \throws std::runtime_error if the directory or a segment can not be opened
+    explicit MessageQueueSegmentLog(const fs::path& directory, std::size_t max_segment_size = 1024 * 1024,
+                                    bool sync_appends = true);
+    ~MessageQueueSegmentLog() override;
+
+    std::vector<DBTransactionMessage>
+    get_message_queue_messages(const QueueType queue_type = QueueType::Transaction) override;
+
+    /// \throws QueryExecutionException if a message with the same unique id is already queued or the record can not be
+    /// written, like DatabaseHandlerCommon does
+    void insert_message_queue_message(const DBTransactionMessage& message,
+                                      const QueueType queue_type = QueueType::Transaction) override;
+
+    /// \throws QueryExecutionException if the record can not be written
+    void remove_message_queue_message(const std::string& unique_id,
+                                      const QueueType queue_type = QueueType::Transaction) override;
+
+    /// \throws QueryExecutionException if the record can not be written
+    void clear_message_queue(const QueueType queue_type = QueueType::Transaction) override;
+
+private:
+    struct Entry {
+        DBTransactionMessage message;
+        std::size_t record_size;
+    };
+
+    struct Queue {
+        /// queued messages by their sequence number, i.e. in the order they have been inserted
+        std::map<uint64_t, Entry> entries;
+        std::map<std::string, uint64_t> sequence_numbers;
+    };
+
+    std::mutex mutex;
+    const fs::path directory;
+    const std::size_t max_segment_size;
+    const bool sync_appends;
+
+    std::map<QueueType, Queue> queues;
+    uint64_t next_sequence_number = 0;
+    /// size of the records of the queued messages and of all other records in the log
+    std::size_t live_bytes = 0;
+    std::size_t garbage_bytes = 0;
+
+    uint64_t segment_number = 0;
+    std::size_t segment_size = 0;
+    int segment_fd = -1;
+
+    fs::path get_segment_path(uint64_t number) const;
+    void open_segment(uint64_t number);
+    void close_segment();
+
+    void recover();
+    /// \brief Applies the given \p record read from the log or appended to it
+    void apply(const json& record, std::size_t record_size);
+    /// \brief Appends the given \p record to the log and applies it
+    void append(const json& record);
+    /// \brief Rewrites the records of the queued messages into a new segment and deletes the older segments if the log
+    /// mostly consists of records of removed messages
+    void compact_if_needed();
+};
+
+/// \brief Moves the messages of the Normal and Transaction queue from \p source to \p destination, keeping their order.
+/// Messages that are already queued in \p destination are not inserted again
+/// \returns the number of moved messages
+/// \throws QueryExecutionException if a message can not be inserted, the messages remain in \p source in this case
+std::size_t move_message_queue_messages(MessageQueuePersistenceInterface& source,
+                                        MessageQueuePersistenceInterface& destination);
+
+/// \brief Persistence of a MessageQueue selected by open_message_queue_persistence
+struct MessageQueuePersistenceSelection {
+    std::shared_ptr<MessageQueuePersistenceInterface> persistence;
+    /// \brief Directory of the segment log that may still contain queued messages. It must be remembered and passed
+    /// as previous_directory on the next start, otherwise its messages are abandoned if the configured directory is
+    /// removed
+    std::optional<fs::path> segment_log_directory;
+};
+
+/// \brief Opens the persistence of a MessageQueue: the segment log in \p directory if set and it can be opened,
+/// otherwise the \p database. The messages queued in the other storage, i.e. the \p database or the segment log in
+/// \p previous_directory used before, are moved into the opened one, so switching the storage does not abandon them
+MessageQueuePersistenceSelection
+open_message_queue_persistence(const std::shared_ptr<MessageQueuePersistenceInterface>& database,
+                               const std::optional<fs::path>& directory,
+                               const std::optional<fs::path>& previous_directory);
+
+} // namespace ocpp::common
@@ -6,6 +6,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <vector>
 
 namespace ocpp {
 
@@ -42,6 +43,31 @@ public:
         return front;
     }
 
+    /// \brief Moves all queued elements to the back of \p elements, keeping their order. The queue is only locked to
+    /// swap out the pending elements, so a consumer handling elements in batches does not take the lock per element
+    /// \return the number of elements moved
+    inline std::size_t drain_into(std::vector<T>& elements) {
+        std::queue<T> pending;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.swap(queue);
+        }
+
+        const auto number_of_elements = pending.size();
+        if (number_of_elements == 0) {
+            return 0;
+        }
+
+        notify_waiting_thread();
+
+        elements.reserve(elements.size() + number_of_elements);
+        while (!pending.empty()) {
+            elements.push_back(std::move(pending.front()));
+            pending.pop();
+        }
+        return number_of_elements;
+    }
+
     /// \brief Queues an element and notifies any threads waiting on the internal conditional variable
     inline void push(T&& value) {
         {
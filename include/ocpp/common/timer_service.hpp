@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <ocpp/common/executor.hpp>
+
+namespace ocpp {
+
+/// \brief Deadlines of timers run by a TimerService are rounded up to multiples of this resolution
+constexpr std::chrono::milliseconds DEFAULT_TIMER_RESOLUTION = std::chrono::milliseconds(50);
+
+/// \brief Wakeup and lag statistics of a TimerService
+struct TimerServiceMetrics {
+    uint64_t wakeups = 0;                   ///< Number of wakeups that ran at least one timer
+    uint64_t callbacks = 0;                 ///< Number of timer callbacks that have been run
+    std::chrono::microseconds max_lag{0};   ///< Largest delay between the deadline of a timer and its callback
+    std::chrono::microseconds total_lag{0}; ///< Sum of all delays, divide by callbacks to get the mean lag
+};
+
+/// \brief Runs any number of steady clock timers on an io_context using a single asio timer. Timers are bucketed by
+/// the tick of the service's resolution they are due in, so all timers that are due in the same tick are dispatched by
+/// one wakeup of the io_context instead of one wakeup per timer.
+///
+/// Callbacks are posted to the strand given for the timer, or to the default strand of the service if there is none. A
+/// slow callback therefore only delays the timers sharing its strand.
+///
+/// Has to be owned by a std::shared_ptr.
+class TimerService : public std::enable_shared_from_this<TimerService> {
+public:
+    using clock = std::chrono::steady_clock;
+    using TimerId = uint64_t;
+
+private:
+    struct Timer {
+        std::function<void()> callback;
+        std::shared_ptr<Strand> strand;
+        clock::duration interval;
+        clock::time_point deadline;
+        /// \brief Tick the timer is bucketed in, std::nullopt while its callback is posted to its strand
+        std::optional<uint64_t> tick;
+    };
+
+    boost::asio::steady_timer asio_timer;
+    const clock::duration resolution;
+    const clock::time_point epoch;
+    const std::shared_ptr<Strand> strand;
+
+    std::mutex mutex;
+    TimerId next_id;
+    std::unordered_map<TimerId, Timer> timers;
+    /// \brief Ids of the timers due in a tick. Entries of cancelled or rescheduled timers are skipped when the tick is
+    /// processed
+    std::map<uint64_t, std::vector<TimerId>> ticks;
+    std::optional<uint64_t> armed_tick;
+    TimerServiceMetrics metrics;
+
+    /// \brief Adds a timer running \p callback after \p delay and then every \p interval if it is not zero
+    TimerId schedule(const std::function<void()>& callback, clock::duration delay, clock::duration interval,
+                     const std::shared_ptr<Strand>& strand);
+
+    /// \brief Puts the timer \p id into the bucket of its deadline. Has to be called with mutex locked
+    void enqueue(TimerId id, Timer& timer);
+
+    /// \brief Arms the asio timer for the earliest tick holding a timer. Has to be called with mutex locked
+    void arm();
+
+    /// \brief Posts the callbacks of all timers that are due to their strands
+    void on_wakeup();
+
+    /// \brief Runs the posted \p callback of the timer \p id unless it has been cancelled in the meantime
+    void run(TimerId id, clock::time_point deadline, const std::function<void()>& callback);
+
+public:
+    /// \brief Creates a timer service running on \p io_context. Timers without a strand of their own run on
+    /// \p default_strand, or on a strand of the service if it is not given
+    explicit TimerService(boost::asio::io_context& io_context,
+                          std::chrono::milliseconds resolution = DEFAULT_TIMER_RESOLUTION,
+                          const std::shared_ptr<Strand>& default_strand = nullptr);
+
+    /// \brief Runs \p callback once after \p delay on \p strand
+    /// \return Id that can be used to cancel the timer
+    TimerId timeout(const std::function<void()>& callback, clock::duration delay,
+                    const std::shared_ptr<Strand>& strand = nullptr);
+
+    /// \brief Runs \p callback every \p interval on \p strand, starting one interval from now
+    /// \return Id that can be used to cancel the timer
+    TimerId interval(const std::function<void()>& callback, clock::duration interval,
+                     const std::shared_ptr<Strand>& strand = nullptr);
+
+    /// \brief Cancels the timer \p id. Its callback is not run anymore, even if it is already due
+    void cancel(TimerId id);
+
+    /// \brief Returns true if the timer \p id is scheduled
+    bool is_scheduled(TimerId id);
+
+    /// \brief Returns the wakeup and lag statistics collected so far
+    TimerServiceMetrics get_metrics();
+};
+
+/// \brief Timer with the interface of an Everest::SteadyTimer that is run by a shared TimerService
+class BatchedTimer {
+private:
+    std::weak_ptr<TimerService> timer_service;
+    std::function<void()> callback;
+    std::shared_ptr<Strand> strand;
+    std::mutex mutex;
+    std::optional<TimerService::TimerId> timer_id;
+
+    void set_callback(const std::function<void()>& callback);
+    void start(TimerService::clock::duration duration, bool periodic);
+
+public:
+    /// \brief Creates a timer run by \p timer_service, its callbacks are run on \p strand if given
+    explicit BatchedTimer(const std::shared_ptr<TimerService>& timer_service,
+                          const std::function<void()>& callback = nullptr,
+                          const std::shared_ptr<Strand>& strand = nullptr);
+    ~BatchedTimer();
+
+    BatchedTimer(const BatchedTimer&) = delete;
+    BatchedTimer& operator=(const BatchedTimer&) = delete;
+
+    /// \brief Runs the given \p callback once after \p delay, replacing the callback of this timer
+    template <class Rep, class Period>
+    void timeout(const std::function<void()>& callback, const std::chrono::duration<Rep, Period>& delay) {
+        this->set_callback(callback);
+        this->timeout(delay);
+    }
+
+    /// \brief Runs the callback of this timer once after \p delay
+    template <class Rep, class Period> void timeout(const std::chrono::duration<Rep, Period>& delay) {
+        this->start(std::chrono::duration_cast<TimerService::clock::duration>(delay), false);
+    }
+
+    /// \brief Runs the given \p callback every \p interval, replacing the callback of this timer
+    template <class Rep, class Period>
+    void interval(const std::function<void()>& callback, const std::chrono::duration<Rep, Period>& interval) {
+        this->set_callback(callback);
+        this->interval(interval);
+    }
+
+    /// \brief Runs the callback of this timer every \p interval
+    template <class Rep, class Period> void interval(const std::chrono::duration<Rep, Period>& interval) {
+        this->start(std::chrono::duration_cast<TimerService::clock::duration>(interval), true);
+    }
+
+    /// \brief Stops the timer
+    void stop();
+
+    /// \brief Returns true if the timer is scheduled
+    bool is_running();
+};
+
+} // namespace ocpp
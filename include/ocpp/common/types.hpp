@@ -829,6 +829,30 @@ enum class QueueType {
     None,
 };
 
+/// \brief Priority class of a CALL in the message queue. The message queue shares the available sends between the
+/// classes by their configured weights, so that a backlog of a class with a low priority does not delay a class with
+/// a higher priority
+enum class MessagePriority {
+    High,
+    Normal,
+    Transaction,
+    Low,
+};
+
+namespace conversions {
+/// \brief Converts the given MessagePriority \p e to std::string
+/// \returns a string representation of the MessagePriority
+std::string message_priority_to_string(MessagePriority e);
+
+/// \brief Converts the given std::string \p s to MessagePriority
+/// \returns a MessagePriority from a string representation
+MessagePriority string_to_message_priority(const std::string& s);
+} // namespace conversions
+
+/// \brief Writes the string representation of the given \p message_priority to the given output stream \p os
+/// \returns an output stream with the MessagePriority written to
+std::ostream& operator<<(std::ostream& os, const MessagePriority& message_priority);
+
 /// \brief Struct containing default limits for amps, watts and number of phases
 struct CompositeScheduleDefaultLimits {
     int32_t amps;
@@ -7,6 +7,8 @@
 #include <tuple>
 #include <vector>
 
+#include <ocpp/common/support_older_cpp_versions.hpp>
+
 namespace ocpp {
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
@@ -35,6 +37,17 @@ std::vector<std::string> split_string(const std::string& string_to_split, const
 ///
 std::string trim_string(const std::string& string_to_trim);
 
+///
+/// \brief Replace the file at \p path by \p content so that it either holds the old or the new content, even on power
+/// loss. The content is written to a temporary file in the same directory, synced to disk and renamed over \p path.
+/// The mode and ownership of an existing file are kept, a new file is only accessible by its owner. If \p path is a
+/// symlink, the file it points to is replaced.
+/// \param path     The file to write.
+/// \param content  The new content of the file.
+/// \return True if the file has been replaced, false otherwise.
+///
+bool write_file_atomically(const fs::path& path, const std::string& content);
+
 } // namespace ocpp
 
 #endif
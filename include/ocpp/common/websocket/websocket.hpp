@@ -26,6 +26,9 @@ public:
     /// \brief Creates a new Websocket object with the provided \p connection_options
     explicit Websocket(const WebsocketConnectionOptions& connection_options,
                        std::shared_ptr<EvseSecurity> evse_security, std::shared_ptr<MessageLogging> logging);
+
+    /// \brief Creates a new Websocket object that uses the given \p websocket implementation
+    explicit Websocket(std::unique_ptr<WebsocketBase> websocket, std::shared_ptr<MessageLogging> logging);
     ~Websocket();
 
     /// \brief Starts the connection attempts. It will init the websocket processing thread
@@ -69,6 +72,9 @@ public:
 
     /// \brief set the \p authorization_key of the connection_options
     void set_authorization_key(const std::string& authorization_key);
+
+    /// \brief Returns the time it took to write the messages passed to send() to the socket
+    LatencyHistogramSnapshot get_send_latency() const;
 };
 
 } // namespace ocpp
@@ -10,6 +10,7 @@
 
 #include <everest/timer.hpp>
 
+#include <ocpp/common/latency_histogram.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/common/websocket/websocket_uri.hpp>
 
@@ -38,6 +39,25 @@ struct WebsocketConnectionOptions {
     std::optional<std::string> iface; // Optional interface where the socket is created. Only usable for libwebsocket
     bool enable_tls_keylog = false;   ///< If set to true enables logging of TLS secrets to the keylog_file
     std::optional<std::filesystem::path> keylog_file; ///< Optional path to a keylog file
+    /// \brief If set to true the permessage-deflate extension (RFC 7692) is offered to the CSMS. Only usable for
+    /// libwebsocket
+    bool enable_permessage_deflate = false;
+    int deflate_client_max_window_bits = 15; ///< LZ77 window (8 - 15) of the messages sent to the CSMS
+    int deflate_server_max_window_bits = 15; ///< LZ77 window (8 - 15) requested for the messages sent by the CSMS
+    /// \brief If set to true the compression context of sent messages is reset after every message, which lowers
+    /// memory usage at the cost of compression ratio
+    bool deflate_client_no_context_takeover = false;
+    /// \brief If set to true the CSMS is asked to reset the compression context after every message
+    bool deflate_server_no_context_takeover = false;
+    /// \brief Messages smaller than this number of bytes are sent uncompressed, since compressing them barely saves
+    /// any bytes
+    std::size_t deflate_min_message_size = 0;
+    /// \brief If set to true the TLS session is cached and resumed when reconnecting, which avoids a full handshake.
+    /// Only usable for libwebsocket
+    bool enable_tls_session_resumption = false;
+    /// \brief Optional file the cached TLS session is persisted in, so it can also be resumed after a restart. The
+    /// file contains the session secret and is created readable for the owner only
+    std::optional<std::filesystem::path> tls_session_file;
 };
 
 ///
@@ -60,6 +80,8 @@ protected:
     std::atomic_int connection_attempts;
     std::atomic_bool shutting_down;
     std::atomic_bool reconnecting;
+    // time between handing a message to send() and it being written to the socket
+    LatencyHistogram send_latency;
 
     /// \brief Indicates if the required callbacks are registered
     /// \returns true if the websocket is properly initialized
@@ -136,6 +158,9 @@ public:
 
     /// \brief set the \p authorization_key of the connection_options
     void set_authorization_key(const std::string& authorization_key);
+
+    /// \brief Returns the time it took to write the messages passed to send() to the socket
+    LatencyHistogramSnapshot get_send_latency() const;
 };
 
 } // namespace ocpp
@@ -8,16 +8,31 @@
 #include <ocpp/common/websocket/websocket_base.hpp>
 
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 
 struct ssl_ctx_st;
+struct ssl_session_st;
 
 namespace ocpp {
 
 struct ConnectionData;
 struct WebsocketMessage;
 
+/// \brief Returns true if \p input_length bytes of an outgoing message are not passed to the permessage-deflate
+/// extension, because the message is smaller than \p min_message_size. RFC 7692 allows to send such messages
+/// uncompressed with RSV1 unset. An empty input means the extension is draining its own output, that is always passed
+/// on
+bool skip_permessage_deflate(std::size_t input_length, std::size_t min_message_size);
+
+/// \brief Returns the key identifying the TLS sessions that may be resumed for a connection with the given \p options.
+/// It changes if the CSMS, the verification settings, the client certificate at \p path_chain or the content of the
+/// CSMS CA bundle at \p ca_location (a file or a directory) changes, so a session is never resumed with a trust anchor
+/// it has not been verified against
+std::string get_tls_session_key(const WebsocketConnectionOptions& options, const std::string& path_chain,
+                                const std::optional<std::string>& ca_location);
+
 /// \brief Experimental libwebsockets TLS connection
 class WebsocketLibwebsockets final : public WebsocketBase {
 public:
@@ -47,6 +62,12 @@ public:
 public:
     int process_callback(void* wsi_ptr, int callback_reason, void* user, void* in, size_t len);
 
+    /// \brief Takes ownership of the TLS \p session negotiated with the CSMS, so it can be resumed on reconnect
+    void store_tls_session(struct ssl_session_st* session);
+
+    /// \brief Returns the cached TLS session with an additional reference the caller must free, or nullptr
+    struct ssl_session_st* get_tls_session();
+
 private:
     bool is_trying_to_connect_internal();
     void close_internal(const WebsocketCloseReason code, const std::string& reason);
@@ -59,6 +80,19 @@ private:
     bool tls_init(struct ssl_ctx_st* ctx, const std::string& path_chain, const std::string& path_key, bool custom_key,
                   std::optional<std::string>& password);
 
+    /// \brief Enables resumption of the cached TLS session on the given \p ctx. The cache is cleared if the CSMS, the
+    /// client certificate at \p path_chain or the CSMS CA bundle at \p ca_location changed since the session has
+    /// been negotiated
+    void init_tls_session_resumption(struct ssl_ctx_st* ctx, const std::string& path_chain,
+                                     const std::optional<std::string>& ca_location);
+
+    /// \brief Loads the TLS session from the tls_session_file, if it has been negotiated for the current
+    /// tls_session_key
+    void load_tls_session_file();
+
+    /// \brief Writes the cached TLS session to the tls_session_file
+    void save_tls_session_file();
+
     /// \brief Websocket processing thread loop
     void thread_websocket_client_loop(std::shared_ptr<ConnectionData> local_data);
 
@@ -118,6 +152,12 @@ private:
     std::atomic_bool stop_deferred_handler;
 
     OcppProtocolVersion connected_ocpp_version;
+
+    // TLS session of the last connection, kept across the recreation of the SSL context on reconnect
+    std::mutex tls_session_mutex;
+    std::shared_ptr<struct ssl_session_st> tls_session;
+    // identifies the CSMS, client certificate and CA bundle the cached session has been negotiated with
+    std::string tls_session_key;
 };
 
 } // namespace ocpp
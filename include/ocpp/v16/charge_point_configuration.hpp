@@ -3,16 +3,40 @@
 #ifndef OCPP_V16_CHARGE_POINT_CONFIGURATION_HPP
 #define OCPP_V16_CHARGE_POINT_CONFIGURATION_HPP
 
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <thread>
+#include <unordered_map>
 
 #include <ocpp/common/support_older_cpp_versions.hpp>
+#include <ocpp/v16/meter_value_sampling_plan.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 #include <ocpp/v16/types.hpp>
 
 namespace ocpp {
 namespace v16 {
 
+/// \brief Typed, immutable copy of the configuration values that are read on hot paths. A new snapshot is published
+/// whenever one of the contained values changes, so readers neither need to look up and convert the JSON configuration
+/// nor hold the configuration mutex.
+struct ConfigurationSnapshot {
+    int32_t number_of_connectors;
+    int32_t heartbeat_interval;
+    int32_t clock_aligned_data_interval;
+    int32_t meter_value_sample_interval;
+    std::vector<MeasurandWithPhase> meter_values_aligned_data;
+    std::vector<MeasurandWithPhase> meter_values_sampled_data;
+    MeterValueSamplingPlan meter_values_aligned_data_plan;
+    MeterValueSamplingPlan meter_values_sampled_data_plan;
+    std::string websocket_ping_payload;
+    std::set<MessageType> supported_message_types_sending;
+    std::set<MessageType> supported_message_types_receiving;
+};
+
 /// \brief contains the configuration of the charge point
 class ChargePointConfiguration {
 private:
@@ -28,13 +52,53 @@ private:
     std::set<MessageType> supported_message_types_sending;
     std::set<MessageType> supported_message_types_receiving;
     std::recursive_mutex configuration_mutex;
+    std::shared_ptr<const ConfigurationSnapshot> snapshot;
+
+    /// \brief Write-behind journal of user config changes that have not been written to disk yet, keyed by profile and
+    /// key. Changes are coalesced and written in one go after a short debounce delay.
+    std::map<std::pair<std::string, std::string>, json> pending_user_config;
+    std::optional<std::chrono::steady_clock::time_point> user_config_first_change;
+    std::optional<std::chrono::steady_clock::time_point> user_config_write_deadline;
+    std::mutex user_config_mutex;
+    std::condition_variable user_config_cv;
+    bool user_config_writer_running;
+    std::thread user_config_writer_thread;
+
+    using KeyGetter = std::function<std::optional<KeyValue>()>;
+    using KeySetter = std::function<ConfigurationStatus(const CiString<500>& value)>;
+
+    /// \brief Describes how get() and set() handle a configuration key
+    struct KeyDescriptor {
+        /// \brief Feature profile that has to be supported to read the key, std::nullopt if it is always readable
+        std::optional<SupportedFeatureProfiles> profile;
+        KeyGetter get;
+        KeySetter set;
+    };
+
+    struct CaseInsensitiveKeyHash {
+        std::size_t operator()(const std::string& key) const;
+    };
+
+    struct CaseInsensitiveKeyEqual {
+        bool operator()(const std::string& lhs, const std::string& rhs) const;
+    };
+
+    /// \brief Known configuration keys, looked up case-insensitively
+    std::unordered_map<std::string, KeyDescriptor, CaseInsensitiveKeyHash, CaseInsensitiveKeyEqual> key_descriptors;
 
     std::vector<MeasurandWithPhase> csv_to_measurand_with_phase_vector(std::string csv);
     bool validate_measurands(const json& config);
     bool measurands_supported(std::string csv);
     json get_user_config();
     void setInUserConfig(std::string profile, std::string key, json value);
+    /// \brief Writes the pending user config changes to disk. Has to be called with user_config_mutex locked
+    void write_pending_user_config();
+    void run_user_config_writer();
     void init_supported_measurands();
+    void init_key_descriptors();
+
+    /// \brief Builds a new snapshot from the current configuration and publishes it
+    void publish_snapshot();
 
     bool isConnectorPhaseRotationValid(std::string str);
 
@@ -43,6 +107,13 @@ private:
 public:
     ChargePointConfiguration(const std::string& config, const fs::path& ocpp_main_path,
                              const fs::path& user_config_path);
+    ~ChargePointConfiguration();
+
+    /// \brief Writes all pending changes of the user config to disk immediately
+    void flush_user_config();
+
+    /// \brief Returns the most recently published configuration snapshot
+    std::shared_ptr<const ConfigurationSnapshot> get_snapshot() const;
 
     // Internal config options
     std::string getChargePointId();
@@ -124,6 +195,16 @@ public:
     bool getEnableTLSKeylog();
     std::string getTLSKeylogFile();
 
+    bool getEnablePermessageDeflate();
+    int getPermessageDeflateClientMaxWindowBits();
+    int getPermessageDeflateServerMaxWindowBits();
+    bool getPermessageDeflateClientNoContextTakeover();
+    bool getPermessageDeflateServerNoContextTakeover();
+    int getPermessageDeflateMinMessageSize();
+
+    bool getEnableTLSSessionResumption();
+    std::optional<std::string> getTLSSessionFile();
+
     int32_t getRetryBackoffRandomRange();
     void setRetryBackoffRandomRange(int32_t retry_backoff_random_range);
     KeyValue getRetryBackoffRandomRangeKeyValue();
@@ -160,6 +241,32 @@ public:
     std::optional<int> getMessageQueueSizeThreshold();
     std::optional<KeyValue> getMessageQueueSizeThresholdKeyValue();
 
+    std::optional<int> getMaxPipelinedCalls();
+    std::optional<KeyValue> getMaxPipelinedCallsKeyValue();
+
+    std::optional<std::string> getPipelinedMessageTypes();
+    std::optional<KeyValue> getPipelinedMessageTypesKeyValue();
+
+    std::optional<std::string> getMessagePriorityWeights();
+    std::optional<KeyValue> getMessagePriorityWeightsKeyValue();
+
+    std::optional<std::string> getMessagePriorityQueueLimits();
+    std::optional<KeyValue> getMessagePriorityQueueLimitsKeyValue();
+
+    std::optional<int> getTransactionUpdateCompactionInterval();
+    std::optional<KeyValue> getTransactionUpdateCompactionIntervalKeyValue();
+
+    std::optional<std::string> getMessageQueueSegmentLogDirectory();
+    std::optional<KeyValue> getMessageQueueSegmentLogDirectoryKeyValue();
+    std::optional<std::string> getMessageQueueSegmentLogDirectoryInUse();
+    void setMessageQueueSegmentLogDirectoryInUse(const std::string& message_queue_segment_log_directory_in_use);
+
+    std::optional<int> getMaxTransactionMeterValuesInMemory();
+    std::optional<KeyValue> getMaxTransactionMeterValuesInMemoryKeyValue();
+
+    std::optional<int> getExecutorThreads();
+    std::optional<KeyValue> getExecutorThreadsKeyValue();
+
     // Core Profile - optional
     std::optional<bool> getAllowOfflineTxForUnknownId();
     void setAllowOfflineTxForUnknownId(bool enabled);
@@ -64,6 +64,7 @@
 #include <ocpp/v16/messages/TriggerMessage.hpp>
 #include <ocpp/v16/messages/UnlockConnector.hpp>
 #include <ocpp/v16/messages/UpdateFirmware.hpp>
+#include <ocpp/v16/meter_value_sampling_plan.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 #include <ocpp/v16/smart_charging.hpp>
 #include <ocpp/v16/transaction.hpp>
@@ -110,13 +111,13 @@ private:
     std::unique_ptr<ChargePointStates> status;
     std::shared_ptr<ChargePointConfiguration> configuration;
     std::shared_ptr<ocpp::v16::DatabaseHandler> database_handler;
-    std::unique_ptr<Everest::SteadyTimer> boot_notification_timer;
-    std::unique_ptr<Everest::SteadyTimer> heartbeat_timer;
+    std::unique_ptr<BatchedTimer> boot_notification_timer;
+    std::unique_ptr<BatchedTimer> heartbeat_timer;
     std::unique_ptr<ClockAlignedTimer> clock_aligned_meter_values_timer;
-    std::vector<std::unique_ptr<Everest::SteadyTimer>> status_notification_timers;
-    std::unique_ptr<Everest::SteadyTimer> ocsp_request_timer;
-    std::unique_ptr<Everest::SteadyTimer> client_certificate_timer;
-    std::unique_ptr<Everest::SteadyTimer> v2g_certificate_timer;
+    std::vector<std::unique_ptr<BatchedTimer>> status_notification_timers;
+    std::unique_ptr<BatchedTimer> ocsp_request_timer;
+    std::unique_ptr<BatchedTimer> client_certificate_timer;
+    std::unique_ptr<BatchedTimer> v2g_certificate_timer;
     std::unique_ptr<Everest::SystemTimer> change_time_offset_timer;
     std::chrono::time_point<date::utc_clock> clock_aligned_meter_values_time_point;
     std::mutex meter_values_mutex;
@@ -215,8 +216,7 @@ private:
     void update_heartbeat_interval();
     void update_meter_values_sample_interval();
     void update_clock_aligned_meter_values_interval();
-    std::optional<MeterValue> get_latest_meter_value(int32_t connector,
-                                                     std::vector<MeasurandWithPhase> values_of_interest,
+    std::optional<MeterValue> get_latest_meter_value(int32_t connector, const MeterValueSamplingPlan& sampling_plan,
                                                      ReadingContext context);
     MeterValue get_signed_meter_value(const std::string& signed_value, const ReadingContext& context,
                                       const ocpp::DateTime& datetime);
@@ -257,6 +257,10 @@ private:
 
     void stop_transaction(int32_t connector, Reason reason, std::optional<CiString<20>> id_tag_end);
 
+    /// \brief Moves older meter values of the \p transaction to the database if MaxTransactionMeterValuesInMemory is
+    /// set
+    void enable_meter_values_spilling(const std::shared_ptr<Transaction>& transaction);
+
     /// \brief Converts the given \p measurands_csv to a vector of Measurands
     /// \param measurands_csv
     /// \return
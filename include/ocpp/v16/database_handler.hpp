@@ -8,6 +8,7 @@
 #include <iostream>
 
 #include <ocpp/common/database/database_handler_common.hpp>
+#include <ocpp/common/database/local_authorization_list_index.hpp>
 #include <ocpp/common/schemas.hpp>
 #include <ocpp/common/support_older_cpp_versions.hpp>
 #include <ocpp/common/types.hpp>
@@ -43,10 +44,12 @@ struct TransactionEntry {
 class DatabaseHandler : public ocpp::common::DatabaseHandlerCommon {
 private:
     const int32_t number_of_connectors;
+    common::LocalAuthorizationListIndex local_authorization_list_index;
 
     // Runs initialization script and initializes the CONNECTORS and AUTH_LIST_VERSION table.
     void init_sql() override;
     void init_connector_table();
+    std::vector<std::string> get_local_authorization_list_keys();
 
 public:
     DatabaseHandler(std::unique_ptr<common::DatabaseConnectionInterface> database,
@@ -86,6 +89,18 @@ public:
     /// transactions will be return. If \p filter_complete is false, all transactions will be returned
     std::vector<TransactionEntry> get_transactions(bool filter_incomplete = false);
 
+    /// \brief Appends the given \p meter_values of the transaction with the given \p session_id to the
+    /// TRANSACTION_METER_VALUES table.
+    void insert_transaction_meter_values(const std::string& session_id, const std::vector<MeterValue>& meter_values);
+
+    /// \brief Returns the meter values of the transaction with the given \p session_id from the
+    /// TRANSACTION_METER_VALUES table in the order they have been inserted.
+    std::vector<MeterValue> get_transaction_meter_values(const std::string& session_id);
+
+    /// \brief Deletes the meter values of the transaction with the given \p session_id from the
+    /// TRANSACTION_METER_VALUES table.
+    void delete_transaction_meter_values(const std::string& session_id);
+
     // authorization cache
     /// \brief Inserts or updates an authorization cache entry to the AUTH_CACHE table.
     void insert_or_update_authorization_cache_entry(const CiString<20>& id_tag, const v16::IdTagInfo& id_tag_info);
@@ -30,6 +30,9 @@ void to_json(json& j, const AuthorizeRequest& k);
 /// \brief Conversion from a given json object \p j to a given AuthorizeRequest \p k
 void from_json(const json& j, AuthorizeRequest& k);
 
+/// \brief Writes the given AuthorizeRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const AuthorizeRequest& k);
+
 /// \brief Writes the string representation of the given AuthorizeRequest \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeRequest written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeRequest& k);
@@ -49,6 +52,9 @@ void to_json(json& j, const AuthorizeResponse& k);
 /// \brief Conversion from a given json object \p j to a given AuthorizeResponse \p k
 void from_json(const json& j, AuthorizeResponse& k);
 
+/// \brief Writes the given AuthorizeResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const AuthorizeResponse& k);
+
 /// \brief Writes the string representation of the given AuthorizeResponse \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeResponse written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeResponse& k);
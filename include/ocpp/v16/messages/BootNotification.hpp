@@ -38,6 +38,9 @@ void to_json(json& j, const BootNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given BootNotificationRequest \p k
 void from_json(const json& j, BootNotificationRequest& k);
 
+/// \brief Writes the given BootNotificationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const BootNotificationRequest& k);
+
 /// \brief Writes the string representation of the given BootNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationRequest& k);
@@ -59,6 +62,9 @@ void to_json(json& j, const BootNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given BootNotificationResponse \p k
 void from_json(const json& j, BootNotificationResponse& k);
 
+/// \brief Writes the given BootNotificationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const BootNotificationResponse& k);
+
 /// \brief Writes the string representation of the given BootNotificationResponse \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationResponse& k);
@@ -28,6 +28,9 @@ void to_json(json& j, const CancelReservationRequest& k);
 /// \brief Conversion from a given json object \p j to a given CancelReservationRequest \p k
 void from_json(const json& j, CancelReservationRequest& k);
 
+/// \brief Writes the given CancelReservationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CancelReservationRequest& k);
+
 /// \brief Writes the string representation of the given CancelReservationRequest \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationRequest written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationRequest& k);
@@ -47,6 +50,9 @@ void to_json(json& j, const CancelReservationResponse& k);
 /// \brief Conversion from a given json object \p j to a given CancelReservationResponse \p k
 void from_json(const json& j, CancelReservationResponse& k);
 
+/// \brief Writes the given CancelReservationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CancelReservationResponse& k);
+
 /// \brief Writes the string representation of the given CancelReservationResponse \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationResponse written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationResponse& k);
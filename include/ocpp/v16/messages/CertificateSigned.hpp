@@ -28,6 +28,9 @@ void to_json(json& j, const CertificateSignedRequest& k);
 /// \brief Conversion from a given json object \p j to a given CertificateSignedRequest \p k
 void from_json(const json& j, CertificateSignedRequest& k);
 
+/// \brief Writes the given CertificateSignedRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CertificateSignedRequest& k);
+
 /// \brief Writes the string representation of the given CertificateSignedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedRequest written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedRequest& k);
@@ -47,6 +50,9 @@ void to_json(json& j, const CertificateSignedResponse& k);
 /// \brief Conversion from a given json object \p j to a given CertificateSignedResponse \p k
 void from_json(const json& j, CertificateSignedResponse& k);
 
+/// \brief Writes the given CertificateSignedResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CertificateSignedResponse& k);
+
 /// \brief Writes the string representation of the given CertificateSignedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedResponse written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedResponse& k);
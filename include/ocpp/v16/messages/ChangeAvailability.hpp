@@ -29,6 +29,9 @@ void to_json(json& j, const ChangeAvailabilityRequest& k);
 /// \brief Conversion from a given json object \p j to a given ChangeAvailabilityRequest \p k
 void from_json(const json& j, ChangeAvailabilityRequest& k);
 
+/// \brief Writes the given ChangeAvailabilityRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChangeAvailabilityRequest& k);
+
 /// \brief Writes the string representation of the given ChangeAvailabilityRequest \p k to the given output stream \p os
 /// \returns an output stream with the ChangeAvailabilityRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityRequest& k);
@@ -48,6 +51,9 @@ void to_json(json& j, const ChangeAvailabilityResponse& k);
 /// \brief Conversion from a given json object \p j to a given ChangeAvailabilityResponse \p k
 void from_json(const json& j, ChangeAvailabilityResponse& k);
 
+/// \brief Writes the given ChangeAvailabilityResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChangeAvailabilityResponse& k);
+
 /// \brief Writes the string representation of the given ChangeAvailabilityResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeAvailabilityResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityResponse& k);
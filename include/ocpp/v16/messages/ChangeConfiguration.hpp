@@ -30,6 +30,9 @@ void to_json(json& j, const ChangeConfigurationRequest& k);
 /// \brief Conversion from a given json object \p j to a given ChangeConfigurationRequest \p k
 void from_json(const json& j, ChangeConfigurationRequest& k);
 
+/// \brief Writes the given ChangeConfigurationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChangeConfigurationRequest& k);
+
 /// \brief Writes the string representation of the given ChangeConfigurationRequest \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationRequest& k);
@@ -49,6 +52,9 @@ void to_json(json& j, const ChangeConfigurationResponse& k);
 /// \brief Conversion from a given json object \p j to a given ChangeConfigurationResponse \p k
 void from_json(const json& j, ChangeConfigurationResponse& k);
 
+/// \brief Writes the given ChangeConfigurationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChangeConfigurationResponse& k);
+
 /// \brief Writes the string representation of the given ChangeConfigurationResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationResponse& k);
@@ -27,6 +27,9 @@ void to_json(json& j, const ClearCacheRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearCacheRequest \p k
 void from_json(const json& j, ClearCacheRequest& k);
 
+/// \brief Writes the given ClearCacheRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearCacheRequest& k);
+
 /// \brief Writes the string representation of the given ClearCacheRequest \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheRequest& k);
@@ -46,6 +49,9 @@ void to_json(json& j, const ClearCacheResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearCacheResponse \p k
 void from_json(const json& j, ClearCacheResponse& k);
 
+/// \brief Writes the given ClearCacheResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearCacheResponse& k);
+
 /// \brief Writes the string representation of the given ClearCacheResponse \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheResponse& k);
@@ -32,6 +32,9 @@ void to_json(json& j, const ClearChargingProfileRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfileRequest \p k
 void from_json(const json& j, ClearChargingProfileRequest& k);
 
+/// \brief Writes the given ClearChargingProfileRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearChargingProfileRequest& k);
+
 /// \brief Writes the string representation of the given ClearChargingProfileRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const ClearChargingProfileResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfileResponse \p k
 void from_json(const json& j, ClearChargingProfileResponse& k);
 
+/// \brief Writes the given ClearChargingProfileResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearChargingProfileResponse& k);
+
 /// \brief Writes the string representation of the given ClearChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileResponse& k);
@@ -32,6 +32,9 @@ void to_json(json& j, const DataTransferRequest& k);
 /// \brief Conversion from a given json object \p j to a given DataTransferRequest \p k
 void from_json(const json& j, DataTransferRequest& k);
 
+/// \brief Writes the given DataTransferRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const DataTransferRequest& k);
+
 /// \brief Writes the string representation of the given DataTransferRequest \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferRequest written to
 std::ostream& operator<<(std::ostream& os, const DataTransferRequest& k);
@@ -52,6 +55,9 @@ void to_json(json& j, const DataTransferResponse& k);
 /// \brief Conversion from a given json object \p j to a given DataTransferResponse \p k
 void from_json(const json& j, DataTransferResponse& k);
 
+/// \brief Writes the given DataTransferResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const DataTransferResponse& k);
+
 /// \brief Writes the string representation of the given DataTransferResponse \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferResponse written to
 std::ostream& operator<<(std::ostream& os, const DataTransferResponse& k);
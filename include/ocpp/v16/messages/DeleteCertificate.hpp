@@ -28,6 +28,9 @@ void to_json(json& j, const DeleteCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given DeleteCertificateRequest \p k
 void from_json(const json& j, DeleteCertificateRequest& k);
 
+/// \brief Writes the given DeleteCertificateRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const DeleteCertificateRequest& k);
+
 /// \brief Writes the string representation of the given DeleteCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateRequest& k);
@@ -47,6 +50,9 @@ void to_json(json& j, const DeleteCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given DeleteCertificateResponse \p k
 void from_json(const json& j, DeleteCertificateResponse& k);
 
+/// \brief Writes the given DeleteCertificateResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const DeleteCertificateResponse& k);
+
 /// \brief Writes the string representation of the given DeleteCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateResponse& k);
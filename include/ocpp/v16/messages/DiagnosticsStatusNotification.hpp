@@ -28,6 +28,9 @@ void to_json(json& j, const DiagnosticsStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given DiagnosticsStatusNotificationRequest \p k
 void from_json(const json& j, DiagnosticsStatusNotificationRequest& k);
 
+/// \brief Writes the given DiagnosticsStatusNotificationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationRequest& k);
@@ -46,6 +49,9 @@ void to_json(json& j, const DiagnosticsStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given DiagnosticsStatusNotificationResponse \p k
 void from_json(const json& j, DiagnosticsStatusNotificationResponse& k);
 
+/// \brief Writes the given DiagnosticsStatusNotificationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationResponse& k);
@@ -30,6 +30,9 @@ void to_json(json& j, const ExtendedTriggerMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given ExtendedTriggerMessageRequest \p k
 void from_json(const json& j, ExtendedTriggerMessageRequest& k);
 
+/// \brief Writes the given ExtendedTriggerMessageRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageRequest& k);
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageRequest \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageRequest& k);
@@ -49,6 +52,9 @@ void to_json(json& j, const ExtendedTriggerMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given ExtendedTriggerMessageResponse \p k
 void from_json(const json& j, ExtendedTriggerMessageResponse& k);
 
+/// \brief Writes the given ExtendedTriggerMessageResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageResponse& k);
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageResponse \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageResponse& k);
@@ -28,6 +28,9 @@ void to_json(json& j, const FirmwareStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given FirmwareStatusNotificationRequest \p k
 void from_json(const json& j, FirmwareStatusNotificationRequest& k);
 
+/// \brief Writes the given FirmwareStatusNotificationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationRequest& k);
@@ -46,6 +49,9 @@ void to_json(json& j, const FirmwareStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given FirmwareStatusNotificationResponse \p k
 void from_json(const json& j, FirmwareStatusNotificationResponse& k);
 
+/// \brief Writes the given FirmwareStatusNotificationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationResponse& k);
@@ -31,6 +31,9 @@ void to_json(json& j, const GetCompositeScheduleRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetCompositeScheduleRequest \p k
 void from_json(const json& j, GetCompositeScheduleRequest& k);
 
+/// \brief Writes the given GetCompositeScheduleRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetCompositeScheduleRequest& k);
+
 /// \brief Writes the string representation of the given GetCompositeScheduleRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleRequest& k);
@@ -53,6 +56,9 @@ void to_json(json& j, const GetCompositeScheduleResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetCompositeScheduleResponse \p k
 void from_json(const json& j, GetCompositeScheduleResponse& k);
 
+/// \brief Writes the given GetCompositeScheduleResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetCompositeScheduleResponse& k);
+
 /// \brief Writes the string representation of the given GetCompositeScheduleResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleResponse& k);
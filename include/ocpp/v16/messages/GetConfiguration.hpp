@@ -29,6 +29,9 @@ void to_json(json& j, const GetConfigurationRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetConfigurationRequest \p k
 void from_json(const json& j, GetConfigurationRequest& k);
 
+/// \brief Writes the given GetConfigurationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetConfigurationRequest& k);
+
 /// \brief Writes the string representation of the given GetConfigurationRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationRequest& k);
@@ -49,6 +52,9 @@ void to_json(json& j, const GetConfigurationResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetConfigurationResponse \p k
 void from_json(const json& j, GetConfigurationResponse& k);
 
+/// \brief Writes the given GetConfigurationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetConfigurationResponse& k);
+
 /// \brief Writes the string representation of the given GetConfigurationResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationResponse& k);
@@ -33,6 +33,9 @@ void to_json(json& j, const GetDiagnosticsRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetDiagnosticsRequest \p k
 void from_json(const json& j, GetDiagnosticsRequest& k);
 
+/// \brief Writes the given GetDiagnosticsRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetDiagnosticsRequest& k);
+
 /// \brief Writes the string representation of the given GetDiagnosticsRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsRequest& k);
@@ -52,6 +55,9 @@ void to_json(json& j, const GetDiagnosticsResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetDiagnosticsResponse \p k
 void from_json(const json& j, GetDiagnosticsResponse& k);
 
+/// \brief Writes the given GetDiagnosticsResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetDiagnosticsResponse& k);
+
 /// \brief Writes the string representation of the given GetDiagnosticsResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsResponse& k);
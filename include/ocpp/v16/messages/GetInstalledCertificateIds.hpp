@@ -29,6 +29,9 @@ void to_json(json& j, const GetInstalledCertificateIdsRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetInstalledCertificateIdsRequest \p k
 void from_json(const json& j, GetInstalledCertificateIdsRequest& k);
 
+/// \brief Writes the given GetInstalledCertificateIdsRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsRequest& k);
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsRequest \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsRequest& k);
@@ -49,6 +52,9 @@ void to_json(json& j, const GetInstalledCertificateIdsResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetInstalledCertificateIdsResponse \p k
 void from_json(const json& j, GetInstalledCertificateIdsResponse& k);
 
+/// \brief Writes the given GetInstalledCertificateIdsResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsResponse& k);
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsResponse \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsResponse& k);
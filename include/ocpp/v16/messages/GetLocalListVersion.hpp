@@ -26,6 +26,9 @@ void to_json(json& j, const GetLocalListVersionRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetLocalListVersionRequest \p k
 void from_json(const json& j, GetLocalListVersionRequest& k);
 
+/// \brief Writes the given GetLocalListVersionRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetLocalListVersionRequest& k);
+
 /// \brief Writes the string representation of the given GetLocalListVersionRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionRequest& k);
@@ -45,6 +48,9 @@ void to_json(json& j, const GetLocalListVersionResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetLocalListVersionResponse \p k
 void from_json(const json& j, GetLocalListVersionResponse& k);
 
+/// \brief Writes the given GetLocalListVersionResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetLocalListVersionResponse& k);
+
 /// \brief Writes the string representation of the given GetLocalListVersionResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionResponse& k);
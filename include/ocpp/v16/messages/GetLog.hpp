@@ -34,6 +34,9 @@ void to_json(json& j, const GetLogRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetLogRequest \p k
 void from_json(const json& j, GetLogRequest& k);
 
+/// \brief Writes the given GetLogRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetLogRequest& k);
+
 /// \brief Writes the string representation of the given GetLogRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetLogRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLogRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const GetLogResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetLogResponse \p k
 void from_json(const json& j, GetLogResponse& k);
 
+/// \brief Writes the given GetLogResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetLogResponse& k);
+
 /// \brief Writes the string representation of the given GetLogResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetLogResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLogResponse& k);
@@ -26,6 +26,9 @@ void to_json(json& j, const HeartbeatRequest& k);
 /// \brief Conversion from a given json object \p j to a given HeartbeatRequest \p k
 void from_json(const json& j, HeartbeatRequest& k);
 
+/// \brief Writes the given HeartbeatRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const HeartbeatRequest& k);
+
 /// \brief Writes the string representation of the given HeartbeatRequest \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatRequest written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatRequest& k);
@@ -45,6 +48,9 @@ void to_json(json& j, const HeartbeatResponse& k);
 /// \brief Conversion from a given json object \p j to a given HeartbeatResponse \p k
 void from_json(const json& j, HeartbeatResponse& k);
 
+/// \brief Writes the given HeartbeatResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const HeartbeatResponse& k);
+
 /// \brief Writes the string representation of the given HeartbeatResponse \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatResponse written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatResponse& k);
@@ -29,6 +29,9 @@ void to_json(json& j, const InstallCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given InstallCertificateRequest \p k
 void from_json(const json& j, InstallCertificateRequest& k);
 
+/// \brief Writes the given InstallCertificateRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k);
+
 /// \brief Writes the string representation of the given InstallCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the InstallCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateRequest& k);
@@ -48,6 +51,9 @@ void to_json(json& j, const InstallCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given InstallCertificateResponse \p k
 void from_json(const json& j, InstallCertificateResponse& k);
 
+/// \brief Writes the given InstallCertificateResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k);
+
 /// \brief Writes the string representation of the given InstallCertificateResponse \p k to the given output stream \p
 /// os \returns an output stream with the InstallCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateResponse& k);
@@ -30,6 +30,9 @@ void to_json(json& j, const LogStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given LogStatusNotificationRequest \p k
 void from_json(const json& j, LogStatusNotificationRequest& k);
 
+/// \brief Writes the given LogStatusNotificationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const LogStatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given LogStatusNotificationRequest \p k to the given output stream \p
 /// os \returns an output stream with the LogStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationRequest& k);
@@ -48,6 +51,9 @@ void to_json(json& j, const LogStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given LogStatusNotificationResponse \p k
 void from_json(const json& j, LogStatusNotificationResponse& k);
 
+/// \brief Writes the given LogStatusNotificationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const LogStatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given LogStatusNotificationResponse \p k to the given output stream
 /// \p os \returns an output stream with the LogStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationResponse& k);
@@ -31,6 +31,9 @@ void to_json(json& j, const MeterValuesRequest& k);
 /// \brief Conversion from a given json object \p j to a given MeterValuesRequest \p k
 void from_json(const json& j, MeterValuesRequest& k);
 
+/// \brief Writes the given MeterValuesRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MeterValuesRequest& k);
+
 /// \brief Writes the string representation of the given MeterValuesRequest \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesRequest written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesRequest& k);
@@ -49,6 +52,9 @@ void to_json(json& j, const MeterValuesResponse& k);
 /// \brief Conversion from a given json object \p j to a given MeterValuesResponse \p k
 void from_json(const json& j, MeterValuesResponse& k);
 
+/// \brief Writes the given MeterValuesResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MeterValuesResponse& k);
+
 /// \brief Writes the string representation of the given MeterValuesResponse \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesResponse written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesResponse& k);
@@ -32,6 +32,9 @@ void to_json(json& j, const RemoteStartTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStartTransactionRequest \p k
 void from_json(const json& j, RemoteStartTransactionRequest& k);
 
+/// \brief Writes the given RemoteStartTransactionRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const RemoteStartTransactionRequest& k);
+
 /// \brief Writes the string representation of the given RemoteStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const RemoteStartTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStartTransactionResponse \p k
 void from_json(const json& j, RemoteStartTransactionResponse& k);
 
+/// \brief Writes the given RemoteStartTransactionResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const RemoteStartTransactionResponse& k);
+
 /// \brief Writes the string representation of the given RemoteStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionResponse& k);
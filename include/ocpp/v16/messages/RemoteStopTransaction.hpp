@@ -28,6 +28,9 @@ void to_json(json& j, const RemoteStopTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStopTransactionRequest \p k
 void from_json(const json& j, RemoteStopTransactionRequest& k);
 
+/// \brief Writes the given RemoteStopTransactionRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const RemoteStopTransactionRequest& k);
+
 /// \brief Writes the string representation of the given RemoteStopTransactionRequest \p k to the given output stream \p
 /// os \returns an output stream with the RemoteStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionRequest& k);
@@ -47,6 +50,9 @@ void to_json(json& j, const RemoteStopTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStopTransactionResponse \p k
 void from_json(const json& j, RemoteStopTransactionResponse& k);
 
+/// \brief Writes the given RemoteStopTransactionResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const RemoteStopTransactionResponse& k);
+
 /// \brief Writes the string representation of the given RemoteStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionResponse& k);
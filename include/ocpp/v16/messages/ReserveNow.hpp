@@ -34,6 +34,9 @@ void to_json(json& j, const ReserveNowRequest& k);
 /// \brief Conversion from a given json object \p j to a given ReserveNowRequest \p k
 void from_json(const json& j, ReserveNowRequest& k);
 
+/// \brief Writes the given ReserveNowRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ReserveNowRequest& k);
+
 /// \brief Writes the string representation of the given ReserveNowRequest \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowRequest written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowRequest& k);
@@ -53,6 +56,9 @@ void to_json(json& j, const ReserveNowResponse& k);
 /// \brief Conversion from a given json object \p j to a given ReserveNowResponse \p k
 void from_json(const json& j, ReserveNowResponse& k);
 
+/// \brief Writes the given ReserveNowResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ReserveNowResponse& k);
+
 /// \brief Writes the string representation of the given ReserveNowResponse \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowResponse written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowResponse& k);
@@ -28,6 +28,9 @@ void to_json(json& j, const ResetRequest& k);
 /// \brief Conversion from a given json object \p j to a given ResetRequest \p k
 void from_json(const json& j, ResetRequest& k);
 
+/// \brief Writes the given ResetRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ResetRequest& k);
+
 /// \brief Writes the string representation of the given ResetRequest \p k to the given output stream \p os
 /// \returns an output stream with the ResetRequest written to
 std::ostream& operator<<(std::ostream& os, const ResetRequest& k);
@@ -47,6 +50,9 @@ void to_json(json& j, const ResetResponse& k);
 /// \brief Conversion from a given json object \p j to a given ResetResponse \p k
 void from_json(const json& j, ResetResponse& k);
 
+/// \brief Writes the given ResetResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ResetResponse& k);
+
 /// \brief Writes the string representation of the given ResetResponse \p k to the given output stream \p os
 /// \returns an output stream with the ResetResponse written to
 std::ostream& operator<<(std::ostream& os, const ResetResponse& k);
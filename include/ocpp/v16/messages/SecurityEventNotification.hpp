@@ -31,6 +31,9 @@ void to_json(json& j, const SecurityEventNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given SecurityEventNotificationRequest \p k
 void from_json(const json& j, SecurityEventNotificationRequest& k);
 
+/// \brief Writes the given SecurityEventNotificationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SecurityEventNotificationRequest& k);
+
 /// \brief Writes the string representation of the given SecurityEventNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationRequest& k);
@@ -49,6 +52,9 @@ void to_json(json& j, const SecurityEventNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given SecurityEventNotificationResponse \p k
 void from_json(const json& j, SecurityEventNotificationResponse& k);
 
+/// \brief Writes the given SecurityEventNotificationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SecurityEventNotificationResponse& k);
+
 /// \brief Writes the string representation of the given SecurityEventNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationResponse& k);
@@ -32,6 +32,9 @@ void to_json(json& j, const SendLocalListRequest& k);
 /// \brief Conversion from a given json object \p j to a given SendLocalListRequest \p k
 void from_json(const json& j, SendLocalListRequest& k);
 
+/// \brief Writes the given SendLocalListRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SendLocalListRequest& k);
+
 /// \brief Writes the string representation of the given SendLocalListRequest \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListRequest written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const SendLocalListResponse& k);
 /// \brief Conversion from a given json object \p j to a given SendLocalListResponse \p k
 void from_json(const json& j, SendLocalListResponse& k);
 
+/// \brief Writes the given SendLocalListResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SendLocalListResponse& k);
+
 /// \brief Writes the string representation of the given SendLocalListResponse \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListResponse written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListResponse& k);
@@ -30,6 +30,9 @@ void to_json(json& j, const SetChargingProfileRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetChargingProfileRequest \p k
 void from_json(const json& j, SetChargingProfileRequest& k);
 
+/// \brief Writes the given SetChargingProfileRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k);
+
 /// \brief Writes the string representation of the given SetChargingProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileRequest& k);
@@ -49,6 +52,9 @@ void to_json(json& j, const SetChargingProfileResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetChargingProfileResponse \p k
 void from_json(const json& j, SetChargingProfileResponse& k);
 
+/// \brief Writes the given SetChargingProfileResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k);
+
 /// \brief Writes the string representation of the given SetChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileResponse& k);
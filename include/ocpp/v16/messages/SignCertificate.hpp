@@ -28,6 +28,9 @@ void to_json(json& j, const SignCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given SignCertificateRequest \p k
 void from_json(const json& j, SignCertificateRequest& k);
 
+/// \brief Writes the given SignCertificateRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SignCertificateRequest& k);
+
 /// \brief Writes the string representation of the given SignCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateRequest& k);
@@ -47,6 +50,9 @@ void to_json(json& j, const SignCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given SignCertificateResponse \p k
 void from_json(const json& j, SignCertificateResponse& k);
 
+/// \brief Writes the given SignCertificateResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SignCertificateResponse& k);
+
 /// \brief Writes the string representation of the given SignCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateResponse& k);
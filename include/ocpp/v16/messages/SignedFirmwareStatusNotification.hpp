@@ -30,6 +30,9 @@ void to_json(json& j, const SignedFirmwareStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given SignedFirmwareStatusNotificationRequest \p k
 void from_json(const json& j, SignedFirmwareStatusNotificationRequest& k);
 
+/// \brief Writes the given SignedFirmwareStatusNotificationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given SignedFirmwareStatusNotificationRequest \p k to the given
 /// output stream \p os \returns an output stream with the SignedFirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const SignedFirmwareStatusNotificationRequest& k);
@@ -48,6 +51,9 @@ void to_json(json& j, const SignedFirmwareStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given SignedFirmwareStatusNotificationResponse \p k
 void from_json(const json& j, SignedFirmwareStatusNotificationResponse& k);
 
+/// \brief Writes the given SignedFirmwareStatusNotificationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given SignedFirmwareStatusNotificationResponse \p k to the given
 /// output stream \p os \returns an output stream with the SignedFirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const SignedFirmwareStatusNotificationResponse& k);
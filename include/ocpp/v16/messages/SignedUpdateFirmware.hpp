@@ -32,6 +32,9 @@ void to_json(json& j, const SignedUpdateFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given SignedUpdateFirmwareRequest \p k
 void from_json(const json& j, SignedUpdateFirmwareRequest& k);
 
+/// \brief Writes the given SignedUpdateFirmwareRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareRequest& k);
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareRequest \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const SignedUpdateFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given SignedUpdateFirmwareResponse \p k
 void from_json(const json& j, SignedUpdateFirmwareResponse& k);
 
+/// \brief Writes the given SignedUpdateFirmwareResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareResponse& k);
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareResponse \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareResponse& k);
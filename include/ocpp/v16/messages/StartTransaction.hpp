@@ -34,6 +34,9 @@ void to_json(json& j, const StartTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given StartTransactionRequest \p k
 void from_json(const json& j, StartTransactionRequest& k);
 
+/// \brief Writes the given StartTransactionRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const StartTransactionRequest& k);
+
 /// \brief Writes the string representation of the given StartTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const StartTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given StartTransactionResponse \p k
 void from_json(const json& j, StartTransactionResponse& k);
 
+/// \brief Writes the given StartTransactionResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const StartTransactionResponse& k);
+
 /// \brief Writes the string representation of the given StartTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionResponse& k);
@@ -36,6 +36,9 @@ void to_json(json& j, const StatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given StatusNotificationRequest \p k
 void from_json(const json& j, StatusNotificationRequest& k);
 
+/// \brief Writes the given StatusNotificationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const StatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given StatusNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the StatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const StatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given StatusNotificationResponse \p k
 void from_json(const json& j, StatusNotificationResponse& k);
 
+/// \brief Writes the given StatusNotificationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const StatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given StatusNotificationResponse \p k to the given output stream \p
 /// os \returns an output stream with the StatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationResponse& k);
@@ -35,6 +35,9 @@ void to_json(json& j, const StopTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given StopTransactionRequest \p k
 void from_json(const json& j, StopTransactionRequest& k);
 
+/// \brief Writes the given StopTransactionRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const StopTransactionRequest& k);
+
 /// \brief Writes the string representation of the given StopTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const StopTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given StopTransactionResponse \p k
 void from_json(const json& j, StopTransactionResponse& k);
 
+/// \brief Writes the given StopTransactionResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const StopTransactionResponse& k);
+
 /// \brief Writes the string representation of the given StopTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionResponse& k);
@@ -30,6 +30,9 @@ void to_json(json& j, const TriggerMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given TriggerMessageRequest \p k
 void from_json(const json& j, TriggerMessageRequest& k);
 
+/// \brief Writes the given TriggerMessageRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const TriggerMessageRequest& k);
+
 /// \brief Writes the string representation of the given TriggerMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageRequest& k);
@@ -49,6 +52,9 @@ void to_json(json& j, const TriggerMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given TriggerMessageResponse \p k
 void from_json(const json& j, TriggerMessageResponse& k);
 
+/// \brief Writes the given TriggerMessageResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const TriggerMessageResponse& k);
+
 /// \brief Writes the string representation of the given TriggerMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageResponse& k);
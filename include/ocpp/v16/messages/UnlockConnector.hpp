@@ -28,6 +28,9 @@ void to_json(json& j, const UnlockConnectorRequest& k);
 /// \brief Conversion from a given json object \p j to a given UnlockConnectorRequest \p k
 void from_json(const json& j, UnlockConnectorRequest& k);
 
+/// \brief Writes the given UnlockConnectorRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const UnlockConnectorRequest& k);
+
 /// \brief Writes the string representation of the given UnlockConnectorRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorRequest written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorRequest& k);
@@ -47,6 +50,9 @@ void to_json(json& j, const UnlockConnectorResponse& k);
 /// \brief Conversion from a given json object \p j to a given UnlockConnectorResponse \p k
 void from_json(const json& j, UnlockConnectorResponse& k);
 
+/// \brief Writes the given UnlockConnectorResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const UnlockConnectorResponse& k);
+
 /// \brief Writes the string representation of the given UnlockConnectorResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorResponse written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorResponse& k);
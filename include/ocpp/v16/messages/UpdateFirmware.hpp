@@ -31,6 +31,9 @@ void to_json(json& j, const UpdateFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given UpdateFirmwareRequest \p k
 void from_json(const json& j, UpdateFirmwareRequest& k);
 
+/// \brief Writes the given UpdateFirmwareRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const UpdateFirmwareRequest& k);
+
 /// \brief Writes the string representation of the given UpdateFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareRequest& k);
@@ -49,6 +52,9 @@ void to_json(json& j, const UpdateFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given UpdateFirmwareResponse \p k
 void from_json(const json& j, UpdateFirmwareResponse& k);
 
+/// \brief Writes the given UpdateFirmwareResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const UpdateFirmwareResponse& k);
+
 /// \brief Writes the string representation of the given UpdateFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareResponse& k);
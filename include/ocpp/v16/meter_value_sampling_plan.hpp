@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_V16_METER_VALUE_SAMPLING_PLAN_HPP
+#define OCPP_V16_METER_VALUE_SAMPLING_PLAN_HPP
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <ocpp/v16/ocpp_types.hpp>
+#include <ocpp/v16/types.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+/// \brief Values of a connector a MeterValue is sampled from
+struct MeterValueSamplingSource {
+    const Measurement& measurement;
+    double max_current_offered;
+    double max_power_offered;
+};
+
+/// \brief A list of configured measurands compiled into the steps needed to sample them. Unit, location and phase of
+/// each SampledValue as well as the field of the Measurement it is read from are determined once when the plan is
+/// created, so sampling only has to read and format the values. Measurands that can never be sampled are dropped.
+class MeterValueSamplingPlan {
+private:
+    enum class StepType {
+        Value,         ///< a single value read by the step's accessor
+        StateOfCharge, ///< soc_Percent of the measurement, location taken from the measurement
+        Rpm,           ///< rpm of the measurement, location taken from the measurement
+        Temperature,   ///< one SampledValue for every entry of temperature_C
+    };
+
+    using ValueAccessor = std::function<std::optional<double>(const MeterValueSamplingSource& source)>;
+
+    struct Step {
+        StepType type;
+        SampledValue prototype;
+        ValueAccessor accessor;
+    };
+
+    std::vector<Step> steps;
+
+    void add_step(const MeasurandWithPhase& measurand);
+
+public:
+    MeterValueSamplingPlan() = default;
+    explicit MeterValueSamplingPlan(const std::vector<MeasurandWithPhase>& measurands);
+
+    /// \brief Samples all measurands of the plan from the given \p source
+    /// \param context reading context of the sampled values
+    /// \return MeterValue with the timestamp of the power meter and a SampledValue for every available measurand
+    MeterValue sample(const MeterValueSamplingSource& source, ReadingContext context) const;
+
+    /// \brief Number of measurands that are sampled by this plan
+    std::size_t size() const;
+};
+
+} // namespace v16
+} // namespace ocpp
+
+#endif // OCPP_V16_METER_VALUE_SAMPLING_PLAN_HPP
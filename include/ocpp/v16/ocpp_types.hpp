@@ -10,6 +10,7 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/types.hpp>
@@ -28,6 +29,9 @@ void to_json(json& j, const IdTagInfo& k);
 /// \brief Conversion from a given json object \p j to a given IdTagInfo \p k
 void from_json(const json& j, IdTagInfo& k);
 
+/// \brief Writes the given IdTagInfo \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const IdTagInfo& k);
+
 // \brief Writes the string representation of the given IdTagInfo \p k to the given output stream \p os
 /// \returns an output stream with the IdTagInfo written to
 std::ostream& operator<<(std::ostream& os, const IdTagInfo& k);
@@ -44,6 +48,9 @@ void to_json(json& j, const CertificateHashDataType& k);
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k);
 
+/// \brief Writes the given CertificateHashDataType \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataType& k);
+
 // \brief Writes the string representation of the given CertificateHashDataType \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataType written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataType& k);
@@ -59,6 +66,9 @@ void to_json(json& j, const ChargingSchedulePeriod& k);
 /// \brief Conversion from a given json object \p j to a given ChargingSchedulePeriod \p k
 void from_json(const json& j, ChargingSchedulePeriod& k);
 
+/// \brief Writes the given ChargingSchedulePeriod \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k);
+
 // \brief Writes the string representation of the given ChargingSchedulePeriod \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedulePeriod written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedulePeriod& k);
@@ -76,6 +86,9 @@ void to_json(json& j, const ChargingSchedule& k);
 /// \brief Conversion from a given json object \p j to a given ChargingSchedule \p k
 void from_json(const json& j, ChargingSchedule& k);
 
+/// \brief Writes the given ChargingSchedule \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedule& k);
+
 // \brief Writes the string representation of the given ChargingSchedule \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedule written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedule& k);
@@ -91,6 +104,9 @@ void to_json(json& j, const KeyValue& k);
 /// \brief Conversion from a given json object \p j to a given KeyValue \p k
 void from_json(const json& j, KeyValue& k);
 
+/// \brief Writes the given KeyValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const KeyValue& k);
+
 // \brief Writes the string representation of the given KeyValue \p k to the given output stream \p os
 /// \returns an output stream with the KeyValue written to
 std::ostream& operator<<(std::ostream& os, const KeyValue& k);
@@ -106,6 +122,9 @@ void to_json(json& j, const LogParametersType& k);
 /// \brief Conversion from a given json object \p j to a given LogParametersType \p k
 void from_json(const json& j, LogParametersType& k);
 
+/// \brief Writes the given LogParametersType \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const LogParametersType& k);
+
 // \brief Writes the string representation of the given LogParametersType \p k to the given output stream \p os
 /// \returns an output stream with the LogParametersType written to
 std::ostream& operator<<(std::ostream& os, const LogParametersType& k);
@@ -125,6 +144,9 @@ void to_json(json& j, const SampledValue& k);
 /// \brief Conversion from a given json object \p j to a given SampledValue \p k
 void from_json(const json& j, SampledValue& k);
 
+/// \brief Writes the given SampledValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SampledValue& k);
+
 // \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
 /// \returns an output stream with the SampledValue written to
 std::ostream& operator<<(std::ostream& os, const SampledValue& k);
@@ -139,6 +161,9 @@ void to_json(json& j, const MeterValue& k);
 /// \brief Conversion from a given json object \p j to a given MeterValue \p k
 void from_json(const json& j, MeterValue& k);
 
+/// \brief Writes the given MeterValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MeterValue& k);
+
 // \brief Writes the string representation of the given MeterValue \p k to the given output stream \p os
 /// \returns an output stream with the MeterValue written to
 std::ostream& operator<<(std::ostream& os, const MeterValue& k);
@@ -160,6 +185,9 @@ void to_json(json& j, const ChargingProfile& k);
 /// \brief Conversion from a given json object \p j to a given ChargingProfile \p k
 void from_json(const json& j, ChargingProfile& k);
 
+/// \brief Writes the given ChargingProfile \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfile& k);
+
 // \brief Writes the string representation of the given ChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfile& k);
@@ -174,6 +202,9 @@ void to_json(json& j, const LocalAuthorizationList& k);
 /// \brief Conversion from a given json object \p j to a given LocalAuthorizationList \p k
 void from_json(const json& j, LocalAuthorizationList& k);
 
+/// \brief Writes the given LocalAuthorizationList \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const LocalAuthorizationList& k);
+
 // \brief Writes the string representation of the given LocalAuthorizationList \p k to the given output stream \p os
 /// \returns an output stream with the LocalAuthorizationList written to
 std::ostream& operator<<(std::ostream& os, const LocalAuthorizationList& k);
@@ -191,6 +222,9 @@ void to_json(json& j, const FirmwareType& k);
 /// \brief Conversion from a given json object \p j to a given FirmwareType \p k
 void from_json(const json& j, FirmwareType& k);
 
+/// \brief Writes the given FirmwareType \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const FirmwareType& k);
+
 // \brief Writes the string representation of the given FirmwareType \p k to the given output stream \p os
 /// \returns an output stream with the FirmwareType written to
 std::ostream& operator<<(std::ostream& os, const FirmwareType& k);
@@ -205,6 +239,9 @@ void to_json(json& j, const TransactionData& k);
 /// \brief Conversion from a given json object \p j to a given TransactionData \p k
 void from_json(const json& j, TransactionData& k);
 
+/// \brief Writes the given TransactionData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const TransactionData& k);
+
 // \brief Writes the string representation of the given TransactionData \p k to the given output stream \p os
 /// \returns an output stream with the TransactionData written to
 std::ostream& operator<<(std::ostream& os, const TransactionData& k);
@@ -7,12 +7,15 @@
 #include <random>
 
 #include <everest/timer.hpp>
+#include <ocpp/common/timer_service.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 #include <ocpp/v16/types.hpp>
 
 namespace ocpp {
 namespace v16 {
 
+class DatabaseHandler;
+
 /// \brief A structure that contains a energy value in Wh that can be used for start/stop energy values and a
 /// corresponding timestamp
 struct StampedEnergyWh {
@@ -37,19 +40,25 @@ private:
     bool active;
     bool finished;
     bool has_signed_meter_values;
-    std::unique_ptr<Everest::SteadyTimer> meter_values_sample_timer;
+    std::unique_ptr<BatchedTimer> meter_values_sample_timer;
     std::string start_transaction_message_id;
     std::string stop_transaction_message_id;
     std::shared_ptr<StampedEnergyWh> stop_energy_wh;
     std::mutex meter_values_mutex;
     std::vector<MeterValue> meter_values;
+    /// \brief Meter values exceeding max_meter_values_in_memory are moved to this database if set
+    std::shared_ptr<DatabaseHandler> database_handler;
+    std::size_t max_meter_values_in_memory;
+
+    /// \brief Moves the oldest meter values to the database, has to be called with meter_values_mutex locked
+    void spill_meter_values();
 
 public:
     /// \brief Creates a new Transaction object, taking ownership of the provided \p meter_values_sample_timer
     /// on the provided \p connector
     Transaction(const int32_t transaction_id, const int32_t& connector, const std::string& session_id,
                 const CiString<20>& id_token, const double meter_start, std::optional<int32_t> reservation_id,
-                const ocpp::DateTime& timestamp, std::unique_ptr<Everest::SteadyTimer> meter_values_sample_timer);
+                const ocpp::DateTime& timestamp, std::unique_ptr<BatchedTimer> meter_values_sample_timer);
 
     /// \brief Provides the energy in Wh at the start of the transaction
     /// \returns the energy in Wh combined with a timestamp
@@ -75,10 +84,16 @@ public:
     /// \returns the authorized id tag
     CiString<20> get_id_tag();
 
+    /// \brief Keeps at most \p max_meter_values_in_memory powermeter values in memory and moves older ones to the
+    /// TRANSACTION_METER_VALUES table of \p database_handler. Meter values that have already been moved there by a
+    /// previous run for this session are provided by get_meter_values as well
+    void enable_meter_values_spilling(std::shared_ptr<DatabaseHandler> database_handler,
+                                      std::size_t max_meter_values_in_memory);
+
     /// \brief Adds the provided \p meter_value to a chronological list of powermeter values
     void add_meter_value(MeterValue meter_value);
 
-    /// \brief Provides all recorded powermeter values
+    /// \brief Provides all recorded powermeter values, including the ones that have been moved to the database
     /// \returns a vector of powermeter values
     std::vector<MeterValue> get_meter_values();
 
@@ -14,8 +14,8 @@ namespace utils {
 
 size_t get_message_size(const ocpp::Call<StopTransactionRequest>& call);
 
-/// \brief Drops every second entry from transactionData as long as the message size of the \p call is greater than the
-/// \p max_message_size
+/// \brief Downsamples transactionData if the message size of the \p call is greater than the \p max_message_size.
+/// Keeps the largest number of evenly spaced entries that fits, always including the first and the last entry
 void drop_transaction_data(size_t max_message_size, ocpp::Call<StopTransactionRequest>& call);
 
 /// \brief Determines if a given \p security_event is critical as defined in the OCPP 1.6 security whitepaper
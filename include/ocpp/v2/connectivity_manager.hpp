@@ -7,8 +7,10 @@
 #include <ocpp/v2/messages/SetNetworkProfile.hpp>
 #include <ocpp/v2/ocpp_types.hpp>
 
+#include <atomic>
 #include <functional>
 #include <future>
+#include <mutex>
 #include <optional>
 namespace ocpp {
 namespace v2 {
@@ -120,7 +122,20 @@ private:
     /// \brief Pointer to the logger
     std::shared_ptr<MessageLogging> logging;
     /// \brief Pointer to the websocket
-    std::unique_ptr<Websocket> websocket;
+    std::shared_ptr<Websocket> websocket;
+    /// \brief Websocket connected to the network connection profile with the next priority without being registered,
+    /// so it can take over as soon as the active websocket is disconnected (NetworkProfileWarmStandby Connect)
+    std::shared_ptr<Websocket> standby_websocket;
+    /// \brief Guards websocket, standby_websocket and the standby state, which are swapped on a failover. The
+    /// websockets are used through a copy of the pointer taken under this lock and never while holding it, because
+    /// disconnecting a websocket joins its threads, which take this lock in their callbacks
+    mutable std::mutex websocket_mutex;
+    std::optional<int32_t> standby_configuration_slot;
+    int32_t standby_network_configuration_priority{0};
+    std::atomic_bool standby_connected{false};
+    OcppProtocolVersion standby_ocpp_version{OcppProtocolVersion::Unknown};
+    /// \brief Runs the preparation of the warm standby and the failover, which must not run on a websocket thread
+    Everest::SteadyTimer standby_timer;
     /// \brief The message callback
     std::function<void(const std::string& message)> message_callback;
     /// \brief Callback that is called when the websocket is connected successfully
@@ -135,7 +150,8 @@ private:
     Everest::SteadyTimer websocket_timer;
     std::optional<int32_t> pending_configuration_slot;
     bool wants_to_be_connected;
-    int32_t active_network_configuration_priority;
+    /// \brief Written by the failover on the standby timer thread as well
+    std::atomic<int32_t> active_network_configuration_priority;
     int last_known_security_level;
     /// @brief Local cached network connection profiles
     std::vector<SetNetworkProfileRequest> cached_network_connection_profiles;
@@ -167,11 +183,42 @@ public:
     void on_charging_station_certificate_changed() override;
     void confirm_successful_connection() override;
 
+protected:
+    /// \brief Constructs the websocket for the given \p connection_options
+    ///
+    virtual std::unique_ptr<Websocket> make_websocket(const WebsocketConnectionOptions& connection_options);
+
 private:
+    /// \brief Returns the active websocket, which may be replaced by a failover at any time
+    ///
+    std::shared_ptr<Websocket> get_websocket() const;
+
     /// \brief Initializes the websocket and tries to connect
     ///
     void try_connect_websocket();
 
+    /// \brief Creates a websocket with the given \p connection_options. Its callbacks are forwarded depending on
+    /// whether it is the active or the standby websocket, the callbacks of a replaced websocket are dropped
+    ///
+    std::shared_ptr<Websocket> create_websocket(const WebsocketConnectionOptions& connection_options);
+
+    /// \brief Sets the ActiveNetworkProfile variable to the given \p configuration_slot
+    ///
+    void set_active_network_profile(int32_t configuration_slot);
+
+    /// \brief Prepares the network connection profile with the next priority according to the configured
+    /// NetworkProfileWarmStandby mode
+    ///
+    void prepare_warm_standby();
+
+    /// \brief Disconnects and removes the standby websocket, e.g. because its connection options are outdated
+    ///
+    void stop_warm_standby();
+
+    /// \brief Replaces the disconnected active websocket by the connected standby websocket
+    ///
+    void switch_to_standby_websocket();
+
     /// \brief Get the current websocket connection options
     /// \return the current websocket connection options
     ///
@@ -65,6 +65,7 @@ extern const ComponentVariable SupportedChargingProfilePurposeTypes;
 extern const ComponentVariable SupportedCriteria;
 extern const ComponentVariable RoundClockAlignedTimestamps;
 extern const ComponentVariable NetworkConfigTimeout;
+extern const ComponentVariable NetworkProfileWarmStandby;
 extern const ComponentVariable MaxCompositeScheduleDuration;
 extern const RequiredComponentVariable NumberOfConnectors;
 extern const ComponentVariable UseSslDefaultVerifyPaths;
@@ -75,6 +76,14 @@ extern const ComponentVariable VerifyCsmsAllowWildcards;
 extern const ComponentVariable IFace;
 extern const ComponentVariable EnableTLSKeylog;
 extern const ComponentVariable TLSKeylogFile;
+extern const ComponentVariable EnablePermessageDeflate;
+extern const ComponentVariable PermessageDeflateClientMaxWindowBits;
+extern const ComponentVariable PermessageDeflateServerMaxWindowBits;
+extern const ComponentVariable PermessageDeflateClientNoContextTakeover;
+extern const ComponentVariable PermessageDeflateServerNoContextTakeover;
+extern const ComponentVariable PermessageDeflateMinMessageSize;
+extern const ComponentVariable EnableTLSSessionResumption;
+extern const ComponentVariable TLSSessionFile;
 extern const ComponentVariable OcspRequestInterval;
 extern const ComponentVariable WebsocketPingPayload;
 extern const ComponentVariable WebsocketPongTimeout;
@@ -85,6 +94,13 @@ extern const ComponentVariable V2GCertificateExpireCheckIntervalSeconds;
 extern const ComponentVariable ClientCertificateExpireCheckInitialDelaySeconds;
 extern const ComponentVariable ClientCertificateExpireCheckIntervalSeconds;
 extern const ComponentVariable MessageQueueSizeThreshold;
+extern const ComponentVariable MaxPipelinedCalls;
+extern const ComponentVariable PipelinedMessageTypes;
+extern const ComponentVariable MessagePriorityWeights;
+extern const ComponentVariable MessagePriorityQueueLimits;
+extern const ComponentVariable TransactionUpdateCompactionInterval;
+extern const ComponentVariable MessageQueueSegmentLogDirectory;
+extern const ComponentVariable MessageQueueSegmentLogDirectoryInUse;
 extern const ComponentVariable MaxMessageSize;
 extern const ComponentVariable ResumeTransactionsOnBoot;
 extern const ComponentVariable AllowSecurityLevelZeroConnections;
@@ -10,8 +10,10 @@
 
 #include <ocpp/common/database/database_connection.hpp>
 #include <ocpp/common/database/database_handler_common.hpp>
+#include <ocpp/common/database/local_authorization_list_index.hpp>
 #include <ocpp/v2/ocpp_types.hpp>
 #include <ocpp/v2/transaction.hpp>
+#include <ocpp/v2/utils.hpp>
 
 #include <everest/logging.hpp>
 
@@ -126,6 +128,13 @@ public:
     /// \brief Get all metervalues linked to transaction with id \p transaction_id
     virtual std::vector<MeterValue> transaction_metervalues_get_all(const std::string& transaction_id) = 0;
 
+    /// \brief Get the metervalues linked to transaction with id \p transaction_id with the given \p filter applied
+    /// while they are read. Gives the same result as applying utils::get_meter_values_with_measurands_applied to
+    /// transaction_metervalues_get_all without building the unfiltered metervalues
+    virtual std::vector<MeterValue>
+    transaction_metervalues_get_tx_ended(const std::string& transaction_id,
+                                         const utils::TxEndedMeterValueFilter& filter) = 0;
+
     /// \brief Remove all metervalue entries linked to transaction with id \p transaction_id
     virtual void transaction_metervalues_clear(const std::string& transaction_id) = 0;
 
@@ -198,6 +207,19 @@ public:
 
     virtual ChargingLimitSourceEnum get_charging_limit_source_for_profile(const int profile_id) = 0;
 
+    /// OCSP refresh state
+
+    /// \brief Inserts or updates the time \p next_refresh at which the OCSP response of the certificate identified by
+    /// \p certificate_key should be refreshed
+    virtual void ocsp_refresh_state_insert_or_update(const std::string& certificate_key,
+                                                     const DateTime& next_refresh) = 0;
+
+    /// \brief Returns the refresh time of every certificate in the OCSP_REFRESH_STATE table by certificate key
+    virtual std::map<std::string, DateTime> ocsp_refresh_state_get_all() = 0;
+
+    /// \brief Deletes the refresh state of the certificate identified by \p certificate_key
+    virtual void ocsp_refresh_state_delete(const std::string& certificate_key) = 0;
+
     virtual std::unique_ptr<common::SQLiteStatementInterface> new_statement(const std::string& sql) = 0;
 };
 
@@ -217,6 +239,16 @@ private:
                              bool replace);
     OperationalStatusEnum get_availability(int32_t evse_id, int32_t connector_id);
 
+    // Local authorization list management (internal helpers)
+    common::LocalAuthorizationListIndex local_authorization_list_index;
+    std::vector<std::string> get_local_authorization_list_keys();
+
+    // Transaction metervalues (internal helpers)
+    /// \brief Reads the metervalues of \p transaction_id and their items with a single query, applying \p filter if
+    /// given
+    std::vector<MeterValue> transaction_metervalues_get(const std::string& transaction_id,
+                                                        const std::optional<utils::TxEndedMeterValueFilter>& filter);
+
 public:
     DatabaseHandler(std::unique_ptr<common::DatabaseConnectionInterface> database,
                     const fs::path& sql_migration_files_path);
@@ -256,6 +288,8 @@ public:
     // Transaction metervalues
     void transaction_metervalues_insert(const std::string& transaction_id, const MeterValue& meter_value) override;
     std::vector<MeterValue> transaction_metervalues_get_all(const std::string& transaction_id) override;
+    std::vector<MeterValue> transaction_metervalues_get_tx_ended(const std::string& transaction_id,
+                                                                 const utils::TxEndedMeterValueFilter& filter) override;
     void transaction_metervalues_clear(const std::string& transaction_id) override;
 
     // transactions
@@ -284,6 +318,10 @@ public:
     virtual std::map<int32_t, std::vector<v2::ChargingProfile>> get_all_charging_profiles_group_by_evse() override;
     ChargingLimitSourceEnum get_charging_limit_source_for_profile(const int profile_id) override;
 
+    void ocsp_refresh_state_insert_or_update(const std::string& certificate_key, const DateTime& next_refresh) override;
+    std::map<std::string, DateTime> ocsp_refresh_state_get_all() override;
+    void ocsp_refresh_state_delete(const std::string& certificate_key) override;
+
     std::unique_ptr<common::SQLiteStatementInterface> new_statement(const std::string& sql) override;
 };
 
@@ -5,6 +5,7 @@
 #define DEVICE_MODEL_HPP
 
 #include <type_traits>
+#include <variant>
 
 #include <everest/logging.hpp>
 
@@ -80,10 +81,19 @@ template <DataEnum T> bool is_type_numeric() {
     }
 }
 
+/// \brief Parsed value of a numeric variable. Values of integer variables are kept as 64 bit integers, so that they do
+/// not lose precision
+using NumericValue = std::variant<std::int64_t, double>;
+
+/// \brief Parses the given \p value of a variable of the given \p data_type
+/// \return the parsed value, or std::nullopt if the \p data_type is not numeric or \p value is not a valid number
+std::optional<NumericValue> parse_numeric_value(DataEnum data_type, const std::string& value);
+
 typedef std::function<void(const std::unordered_map<int64_t, VariableMonitoringMeta>& monitors,
                            const Component& component, const Variable& variable,
                            const VariableCharacteristics& characteristics, const VariableAttribute& attribute,
-                           const std::string& value_previous, const std::string& value_current)>
+                           const std::string& value_previous, const std::string& value_current,
+                           const std::optional<NumericValue>& value_current_numeric)>
     on_variable_changed;
 
 typedef std::function<void(const VariableMonitoringMeta& updated_monitor, const Component& component,
@@ -91,6 +101,8 @@ typedef std::function<void(const VariableMonitoringMeta& updated_monitor, const
                            const VariableAttribute& attribute, const std::string& current_value)>
     on_monitor_updated;
 
+typedef std::function<void(const int32_t monitor_id)> on_monitor_cleared;
+
 /// \brief This class manages access to the device model representation and to the device model interface and provides
 /// functionality to support the use cases defined in the functional block Provisioning
 class DeviceModel {
@@ -103,6 +115,8 @@ private:
     on_variable_changed variable_listener;
     /// \brief Listener for the internal update of a monitor
     on_monitor_updated monitor_update_listener;
+    /// \brief Listener for the removal of a monitor
+    on_monitor_cleared monitor_clear_listener;
 
     /// \brief Private helper method that does some checks with the device model representation in memory to evaluate if
     /// a value for the given parameters can be requested. If it can be requested it will be retrieved from the device
@@ -269,10 +283,17 @@ public:
         variable_listener = std::move(listener);
     }
 
+    /// \brief Registers a \p listener that is called whenever a monitor was successfully set, either because it was
+    /// newly added or because an existing monitor was updated
     void register_monitor_listener(on_monitor_updated&& listener) {
         monitor_update_listener = std::move(listener);
     }
 
+    /// \brief Registers a \p listener that is called for every monitor that was removed from the device model
+    void register_monitor_cleared_listener(on_monitor_cleared&& listener) {
+        monitor_clear_listener = std::move(listener);
+    }
+
     /// \brief Sets the given monitor \p requests in the device model
     /// \param request
     /// \param type The type of the set monitors. HardWiredMonitor - used for OEM specific monitors,
@@ -3,7 +3,13 @@
 
 #pragma once
 
+#include <cstring>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <ocpp/v2/message_handler.hpp>
+#include <ocpp/v2/utils.hpp>
 
 namespace ocpp::v2 {
 struct FunctionalBlockContext;
@@ -15,6 +21,24 @@ struct GetLocalListVersionRequest;
 
 class DatabaseHandlerInterface;
 
+using utils::IdTokenHashDigest;
+
+struct IdTokenHashDigestHash {
+    std::size_t operator()(const IdTokenHashDigest& digest) const {
+        // The digest is uniformly distributed already, so its first bytes are a sufficient hash
+        std::size_t hash;
+        std::memcpy(&hash, digest.data(), sizeof(hash));
+        return hash;
+    }
+};
+
+/// \brief Authorization cache entry that is held in memory in front of the database
+struct InMemoryAuthorizationCacheEntry {
+    IdTokenHashDigest digest;
+    IdTokenInfo id_token_info;
+    DateTime last_used;
+};
+
 class AuthorizationInterface : public MessageHandlerInterface {
 public:
     virtual ~AuthorizationInterface() {
@@ -53,6 +77,20 @@ private: // Members
     std::thread auth_cache_cleanup_thread;
     std::atomic_bool auth_cache_cleanup_handler_running;
 
+    // In memory authorization cache, the most recently used entry is at the front of the list
+    std::list<InMemoryAuthorizationCacheEntry> auth_cache_entries;
+    std::unordered_map<IdTokenHashDigest, std::list<InMemoryAuthorizationCacheEntry>::iterator, IdTokenHashDigestHash>
+        auth_cache_index;
+    /// \brief Digests of the entries of which the last used timestamp still needs to be written to the database
+    std::unordered_set<IdTokenHashDigest, IdTokenHashDigestHash> auth_cache_last_used_dirty;
+    /// \brief Incremented on every change of the cache, so that an entry read from the database is only added to the
+    /// in memory cache if the cache was not changed in the meantime
+    std::uint64_t auth_cache_generation;
+    /// \brief Protects the in memory cache. It is never held during database I/O, so lookups are not blocked by it
+    std::mutex auth_cache_mutex;
+    /// \brief Serializes the writes to the database with the corresponding updates of the in memory cache
+    std::mutex auth_cache_write_mutex;
+
 public:
     explicit Authorization(const FunctionalBlockContext& context);
     ~Authorization();
@@ -78,6 +116,26 @@ public:
 private: // Functions
     void stop_auth_cache_cleanup_thread();
 
+    std::optional<AuthorizationCacheEntry> authorization_cache_get_entry(const IdTokenHashDigest& digest);
+    void authorization_cache_insert_entry(const IdTokenHashDigest& digest, const IdTokenInfo& id_token_info);
+    void authorization_cache_delete_entry(const IdTokenHashDigest& digest);
+
+    /// \brief Marks the cache entry of \p digest as used. The entry is updated in memory and the last used timestamp
+    /// is written to the database by the cleanup thread every AUTH_CACHE_LAST_USED_FLUSH_INTERVAL
+    void authorization_cache_update_last_used(const IdTokenHashDigest& digest);
+    /// \brief Writes the last used timestamps of all dirty entries to the database
+    void authorization_cache_flush_last_used();
+
+    /// \brief Inserts or replaces the given entry in the in memory cache, evicting the least recently used entries if
+    /// the cache is full. Requires the auth_cache_mutex to be locked
+    void authorization_cache_memory_insert(const IdTokenHashDigest& digest, const IdTokenInfo& id_token_info,
+                                           const DateTime& last_used);
+    /// \brief Removes the entry with the given \p digest from the in memory cache. Requires the auth_cache_mutex to be
+    /// locked
+    void authorization_cache_memory_erase(const IdTokenHashDigest& digest);
+    /// \brief Removes all entries from the in memory cache. Requires the auth_cache_mutex to be locked
+    void authorization_cache_memory_clear();
+
     // Functional Block C: Authorization
     void handle_clear_cache_req(Call<ClearCacheRequest> call);
     void cache_cleanup_handler();
@@ -3,10 +3,15 @@
 
 #pragma once
 
+#include <map>
+#include <mutex>
+
 #include <ocpp/v2/message_handler.hpp>
 
 #include <ocpp/common/aligned_timer.hpp>
 #include <ocpp/v2/average_meter_values.hpp>
+#include <ocpp/v2/comparators.hpp>
+#include <ocpp/v2/utils.hpp>
 
 namespace ocpp::v2 {
 struct FunctionalBlockContext;
@@ -21,6 +26,12 @@ public:
     virtual void on_meter_value(const int32_t evse_id, const MeterValue& meter_value) = 0;
     virtual MeterValue get_latest_meter_value_filtered(const MeterValue& meter_value, ReadingContextEnum context,
                                                        const RequiredComponentVariable& component_variable) = 0;
+    /// \brief Gets the measurands configured in the given \p component_variable (e.g. AlignedDataMeasurands) as a
+    /// precompiled mask. The mask is cached and only rebuilt after update_measurand_filter was called for the variable.
+    virtual utils::MeasurandMask get_measurand_filter(const RequiredComponentVariable& component_variable) = 0;
+    /// \brief Should be called when the value of the given \p component_variable has changed, so a cached measurand
+    /// filter of this variable is rebuilt on next use
+    virtual void update_measurand_filter(const ComponentVariable& component_variable) = 0;
     // Functional Block J: MeterValues
     virtual void meter_values_req(const int32_t evse_id, const std::vector<MeterValue>& meter_values,
                                   const bool initiated_by_trigger_message = false) = 0;
@@ -35,6 +46,8 @@ public:
     void on_meter_value(const int32_t evse_id, const MeterValue& meter_value) override;
     MeterValue get_latest_meter_value_filtered(const MeterValue& meter_value, ReadingContextEnum context,
                                                const RequiredComponentVariable& component_variable) override;
+    utils::MeasurandMask get_measurand_filter(const RequiredComponentVariable& component_variable) override;
+    void update_measurand_filter(const ComponentVariable& component_variable) override;
 
     void meter_values_req(const int32_t evse_id, const std::vector<MeterValue>& meter_values,
                           const bool initiated_by_trigger_message = false) override;
@@ -45,6 +58,10 @@ private: // Members
     ClockAlignedTimer aligned_meter_values_timer;
     AverageMeterValues aligned_data_evse0; // represents evseId = 0 meter value
 
+    /// \brief Precompiled measurand filters per configured *Measurands variable
+    std::map<ComponentVariable, utils::MeasurandMask> measurand_filters;
+    std::mutex measurand_filters_mutex;
+
 private: // Functions
     // Internal helper functions
     void update_dm_evse_power(const int32_t evse_id, const MeterValue& meter_value);
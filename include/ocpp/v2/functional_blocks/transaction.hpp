@@ -11,6 +11,7 @@ class AuthorizationInterface;
 class AvailabilityInterface;
 class SmartChargingInterface;
 class TariffAndCostInterface;
+class MeterValuesInterface;
 
 struct GetTransactionStatusRequest;
 
@@ -82,8 +83,8 @@ public:
     TransactionBlock(const FunctionalBlockContext& functional_block_context,
                      MessageQueue<v2::MessageType>& message_queue, AuthorizationInterface& authorization,
                      AvailabilityInterface& availability, SmartChargingInterface& smart_charging,
-                     TariffAndCostInterface& tariff_and_cost, StopTransactionCallback stop_transaction_callback,
-                     PauseChargingCallback pause_charging_callback,
+                     TariffAndCostInterface& tariff_and_cost, MeterValuesInterface& meter_values,
+                     StopTransactionCallback stop_transaction_callback, PauseChargingCallback pause_charging_callback,
                      std::optional<TransactionEventCallback> transaction_event_callback,
                      std::optional<TransactionEventResponseCallback> transaction_event_response_callback,
                      ResetCallback reset_callback);
@@ -119,6 +120,7 @@ private: // Members
     AvailabilityInterface& availability;
     SmartChargingInterface& smart_charging;
     TariffAndCostInterface& tariff_and_cost;
+    MeterValuesInterface& meter_values;
     StopTransactionCallback stop_transaction_callback;
     PauseChargingCallback pause_charging_callback;
     std::optional<TransactionEventCallback> transaction_event_callback;
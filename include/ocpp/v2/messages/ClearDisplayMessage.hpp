@@ -31,6 +31,9 @@ void to_json(json& j, const ClearDisplayMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearDisplayMessageRequest \p k
 void from_json(const json& j, ClearDisplayMessageRequest& k);
 
+/// \brief Writes the given ClearDisplayMessageRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearDisplayMessageRequest& k);
+
 /// \brief Writes the string representation of the given ClearDisplayMessageRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageRequest& k);
@@ -52,6 +55,9 @@ void to_json(json& j, const ClearDisplayMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearDisplayMessageResponse \p k
 void from_json(const json& j, ClearDisplayMessageResponse& k);
 
+/// \brief Writes the given ClearDisplayMessageResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearDisplayMessageResponse& k);
+
 /// \brief Writes the string representation of the given ClearDisplayMessageResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageResponse& k);
@@ -31,6 +31,9 @@ void to_json(json& j, const ClearVariableMonitoringRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearVariableMonitoringRequest \p k
 void from_json(const json& j, ClearVariableMonitoringRequest& k);
 
+/// \brief Writes the given ClearVariableMonitoringRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearVariableMonitoringRequest& k);
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringRequest \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const ClearVariableMonitoringResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearVariableMonitoringResponse \p k
 void from_json(const json& j, ClearVariableMonitoringResponse& k);
 
+/// \brief Writes the given ClearVariableMonitoringResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearVariableMonitoringResponse& k);
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringResponse& k);
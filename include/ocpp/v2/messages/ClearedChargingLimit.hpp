@@ -32,6 +32,9 @@ void to_json(json& j, const ClearedChargingLimitRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearedChargingLimitRequest \p k
 void from_json(const json& j, ClearedChargingLimitRequest& k);
 
+/// \brief Writes the given ClearedChargingLimitRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearedChargingLimitRequest& k);
+
 /// \brief Writes the string representation of the given ClearedChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const ClearedChargingLimitResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearedChargingLimitResponse \p k
 void from_json(const json& j, ClearedChargingLimitResponse& k);
 
+/// \brief Writes the given ClearedChargingLimitResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearedChargingLimitResponse& k);
+
 /// \brief Writes the string representation of the given ClearedChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitResponse& k);
@@ -31,6 +31,9 @@ void to_json(json& j, const CostUpdatedRequest& k);
 /// \brief Conversion from a given json object \p j to a given CostUpdatedRequest \p k
 void from_json(const json& j, CostUpdatedRequest& k);
 
+/// \brief Writes the given CostUpdatedRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CostUpdatedRequest& k);
+
 /// \brief Writes the string representation of the given CostUpdatedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedRequest written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedRequest& k);
@@ -50,6 +53,9 @@ void to_json(json& j, const CostUpdatedResponse& k);
 /// \brief Conversion from a given json object \p j to a given CostUpdatedResponse \p k
 void from_json(const json& j, CostUpdatedResponse& k);
 
+/// \brief Writes the given CostUpdatedResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CostUpdatedResponse& k);
+
 /// \brief Writes the string representation of the given CostUpdatedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedResponse written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedResponse& k);
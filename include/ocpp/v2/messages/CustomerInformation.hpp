@@ -36,6 +36,9 @@ void to_json(json& j, const CustomerInformationRequest& k);
 /// \brief Conversion from a given json object \p j to a given CustomerInformationRequest \p k
 void from_json(const json& j, CustomerInformationRequest& k);
 
+/// \brief Writes the given CustomerInformationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CustomerInformationRequest& k);
+
 /// \brief Writes the string representation of the given CustomerInformationRequest \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationRequest& k);
@@ -57,6 +60,9 @@ void to_json(json& j, const CustomerInformationResponse& k);
 /// \brief Conversion from a given json object \p j to a given CustomerInformationResponse \p k
 void from_json(const json& j, CustomerInformationResponse& k);
 
+/// \brief Writes the given CustomerInformationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CustomerInformationResponse& k);
+
 /// \brief Writes the string representation of the given CustomerInformationResponse \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationResponse& k);
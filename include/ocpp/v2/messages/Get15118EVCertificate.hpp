@@ -34,6 +34,9 @@ void to_json(json& j, const Get15118EVCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given Get15118EVCertificateRequest \p k
 void from_json(const json& j, Get15118EVCertificateRequest& k);
 
+/// \brief Writes the given Get15118EVCertificateRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Get15118EVCertificateRequest& k);
+
 /// \brief Writes the string representation of the given Get15118EVCertificateRequest \p k to the given output stream \p
 /// os \returns an output stream with the Get15118EVCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateRequest& k);
@@ -56,6 +59,9 @@ void to_json(json& j, const Get15118EVCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given Get15118EVCertificateResponse \p k
 void from_json(const json& j, Get15118EVCertificateResponse& k);
 
+/// \brief Writes the given Get15118EVCertificateResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Get15118EVCertificateResponse& k);
+
 /// \brief Writes the string representation of the given Get15118EVCertificateResponse \p k to the given output stream
 /// \p os \returns an output stream with the Get15118EVCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateResponse& k);
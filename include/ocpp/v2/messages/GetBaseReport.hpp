@@ -32,6 +32,9 @@ void to_json(json& j, const GetBaseReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetBaseReportRequest \p k
 void from_json(const json& j, GetBaseReportRequest& k);
 
+/// \brief Writes the given GetBaseReportRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetBaseReportRequest& k);
+
 /// \brief Writes the string representation of the given GetBaseReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportRequest& k);
@@ -53,6 +56,9 @@ void to_json(json& j, const GetBaseReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetBaseReportResponse \p k
 void from_json(const json& j, GetBaseReportResponse& k);
 
+/// \brief Writes the given GetBaseReportResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetBaseReportResponse& k);
+
 /// \brief Writes the string representation of the given GetBaseReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportResponse& k);
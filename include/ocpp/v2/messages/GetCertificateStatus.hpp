@@ -31,6 +31,9 @@ void to_json(json& j, const GetCertificateStatusRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetCertificateStatusRequest \p k
 void from_json(const json& j, GetCertificateStatusRequest& k);
 
+/// \brief Writes the given GetCertificateStatusRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetCertificateStatusRequest& k);
+
 /// \brief Writes the string representation of the given GetCertificateStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusRequest& k);
@@ -53,6 +56,9 @@ void to_json(json& j, const GetCertificateStatusResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetCertificateStatusResponse \p k
 void from_json(const json& j, GetCertificateStatusResponse& k);
 
+/// \brief Writes the given GetCertificateStatusResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetCertificateStatusResponse& k);
+
 /// \brief Writes the string representation of the given GetCertificateStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusResponse& k);
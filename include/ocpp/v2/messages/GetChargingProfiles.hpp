@@ -33,6 +33,9 @@ void to_json(json& j, const GetChargingProfilesRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetChargingProfilesRequest \p k
 void from_json(const json& j, GetChargingProfilesRequest& k);
 
+/// \brief Writes the given GetChargingProfilesRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetChargingProfilesRequest& k);
+
 /// \brief Writes the string representation of the given GetChargingProfilesRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const GetChargingProfilesResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetChargingProfilesResponse \p k
 void from_json(const json& j, GetChargingProfilesResponse& k);
 
+/// \brief Writes the given GetChargingProfilesResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetChargingProfilesResponse& k);
+
 /// \brief Writes the string representation of the given GetChargingProfilesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesResponse& k);
@@ -34,6 +34,9 @@ void to_json(json& j, const GetDisplayMessagesRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetDisplayMessagesRequest \p k
 void from_json(const json& j, GetDisplayMessagesRequest& k);
 
+/// \brief Writes the given GetDisplayMessagesRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetDisplayMessagesRequest& k);
+
 /// \brief Writes the string representation of the given GetDisplayMessagesRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetDisplayMessagesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesRequest& k);
@@ -55,6 +58,9 @@ void to_json(json& j, const GetDisplayMessagesResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetDisplayMessagesResponse \p k
 void from_json(const json& j, GetDisplayMessagesResponse& k);
 
+/// \brief Writes the given GetDisplayMessagesResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetDisplayMessagesResponse& k);
+
 /// \brief Writes the string representation of the given GetDisplayMessagesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesResponse& k);
@@ -33,6 +33,9 @@ void to_json(json& j, const GetMonitoringReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetMonitoringReportRequest \p k
 void from_json(const json& j, GetMonitoringReportRequest& k);
 
+/// \brief Writes the given GetMonitoringReportRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetMonitoringReportRequest& k);
+
 /// \brief Writes the string representation of the given GetMonitoringReportRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const GetMonitoringReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetMonitoringReportResponse \p k
 void from_json(const json& j, GetMonitoringReportResponse& k);
 
+/// \brief Writes the given GetMonitoringReportResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetMonitoringReportResponse& k);
+
 /// \brief Writes the string representation of the given GetMonitoringReportResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportResponse& k);
@@ -33,6 +33,9 @@ void to_json(json& j, const GetReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetReportRequest \p k
 void from_json(const json& j, GetReportRequest& k);
 
+/// \brief Writes the given GetReportRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetReportRequest& k);
+
 /// \brief Writes the string representation of the given GetReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetReportRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const GetReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetReportResponse \p k
 void from_json(const json& j, GetReportResponse& k);
 
+/// \brief Writes the given GetReportResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetReportResponse& k);
+
 /// \brief Writes the string representation of the given GetReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetReportResponse& k);
@@ -30,6 +30,9 @@ void to_json(json& j, const GetTransactionStatusRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetTransactionStatusRequest \p k
 void from_json(const json& j, GetTransactionStatusRequest& k);
 
+/// \brief Writes the given GetTransactionStatusRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetTransactionStatusRequest& k);
+
 /// \brief Writes the string representation of the given GetTransactionStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const GetTransactionStatusResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetTransactionStatusResponse \p k
 void from_json(const json& j, GetTransactionStatusResponse& k);
 
+/// \brief Writes the given GetTransactionStatusResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetTransactionStatusResponse& k);
+
 /// \brief Writes the string representation of the given GetTransactionStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusResponse& k);
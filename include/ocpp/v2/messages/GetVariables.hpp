@@ -31,6 +31,9 @@ void to_json(json& j, const GetVariablesRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetVariablesRequest \p k
 void from_json(const json& j, GetVariablesRequest& k);
 
+/// \brief Writes the given GetVariablesRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetVariablesRequest& k);
+
 /// \brief Writes the string representation of the given GetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const GetVariablesResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetVariablesResponse \p k
 void from_json(const json& j, GetVariablesResponse& k);
 
+/// \brief Writes the given GetVariablesResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetVariablesResponse& k);
+
 /// \brief Writes the string representation of the given GetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesResponse& k);
@@ -33,6 +33,9 @@ void to_json(json& j, const NotifyChargingLimitRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyChargingLimitRequest \p k
 void from_json(const json& j, NotifyChargingLimitRequest& k);
 
+/// \brief Writes the given NotifyChargingLimitRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyChargingLimitRequest& k);
+
 /// \brief Writes the string representation of the given NotifyChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitRequest& k);
@@ -52,6 +55,9 @@ void to_json(json& j, const NotifyChargingLimitResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyChargingLimitResponse \p k
 void from_json(const json& j, NotifyChargingLimitResponse& k);
 
+/// \brief Writes the given NotifyChargingLimitResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyChargingLimitResponse& k);
+
 /// \brief Writes the string representation of the given NotifyChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitResponse& k);
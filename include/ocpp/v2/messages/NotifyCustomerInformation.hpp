@@ -34,6 +34,9 @@ void to_json(json& j, const NotifyCustomerInformationRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyCustomerInformationRequest \p k
 void from_json(const json& j, NotifyCustomerInformationRequest& k);
 
+/// \brief Writes the given NotifyCustomerInformationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyCustomerInformationRequest& k);
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationRequest \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationRequest& k);
@@ -53,6 +56,9 @@ void to_json(json& j, const NotifyCustomerInformationResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyCustomerInformationResponse \p k
 void from_json(const json& j, NotifyCustomerInformationResponse& k);
 
+/// \brief Writes the given NotifyCustomerInformationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyCustomerInformationResponse& k);
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationResponse& k);
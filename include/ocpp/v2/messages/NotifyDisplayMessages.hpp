@@ -33,6 +33,9 @@ void to_json(json& j, const NotifyDisplayMessagesRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyDisplayMessagesRequest \p k
 void from_json(const json& j, NotifyDisplayMessagesRequest& k);
 
+/// \brief Writes the given NotifyDisplayMessagesRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesRequest& k);
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyDisplayMessagesRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesRequest& k);
@@ -52,6 +55,9 @@ void to_json(json& j, const NotifyDisplayMessagesResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyDisplayMessagesResponse \p k
 void from_json(const json& j, NotifyDisplayMessagesResponse& k);
 
+/// \brief Writes the given NotifyDisplayMessagesResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesResponse& k);
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesResponse& k);
@@ -33,6 +33,9 @@ void to_json(json& j, const NotifyEVChargingNeedsRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingNeedsRequest \p k
 void from_json(const json& j, NotifyEVChargingNeedsRequest& k);
 
+/// \brief Writes the given NotifyEVChargingNeedsRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsRequest& k);
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyEVChargingNeedsRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const NotifyEVChargingNeedsResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingNeedsResponse \p k
 void from_json(const json& j, NotifyEVChargingNeedsResponse& k);
 
+/// \brief Writes the given NotifyEVChargingNeedsResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsResponse& k);
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingNeedsResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsResponse& k);
@@ -33,6 +33,9 @@ void to_json(json& j, const NotifyEVChargingScheduleRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingScheduleRequest \p k
 void from_json(const json& j, NotifyEVChargingScheduleRequest& k);
 
+/// \brief Writes the given NotifyEVChargingScheduleRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleRequest& k);
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const NotifyEVChargingScheduleResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingScheduleResponse \p k
 void from_json(const json& j, NotifyEVChargingScheduleResponse& k);
 
+/// \brief Writes the given NotifyEVChargingScheduleResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleResponse& k);
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyEVChargingScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleResponse& k);
@@ -34,6 +34,9 @@ void to_json(json& j, const NotifyEventRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEventRequest \p k
 void from_json(const json& j, NotifyEventRequest& k);
 
+/// \brief Writes the given NotifyEventRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEventRequest& k);
+
 /// \brief Writes the string representation of the given NotifyEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventRequest& k);
@@ -53,6 +56,9 @@ void to_json(json& j, const NotifyEventResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEventResponse \p k
 void from_json(const json& j, NotifyEventResponse& k);
 
+/// \brief Writes the given NotifyEventResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyEventResponse& k);
+
 /// \brief Writes the string representation of the given NotifyEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventResponse& k);
@@ -35,6 +35,9 @@ void to_json(json& j, const NotifyMonitoringReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyMonitoringReportRequest \p k
 void from_json(const json& j, NotifyMonitoringReportRequest& k);
 
+/// \brief Writes the given NotifyMonitoringReportRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyMonitoringReportRequest& k);
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const NotifyMonitoringReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyMonitoringReportResponse \p k
 void from_json(const json& j, NotifyMonitoringReportResponse& k);
 
+/// \brief Writes the given NotifyMonitoringReportResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyMonitoringReportResponse& k);
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportResponse& k);
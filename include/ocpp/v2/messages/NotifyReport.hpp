@@ -35,6 +35,9 @@ void to_json(json& j, const NotifyReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyReportRequest \p k
 void from_json(const json& j, NotifyReportRequest& k);
 
+/// \brief Writes the given NotifyReportRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyReportRequest& k);
+
 /// \brief Writes the string representation of the given NotifyReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const NotifyReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyReportResponse \p k
 void from_json(const json& j, NotifyReportResponse& k);
 
+/// \brief Writes the given NotifyReportResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NotifyReportResponse& k);
+
 /// \brief Writes the string representation of the given NotifyReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportResponse& k);
@@ -35,6 +35,9 @@ void to_json(json& j, const PublishFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareRequest \p k
 void from_json(const json& j, PublishFirmwareRequest& k);
 
+/// \brief Writes the given PublishFirmwareRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const PublishFirmwareRequest& k);
+
 /// \brief Writes the string representation of the given PublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareRequest& k);
@@ -56,6 +59,9 @@ void to_json(json& j, const PublishFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareResponse \p k
 void from_json(const json& j, PublishFirmwareResponse& k);
 
+/// \brief Writes the given PublishFirmwareResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const PublishFirmwareResponse& k);
+
 /// \brief Writes the string representation of the given PublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareResponse& k);
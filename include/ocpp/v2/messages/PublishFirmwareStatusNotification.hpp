@@ -33,6 +33,9 @@ void to_json(json& j, const PublishFirmwareStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareStatusNotificationRequest \p k
 void from_json(const json& j, PublishFirmwareStatusNotificationRequest& k);
 
+/// \brief Writes the given PublishFirmwareStatusNotificationRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationRequest \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationRequest& k);
@@ -52,6 +55,9 @@ void to_json(json& j, const PublishFirmwareStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareStatusNotificationResponse \p k
 void from_json(const json& j, PublishFirmwareStatusNotificationResponse& k);
 
+/// \brief Writes the given PublishFirmwareStatusNotificationResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationResponse \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationResponse& k);
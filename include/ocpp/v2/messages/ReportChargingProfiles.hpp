@@ -35,6 +35,9 @@ void to_json(json& j, const ReportChargingProfilesRequest& k);
 /// \brief Conversion from a given json object \p j to a given ReportChargingProfilesRequest \p k
 void from_json(const json& j, ReportChargingProfilesRequest& k);
 
+/// \brief Writes the given ReportChargingProfilesRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ReportChargingProfilesRequest& k);
+
 /// \brief Writes the string representation of the given ReportChargingProfilesRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesRequest& k);
@@ -54,6 +57,9 @@ void to_json(json& j, const ReportChargingProfilesResponse& k);
 /// \brief Conversion from a given json object \p j to a given ReportChargingProfilesResponse \p k
 void from_json(const json& j, ReportChargingProfilesResponse& k);
 
+/// \brief Writes the given ReportChargingProfilesResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ReportChargingProfilesResponse& k);
+
 /// \brief Writes the string representation of the given ReportChargingProfilesResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesResponse& k);
@@ -35,6 +35,9 @@ void to_json(json& j, const RequestStartTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RequestStartTransactionRequest \p k
 void from_json(const json& j, RequestStartTransactionRequest& k);
 
+/// \brief Writes the given RequestStartTransactionRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const RequestStartTransactionRequest& k);
+
 /// \brief Writes the string representation of the given RequestStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionRequest& k);
@@ -57,6 +60,9 @@ void to_json(json& j, const RequestStartTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RequestStartTransactionResponse \p k
 void from_json(const json& j, RequestStartTransactionResponse& k);
 
+/// \brief Writes the given RequestStartTransactionResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const RequestStartTransactionResponse& k);
+
 /// \brief Writes the string representation of the given RequestStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionResponse& k);
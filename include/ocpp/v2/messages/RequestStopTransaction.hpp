@@ -31,6 +31,9 @@ void to_json(json& j, const RequestStopTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RequestStopTransactionRequest \p k
 void from_json(const json& j, RequestStopTransactionRequest& k);
 
+/// \brief Writes the given RequestStopTransactionRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const RequestStopTransactionRequest& k);
+
 /// \brief Writes the string representation of the given RequestStopTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionRequest& k);
@@ -52,6 +55,9 @@ void to_json(json& j, const RequestStopTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RequestStopTransactionResponse \p k
 void from_json(const json& j, RequestStopTransactionResponse& k);
 
+/// \brief Writes the given RequestStopTransactionResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const RequestStopTransactionResponse& k);
+
 /// \brief Writes the string representation of the given RequestStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionResponse& k);
@@ -32,6 +32,9 @@ void to_json(json& j, const ReservationStatusUpdateRequest& k);
 /// \brief Conversion from a given json object \p j to a given ReservationStatusUpdateRequest \p k
 void from_json(const json& j, ReservationStatusUpdateRequest& k);
 
+/// \brief Writes the given ReservationStatusUpdateRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ReservationStatusUpdateRequest& k);
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateRequest written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const ReservationStatusUpdateResponse& k);
 /// \brief Conversion from a given json object \p j to a given ReservationStatusUpdateResponse \p k
 void from_json(const json& j, ReservationStatusUpdateResponse& k);
 
+/// \brief Writes the given ReservationStatusUpdateResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ReservationStatusUpdateResponse& k);
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateResponse written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateResponse& k);
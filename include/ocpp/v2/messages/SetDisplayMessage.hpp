@@ -31,6 +31,9 @@ void to_json(json& j, const SetDisplayMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetDisplayMessageRequest \p k
 void from_json(const json& j, SetDisplayMessageRequest& k);
 
+/// \brief Writes the given SetDisplayMessageRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetDisplayMessageRequest& k);
+
 /// \brief Writes the string representation of the given SetDisplayMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageRequest& k);
@@ -52,6 +55,9 @@ void to_json(json& j, const SetDisplayMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetDisplayMessageResponse \p k
 void from_json(const json& j, SetDisplayMessageResponse& k);
 
+/// \brief Writes the given SetDisplayMessageResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetDisplayMessageResponse& k);
+
 /// \brief Writes the string representation of the given SetDisplayMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageResponse& k);
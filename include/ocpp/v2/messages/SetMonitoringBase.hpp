@@ -31,6 +31,9 @@ void to_json(json& j, const SetMonitoringBaseRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringBaseRequest \p k
 void from_json(const json& j, SetMonitoringBaseRequest& k);
 
+/// \brief Writes the given SetMonitoringBaseRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringBaseRequest& k);
+
 /// \brief Writes the string representation of the given SetMonitoringBaseRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseRequest& k);
@@ -52,6 +55,9 @@ void to_json(json& j, const SetMonitoringBaseResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringBaseResponse \p k
 void from_json(const json& j, SetMonitoringBaseResponse& k);
 
+/// \brief Writes the given SetMonitoringBaseResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringBaseResponse& k);
+
 /// \brief Writes the string representation of the given SetMonitoringBaseResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseResponse& k);
@@ -31,6 +31,9 @@ void to_json(json& j, const SetMonitoringLevelRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringLevelRequest \p k
 void from_json(const json& j, SetMonitoringLevelRequest& k);
 
+/// \brief Writes the given SetMonitoringLevelRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringLevelRequest& k);
+
 /// \brief Writes the string representation of the given SetMonitoringLevelRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringLevelRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelRequest& k);
@@ -52,6 +55,9 @@ void to_json(json& j, const SetMonitoringLevelResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringLevelResponse \p k
 void from_json(const json& j, SetMonitoringLevelResponse& k);
 
+/// \brief Writes the given SetMonitoringLevelResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringLevelResponse& k);
+
 /// \brief Writes the string representation of the given SetMonitoringLevelResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetMonitoringLevelResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelResponse& k);
@@ -32,6 +32,9 @@ void to_json(json& j, const SetNetworkProfileRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetNetworkProfileRequest \p k
 void from_json(const json& j, SetNetworkProfileRequest& k);
 
+/// \brief Writes the given SetNetworkProfileRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetNetworkProfileRequest& k);
+
 /// \brief Writes the string representation of the given SetNetworkProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileRequest& k);
@@ -53,6 +56,9 @@ void to_json(json& j, const SetNetworkProfileResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetNetworkProfileResponse \p k
 void from_json(const json& j, SetNetworkProfileResponse& k);
 
+/// \brief Writes the given SetNetworkProfileResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetNetworkProfileResponse& k);
+
 /// \brief Writes the string representation of the given SetNetworkProfileResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileResponse& k);
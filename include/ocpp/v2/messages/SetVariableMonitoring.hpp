@@ -31,6 +31,9 @@ void to_json(json& j, const SetVariableMonitoringRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableMonitoringRequest \p k
 void from_json(const json& j, SetVariableMonitoringRequest& k);
 
+/// \brief Writes the given SetVariableMonitoringRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableMonitoringRequest& k);
+
 /// \brief Writes the string representation of the given SetVariableMonitoringRequest \p k to the given output stream \p
 /// os \returns an output stream with the SetVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const SetVariableMonitoringResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableMonitoringResponse \p k
 void from_json(const json& j, SetVariableMonitoringResponse& k);
 
+/// \brief Writes the given SetVariableMonitoringResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableMonitoringResponse& k);
+
 /// \brief Writes the string representation of the given SetVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the SetVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringResponse& k);
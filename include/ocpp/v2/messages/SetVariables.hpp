@@ -31,6 +31,9 @@ void to_json(json& j, const SetVariablesRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetVariablesRequest \p k
 void from_json(const json& j, SetVariablesRequest& k);
 
+/// \brief Writes the given SetVariablesRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetVariablesRequest& k);
+
 /// \brief Writes the string representation of the given SetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const SetVariablesResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetVariablesResponse \p k
 void from_json(const json& j, SetVariablesResponse& k);
 
+/// \brief Writes the given SetVariablesResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetVariablesResponse& k);
+
 /// \brief Writes the string representation of the given SetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesResponse& k);
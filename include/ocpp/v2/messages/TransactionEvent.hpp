@@ -42,6 +42,9 @@ void to_json(json& j, const TransactionEventRequest& k);
 /// \brief Conversion from a given json object \p j to a given TransactionEventRequest \p k
 void from_json(const json& j, TransactionEventRequest& k);
 
+/// \brief Writes the given TransactionEventRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const TransactionEventRequest& k);
+
 /// \brief Writes the string representation of the given TransactionEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventRequest written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventRequest& k);
@@ -65,6 +68,9 @@ void to_json(json& j, const TransactionEventResponse& k);
 /// \brief Conversion from a given json object \p j to a given TransactionEventResponse \p k
 void from_json(const json& j, TransactionEventResponse& k);
 
+/// \brief Writes the given TransactionEventResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const TransactionEventResponse& k);
+
 /// \brief Writes the string representation of the given TransactionEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventResponse written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventResponse& k);
@@ -31,6 +31,9 @@ void to_json(json& j, const UnpublishFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given UnpublishFirmwareRequest \p k
 void from_json(const json& j, UnpublishFirmwareRequest& k);
 
+/// \brief Writes the given UnpublishFirmwareRequest \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const UnpublishFirmwareRequest& k);
+
 /// \brief Writes the string representation of the given UnpublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareRequest& k);
@@ -51,6 +54,9 @@ void to_json(json& j, const UnpublishFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given UnpublishFirmwareResponse \p k
 void from_json(const json& j, UnpublishFirmwareResponse& k);
 
+/// \brief Writes the given UnpublishFirmwareResponse \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const UnpublishFirmwareResponse& k);
+
 /// \brief Writes the string representation of the given UnpublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareResponse& k);
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <mutex>
+#include <queue>
+#include <set>
 #include <unordered_map>
 
 #include <everest/timer.hpp>
@@ -11,12 +14,10 @@
 #include <ocpp/v2/ocpp_enums.hpp>
 #include <ocpp/v2/ocpp_types.hpp>
 
-#include <ocpp/v2/device_model_storage_interface.hpp>
+#include <ocpp/v2/device_model.hpp>
 
 namespace ocpp::v2 {
 
-class DeviceModel;
-
 enum UpdateMonitorMetaType {
     TRIGGER,
     PERIODIC
@@ -50,6 +51,28 @@ struct PeriodicMetadata {
     /// \brief Next time when we require to trigger a clock aligned value. Has meaning
     /// only for periodic monitors
     std::chrono::time_point<std::chrono::system_clock> next_trigger_clock_aligned;
+
+    /// \brief Time at which this monitor is scheduled to be processed next, used as
+    /// key in the periodic monitor schedule
+    std::chrono::time_point<std::chrono::steady_clock> next_trigger_steady;
+};
+
+/// \brief Entry of the periodic monitor schedule
+struct PeriodicMonitorScheduleEntry {
+    std::chrono::time_point<std::chrono::steady_clock> next_trigger;
+    std::int32_t monitor_id;
+
+    bool operator>(const PeriodicMonitorScheduleEntry& other) const {
+        return next_trigger > other.next_trigger;
+    }
+};
+
+/// \brief Parsed reference value of a delta monitor
+struct DeltaMonitorReference {
+    /// \brief Reference value as stored in the device model, used to detect changes
+    std::string reference_value;
+    /// \brief Numeric representation of the reference value
+    NumericValue value;
 };
 
 /// \brief Meta data required for our internal keeping needs
@@ -122,6 +145,9 @@ public:
     void process_triggered_monitors();
 
 private:
+    /// \brief The unit tests process the monitors and inspect the periodic monitor schedule
+    friend class MonitoringUpdaterTest;
+
     /// \brief Callback that is registered to the 'device_model' that determines if any of
     /// the monitors are triggered for a certain variable when the internal value is used. Will
     /// delay the sending of the monitors to the CSMS until the charging station has
@@ -132,28 +158,47 @@ private:
     void on_variable_changed(const std::unordered_map<int64_t, VariableMonitoringMeta>& monitors,
                              const Component& component, const Variable& variable,
                              const VariableCharacteristics& characteristics, const VariableAttribute& attribute,
-                             const std::string& value_old, const std::string& value_current);
+                             const std::string& value_old, const std::string& value_current,
+                             const std::optional<NumericValue>& value_current_numeric);
 
-    /// \brief Callback that is registered to the 'device_model' that determines if any of
-    /// the already existing monitors were updated. It is required for some spec requirements
-    /// that must refresh monitor data in the case of a monitor update
+    /// \brief Callback that is registered to the 'device_model' that is called when a monitor was
+    /// added or updated. It is required for some spec requirements that must refresh monitor data
+    /// in the case of a monitor update and keeps the periodic monitor schedule up to date
     void on_monitor_updated(const VariableMonitoringMeta& updated_monitor, const Component& component,
                             const Variable& variable, const VariableCharacteristics& characteristics,
                             const VariableAttribute& attribute, const std::string& current_value);
 
+    /// \brief Callback that is registered to the 'device_model' that is called when a monitor was
+    /// removed, so that it is removed from the periodic monitor schedule
+    void on_monitor_cleared(const std::int32_t monitor_id);
+
     /// \brief Evaluates if an monitor was triggered, and if it is triggered
-    /// it adds it to our internal list
+    /// it adds it to our internal list. For numeric variables \p value_current_numeric
+    /// holds the already parsed \p value_current
     void evaluate_monitor(const VariableMonitoringMeta& monitor_meta, const Component& component,
                           const Variable& variable, const VariableCharacteristics& characteristics,
                           const VariableAttribute& attribute, const std::string& value_previous,
-                          const std::string& value_current);
+                          const std::string& value_current, const std::optional<NumericValue>& value_current_numeric);
 
-    /// \brief Processes the periodic monitors. Since this can be somewhat of a costly
-    /// operation (DB query of each triggered monitor's actual value) the processing time
-    /// can be configured using the 'VariableMonitoringProcessTime' internal variable. If
-    // there are also any pending alert triggered monitors, those will be processed too
+    /// \brief Returns the numeric reference value of the delta \p monitor_meta of a variable with the given
+    /// \p data_type. The parsed value is cached and only parsed again when the reference value changes
+    std::optional<NumericValue> get_delta_reference(const VariableMonitoringMeta& monitor_meta, DataEnum data_type);
+
+    /// \brief Processes the periodic monitors that are due and the pending alert triggered
+    /// monitors. Since this can be somewhat of a costly operation (DB query of each triggered
+    /// monitor's actual value) the processing time can be configured using the
+    /// 'VariableMonitoringProcessTime' internal variable
     void process_monitors_internal(bool allow_periodics, bool allow_trigger);
 
+    /// \brief Pops all due monitors from the periodic monitor schedule and processes them,
+    /// together with the periodic monitors that still have events pending from an offline period
+    void process_periodic_monitors_internal(bool is_offline, int offline_severity, int active_monitoring_level,
+                                            MonitoringBaseEnum active_monitoring_base);
+
+    /// \brief Processes all alert triggered monitors
+    void process_trigger_monitors_internal(bool is_offline, int offline_severity, int active_monitoring_level,
+                                           MonitoringBaseEnum active_monitoring_base);
+
     /// \brief Processes the monitor meta, generating in it's internal list all the
     /// required events. It will generate the EventData for a notify regardless
     /// of the offline state
@@ -164,9 +209,19 @@ private:
     /// monitor meta data. That implies various checks for various states
     bool should_remove_monitor_meta_internal(const UpdaterMonitorMeta& updater_meta_data);
 
-    /// \brief Query the database (from in-memory data for fast retrieval)
-    /// and updates our internal monitors with the new database data
-    void update_periodic_monitors_internal();
+    /// \brief Query the database (from in-memory data for fast retrieval) and rebuilds
+    /// the periodic monitor schedule. Only required when the monitoring starts, afterwards
+    /// the schedule is updated incrementally by the monitor listeners
+    void rebuild_periodic_monitors_internal();
+
+    /// \brief Adds the given periodic \p monitor_meta to the schedule, or refreshes it if it
+    /// is already scheduled
+    void add_periodic_monitor_internal(const VariableMonitoringMeta& monitor_meta, const Component& component,
+                                       const Variable& variable);
+
+    /// \brief Computes the next trigger time of the given periodic \p updater_meta_data and
+    /// pushes it to the periodic monitor schedule
+    void schedule_periodic_monitor_internal(UpdaterMonitorMeta& updater_meta_data);
 
     void get_monitoring_info(bool& out_is_offline, int& out_offline_severity, int& out_active_monitoring_level,
                              MonitoringBaseEnum& out_active_monitoring_base);
@@ -183,7 +238,23 @@ private:
     notify_events notify_csms_events;
     is_offline is_chargepoint_offline;
 
+    /// \brief Alert triggered monitors that are waiting to be processed
     std::unordered_map<std::int32_t, UpdaterMonitorMeta> updater_monitors_meta;
+
+    /// \brief Parsed reference values of numeric delta monitors. Guarded by its own mutex, since it is used by the
+    /// variable listener as well as by the monitor listeners
+    std::unordered_map<std::int32_t, DeltaMonitorReference> delta_references;
+    std::mutex delta_references_mutex;
+
+    /// \brief All periodic monitors of the device model
+    std::unordered_map<std::int32_t, UpdaterMonitorMeta> periodic_monitors_meta;
+    /// \brief Periodic monitors ordered by their next trigger time. Entries of monitors that were
+    /// removed or rescheduled in the meantime are skipped when they are popped
+    std::priority_queue<PeriodicMonitorScheduleEntry, std::vector<PeriodicMonitorScheduleEntry>, std::greater<>>
+        periodic_monitors_schedule;
+    /// \brief Periodic monitors that have generated events that could not be sent yet
+    std::set<std::int32_t> periodic_monitors_pending;
+    std::mutex periodic_monitors_mutex;
 };
 
 } // namespace ocpp::v2
@@ -10,6 +10,7 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v2/ocpp_enums.hpp>
 
@@ -29,6 +30,9 @@ void to_json(json& j, const AdditionalInfo& k);
 /// \brief Conversion from a given json object \p j to a given AdditionalInfo \p k
 void from_json(const json& j, AdditionalInfo& k);
 
+/// \brief Writes the given AdditionalInfo \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const AdditionalInfo& k);
+
 // \brief Writes the string representation of the given AdditionalInfo \p k to the given output stream \p os
 /// \returns an output stream with the AdditionalInfo written to
 std::ostream& operator<<(std::ostream& os, const AdditionalInfo& k);
@@ -45,6 +49,9 @@ void to_json(json& j, const IdToken& k);
 /// \brief Conversion from a given json object \p j to a given IdToken \p k
 void from_json(const json& j, IdToken& k);
 
+/// \brief Writes the given IdToken \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const IdToken& k);
+
 // \brief Writes the string representation of the given IdToken \p k to the given output stream \p os
 /// \returns an output stream with the IdToken written to
 std::ostream& operator<<(std::ostream& os, const IdToken& k);
@@ -63,6 +70,9 @@ void to_json(json& j, const OCSPRequestData& k);
 /// \brief Conversion from a given json object \p j to a given OCSPRequestData \p k
 void from_json(const json& j, OCSPRequestData& k);
 
+/// \brief Writes the given OCSPRequestData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const OCSPRequestData& k);
+
 // \brief Writes the string representation of the given OCSPRequestData \p k to the given output stream \p os
 /// \returns an output stream with the OCSPRequestData written to
 std::ostream& operator<<(std::ostream& os, const OCSPRequestData& k);
@@ -79,6 +89,9 @@ void to_json(json& j, const MessageContent& k);
 /// \brief Conversion from a given json object \p j to a given MessageContent \p k
 void from_json(const json& j, MessageContent& k);
 
+/// \brief Writes the given MessageContent \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MessageContent& k);
+
 // \brief Writes the string representation of the given MessageContent \p k to the given output stream \p os
 /// \returns an output stream with the MessageContent written to
 std::ostream& operator<<(std::ostream& os, const MessageContent& k);
@@ -100,6 +113,9 @@ void to_json(json& j, const IdTokenInfo& k);
 /// \brief Conversion from a given json object \p j to a given IdTokenInfo \p k
 void from_json(const json& j, IdTokenInfo& k);
 
+/// \brief Writes the given IdTokenInfo \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const IdTokenInfo& k);
+
 // \brief Writes the string representation of the given IdTokenInfo \p k to the given output stream \p os
 /// \returns an output stream with the IdTokenInfo written to
 std::ostream& operator<<(std::ostream& os, const IdTokenInfo& k);
@@ -115,6 +131,9 @@ void to_json(json& j, const Modem& k);
 /// \brief Conversion from a given json object \p j to a given Modem \p k
 void from_json(const json& j, Modem& k);
 
+/// \brief Writes the given Modem \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Modem& k);
+
 // \brief Writes the string representation of the given Modem \p k to the given output stream \p os
 /// \returns an output stream with the Modem written to
 std::ostream& operator<<(std::ostream& os, const Modem& k);
@@ -133,6 +152,9 @@ void to_json(json& j, const ChargingStation& k);
 /// \brief Conversion from a given json object \p j to a given ChargingStation \p k
 void from_json(const json& j, ChargingStation& k);
 
+/// \brief Writes the given ChargingStation \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingStation& k);
+
 // \brief Writes the string representation of the given ChargingStation \p k to the given output stream \p os
 /// \returns an output stream with the ChargingStation written to
 std::ostream& operator<<(std::ostream& os, const ChargingStation& k);
@@ -148,6 +170,9 @@ void to_json(json& j, const StatusInfo& k);
 /// \brief Conversion from a given json object \p j to a given StatusInfo \p k
 void from_json(const json& j, StatusInfo& k);
 
+/// \brief Writes the given StatusInfo \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const StatusInfo& k);
+
 // \brief Writes the string representation of the given StatusInfo \p k to the given output stream \p os
 /// \returns an output stream with the StatusInfo written to
 std::ostream& operator<<(std::ostream& os, const StatusInfo& k);
@@ -163,6 +188,9 @@ void to_json(json& j, const EVSE& k);
 /// \brief Conversion from a given json object \p j to a given EVSE \p k
 void from_json(const json& j, EVSE& k);
 
+/// \brief Writes the given EVSE \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const EVSE& k);
+
 // \brief Writes the string representation of the given EVSE \p k to the given output stream \p os
 /// \returns an output stream with the EVSE written to
 std::ostream& operator<<(std::ostream& os, const EVSE& k);
@@ -179,6 +207,9 @@ void to_json(json& j, const ClearChargingProfile& k);
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfile \p k
 void from_json(const json& j, ClearChargingProfile& k);
 
+/// \brief Writes the given ClearChargingProfile \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearChargingProfile& k);
+
 // \brief Writes the string representation of the given ClearChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ClearChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfile& k);
@@ -195,6 +226,9 @@ void to_json(json& j, const ClearMonitoringResult& k);
 /// \brief Conversion from a given json object \p j to a given ClearMonitoringResult \p k
 void from_json(const json& j, ClearMonitoringResult& k);
 
+/// \brief Writes the given ClearMonitoringResult \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearMonitoringResult& k);
+
 // \brief Writes the string representation of the given ClearMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the ClearMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const ClearMonitoringResult& k);
@@ -212,6 +246,9 @@ void to_json(json& j, const CertificateHashDataType& k);
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k);
 
+/// \brief Writes the given CertificateHashDataType \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataType& k);
+
 // \brief Writes the string representation of the given CertificateHashDataType \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataType written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataType& k);
@@ -229,6 +266,9 @@ void to_json(json& j, const ChargingProfileCriterion& k);
 /// \brief Conversion from a given json object \p j to a given ChargingProfileCriterion \p k
 void from_json(const json& j, ChargingProfileCriterion& k);
 
+/// \brief Writes the given ChargingProfileCriterion \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfileCriterion& k);
+
 // \brief Writes the string representation of the given ChargingProfileCriterion \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfileCriterion written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfileCriterion& k);
@@ -246,6 +286,9 @@ void to_json(json& j, const ChargingSchedulePeriod& k);
 /// \brief Conversion from a given json object \p j to a given ChargingSchedulePeriod \p k
 void from_json(const json& j, ChargingSchedulePeriod& k);
 
+/// \brief Writes the given ChargingSchedulePeriod \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k);
+
 // \brief Writes the string representation of the given ChargingSchedulePeriod \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedulePeriod written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedulePeriod& k);
@@ -264,6 +307,9 @@ void to_json(json& j, const CompositeSchedule& k);
 /// \brief Conversion from a given json object \p j to a given CompositeSchedule \p k
 void from_json(const json& j, CompositeSchedule& k);
 
+/// \brief Writes the given CompositeSchedule \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CompositeSchedule& k);
+
 // \brief Writes the string representation of the given CompositeSchedule \p k to the given output stream \p os
 /// \returns an output stream with the CompositeSchedule written to
 std::ostream& operator<<(std::ostream& os, const CompositeSchedule& k);
@@ -280,6 +326,9 @@ void to_json(json& j, const CertificateHashDataChain& k);
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataChain \p k
 void from_json(const json& j, CertificateHashDataChain& k);
 
+/// \brief Writes the given CertificateHashDataChain \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataChain& k);
+
 // \brief Writes the string representation of the given CertificateHashDataChain \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataChain written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataChain& k);
@@ -296,6 +345,9 @@ void to_json(json& j, const LogParameters& k);
 /// \brief Conversion from a given json object \p j to a given LogParameters \p k
 void from_json(const json& j, LogParameters& k);
 
+/// \brief Writes the given LogParameters \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const LogParameters& k);
+
 // \brief Writes the string representation of the given LogParameters \p k to the given output stream \p os
 /// \returns an output stream with the LogParameters written to
 std::ostream& operator<<(std::ostream& os, const LogParameters& k);
@@ -312,6 +364,9 @@ void to_json(json& j, const Component& k);
 /// \brief Conversion from a given json object \p j to a given Component \p k
 void from_json(const json& j, Component& k);
 
+/// \brief Writes the given Component \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Component& k);
+
 // \brief Writes the string representation of the given Component \p k to the given output stream \p os
 /// \returns an output stream with the Component written to
 std::ostream& operator<<(std::ostream& os, const Component& k);
@@ -327,6 +382,9 @@ void to_json(json& j, const Variable& k);
 /// \brief Conversion from a given json object \p j to a given Variable \p k
 void from_json(const json& j, Variable& k);
 
+/// \brief Writes the given Variable \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Variable& k);
+
 // \brief Writes the string representation of the given Variable \p k to the given output stream \p os
 /// \returns an output stream with the Variable written to
 std::ostream& operator<<(std::ostream& os, const Variable& k);
@@ -342,6 +400,9 @@ void to_json(json& j, const ComponentVariable& k);
 /// \brief Conversion from a given json object \p j to a given ComponentVariable \p k
 void from_json(const json& j, ComponentVariable& k);
 
+/// \brief Writes the given ComponentVariable \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ComponentVariable& k);
+
 // \brief Writes the string representation of the given ComponentVariable \p k to the given output stream \p os
 /// \returns an output stream with the ComponentVariable written to
 std::ostream& operator<<(std::ostream& os, const ComponentVariable& k);
@@ -358,6 +419,9 @@ void to_json(json& j, const GetVariableData& k);
 /// \brief Conversion from a given json object \p j to a given GetVariableData \p k
 void from_json(const json& j, GetVariableData& k);
 
+/// \brief Writes the given GetVariableData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetVariableData& k);
+
 // \brief Writes the string representation of the given GetVariableData \p k to the given output stream \p os
 /// \returns an output stream with the GetVariableData written to
 std::ostream& operator<<(std::ostream& os, const GetVariableData& k);
@@ -377,6 +441,9 @@ void to_json(json& j, const GetVariableResult& k);
 /// \brief Conversion from a given json object \p j to a given GetVariableResult \p k
 void from_json(const json& j, GetVariableResult& k);
 
+/// \brief Writes the given GetVariableResult \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetVariableResult& k);
+
 // \brief Writes the string representation of the given GetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the GetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const GetVariableResult& k);
@@ -394,6 +461,9 @@ void to_json(json& j, const SignedMeterValue& k);
 /// \brief Conversion from a given json object \p j to a given SignedMeterValue \p k
 void from_json(const json& j, SignedMeterValue& k);
 
+/// \brief Writes the given SignedMeterValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SignedMeterValue& k);
+
 // \brief Writes the string representation of the given SignedMeterValue \p k to the given output stream \p os
 /// \returns an output stream with the SignedMeterValue written to
 std::ostream& operator<<(std::ostream& os, const SignedMeterValue& k);
@@ -409,6 +479,9 @@ void to_json(json& j, const UnitOfMeasure& k);
 /// \brief Conversion from a given json object \p j to a given UnitOfMeasure \p k
 void from_json(const json& j, UnitOfMeasure& k);
 
+/// \brief Writes the given UnitOfMeasure \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const UnitOfMeasure& k);
+
 // \brief Writes the string representation of the given UnitOfMeasure \p k to the given output stream \p os
 /// \returns an output stream with the UnitOfMeasure written to
 std::ostream& operator<<(std::ostream& os, const UnitOfMeasure& k);
@@ -429,6 +502,9 @@ void to_json(json& j, const SampledValue& k);
 /// \brief Conversion from a given json object \p j to a given SampledValue \p k
 void from_json(const json& j, SampledValue& k);
 
+/// \brief Writes the given SampledValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SampledValue& k);
+
 // \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
 /// \returns an output stream with the SampledValue written to
 std::ostream& operator<<(std::ostream& os, const SampledValue& k);
@@ -444,6 +520,9 @@ void to_json(json& j, const MeterValue& k);
 /// \brief Conversion from a given json object \p j to a given MeterValue \p k
 void from_json(const json& j, MeterValue& k);
 
+/// \brief Writes the given MeterValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MeterValue& k);
+
 // \brief Writes the string representation of the given MeterValue \p k to the given output stream \p os
 /// \returns an output stream with the MeterValue written to
 std::ostream& operator<<(std::ostream& os, const MeterValue& k);
@@ -459,6 +538,9 @@ void to_json(json& j, const RelativeTimeInterval& k);
 /// \brief Conversion from a given json object \p j to a given RelativeTimeInterval \p k
 void from_json(const json& j, RelativeTimeInterval& k);
 
+/// \brief Writes the given RelativeTimeInterval \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const RelativeTimeInterval& k);
+
 // \brief Writes the string representation of the given RelativeTimeInterval \p k to the given output stream \p os
 /// \returns an output stream with the RelativeTimeInterval written to
 std::ostream& operator<<(std::ostream& os, const RelativeTimeInterval& k);
@@ -475,6 +557,9 @@ void to_json(json& j, const Cost& k);
 /// \brief Conversion from a given json object \p j to a given Cost \p k
 void from_json(const json& j, Cost& k);
 
+/// \brief Writes the given Cost \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Cost& k);
+
 // \brief Writes the string representation of the given Cost \p k to the given output stream \p os
 /// \returns an output stream with the Cost written to
 std::ostream& operator<<(std::ostream& os, const Cost& k);
@@ -490,6 +575,9 @@ void to_json(json& j, const ConsumptionCost& k);
 /// \brief Conversion from a given json object \p j to a given ConsumptionCost \p k
 void from_json(const json& j, ConsumptionCost& k);
 
+/// \brief Writes the given ConsumptionCost \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ConsumptionCost& k);
+
 // \brief Writes the string representation of the given ConsumptionCost \p k to the given output stream \p os
 /// \returns an output stream with the ConsumptionCost written to
 std::ostream& operator<<(std::ostream& os, const ConsumptionCost& k);
@@ -506,6 +594,9 @@ void to_json(json& j, const SalesTariffEntry& k);
 /// \brief Conversion from a given json object \p j to a given SalesTariffEntry \p k
 void from_json(const json& j, SalesTariffEntry& k);
 
+/// \brief Writes the given SalesTariffEntry \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SalesTariffEntry& k);
+
 // \brief Writes the string representation of the given SalesTariffEntry \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariffEntry written to
 std::ostream& operator<<(std::ostream& os, const SalesTariffEntry& k);
@@ -523,6 +614,9 @@ void to_json(json& j, const SalesTariff& k);
 /// \brief Conversion from a given json object \p j to a given SalesTariff \p k
 void from_json(const json& j, SalesTariff& k);
 
+/// \brief Writes the given SalesTariff \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SalesTariff& k);
+
 // \brief Writes the string representation of the given SalesTariff \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariff written to
 std::ostream& operator<<(std::ostream& os, const SalesTariff& k);
@@ -543,6 +637,9 @@ void to_json(json& j, const ChargingSchedule& k);
 /// \brief Conversion from a given json object \p j to a given ChargingSchedule \p k
 void from_json(const json& j, ChargingSchedule& k);
 
+/// \brief Writes the given ChargingSchedule \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedule& k);
+
 // \brief Writes the string representation of the given ChargingSchedule \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedule written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedule& k);
@@ -558,6 +655,9 @@ void to_json(json& j, const ChargingLimit& k);
 /// \brief Conversion from a given json object \p j to a given ChargingLimit \p k
 void from_json(const json& j, ChargingLimit& k);
 
+/// \brief Writes the given ChargingLimit \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingLimit& k);
+
 // \brief Writes the string representation of the given ChargingLimit \p k to the given output stream \p os
 /// \returns an output stream with the ChargingLimit written to
 std::ostream& operator<<(std::ostream& os, const ChargingLimit& k);
@@ -579,6 +679,9 @@ void to_json(json& j, const MessageInfo& k);
 /// \brief Conversion from a given json object \p j to a given MessageInfo \p k
 void from_json(const json& j, MessageInfo& k);
 
+/// \brief Writes the given MessageInfo \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MessageInfo& k);
+
 // \brief Writes the string representation of the given MessageInfo \p k to the given output stream \p os
 /// \returns an output stream with the MessageInfo written to
 std::ostream& operator<<(std::ostream& os, const MessageInfo& k);
@@ -596,6 +699,9 @@ void to_json(json& j, const ACChargingParameters& k);
 /// \brief Conversion from a given json object \p j to a given ACChargingParameters \p k
 void from_json(const json& j, ACChargingParameters& k);
 
+/// \brief Writes the given ACChargingParameters \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ACChargingParameters& k);
+
 // \brief Writes the string representation of the given ACChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the ACChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const ACChargingParameters& k);
@@ -617,6 +723,9 @@ void to_json(json& j, const DCChargingParameters& k);
 /// \brief Conversion from a given json object \p j to a given DCChargingParameters \p k
 void from_json(const json& j, DCChargingParameters& k);
 
+/// \brief Writes the given DCChargingParameters \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const DCChargingParameters& k);
+
 // \brief Writes the string representation of the given DCChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the DCChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const DCChargingParameters& k);
@@ -634,6 +743,9 @@ void to_json(json& j, const ChargingNeeds& k);
 /// \brief Conversion from a given json object \p j to a given ChargingNeeds \p k
 void from_json(const json& j, ChargingNeeds& k);
 
+/// \brief Writes the given ChargingNeeds \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingNeeds& k);
+
 // \brief Writes the string representation of the given ChargingNeeds \p k to the given output stream \p os
 /// \returns an output stream with the ChargingNeeds written to
 std::ostream& operator<<(std::ostream& os, const ChargingNeeds& k);
@@ -660,6 +772,9 @@ void to_json(json& j, const EventData& k);
 /// \brief Conversion from a given json object \p j to a given EventData \p k
 void from_json(const json& j, EventData& k);
 
+/// \brief Writes the given EventData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const EventData& k);
+
 // \brief Writes the string representation of the given EventData \p k to the given output stream \p os
 /// \returns an output stream with the EventData written to
 std::ostream& operator<<(std::ostream& os, const EventData& k);
@@ -678,6 +793,9 @@ void to_json(json& j, const VariableMonitoring& k);
 /// \brief Conversion from a given json object \p j to a given VariableMonitoring \p k
 void from_json(const json& j, VariableMonitoring& k);
 
+/// \brief Writes the given VariableMonitoring \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const VariableMonitoring& k);
+
 // \brief Writes the string representation of the given VariableMonitoring \p k to the given output stream \p os
 /// \returns an output stream with the VariableMonitoring written to
 std::ostream& operator<<(std::ostream& os, const VariableMonitoring& k);
@@ -694,6 +812,9 @@ void to_json(json& j, const MonitoringData& k);
 /// \brief Conversion from a given json object \p j to a given MonitoringData \p k
 void from_json(const json& j, MonitoringData& k);
 
+/// \brief Writes the given MonitoringData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MonitoringData& k);
+
 // \brief Writes the string representation of the given MonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the MonitoringData written to
 std::ostream& operator<<(std::ostream& os, const MonitoringData& k);
@@ -712,6 +833,9 @@ void to_json(json& j, const VariableAttribute& k);
 /// \brief Conversion from a given json object \p j to a given VariableAttribute \p k
 void from_json(const json& j, VariableAttribute& k);
 
+/// \brief Writes the given VariableAttribute \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const VariableAttribute& k);
+
 // \brief Writes the string representation of the given VariableAttribute \p k to the given output stream \p os
 /// \returns an output stream with the VariableAttribute written to
 std::ostream& operator<<(std::ostream& os, const VariableAttribute& k);
@@ -731,6 +855,9 @@ void to_json(json& j, const VariableCharacteristics& k);
 /// \brief Conversion from a given json object \p j to a given VariableCharacteristics \p k
 void from_json(const json& j, VariableCharacteristics& k);
 
+/// \brief Writes the given VariableCharacteristics \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const VariableCharacteristics& k);
+
 // \brief Writes the string representation of the given VariableCharacteristics \p k to the given output stream \p os
 /// \returns an output stream with the VariableCharacteristics written to
 std::ostream& operator<<(std::ostream& os, const VariableCharacteristics& k);
@@ -748,6 +875,9 @@ void to_json(json& j, const ReportData& k);
 /// \brief Conversion from a given json object \p j to a given ReportData \p k
 void from_json(const json& j, ReportData& k);
 
+/// \brief Writes the given ReportData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ReportData& k);
+
 // \brief Writes the string representation of the given ReportData \p k to the given output stream \p os
 /// \returns an output stream with the ReportData written to
 std::ostream& operator<<(std::ostream& os, const ReportData& k);
@@ -770,6 +900,9 @@ void to_json(json& j, const ChargingProfile& k);
 /// \brief Conversion from a given json object \p j to a given ChargingProfile \p k
 void from_json(const json& j, ChargingProfile& k);
 
+/// \brief Writes the given ChargingProfile \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfile& k);
+
 // \brief Writes the string representation of the given ChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfile& k);
@@ -785,6 +918,9 @@ void to_json(json& j, const AuthorizationData& k);
 /// \brief Conversion from a given json object \p j to a given AuthorizationData \p k
 void from_json(const json& j, AuthorizationData& k);
 
+/// \brief Writes the given AuthorizationData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const AuthorizationData& k);
+
 // \brief Writes the string representation of the given AuthorizationData \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizationData written to
 std::ostream& operator<<(std::ostream& os, const AuthorizationData& k);
@@ -805,6 +941,9 @@ void to_json(json& j, const APN& k);
 /// \brief Conversion from a given json object \p j to a given APN \p k
 void from_json(const json& j, APN& k);
 
+/// \brief Writes the given APN \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const APN& k);
+
 // \brief Writes the string representation of the given APN \p k to the given output stream \p os
 /// \returns an output stream with the APN written to
 std::ostream& operator<<(std::ostream& os, const APN& k);
@@ -824,6 +963,9 @@ void to_json(json& j, const VPN& k);
 /// \brief Conversion from a given json object \p j to a given VPN \p k
 void from_json(const json& j, VPN& k);
 
+/// \brief Writes the given VPN \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const VPN& k);
+
 // \brief Writes the string representation of the given VPN \p k to the given output stream \p os
 /// \returns an output stream with the VPN written to
 std::ostream& operator<<(std::ostream& os, const VPN& k);
@@ -845,6 +987,9 @@ void to_json(json& j, const NetworkConnectionProfile& k);
 /// \brief Conversion from a given json object \p j to a given NetworkConnectionProfile \p k
 void from_json(const json& j, NetworkConnectionProfile& k);
 
+/// \brief Writes the given NetworkConnectionProfile \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NetworkConnectionProfile& k);
+
 // \brief Writes the string representation of the given NetworkConnectionProfile \p k to the given output stream \p os
 /// \returns an output stream with the NetworkConnectionProfile written to
 std::ostream& operator<<(std::ostream& os, const NetworkConnectionProfile& k);
@@ -865,6 +1010,9 @@ void to_json(json& j, const SetMonitoringData& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringData \p k
 void from_json(const json& j, SetMonitoringData& k);
 
+/// \brief Writes the given SetMonitoringData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringData& k);
+
 // \brief Writes the string representation of the given SetMonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringData written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringData& k);
@@ -885,6 +1033,9 @@ void to_json(json& j, const SetMonitoringResult& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringResult \p k
 void from_json(const json& j, SetMonitoringResult& k);
 
+/// \brief Writes the given SetMonitoringResult \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringResult& k);
+
 // \brief Writes the string representation of the given SetMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringResult& k);
@@ -908,6 +1059,9 @@ void to_json(json& j, const SetVariableData& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableData \p k
 void from_json(const json& j, SetVariableData& k);
 
+/// \brief Writes the given SetVariableData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableData& k);
+
 // \brief Writes the string representation of the given SetVariableData \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableData written to
 std::ostream& operator<<(std::ostream& os, const SetVariableData& k);
@@ -926,6 +1080,9 @@ void to_json(json& j, const SetVariableResult& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableResult \p k
 void from_json(const json& j, SetVariableResult& k);
 
+/// \brief Writes the given SetVariableResult \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableResult& k);
+
 // \brief Writes the string representation of the given SetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const SetVariableResult& k);
@@ -944,6 +1101,9 @@ void to_json(json& j, const Transaction& k);
 /// \brief Conversion from a given json object \p j to a given Transaction \p k
 void from_json(const json& j, Transaction& k);
 
+/// \brief Writes the given Transaction \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Transaction& k);
+
 // \brief Writes the string representation of the given Transaction \p k to the given output stream \p os
 /// \returns an output stream with the Transaction written to
 std::ostream& operator<<(std::ostream& os, const Transaction& k);
@@ -962,6 +1122,9 @@ void to_json(json& j, const Firmware& k);
 /// \brief Conversion from a given json object \p j to a given Firmware \p k
 void from_json(const json& j, Firmware& k);
 
+/// \brief Writes the given Firmware \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Firmware& k);
+
 // \brief Writes the string representation of the given Firmware \p k to the given output stream \p os
 /// \returns an output stream with the Firmware written to
 std::ostream& operator<<(std::ostream& os, const Firmware& k);
@@ -6,6 +6,7 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <map>
 #include <mutex>
 #include <stdexcept>
 #include <thread>
@@ -39,6 +40,7 @@ typedef std::function<GetCertificateStatusResponse(GetCertificateStatusRequest)>
 
 // Forward declarations to avoid include loops
 class ChargePoint;
+class DatabaseHandlerInterface;
 class UnexpectedMessageTypeFromCSMS;
 
 class OcspUpdaterInterface {
@@ -55,9 +57,17 @@ public:
 class OcspUpdater : public OcspUpdaterInterface {
 public:
     OcspUpdater() = delete;
+    /// \brief Creates an OcspUpdater. The OCSP response of every certificate is refreshed after
+    /// \p ocsp_cache_update_interval, or earlier when its nextUpdate minus \p ocsp_refresh_margin comes first.
+    /// Up to \p max_concurrent_requests GetCertificateStatus requests are sent at the same time. If a
+    /// \p database_handler is given, the time of the next refresh of every certificate is persisted, so responses that
+    /// are still fresh are not requested again after a restart
     OcspUpdater(std::shared_ptr<EvseSecurity> evse_security, cert_status_func get_cert_status_from_csms,
                 std::chrono::seconds ocsp_cache_update_interval = std::chrono::hours(167),
-                std::chrono::seconds ocsp_cache_update_retry_interval = std::chrono::hours(24));
+                std::chrono::seconds ocsp_cache_update_retry_interval = std::chrono::hours(24),
+                std::shared_ptr<DatabaseHandlerInterface> database_handler = nullptr,
+                std::size_t max_concurrent_requests = 1,
+                std::chrono::seconds ocsp_refresh_margin = std::chrono::hours(24));
     virtual ~OcspUpdater() {
     }
 
@@ -90,10 +100,30 @@ private:
     const std::chrono::seconds ocsp_cache_update_interval;
     const std::chrono::seconds ocsp_cache_update_retry_interval;
 
+    // Optional, persists next_refresh
+    std::shared_ptr<DatabaseHandlerInterface> database_handler;
+    const std::size_t max_concurrent_requests;
+    const std::chrono::seconds ocsp_refresh_margin;
+    // Time at which the OCSP response of a certificate should be refreshed, by certificate key
+    std::map<std::string, std::chrono::time_point<date::utc_clock>> next_refresh;
+    bool refresh_state_loaded;
+    // Set by trigger_ocsp_cache_update, refreshes all certificates regardless of next_refresh
+    bool refresh_all;
+
     // Running loop of the OCSP updater thread
     void updater_thread_loop();
     // Helper method, only called within updater_thread_loop().
     void execute_ocsp_update();
+    // Sends the GetCertificateStatusRequest for the given \p ocsp_request and returns the ocspResult
+    std::string request_ocsp_result(const ocpp::OCSPRequestData& ocsp_request);
+    // Returns the time at which the given \p ocsp_result received at \p now should be refreshed
+    std::chrono::time_point<date::utc_clock> get_next_refresh(const std::string& ocsp_result,
+                                                               std::chrono::time_point<date::utc_clock> now) const;
+    // Returns the deadline of the next update, which is the earliest next_refresh of all certificates
+    std::chrono::time_point<std::chrono::steady_clock> get_next_update_deadline() const;
+    void load_refresh_state();
+    void set_next_refresh(const std::string& certificate_key, std::chrono::time_point<date::utc_clock> next_refresh);
+    void delete_next_refresh(const std::string& certificate_key);
 };
 
 } // namespace ocpp::v2
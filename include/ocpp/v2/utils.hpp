@@ -3,20 +3,52 @@
 #ifndef V2_UTILS_HPP
 #define V2_UTILS_HPP
 
+#include <array>
+#include <bitset>
+#include <cstdint>
+
 #include <ocpp/v2/ocpp_types.hpp>
 #include <ocpp/v2/types.hpp>
 namespace ocpp {
 namespace v2 {
 namespace utils {
 
+/// \brief Set of MeasurandEnum values, indexed by the numeric value of the enum. Used to filter meter values without
+/// searching the configured measurands for every SampledValue
+using MeasurandMask = std::bitset<64>;
+static_assert(static_cast<std::size_t>(MeasurandEnum::Voltage) < MeasurandMask().size(),
+              "MeasurandMask is too small to hold all MeasurandEnum values");
+
+/// \brief Measurand filters applied to the meter values of a TransactionEvent(Ended)
+struct TxEndedMeterValueFilter {
+    /// \brief Applied to Transaction_Begin, Interruption_Begin, Transaction_End, Interruption_End and Sample_Periodic
+    MeasurandMask sampled_measurands;
+    /// \brief Applied to Sample_Clock
+    MeasurandMask aligned_measurands;
+    /// \brief Meter values after this timestamp are omitted
+    ocpp::DateTime max_timestamp;
+    bool include_sampled_signed = true;
+    bool include_aligned_signed = true;
+};
+
 /// \brief This function returns the configured Measurand as an std::vector
 /// \brief std::vector<MeasurandEnum> of the configured AlignedDataMeasurands
 std::vector<MeasurandEnum> get_measurands_vec(const std::string& measurands_csv);
 
+/// \brief Converts the given \p measurands into a MeasurandMask
+MeasurandMask get_measurands_mask(const std::vector<MeasurandEnum>& measurands);
+
+/// \brief Parses the given \p measurands_csv directly into a MeasurandMask
+MeasurandMask get_measurands_mask(const std::string& measurands_csv);
+
 /// \brief This function determines if any of the \p measurands is present in the \p _meter_value at all
 /// \return True if any measurand is found, false otherwise
 bool meter_value_has_any_measurand(const MeterValue& _meter_value, const std::vector<MeasurandEnum>& measurands);
 
+/// \brief This function determines if any of the measurands in \p measurands_mask is present in the \p _meter_value
+/// \return True if any measurand is found, false otherwise
+bool meter_value_has_any_measurand(const MeterValue& _meter_value, const MeasurandMask& measurands_mask);
+
 /// \brief Applies the given \p measurands to the given \p _meter_value . The returned meter value will only contain
 /// SampledValues which measurand is listed in the given \param measurands . If no measurand is set for the
 /// SampledValue, the SampledValue will also be omitted.
@@ -28,6 +60,15 @@ MeterValue get_meter_value_with_measurands_applied(const MeterValue& _meter_valu
                                                    const std::vector<MeasurandEnum>& measurands,
                                                    bool include_signed = true);
 
+/// \brief Applies the given \p measurands_mask to the given \p _meter_value . Behaves like the overload taking a
+/// std::vector<MeasurandEnum>, but builds the result in a single pass and only copies the SampledValues that are kept.
+/// \param _meter_value the meter value to be filtered
+/// \param measurands_mask applied measurands
+/// \param include_signed if signed meter values should be included or not
+/// \return filtered meter value
+MeterValue get_meter_value_with_measurands_applied(const MeterValue& _meter_value, const MeasurandMask& measurands_mask,
+                                                   bool include_signed = true);
+
 /// \brief Applies the given measurands to \p meter_values based on their ReadingContext.
 /// Transaction_Begin, Interruption_Begin, Transaction_End, Interruption_End and Sample_Periodic will be filtered using
 /// \p sampled_tx_ended_measurands.
@@ -41,6 +82,15 @@ std::vector<MeterValue> get_meter_values_with_measurands_applied(
     const std::vector<MeasurandEnum>& aligned_tx_ended_measurands, ocpp::DateTime max_timestamp,
     bool include_sampled_signed = true, bool include_aligned_signed = true);
 
+/// \brief Same as the overload above, using precompiled \p sampled_tx_ended_measurands and
+/// \p aligned_tx_ended_measurands masks
+std::vector<MeterValue> get_meter_values_with_measurands_applied(const std::vector<MeterValue>& meter_values,
+                                                                 const MeasurandMask& sampled_tx_ended_measurands,
+                                                                 const MeasurandMask& aligned_tx_ended_measurands,
+                                                                 ocpp::DateTime max_timestamp,
+                                                                 bool include_sampled_signed = true,
+                                                                 bool include_aligned_signed = true);
+
 ///
 /// \brief Set reading context of metervalue sampled values.
 /// \param meter_value      The meter value to set context on
@@ -54,11 +104,23 @@ MeterValue set_meter_value_reading_context(const MeterValue& meter_value, const
 /// \return
 std::string sha256(const std::string& str);
 
+/// \brief Binary representation of an id token hash (SHA-256)
+using IdTokenHashDigest = std::array<std::uint8_t, 32>;
+
 /// \brief Return a SHA256 hash generated from a combination of the \p token type and id
 /// \param token the token to generate the hash for
 /// \return A SHA256 hash string
 std::string generate_token_hash(const IdToken& token);
 
+/// \brief Return the binary SHA256 digest of the combination of the \p token type and id, the hex encoding of it is
+/// the hash returned by generate_token_hash
+/// \param token the token to generate the digest for
+/// \return The binary SHA256 digest
+IdTokenHashDigest generate_token_hash_digest(const IdToken& token);
+
+/// \brief Return the lower case hex encoding of the given \p digest, as used by generate_token_hash
+std::string to_hex_string(const IdTokenHashDigest& digest);
+
 /// \brief Align the clock aligned timestamps to the interval values
 /// \param timestamp the timestamp to align
 /// \param align_interval the clock aligned interval to align to since midnight 00:00
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <algorithm>
+#include <functional>
+
+#include <ocpp/common/bloom_filter.hpp>
+
+namespace ocpp {
+
+namespace {
+// 10 bits per key and 7 probes give a false positive rate of about 1%
+constexpr std::size_t BITS_PER_ELEMENT = 10;
+constexpr std::size_t NUMBER_OF_HASHES = 7;
+constexpr std::size_t MIN_NUMBER_OF_BITS = 64;
+
+uint64_t fnv1a(std::string_view key) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const auto c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+} // namespace
+
+BloomFilter::BloomFilter(std::size_t expected_elements) :
+    expected_elements(expected_elements), number_of_elements(0) {
+    const auto words = (std::max(expected_elements * BITS_PER_ELEMENT, MIN_NUMBER_OF_BITS) + 63) / 64;
+    this->bits.assign(words, 0);
+    this->number_of_bits = words * 64;
+}
+
+bool BloomFilter::insert(std::string_view key) {
+    // double hashing: the i-th probe is h1 + i * h2
+    const uint64_t h1 = std::hash<std::string_view>{}(key);
+    const uint64_t h2 = fnv1a(key) | 1;
+    bool inserted = false;
+    for (std::size_t i = 0; i < NUMBER_OF_HASHES; i++) {
+        const auto bit = (h1 + i * h2) % this->number_of_bits;
+        const auto mask = uint64_t{1} << (bit % 64);
+        if ((this->bits[bit / 64] & mask) == 0) {
+            this->bits[bit / 64] |= mask;
+            inserted = true;
+        }
+    }
+    // a key of which all bits are already set does not change the fill ratio, so it is not counted
+    if (inserted) {
+        this->number_of_elements++;
+    }
+    return inserted;
+}
+
+bool BloomFilter::may_contain(std::string_view key) const {
+    const uint64_t h1 = std::hash<std::string_view>{}(key);
+    const uint64_t h2 = fnv1a(key) | 1;
+    for (std::size_t i = 0; i < NUMBER_OF_HASHES; i++) {
+        const auto bit = (h1 + i * h2) % this->number_of_bits;
+        if ((this->bits[bit / 64] & (uint64_t{1} << (bit % 64))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void BloomFilter::clear() {
+    std::fill(this->bits.begin(), this->bits.end(), 0);
+    this->number_of_elements = 0;
+}
+
+std::size_t BloomFilter::size() const {
+    return this->number_of_elements;
+}
+
+std::size_t BloomFilter::capacity() const {
+    return this->expected_elements;
+}
+
+} // namespace ocpp
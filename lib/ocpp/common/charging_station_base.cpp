@@ -18,13 +18,21 @@ ChargingStationBase::ChargingStationBase(const std::shared_ptr<EvseSecurity> evs
         this->evse_security = std::make_shared<EvseSecurityImpl>(security_configuration.value());
     }
     this->work = boost::make_shared<boost::asio::io_service::work>(this->io_service);
-    this->io_service_thread = std::thread([this]() { this->io_service.run(); });
+    this->executor = std::make_unique<Executor>(this->io_service);
+    // timers of the station run on the station strand, like the work posted to the executor, so that they keep the
+    // ordering of the former single io_context thread
+    this->timer_service = std::make_shared<TimerService>(this->io_service, DEFAULT_TIMER_RESOLUTION,
+                                                         this->executor->get_station_strand());
 }
 
 ChargingStationBase::~ChargingStationBase() {
     work->get_io_context().stop();
     io_service.stop();
-    io_service_thread.join();
+    executor->join();
+}
+
+TimerServiceMetrics ChargingStationBase::get_timer_service_metrics() {
+    return this->timer_service->get_metrics();
 }
 
 } // namespace ocpp
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <algorithm>
+
+#include <everest/logging.hpp>
+
+#include <ocpp/common/database/local_authorization_list_index.hpp>
+
+namespace ocpp::common {
+
+namespace {
+constexpr std::size_t MIN_INDEX_CAPACITY = 1024;
+}
+
+LocalAuthorizationListIndex::LocalAuthorizationListIndex(KeyLoader key_loader) :
+    key_loader(std::move(key_loader)), valid(false), removed_keys(0) {
+}
+
+void LocalAuthorizationListIndex::rebuild() {
+    const auto keys = this->key_loader();
+    this->assign(keys, keys.size() * 2);
+}
+
+void LocalAuthorizationListIndex::assign(const std::vector<std::string>& keys, std::size_t expected_keys) {
+    this->filter = BloomFilter(std::max(expected_keys, MIN_INDEX_CAPACITY));
+    for (const auto& key : keys) {
+        this->filter.insert(key);
+    }
+    this->removed_keys = 0;
+    this->valid = true;
+}
+
+bool LocalAuthorizationListIndex::may_contain(const std::string& key) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    if (!this->valid) {
+        try {
+            this->rebuild();
+        } catch (const std::exception& e) {
+            // fall back to querying the database
+            EVLOG_warning << "Could not build local authorization list index: " << e.what();
+            return true;
+        }
+    }
+    return this->filter.may_contain(key);
+}
+
+void LocalAuthorizationListIndex::update(const std::vector<std::string>& inserted_keys,
+                                         const std::vector<std::string>& removed_keys,
+                                         const std::function<void()>& commit) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    try {
+        commit();
+    } catch (...) {
+        // the database might have been changed partially
+        this->valid = false;
+        throw;
+    }
+
+    if (!this->valid) {
+        return;
+    }
+
+    if (this->filter.size() == 0 and removed_keys.empty() and inserted_keys.size() > this->filter.capacity()) {
+        // full update of a cleared list: build the filter in one go instead of reading back the database
+        this->assign(inserted_keys, inserted_keys.size() * 2);
+        return;
+    }
+
+    for (const auto& key : inserted_keys) {
+        this->filter.insert(key);
+    }
+
+    // the filter only counts distinct keys, so updates of existing entries do not cause a rebuild
+    if (this->filter.size() > this->filter.capacity()) {
+        this->valid = false;
+        return;
+    }
+
+    this->removed_keys += removed_keys.size();
+    if (this->removed_keys > this->filter.size() / 2) {
+        this->valid = false;
+    }
+}
+
+void LocalAuthorizationListIndex::clear() {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    this->filter.clear();
+    this->removed_keys = 0;
+    this->valid = true;
+}
+
+void LocalAuthorizationListIndex::invalidate() {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    this->valid = false;
+}
+
+} // namespace ocpp::common
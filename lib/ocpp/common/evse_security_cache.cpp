@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <algorithm>
+#include <limits>
+
+#include <openssl/evp.h>
+
+#include <ocpp/common/evse_security_cache.hpp>
+
+namespace ocpp {
+
+namespace {
+std::string get_chain_hash(const std::string& certificate_chain) {
+    unsigned char hash[EVP_MAX_MD_SIZE];
+    unsigned int hash_size = 0;
+    EVP_Digest(certificate_chain.data(), certificate_chain.size(), hash, &hash_size, EVP_sha256(), nullptr);
+    return std::string(reinterpret_cast<const char*>(hash), hash_size);
+}
+} // namespace
+
+EvseSecurityCache::EvseSecurityCache(std::chrono::seconds time_to_live, std::size_t max_certificate_chains) :
+    time_to_live(time_to_live), max_certificate_chains(max_certificate_chains), generation(0) {
+}
+
+std::uint64_t EvseSecurityCache::get_generation() {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    return this->generation;
+}
+
+template <typename Key, typename T>
+std::optional<T> EvseSecurityCache::get(std::map<Key, Entry<T>>& entries, const Key& key) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    const auto it = entries.find(key);
+    if (it == entries.end()) {
+        return std::nullopt;
+    }
+    if (it->second.expiry <= std::chrono::steady_clock::now()) {
+        entries.erase(it);
+        return std::nullopt;
+    }
+    return it->second.value;
+}
+
+template <typename Key, typename T>
+void EvseSecurityCache::set(std::map<Key, Entry<T>>& entries, const Key& key, const T& value, std::size_t max_entries,
+                            std::uint64_t generation) {
+    if (this->time_to_live.count() <= 0 or max_entries == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lk(this->mutex);
+    if (generation != this->generation) {
+        // the cache was invalidated while the value was computed, so it may be outdated already
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (entries.size() >= max_entries and entries.count(key) == 0) {
+        for (auto it = entries.begin(); it != entries.end();) {
+            it = it->second.expiry <= now ? entries.erase(it) : std::next(it);
+        }
+        if (entries.size() >= max_entries) {
+            entries.erase(std::min_element(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.second.expiry < rhs.second.expiry;
+            }));
+        }
+    }
+    entries.insert_or_assign(key, Entry<T>{value, now + this->time_to_live});
+}
+
+std::optional<CertificateValidationResult>
+EvseSecurityCache::get_verification_result(const std::string& certificate_chain,
+                                           LeafCertificateType certificate_type) {
+    return this->get(this->verification_results, std::make_pair(get_chain_hash(certificate_chain), certificate_type));
+}
+
+void EvseSecurityCache::set_verification_result(const std::string& certificate_chain,
+                                                LeafCertificateType certificate_type,
+                                                CertificateValidationResult result, std::uint64_t generation) {
+    if (result == CertificateValidationResult::Unknown) {
+        return;
+    }
+    this->set(this->verification_results, std::make_pair(get_chain_hash(certificate_chain), certificate_type), result,
+              this->max_certificate_chains, generation);
+}
+
+std::optional<std::vector<OCSPRequestData>>
+EvseSecurityCache::get_mo_ocsp_request_data(const std::string& certificate_chain) {
+    return this->get(this->mo_ocsp_request_data, get_chain_hash(certificate_chain));
+}
+
+void EvseSecurityCache::set_mo_ocsp_request_data(const std::string& certificate_chain,
+                                                 const std::vector<OCSPRequestData>& ocsp_request_data,
+                                                 std::uint64_t generation) {
+    this->set(this->mo_ocsp_request_data, get_chain_hash(certificate_chain), ocsp_request_data,
+              this->max_certificate_chains, generation);
+}
+
+std::optional<std::vector<CertificateHashDataChain>>
+EvseSecurityCache::get_installed_certificates(const std::vector<CertificateType>& certificate_types) {
+    return this->get(this->installed_certificates, certificate_types);
+}
+
+void EvseSecurityCache::set_installed_certificates(
+    const std::vector<CertificateType>& certificate_types,
+    const std::vector<CertificateHashDataChain>& installed_certificates, std::uint64_t generation) {
+    // the number of different combinations of certificate types requested is small, so this map is not limited
+    this->set(this->installed_certificates, certificate_types, installed_certificates,
+              std::numeric_limits<std::size_t>::max(), generation);
+}
+
+std::optional<GetCertificateInfoResult>
+EvseSecurityCache::get_leaf_certificate_info(CertificateSigningUseEnum certificate_type, bool include_ocsp) {
+    return this->get(this->leaf_certificate_info, std::make_pair(certificate_type, include_ocsp));
+}
+
+void EvseSecurityCache::set_leaf_certificate_info(CertificateSigningUseEnum certificate_type, bool include_ocsp,
+                                                  const GetCertificateInfoResult& leaf_certificate_info,
+                                                  std::uint64_t generation) {
+    if (leaf_certificate_info.status != GetCertificateInfoStatus::Accepted) {
+        return;
+    }
+    this->set(this->leaf_certificate_info, std::make_pair(certificate_type, include_ocsp), leaf_certificate_info,
+              std::numeric_limits<std::size_t>::max(), generation);
+}
+
+void EvseSecurityCache::invalidate() {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    this->generation++;
+    this->verification_results.clear();
+    this->mo_ocsp_request_data.clear();
+    this->installed_certificates.clear();
+    this->leaf_certificate_info.clear();
+}
+
+void EvseSecurityCache::invalidate_leaf_certificate_info() {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    this->generation++;
+    this->leaf_certificate_info.clear();
+}
+
+} // namespace ocpp
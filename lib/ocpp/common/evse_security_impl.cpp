@@ -4,7 +4,8 @@
 #include <ocpp/common/evse_security_impl.hpp>
 
 namespace ocpp {
-EvseSecurityImpl::EvseSecurityImpl(const SecurityConfiguration& security_configuration) {
+EvseSecurityImpl::EvseSecurityImpl(const SecurityConfiguration& security_configuration) :
+    cache(security_configuration.certificate_cache_time_to_live, security_configuration.certificate_cache_max_chains) {
     evse_security::FilePaths file_paths;
     file_paths.csms_ca_bundle = security_configuration.csms_ca_bundle;
     file_paths.mf_ca_bundle = security_configuration.mf_ca_bundle;
@@ -26,29 +27,48 @@ EvseSecurityImpl::EvseSecurityImpl(const SecurityConfiguration& security_configu
 
 InstallCertificateResult EvseSecurityImpl::install_ca_certificate(const std::string& certificate,
                                                                   const CaCertificateType& certificate_type) {
-    return conversions::to_ocpp(
+    const auto result = conversions::to_ocpp(
         this->evse_security->install_ca_certificate(certificate, conversions::from_ocpp(certificate_type)));
+    this->cache.invalidate();
+    return result;
 }
 
 DeleteCertificateResult EvseSecurityImpl::delete_certificate(const CertificateHashDataType& certificate_hash_data) {
-    return conversions::to_ocpp(this->evse_security->delete_certificate(conversions::from_ocpp(certificate_hash_data)));
+    const auto result =
+        conversions::to_ocpp(this->evse_security->delete_certificate(conversions::from_ocpp(certificate_hash_data)));
+    this->cache.invalidate();
+    return result;
 }
 
 InstallCertificateResult EvseSecurityImpl::update_leaf_certificate(const std::string& certificate_chain,
                                                                    const CertificateSigningUseEnum& certificate_type) {
-    return conversions::to_ocpp(
+    const auto result = conversions::to_ocpp(
         this->evse_security->update_leaf_certificate(certificate_chain, conversions::from_ocpp(certificate_type)));
+    this->cache.invalidate();
+    return result;
 }
 
 CertificateValidationResult EvseSecurityImpl::verify_certificate(const std::string& certificate_chain,
                                                                  const LeafCertificateType& certificate_type) {
+    const auto cached_result = this->cache.get_verification_result(certificate_chain, certificate_type);
+    if (cached_result.has_value()) {
+        return cached_result.value();
+    }
 
-    return conversions::to_ocpp(
+    const auto cache_generation = this->cache.get_generation();
+    const auto result = conversions::to_ocpp(
         this->evse_security->verify_certificate(certificate_chain, conversions::from_ocpp(certificate_type)));
+    this->cache.set_verification_result(certificate_chain, certificate_type, result, cache_generation);
+    return result;
 }
 
 std::vector<CertificateHashDataChain>
 EvseSecurityImpl::get_installed_certificates(const std::vector<CertificateType>& certificate_types) {
+    auto cached_result = this->cache.get_installed_certificates(certificate_types);
+    if (cached_result.has_value()) {
+        return std::move(cached_result.value());
+    }
+
     std::vector<CertificateHashDataChain> result;
 
     std::vector<evse_security::CertificateType> _certificate_types;
@@ -57,11 +77,13 @@ EvseSecurityImpl::get_installed_certificates(const std::vector<CertificateType>&
         _certificate_types.push_back(conversions::from_ocpp(certificate_type));
     }
 
+    const auto cache_generation = this->cache.get_generation();
     const auto installed_certificates = this->evse_security->get_installed_certificates(_certificate_types);
 
     for (const auto& certificate_hash_data : installed_certificates.certificate_hash_data_chain) {
         result.push_back(conversions::to_ocpp(certificate_hash_data));
     }
+    this->cache.set_installed_certificates(certificate_types, result, cache_generation);
     return result;
 }
 
@@ -77,19 +99,27 @@ std::vector<OCSPRequestData> EvseSecurityImpl::get_v2g_ocsp_request_data() {
 }
 
 std::vector<OCSPRequestData> EvseSecurityImpl::get_mo_ocsp_request_data(const std::string& certificate_chain) {
+    auto cached_result = this->cache.get_mo_ocsp_request_data(certificate_chain);
+    if (cached_result.has_value()) {
+        return std::move(cached_result.value());
+    }
+
     std::vector<OCSPRequestData> result;
 
+    const auto cache_generation = this->cache.get_generation();
     const auto ocsp_request_data = this->evse_security->get_mo_ocsp_request_data(certificate_chain);
     for (const auto& ocsp_request_entry : ocsp_request_data.ocsp_request_data_list) {
         result.push_back(conversions::to_ocpp(ocsp_request_entry));
     }
 
+    this->cache.set_mo_ocsp_request_data(certificate_chain, result, cache_generation);
     return result;
 }
 
 void EvseSecurityImpl::update_ocsp_cache(const CertificateHashDataType& certificate_hash_data,
                                          const std::string& ocsp_response) {
     this->evse_security->update_ocsp_cache(conversions::from_ocpp(certificate_hash_data), ocsp_response);
+    this->cache.invalidate_leaf_certificate_info();
 }
 
 bool EvseSecurityImpl::is_ca_certificate_installed(const CaCertificateType& certificate_type) {
@@ -113,6 +143,12 @@ EvseSecurityImpl::generate_certificate_signing_request(const CertificateSigningU
 
 GetCertificateInfoResult EvseSecurityImpl::get_leaf_certificate_info(const CertificateSigningUseEnum& certificate_type,
                                                                      bool include_ocsp) {
+    auto cached_result = this->cache.get_leaf_certificate_info(certificate_type, include_ocsp);
+    if (cached_result.has_value()) {
+        return std::move(cached_result.value());
+    }
+
+    const auto cache_generation = this->cache.get_generation();
     const auto info_response = this->evse_security->get_leaf_certificate_info(
         conversions::from_ocpp(certificate_type), evse_security::EncodingFormat::PEM, include_ocsp);
 
@@ -123,11 +159,14 @@ GetCertificateInfoResult EvseSecurityImpl::get_leaf_certificate_info(const Certi
         result.info = conversions::to_ocpp(info_response.info.value());
     }
 
+    this->cache.set_leaf_certificate_info(certificate_type, include_ocsp, result, cache_generation);
     return result;
 }
 
 bool EvseSecurityImpl::update_certificate_links(const CertificateSigningUseEnum& certificate_type) {
-    return this->evse_security->update_certificate_links(conversions::from_ocpp(certificate_type));
+    const auto result = this->evse_security->update_certificate_links(conversions::from_ocpp(certificate_type));
+    this->cache.invalidate_leaf_certificate_info();
+    return result;
 }
 
 std::string EvseSecurityImpl::get_verify_file(const CaCertificateType& certificate_type) {
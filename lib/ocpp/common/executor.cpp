@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <algorithm>
+
+#include <boost/asio/post.hpp>
+
+#include <ocpp/common/executor.hpp>
+
+namespace ocpp {
+
+Executor::Executor(boost::asio::io_context& io_context, std::size_t number_of_threads) :
+    io_context(io_context), station_strand(std::make_shared<Strand>(io_context.get_executor())) {
+    this->set_number_of_threads(std::max(number_of_threads, std::size_t(1)));
+}
+
+Executor::~Executor() {
+    this->join();
+}
+
+void Executor::set_number_of_threads(std::size_t number_of_threads) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    while (this->threads.size() < number_of_threads) {
+        this->threads.emplace_back([this]() { this->io_context.run(); });
+    }
+}
+
+std::size_t Executor::get_number_of_threads() {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    return this->threads.size();
+}
+
+std::shared_ptr<Strand> Executor::get_strand(int32_t id) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    auto& strand = this->strands[id];
+    if (strand == nullptr) {
+        strand = std::make_shared<Strand>(this->io_context.get_executor());
+    }
+    return strand;
+}
+
+std::shared_ptr<Strand> Executor::get_station_strand() {
+    return this->station_strand;
+}
+
+void Executor::post(int32_t id, const std::function<void()>& handler) {
+    boost::asio::post(*this->get_strand(id), handler);
+}
+
+void Executor::post(const std::function<void()>& handler) {
+    boost::asio::post(*this->station_strand, handler);
+}
+
+void Executor::join() {
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lk(this->mutex);
+        threads.swap(this->threads);
+    }
+    for (auto& thread : threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+} // namespace ocpp
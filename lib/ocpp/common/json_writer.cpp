@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+
+#include <nlohmann/json.hpp>
+
+#include <ocpp/common/json_writer.hpp>
+
+namespace ocpp {
+
+namespace {
+const char HEX_DIGITS[] = "0123456789abcdef";
+
+std::string to_hex_byte(unsigned char byte) {
+    const char upper_hex_digits[] = "0123456789ABCDEF";
+    return {'0', 'x', upper_hex_digits[byte >> 4], upper_hex_digits[byte & 0x0F]};
+}
+
+/// \brief Validates the UTF-8 sequence that starts with the byte at \p index of \p value, which is not ASCII
+/// \returns the length of the sequence in bytes
+/// \throws json::type_error like json::dump() does for invalid UTF-8
+std::size_t get_utf8_sequence_length(std::string_view value, std::size_t index) {
+    const auto first = static_cast<unsigned char>(value[index]);
+    std::size_t length = 0;
+    // range of the second byte, it excludes overlong encodings, surrogates and code points above U+10FFFF
+    unsigned char lower = 0x80;
+    unsigned char upper = 0xBF;
+    if (first >= 0xC2 and first <= 0xDF) {
+        length = 2;
+    } else if (first >= 0xE0 and first <= 0xEF) {
+        length = 3;
+        lower = first == 0xE0 ? 0xA0 : lower;
+        upper = first == 0xED ? 0x9F : upper;
+    } else if (first >= 0xF0 and first <= 0xF4) {
+        length = 4;
+        lower = first == 0xF0 ? 0x90 : lower;
+        upper = first == 0xF4 ? 0x8F : upper;
+    } else {
+        throw json::type_error::create(
+            316, "invalid UTF-8 byte at index " + std::to_string(index) + ": " + to_hex_byte(first), nullptr);
+    }
+
+    for (std::size_t i = index + 1; i < index + length; i++) {
+        if (i == value.size()) {
+            throw json::type_error::create(
+                316, "incomplete UTF-8 string; last byte: " + to_hex_byte(static_cast<unsigned char>(value.back())),
+                nullptr);
+        }
+        const auto byte = static_cast<unsigned char>(value[i]);
+        if (byte < lower or byte > upper) {
+            throw json::type_error::create(
+                316, "invalid UTF-8 byte at index " + std::to_string(i) + ": " + to_hex_byte(byte), nullptr);
+        }
+        lower = 0x80;
+        upper = 0xBF;
+    }
+    return length;
+}
+
+template <typename T> void append_number(std::string& buffer, T value) {
+    std::array<char, 32> digits;
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    buffer.append(digits.data(), result.ptr);
+}
+
+/// \brief Appends the shortest representation of the finite \p value in the format of json::dump(): fixed notation with
+/// at least one fractional digit for decimal exponents in [-4, 15], scientific notation with an at least two digit
+/// exponent otherwise
+void append_double(std::string& buffer, double value) {
+    std::array<char, 32> scientific;
+    const auto end = std::to_chars(scientific.data(), scientific.data() + scientific.size(), value,
+                                   std::chars_format::scientific)
+                         .ptr;
+    const char* it = scientific.data();
+    if (*it == '-') {
+        buffer.push_back('-');
+        it++;
+    }
+    std::string digits;
+    for (; *it != 'e'; it++) {
+        if (*it != '.') {
+            digits.push_back(*it);
+        }
+    }
+    int exponent = 0;
+    std::from_chars(it + (it[1] == '+' ? 2 : 1), end, exponent);
+
+    // the value is 0.digits * 10^n
+    const int k = static_cast<int>(digits.size());
+    const int n = exponent + 1;
+    if (k <= n and n <= 15) {
+        buffer.append(digits);
+        buffer.append(n - k, '0');
+        buffer.append(".0");
+    } else if (0 < n and n <= 15) {
+        buffer.append(digits, 0, n);
+        buffer.push_back('.');
+        buffer.append(digits, n);
+    } else if (-4 < n and n <= 0) {
+        buffer.append("0.");
+        buffer.append(-n, '0');
+        buffer.append(digits);
+    } else {
+        buffer.push_back(digits[0]);
+        if (k > 1) {
+            buffer.push_back('.');
+            buffer.append(digits, 1);
+        }
+        buffer.append(exponent < 0 ? "e-" : "e+");
+        const int abs_exponent = std::abs(exponent);
+        if (abs_exponent < 10) {
+            buffer.push_back('0');
+        }
+        append_number(buffer, abs_exponent);
+    }
+}
+} // namespace
+
+JsonWriter::JsonWriter(std::string& buffer) : buffer(buffer) {
+}
+
+void JsonWriter::separate() {
+    if (not this->first) {
+        this->buffer.push_back(',');
+    }
+    this->first = false;
+}
+
+void JsonWriter::start_object() {
+    this->separate();
+    this->buffer.push_back('{');
+    this->first = true;
+}
+
+void JsonWriter::end_object() {
+    this->buffer.push_back('}');
+    this->first = false;
+}
+
+void JsonWriter::start_array() {
+    this->separate();
+    this->buffer.push_back('[');
+    this->first = true;
+}
+
+void JsonWriter::end_array() {
+    this->buffer.push_back(']');
+    this->first = false;
+}
+
+void JsonWriter::key(std::string_view key) {
+    this->value(key);
+    this->buffer.push_back(':');
+    this->first = true;
+}
+
+void JsonWriter::value(std::string_view value) {
+    this->separate();
+    this->buffer.push_back('"');
+    // append the characters that do not need to be escaped in chunks
+    std::size_t begin = 0;
+    for (std::size_t i = 0; i < value.size(); i++) {
+        const auto c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x80) {
+            i += get_utf8_sequence_length(value, i) - 1;
+            continue;
+        }
+        if (c >= 0x20 and c != '"' and c != '\\') {
+            continue;
+        }
+        this->buffer.append(value.data() + begin, i - begin);
+        begin = i + 1;
+        switch (c) {
+        case '"':
+            this->buffer.append("\\\"");
+            break;
+        case '\\':
+            this->buffer.append("\\\\");
+            break;
+        case '\b':
+            this->buffer.append("\\b");
+            break;
+        case '\f':
+            this->buffer.append("\\f");
+            break;
+        case '\n':
+            this->buffer.append("\\n");
+            break;
+        case '\r':
+            this->buffer.append("\\r");
+            break;
+        case '\t':
+            this->buffer.append("\\t");
+            break;
+        default:
+            this->buffer.append("\\u00");
+            this->buffer.push_back(HEX_DIGITS[c >> 4]);
+            this->buffer.push_back(HEX_DIGITS[c & 0x0F]);
+            break;
+        }
+    }
+    this->buffer.append(value.data() + begin, value.size() - begin);
+    this->buffer.push_back('"');
+}
+
+void JsonWriter::value(const std::string& value) {
+    this->value(std::string_view(value));
+}
+
+void JsonWriter::value(const char* value) {
+    this->value(std::string_view(value));
+}
+
+void JsonWriter::value(bool value) {
+    this->separate();
+    this->buffer.append(value ? "true" : "false");
+}
+
+void JsonWriter::value(int32_t value) {
+    this->separate();
+    append_number(this->buffer, value);
+}
+
+void JsonWriter::value(int64_t value) {
+    this->separate();
+    append_number(this->buffer, value);
+}
+
+void JsonWriter::value(double value) {
+    this->separate();
+    if (not std::isfinite(value)) {
+        this->buffer.append("null");
+        return;
+    }
+    append_double(this->buffer, value);
+}
+
+void JsonWriter::value(const json& value) {
+    this->separate();
+    this->buffer.append(value.dump());
+}
+
+} // namespace ocpp
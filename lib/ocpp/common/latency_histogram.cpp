@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <ocpp/common/latency_histogram.hpp>
+
+namespace ocpp {
+
+std::chrono::microseconds LatencyHistogramSnapshot::mean() const {
+    if (this->count == 0) {
+        return std::chrono::microseconds(0);
+    }
+    return this->sum / this->count;
+}
+
+std::chrono::microseconds LatencyHistogramSnapshot::percentile(double quantile) const {
+    if (this->count == 0) {
+        return std::chrono::microseconds(0);
+    }
+    const auto scaled_count = std::clamp(quantile, 0.0, 1.0) * static_cast<double>(this->count);
+    const auto rank = std::max(uint64_t(1), static_cast<uint64_t>(std::ceil(scaled_count)));
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < this->buckets.size(); i++) {
+        seen += this->buckets.at(i);
+        if (seen >= rank) {
+            return std::min(LatencyHistogram::get_bucket_upper_bound(i), this->max);
+        }
+    }
+    return this->max;
+}
+
+void LatencyHistogram::record(std::chrono::microseconds latency) {
+    const auto value = static_cast<uint64_t>(std::max(latency.count(), std::chrono::microseconds::rep(0)));
+    this->buckets.at(get_bucket_index(value)).fetch_add(1, std::memory_order_relaxed);
+    this->count.fetch_add(1, std::memory_order_relaxed);
+    this->sum.fetch_add(value, std::memory_order_relaxed);
+
+    auto max = this->max.load(std::memory_order_relaxed);
+    while (value > max and !this->max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+}
+
+LatencyHistogramSnapshot LatencyHistogram::get_snapshot() const {
+    LatencyHistogramSnapshot snapshot;
+    snapshot.buckets.reserve(NUMBER_OF_BUCKETS);
+    for (const auto& bucket : this->buckets) {
+        snapshot.buckets.push_back(bucket.load(std::memory_order_relaxed));
+    }
+    snapshot.count = this->count.load(std::memory_order_relaxed);
+    snapshot.sum = std::chrono::microseconds(this->sum.load(std::memory_order_relaxed));
+    snapshot.max = std::chrono::microseconds(this->max.load(std::memory_order_relaxed));
+    return snapshot;
+}
+
+std::size_t LatencyHistogram::get_bucket_index(uint64_t microseconds) {
+    if (microseconds < SUB_BUCKETS) {
+        return microseconds;
+    }
+    // position of the highest set bit, selects the power of two
+    const std::size_t magnitude = 63 - __builtin_clzll(microseconds);
+    // the bits right below the highest set bit select the linear bucket within the power of two
+    const std::size_t sub_bucket = (microseconds >> (magnitude - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return (magnitude - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub_bucket;
+}
+
+std::chrono::microseconds LatencyHistogram::get_bucket_upper_bound(std::size_t index) {
+    if (index < SUB_BUCKETS) {
+        return std::chrono::microseconds(index);
+    }
+    const std::size_t magnitude = index / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    const uint64_t sub_bucket = index % SUB_BUCKETS;
+    const auto shift = magnitude - SUB_BUCKET_BITS;
+    // the upper bound of the very last bucket does not fit into a signed microseconds count
+    if (sub_bucket == SUB_BUCKETS - 1 and shift + SUB_BUCKET_BITS + 1 >= 64) {
+        return std::chrono::microseconds::max();
+    }
+    const uint64_t upper_bound = ((SUB_BUCKETS + sub_bucket + 1) << shift) - 1;
+    return std::chrono::microseconds(static_cast<std::chrono::microseconds::rep>(
+        std::min(upper_bound, static_cast<uint64_t>(std::numeric_limits<std::chrono::microseconds::rep>::max()))));
+}
+
+} // namespace ocpp
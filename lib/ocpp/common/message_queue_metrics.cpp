@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/common/message_queue_metrics.hpp>
+
+namespace ocpp {
+
+namespace {
+void update_max(std::atomic<std::size_t>& max, std::size_t value) {
+    auto current = max.load(std::memory_order_relaxed);
+    while (value > current and !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+} // namespace
+
+MessageTypeMetrics& MessageQueueMetrics::get(const std::string& message_type) {
+    std::lock_guard<std::mutex> lk(this->message_types_mutex);
+    auto& metrics = this->message_types[message_type];
+    if (metrics == nullptr) {
+        metrics = std::make_unique<MessageTypeMetrics>();
+    }
+    return *metrics;
+}
+
+void MessageQueueMetrics::set_queue_sizes(std::size_t normal_queue_size, std::size_t transaction_queue_size) {
+    this->normal_queue_size.store(normal_queue_size, std::memory_order_relaxed);
+    this->transaction_queue_size.store(transaction_queue_size, std::memory_order_relaxed);
+    update_max(this->max_normal_queue_size, normal_queue_size);
+    update_max(this->max_transaction_queue_size, transaction_queue_size);
+}
+
+void MessageQueueMetrics::add_dropped_messages(QueueType queue_type, uint64_t number_of_messages) {
+    switch (queue_type) {
+    case QueueType::Normal:
+        this->dropped_normal_messages.fetch_add(number_of_messages, std::memory_order_relaxed);
+        break;
+    case QueueType::Transaction:
+        this->dropped_transaction_messages.fetch_add(number_of_messages, std::memory_order_relaxed);
+        break;
+    case QueueType::None:
+        break;
+    }
+}
+
+MessageQueueMetricsSnapshot MessageQueueMetrics::get_snapshot() const {
+    MessageQueueMetricsSnapshot snapshot;
+    {
+        std::lock_guard<std::mutex> lk(this->message_types_mutex);
+        for (const auto& [message_type, metrics] : this->message_types) {
+            auto& message_type_snapshot = snapshot.message_types[message_type];
+            message_type_snapshot.sent = metrics->sent.load(std::memory_order_relaxed);
+            message_type_snapshot.send_failures = metrics->send_failures.load(std::memory_order_relaxed);
+            message_type_snapshot.retries = metrics->retries.load(std::memory_order_relaxed);
+            message_type_snapshot.timeouts = metrics->timeouts.load(std::memory_order_relaxed);
+            message_type_snapshot.call_errors = metrics->call_errors.load(std::memory_order_relaxed);
+            message_type_snapshot.dropped = metrics->dropped.load(std::memory_order_relaxed);
+            message_type_snapshot.in_flight_time = metrics->in_flight_time.get_snapshot();
+        }
+    }
+    snapshot.normal_queue_size = this->normal_queue_size.load(std::memory_order_relaxed);
+    snapshot.transaction_queue_size = this->transaction_queue_size.load(std::memory_order_relaxed);
+    snapshot.max_normal_queue_size = this->max_normal_queue_size.load(std::memory_order_relaxed);
+    snapshot.max_transaction_queue_size = this->max_transaction_queue_size.load(std::memory_order_relaxed);
+    snapshot.dropped_normal_messages = this->dropped_normal_messages.load(std::memory_order_relaxed);
+    snapshot.dropped_transaction_messages = this->dropped_transaction_messages.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+} // namespace ocpp
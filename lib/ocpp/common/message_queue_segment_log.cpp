@@ -0,0 +1,420 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+
+#include <everest/logging.hpp>
+
+#include <ocpp/common/database/database_exceptions.hpp>
+#include <ocpp/common/message_queue_segment_log.hpp>
+#include <ocpp/common/utils.hpp>
+
+namespace ocpp::common {
+
+namespace {
+const std::string SEGMENT_PREFIX = "segment-";
+const std::string SEGMENT_SUFFIX = ".log";
+// every record starts with the size of its payload and the CRC-32 of its payload, both little endian
+constexpr std::size_t RECORD_HEADER_SIZE = 8;
+
+uint32_t crc32(const std::string& data) {
+    static const auto table = []() {
+        std::array<uint32_t, 256> table{};
+        for (uint32_t i = 0; i < table.size(); i++) {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++) {
+                crc = (crc & 1) ? 0xEDB88320 ^ (crc >> 1) : crc >> 1;
+            }
+            table[i] = crc;
+        }
+        return table;
+    }();
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (const unsigned char byte : data) {
+        crc = table[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+void append_uint32(std::string& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+uint32_t read_uint32(const std::string& in, std::size_t offset) {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        value |= static_cast<uint32_t>(static_cast<unsigned char>(in.at(offset + i))) << (8 * i);
+    }
+    return value;
+}
+
+std::string encode_record(const json& record) {
+    const auto payload = record.dump();
+    std::string encoded;
+    encoded.reserve(RECORD_HEADER_SIZE + payload.size());
+    append_uint32(encoded, static_cast<uint32_t>(payload.size()));
+    append_uint32(encoded, crc32(payload));
+    encoded += payload;
+    return encoded;
+}
+
+/// \brief Both QueueType::Transaction and QueueType::None refer to the transaction queue, like in DatabaseHandlerCommon
+QueueType get_queue(const QueueType queue_type) {
+    return queue_type == QueueType::Normal ? QueueType::Normal : QueueType::Transaction;
+}
+
+json insert_record(const DBTransactionMessage& message, const QueueType queue_type) {
+    return json{{"op", "insert"},
+                {"queue", static_cast<int>(queue_type)},
+                {"unique_id", message.unique_id},
+                {"message", message.json_message},
+                {"message_type", message.message_type},
+                {"message_attempts", message.message_attempts},
+                {"timestamp", message.timestamp.to_rfc3339()}};
+}
+} // namespace
+
+MessageQueueSegmentLog::MessageQueueSegmentLog(const fs::path& directory, std::size_t max_segment_size,
+                                               bool sync_appends) :
+    directory(directory), max_segment_size(max_segment_size), sync_appends(sync_appends) {
+    fs::create_directories(this->directory);
+    this->queues[QueueType::Normal];
+    this->queues[QueueType::Transaction];
+    this->recover();
+}
+
+MessageQueueSegmentLog::~MessageQueueSegmentLog() {
+    this->close_segment();
+}
+
+fs::path MessageQueueSegmentLog::get_segment_path(uint64_t number) const {
+    std::ostringstream file_name;
+    file_name << SEGMENT_PREFIX << std::setw(20) << std::setfill('0') << number << SEGMENT_SUFFIX;
+    return this->directory / file_name.str();
+}
+
+void MessageQueueSegmentLog::open_segment(uint64_t number) {
+    this->close_segment();
+    const auto path = this->get_segment_path(number);
+    this->segment_fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (this->segment_fd < 0) {
+        throw std::runtime_error("Could not open message queue segment " + path.string());
+    }
+    this->segment_number = number;
+    this->segment_size = fs::file_size(path);
+}
+
+void MessageQueueSegmentLog::close_segment() {
+    if (this->segment_fd >= 0) {
+        ::close(this->segment_fd);
+        this->segment_fd = -1;
+    }
+}
+
+void MessageQueueSegmentLog::recover() {
+    std::vector<uint64_t> segment_numbers;
+    for (const auto& file : fs::directory_iterator(this->directory)) {
+        const auto file_name = file.path().filename().string();
+        if (file_name.size() <= SEGMENT_PREFIX.size() + SEGMENT_SUFFIX.size() or
+            file_name.compare(0, SEGMENT_PREFIX.size(), SEGMENT_PREFIX) != 0 or
+            file_name.compare(file_name.size() - SEGMENT_SUFFIX.size(), SEGMENT_SUFFIX.size(), SEGMENT_SUFFIX) != 0) {
+            continue;
+        }
+        const auto number =
+            file_name.substr(SEGMENT_PREFIX.size(), file_name.size() - SEGMENT_PREFIX.size() - SEGMENT_SUFFIX.size());
+        try {
+            segment_numbers.push_back(std::stoull(number));
+        } catch (const std::exception& e) {
+            EVLOG_warning << "Ignoring file " << file_name << " in message queue log directory";
+        }
+    }
+    std::sort(segment_numbers.begin(), segment_numbers.end());
+
+    for (const auto number : segment_numbers) {
+        const auto path = this->get_segment_path(number);
+        std::ifstream ifs(path, std::ios::binary);
+        const std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+        std::size_t offset = 0;
+        while (offset < content.size()) {
+            if (content.size() - offset < RECORD_HEADER_SIZE) {
+                break;
+            }
+            const auto payload_size = read_uint32(content, offset);
+            if (content.size() - offset - RECORD_HEADER_SIZE < payload_size) {
+                break;
+            }
+            const auto payload = content.substr(offset + RECORD_HEADER_SIZE, payload_size);
+            if (crc32(payload) != read_uint32(content, offset + 4)) {
+                break;
+            }
+            try {
+                this->apply(json::parse(payload), RECORD_HEADER_SIZE + payload_size);
+            } catch (const std::exception& e) {
+                EVLOG_error << "Could not apply record of message queue segment " << path << ": " << e.what();
+                break;
+            }
+            offset += RECORD_HEADER_SIZE + payload_size;
+        }
+
+        if (offset < content.size()) {
+            EVLOG_warning << "Discarding " << content.size() - offset << " bytes of torn or corrupted records of "
+                          << "message queue segment " << path;
+            if (number == segment_numbers.back()) {
+                // the following appends must not end up behind the discarded bytes
+                fs::resize_file(path, offset);
+            } else {
+                this->garbage_bytes += content.size() - offset;
+            }
+        }
+    }
+
+    this->open_segment(segment_numbers.empty() ? 0 : segment_numbers.back());
+    this->compact_if_needed();
+}
+
+void MessageQueueSegmentLog::apply(const json& record, std::size_t record_size) {
+    auto& queue = this->queues.at(get_queue(static_cast<QueueType>(record.at("queue").get<int>())));
+    const auto op = record.at("op").get<std::string>();
+
+    if (op == "insert") {
+        DBTransactionMessage message;
+        message.unique_id = record.at("unique_id");
+        message.json_message = record.at("message");
+        message.message_type = record.at("message_type");
+        message.message_attempts = record.at("message_attempts");
+        message.timestamp = DateTime(record.at("timestamp").get<std::string>());
+
+        const auto sequence_number = queue.sequence_numbers.find(message.unique_id);
+        if (sequence_number != queue.sequence_numbers.end()) {
+            // a message can only be inserted twice if the log has been compacted, but the older segments have not
+            // been deleted yet. The message keeps its position
+            auto& entry = queue.entries.at(sequence_number->second);
+            this->live_bytes -= entry.record_size;
+            this->garbage_bytes += entry.record_size;
+            entry = {std::move(message), record_size};
+        } else {
+            queue.sequence_numbers[message.unique_id] = this->next_sequence_number;
+            queue.entries.emplace(this->next_sequence_number, Entry{std::move(message), record_size});
+            this->next_sequence_number++;
+        }
+        this->live_bytes += record_size;
+    } else if (op == "remove") {
+        const auto sequence_number = queue.sequence_numbers.find(record.at("unique_id").get<std::string>());
+        if (sequence_number != queue.sequence_numbers.end()) {
+            const auto entry = queue.entries.find(sequence_number->second);
+            this->live_bytes -= entry->second.record_size;
+            this->garbage_bytes += entry->second.record_size;
+            queue.entries.erase(entry);
+            queue.sequence_numbers.erase(sequence_number);
+        }
+        this->garbage_bytes += record_size;
+    } else if (op == "clear") {
+        for (const auto& [sequence_number, entry] : queue.entries) {
+            this->live_bytes -= entry.record_size;
+            this->garbage_bytes += entry.record_size;
+        }
+        queue.entries.clear();
+        queue.sequence_numbers.clear();
+        this->garbage_bytes += record_size;
+    } else {
+        throw std::invalid_argument("Unknown operation " + op);
+    }
+}
+
+void MessageQueueSegmentLog::append(const json& record) {
+    const auto encoded = encode_record(record);
+    if (this->segment_size > 0 and this->segment_size + encoded.size() > this->max_segment_size) {
+        this->open_segment(this->segment_number + 1);
+    }
+
+    const char* data = encoded.data();
+    std::size_t remaining = encoded.size();
+    while (remaining > 0) {
+        const auto written = ::write(this->segment_fd, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            // drop the partially written record or continue in a new segment, so the following records can still be
+            // recovered
+            if (::ftruncate(this->segment_fd, this->segment_size) != 0) {
+                this->open_segment(this->segment_number + 1);
+            }
+            throw QueryExecutionException("Could not append record to message queue segment");
+        }
+        data += written;
+        remaining -= static_cast<std::size_t>(written);
+    }
+    if (this->sync_appends and ::fdatasync(this->segment_fd) != 0) {
+        EVLOG_warning << "Could not sync message queue segment " << this->get_segment_path(this->segment_number);
+    }
+    this->segment_size += encoded.size();
+
+    this->apply(record, encoded.size());
+}
+
+void MessageQueueSegmentLog::compact_if_needed() {
+    if (this->garbage_bytes < this->max_segment_size or this->garbage_bytes <= this->live_bytes) {
+        return;
+    }
+
+    std::string content;
+    for (const auto& [queue_type, queue] : this->queues) {
+        for (const auto& [sequence_number, entry] : queue.entries) {
+            content += encode_record(insert_record(entry.message, queue_type));
+        }
+    }
+
+    // the compacted segment only becomes visible once it is complete, if the older segments can not be deleted the
+    // records of the compacted segment are simply applied again during the recovery
+    const auto compacted_segment_number = this->segment_number + 1;
+    if (!write_file_atomically(this->get_segment_path(compacted_segment_number), content)) {
+        EVLOG_warning << "Could not compact message queue log in " << this->directory;
+        return;
+    }
+    const auto old_segment_number = this->segment_number;
+    this->open_segment(compacted_segment_number);
+    std::vector<fs::path> old_segments;
+    for (const auto& file : fs::directory_iterator(this->directory)) {
+        if (file.path().filename().string().compare(0, SEGMENT_PREFIX.size(), SEGMENT_PREFIX) == 0 and
+            file.path() != this->get_segment_path(compacted_segment_number)) {
+            old_segments.push_back(file.path());
+        }
+    }
+    for (const auto& path : old_segments) {
+        fs::remove(path);
+    }
+    EVLOG_debug << "Compacted message queue log from segment " << old_segment_number << " into segment "
+                << compacted_segment_number << ", dropped " << this->garbage_bytes << " bytes";
+    this->garbage_bytes = 0;
+}
+
+std::vector<DBTransactionMessage> MessageQueueSegmentLog::get_message_queue_messages(const QueueType queue_type) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    std::vector<DBTransactionMessage> messages;
+    for (const auto& [sequence_number, entry] : this->queues.at(get_queue(queue_type)).entries) {
+        messages.push_back(entry.message);
+    }
+    return messages;
+}
+
+void MessageQueueSegmentLog::insert_message_queue_message(const DBTransactionMessage& message,
+                                                          const QueueType queue_type) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    if (this->queues.at(get_queue(queue_type)).sequence_numbers.count(message.unique_id)) {
+        throw QueryExecutionException("Message with unique id " + message.unique_id + " is already queued");
+    }
+    this->append(insert_record(message, get_queue(queue_type)));
+}
+
+void MessageQueueSegmentLog::remove_message_queue_message(const std::string& unique_id, const QueueType queue_type) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    if (this->queues.at(get_queue(queue_type)).sequence_numbers.count(unique_id) == 0) {
+        return;
+    }
+    this->append(json{{"op", "remove"}, {"queue", static_cast<int>(get_queue(queue_type))}, {"unique_id", unique_id}});
+    this->compact_if_needed();
+}
+
+void MessageQueueSegmentLog::clear_message_queue(const QueueType queue_type) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    if (this->queues.at(get_queue(queue_type)).entries.empty()) {
+        return;
+    }
+    this->append(json{{"op", "clear"}, {"queue", static_cast<int>(get_queue(queue_type))}});
+    this->compact_if_needed();
+}
+
+std::size_t move_message_queue_messages(MessageQueuePersistenceInterface& source,
+                                        MessageQueuePersistenceInterface& destination) {
+    std::size_t moved = 0;
+    for (const auto queue_type : {QueueType::Normal, QueueType::Transaction}) {
+        const auto messages = source.get_message_queue_messages(queue_type);
+        if (messages.empty()) {
+            continue;
+        }
+
+        // a previous move may have been interrupted after inserting some of the messages
+        std::set<std::string> queued_unique_ids;
+        for (const auto& message : destination.get_message_queue_messages(queue_type)) {
+            queued_unique_ids.insert(message.unique_id);
+        }
+        for (const auto& message : messages) {
+            if (queued_unique_ids.count(message.unique_id) == 0) {
+                destination.insert_message_queue_message(message, queue_type);
+                moved++;
+            }
+        }
+        source.clear_message_queue(queue_type);
+    }
+    return moved;
+}
+
+MessageQueuePersistenceSelection
+open_message_queue_persistence(const std::shared_ptr<MessageQueuePersistenceInterface>& database,
+                               const std::optional<fs::path>& directory,
+                               const std::optional<fs::path>& previous_directory) {
+    MessageQueuePersistenceSelection selection{database, std::nullopt};
+    if (directory.has_value()) {
+        // the log may contain queued messages even if it can not be opened right now
+        selection.segment_log_directory = directory;
+        try {
+            selection.persistence = std::make_shared<MessageQueueSegmentLog>(directory.value());
+        } catch (const std::exception& e) {
+            EVLOG_error << "Could not open message queue segment log, persisting messages in the database. Messages "
+                           "queued in the segment log are sent once it can be opened again: "
+                        << e.what();
+        }
+        if (selection.persistence != database) {
+            try {
+                const auto moved = move_message_queue_messages(*database, *selection.persistence);
+                if (moved > 0) {
+                    EVLOG_info << "Moved " << moved
+                               << " queued messages from the database to the message queue segment log";
+                }
+            } catch (const std::exception& e) {
+                EVLOG_error << "Could not move the queued messages of the database to the message queue segment log, "
+                               "they are moved on the next start: "
+                            << e.what();
+            }
+        }
+    }
+
+    if (!previous_directory.has_value() or previous_directory == directory) {
+        return selection;
+    }
+
+    try {
+        if (!fs::exists(previous_directory.value())) {
+            return selection;
+        }
+        MessageQueueSegmentLog previous_segment_log(previous_directory.value());
+        const auto moved = move_message_queue_messages(previous_segment_log, *selection.persistence);
+        if (moved > 0) {
+            EVLOG_info << "Moved " << moved << " queued messages from the message queue segment log in "
+                       << previous_directory.value();
+        }
+    } catch (const std::exception& e) {
+        EVLOG_error << "Could not move the queued messages of the message queue segment log in "
+                    << previous_directory.value() << ", they are moved on the next start: " << e.what();
+        if (!selection.segment_log_directory.has_value()) {
+            selection.segment_log_directory = previous_directory;
+        }
+    }
+    return selection;
+}
+
+} // namespace ocpp::common
@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <algorithm>
+
+#include <boost/asio/post.hpp>
+
+#include <ocpp/common/timer_service.hpp>
+
+namespace ocpp {
+
+TimerService::TimerService(boost::asio::io_context& io_context, std::chrono::milliseconds resolution,
+                           const std::shared_ptr<Strand>& default_strand) :
+    asio_timer(io_context),
+    resolution(std::max(std::chrono::duration_cast<clock::duration>(resolution), clock::duration(1))),
+    epoch(clock::now()),
+    strand(default_strand != nullptr ? default_strand : std::make_shared<Strand>(io_context.get_executor())),
+    next_id(1) {
+}
+
+TimerService::TimerId TimerService::timeout(const std::function<void()>& callback, clock::duration delay,
+                                            const std::shared_ptr<Strand>& strand) {
+    return this->schedule(callback, delay, clock::duration::zero(), strand);
+}
+
+TimerService::TimerId TimerService::interval(const std::function<void()>& callback, clock::duration interval,
+                                             const std::shared_ptr<Strand>& strand) {
+    // intervals shorter than a tick would be run on every wakeup anyway
+    interval = std::max(interval, this->resolution);
+    return this->schedule(callback, interval, interval, strand);
+}
+
+TimerService::TimerId TimerService::schedule(const std::function<void()>& callback, clock::duration delay,
+                                             clock::duration interval, const std::shared_ptr<Strand>& strand) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    const auto id = this->next_id++;
+    auto& timer = this->timers[id];
+    timer.callback = callback;
+    timer.strand = strand != nullptr ? strand : this->strand;
+    timer.interval = interval;
+    timer.deadline = clock::now() + std::max(delay, clock::duration::zero());
+    this->enqueue(id, timer);
+    this->arm();
+    return id;
+}
+
+void TimerService::enqueue(TimerId id, Timer& timer) {
+    // round up so that a timer is never run before its deadline
+    const auto offset = timer.deadline - this->epoch;
+    const auto tick = static_cast<uint64_t>((offset + this->resolution - clock::duration(1)) / this->resolution);
+    timer.tick = tick;
+    this->ticks[tick].push_back(id);
+}
+
+void TimerService::arm() {
+    if (this->ticks.empty()) {
+        if (this->armed_tick.has_value()) {
+            this->asio_timer.cancel();
+            this->armed_tick.reset();
+        }
+        return;
+    }
+
+    const auto next_tick = this->ticks.begin()->first;
+    if (this->armed_tick == next_tick) {
+        return;
+    }
+    this->armed_tick = next_tick;
+    this->asio_timer.expires_at(this->epoch + next_tick * this->resolution);
+    this->asio_timer.async_wait([weak_service = this->weak_from_this()](const boost::system::error_code& ec) {
+        if (ec == boost::asio::error::operation_aborted) {
+            // rearmed or cancelled
+            return;
+        }
+        if (auto timer_service = weak_service.lock()) {
+            timer_service->on_wakeup();
+        }
+    });
+}
+
+void TimerService::on_wakeup() {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    this->armed_tick.reset();
+    const auto now = clock::now();
+    const auto current_tick = static_cast<uint64_t>((now - this->epoch) / this->resolution);
+    bool dispatched = false;
+
+    auto it = this->ticks.begin();
+    while (it != this->ticks.end() and it->first <= current_tick) {
+        for (const auto id : it->second) {
+            auto timer_it = this->timers.find(id);
+            if (timer_it == this->timers.end() or timer_it->second.tick != it->first) {
+                continue;
+            }
+            auto& timer = timer_it->second;
+
+            boost::asio::post(*timer.strand, [weak_service = this->weak_from_this(), id, deadline = timer.deadline,
+                                              callback = timer.callback]() {
+                if (auto timer_service = weak_service.lock()) {
+                    timer_service->run(id, deadline, callback);
+                }
+            });
+            dispatched = true;
+
+            if (timer.interval > clock::duration::zero()) {
+                timer.deadline += timer.interval;
+                if (timer.deadline <= now) {
+                    // skip runs that have been missed instead of running them in a burst
+                    timer.deadline = now + timer.interval;
+                }
+                this->enqueue(id, timer);
+            } else {
+                timer.tick.reset();
+            }
+        }
+        it = this->ticks.erase(it);
+    }
+
+    if (dispatched) {
+        this->metrics.wakeups++;
+    }
+    this->arm();
+}
+
+void TimerService::run(TimerId id, clock::time_point deadline, const std::function<void()>& callback) {
+    {
+        // the timer might have been cancelled after its callback has been posted
+        std::lock_guard<std::mutex> lk(this->mutex);
+        auto timer_it = this->timers.find(id);
+        if (timer_it == this->timers.end()) {
+            return;
+        }
+        if (timer_it->second.interval == clock::duration::zero()) {
+            this->timers.erase(timer_it);
+        }
+
+        // the lag includes the time the callback has been waiting for its strand
+        const auto lag = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - deadline);
+        this->metrics.max_lag = std::max(this->metrics.max_lag, lag);
+        this->metrics.total_lag += lag;
+        this->metrics.callbacks++;
+    }
+    if (callback != nullptr) {
+        callback();
+    }
+}
+
+void TimerService::cancel(TimerId id) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    // the entry in ticks is skipped once its tick is processed
+    this->timers.erase(id);
+}
+
+bool TimerService::is_scheduled(TimerId id) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    return this->timers.find(id) != this->timers.end();
+}
+
+TimerServiceMetrics TimerService::get_metrics() {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    return this->metrics;
+}
+
+BatchedTimer::BatchedTimer(const std::shared_ptr<TimerService>& timer_service, const std::function<void()>& callback,
+                           const std::shared_ptr<Strand>& strand) :
+    timer_service(timer_service), callback(callback), strand(strand) {
+}
+
+BatchedTimer::~BatchedTimer() {
+    this->stop();
+}
+
+void BatchedTimer::set_callback(const std::function<void()>& callback) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    this->callback = callback;
+}
+
+void BatchedTimer::start(TimerService::clock::duration duration, bool periodic) {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    auto timer_service = this->timer_service.lock();
+    if (timer_service == nullptr) {
+        return;
+    }
+    if (this->timer_id.has_value()) {
+        timer_service->cancel(this->timer_id.value());
+    }
+    this->timer_id = periodic ? timer_service->interval(this->callback, duration, this->strand)
+                              : timer_service->timeout(this->callback, duration, this->strand);
+}
+
+void BatchedTimer::stop() {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    if (!this->timer_id.has_value()) {
+        return;
+    }
+    if (auto timer_service = this->timer_service.lock()) {
+        timer_service->cancel(this->timer_id.value());
+    }
+    this->timer_id.reset();
+}
+
+bool BatchedTimer::is_running() {
+    std::lock_guard<std::mutex> lk(this->mutex);
+    if (!this->timer_id.has_value()) {
+        return false;
+    }
+    auto timer_service = this->timer_service.lock();
+    return timer_service != nullptr and timer_service->is_scheduled(this->timer_id.value());
+}
+
+} // namespace ocpp
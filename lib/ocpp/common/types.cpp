@@ -1287,4 +1287,41 @@ firmware_status_notification_to_firmware_status_enum_type(const FirmwareStatusNo
 
 } // namespace conversions
 
+namespace conversions {
+std::string message_priority_to_string(MessagePriority e) {
+    switch (e) {
+    case MessagePriority::High:
+        return "High";
+    case MessagePriority::Normal:
+        return "Normal";
+    case MessagePriority::Transaction:
+        return "Transaction";
+    case MessagePriority::Low:
+        return "Low";
+    }
+    throw EnumToStringException{e, "MessagePriority"};
+}
+
+MessagePriority string_to_message_priority(const std::string& s) {
+    if (s == "High") {
+        return MessagePriority::High;
+    }
+    if (s == "Normal") {
+        return MessagePriority::Normal;
+    }
+    if (s == "Transaction") {
+        return MessagePriority::Transaction;
+    }
+    if (s == "Low") {
+        return MessagePriority::Low;
+    }
+    throw StringToEnumException{s, "MessagePriority"};
+}
+} // namespace conversions
+
+std::ostream& operator<<(std::ostream& os, const MessagePriority& message_priority) {
+    os << conversions::message_priority_to_string(message_priority);
+    return os;
+}
+
 } // namespace ocpp
@@ -2,9 +2,15 @@
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
 #include <mutex>
+#include <optional>
 #include <regex>
 #include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <ocpp/common/utils.hpp>
 
@@ -104,4 +110,93 @@ bool is_boolean(const std::string& value) {
     return iequals(value, "true") || iequals(value, "false");
 }
 
+/// \brief Follows the symlinks at \p path
+/// \return The path of the file the symlinks point to, or std::nullopt if there are too many levels of symlinks
+static std::optional<fs::path> resolve_symlinks(const fs::path& path) {
+    // same limit as the kernel applies when following symlinks
+    constexpr int MAX_SYMLINKS = 40;
+
+    auto target = path;
+    for (int i = 0; i < MAX_SYMLINKS; i++) {
+        std::error_code ec;
+        if (!fs::is_symlink(target, ec)) {
+            return target;
+        }
+        const auto link = fs::read_symlink(target, ec);
+        if (ec) {
+            return std::nullopt;
+        }
+        target = link.is_absolute() ? link : target.parent_path() / link;
+    }
+    return std::nullopt;
+}
+
+bool write_file_atomically(const fs::path& path, const std::string& content) {
+    // replace the file a symlink points to instead of the symlink itself
+    const auto target_path = resolve_symlinks(path);
+    if (!target_path.has_value()) {
+        return false;
+    }
+    const auto tmp_path = fs::path(target_path.value().string() + ".tmp");
+
+    // create a new file that is only accessible by the owner, a left over temporary file might have any mode
+    std::remove(tmp_path.c_str());
+    const int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (fd < 0) {
+        return false;
+    }
+
+    bool success = true;
+
+    // keep the permissions and the ownership of the file that is replaced
+    struct stat original;
+    if (::stat(target_path.value().c_str(), &original) == 0) {
+        if (::fchmod(fd, original.st_mode & 07777) != 0) {
+            success = false;
+        }
+        if ((original.st_uid != ::geteuid() or original.st_gid != ::getegid()) and
+            ::fchown(fd, original.st_uid, original.st_gid) != 0) {
+            // the file would become inaccessible for its owner
+            success = false;
+        }
+    }
+
+    const char* data = content.data();
+    std::size_t remaining = content.size();
+    while (success and remaining > 0) {
+        const auto written = ::write(fd, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            success = false;
+            break;
+        }
+        data += written;
+        remaining -= static_cast<std::size_t>(written);
+    }
+
+    if (::fsync(fd) != 0) {
+        success = false;
+    }
+    if (::close(fd) != 0) {
+        success = false;
+    }
+
+    if (!success or std::rename(tmp_path.c_str(), target_path.value().c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+    // make the rename itself durable
+    const auto directory = target_path.value().has_parent_path() ? target_path.value().parent_path() : fs::path(".");
+    const int dir_fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir_fd >= 0) {
+        ::fsync(dir_fd);
+        ::close(dir_fd);
+    }
+
+    return true;
+}
+
 } // namespace ocpp
@@ -19,6 +19,10 @@ Websocket::Websocket(const WebsocketConnectionOptions& connection_options, std::
     this->websocket = std::make_unique<WebsocketLibwebsockets>(connection_options, evse_security);
 }
 
+Websocket::Websocket(std::unique_ptr<WebsocketBase> websocket, std::shared_ptr<MessageLogging> logging) :
+    websocket(std::move(websocket)), logging(logging) {
+}
+
 Websocket::~Websocket() {
 }
 
@@ -94,4 +98,8 @@ void Websocket::set_authorization_key(const std::string& authorization_key) {
     this->websocket->set_authorization_key(authorization_key);
 }
 
+LatencyHistogramSnapshot Websocket::get_send_latency() const {
+    return this->websocket->get_send_latency();
+}
+
 } // namespace ocpp
@@ -173,6 +173,10 @@ void WebsocketBase::set_authorization_key(const std::string& authorization_key)
     this->connection_options.authorization_key = authorization_key;
 }
 
+LatencyHistogramSnapshot WebsocketBase::get_send_latency() const {
+    return this->send_latency.get_snapshot();
+}
+
 void WebsocketBase::on_pong_timeout(std::string msg) {
     if (!this->reconnecting) {
         EVLOG_info << "Reconnecting because of a pong timeout after " << this->connection_options.pong_timeout_s << "s";
@@ -7,6 +7,8 @@
 
 #include <libwebsockets.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -15,8 +17,15 @@
 #include <mutex>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <openssl/evp.h>
 #include <openssl/opensslv.h>
+#include <openssl/pem.h>
 #include <openssl/ssl.h>
 #include <openssl/x509v3.h>
 
@@ -57,6 +66,27 @@ public:
     }
 };
 
+template <> class std::default_delete<SSL_SESSION> {
+public:
+    void operator()(SSL_SESSION* ptr) const {
+        ::SSL_SESSION_free(ptr);
+    }
+};
+
+template <> class std::default_delete<BIO> {
+public:
+    void operator()(BIO* ptr) const {
+        ::BIO_free(ptr);
+    }
+};
+
+template <> class std::default_delete<EVP_MD_CTX> {
+public:
+    void operator()(EVP_MD_CTX* ptr) const {
+        ::EVP_MD_CTX_free(ptr);
+    }
+};
+
 namespace ocpp {
 
 using evse_security::is_custom_private_key_file;
@@ -225,6 +255,35 @@ public:
         return lws_ctx.get();
     }
 
+    /// \brief Builds the permessage-deflate offer from the given \p options
+    /// \returns the extensions to be used for the lws context, they stay valid as long as this object
+    const lws_extension* init_extensions(const WebsocketConnectionOptions& options,
+                                         lws_extension_callback_function* deflate_callback) {
+        const auto client_window_bits = std::clamp(options.deflate_client_max_window_bits, 8, 15);
+        const auto server_window_bits = std::clamp(options.deflate_server_max_window_bits, 8, 15);
+
+        this->deflate_client_offer = "permessage-deflate; client_max_window_bits=" +
+                                     std::to_string(client_window_bits) +
+                                     "; server_max_window_bits=" + std::to_string(server_window_bits);
+        if (options.deflate_client_no_context_takeover) {
+            this->deflate_client_offer += "; client_no_context_takeover";
+        }
+        if (options.deflate_server_no_context_takeover) {
+            this->deflate_client_offer += "; server_no_context_takeover";
+        }
+        this->deflate_min_message_size = options.deflate_min_message_size;
+
+        this->extensions.at(0) = {"permessage-deflate", deflate_callback, this->deflate_client_offer.c_str()};
+        this->extensions.at(1) = {nullptr, nullptr, nullptr};
+        EVLOG_debug << "Offering websocket extension: " << this->deflate_client_offer;
+        return this->extensions.data();
+    }
+
+    // No need for sync here since its only set before the lws context is created
+    std::size_t get_deflate_min_message_size() const {
+        return deflate_min_message_size;
+    }
+
     // No need for sync here since its set on construction
     WebsocketLibwebsockets* get_owner() {
         return owner;
@@ -237,6 +296,10 @@ private:
     std::unique_ptr<lws_context> lws_ctx;
     // Internal used WSI
     lws* wsi;
+    // Extensions offered to the CSMS, referenced by the lws context
+    std::array<lws_extension, 2> extensions{};
+    std::string deflate_client_offer;
+    std::size_t deflate_min_message_size = 0;
     // Owner, set on creation
     WebsocketLibwebsockets* owner;
 
@@ -423,6 +486,108 @@ static int callback_minimal(struct lws* wsi, enum lws_callback_reasons reason, v
     return 0;
 }
 
+bool skip_permessage_deflate(std::size_t input_length, std::size_t min_message_size) {
+    return input_length > 0 and input_length < min_message_size;
+}
+
+/// \brief Adds the content of the file at \p path to the digest \p ctx
+static bool digest_file(EVP_MD_CTX* ctx, const std::filesystem::path& path) {
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs) {
+        return false;
+    }
+
+    std::array<char, 4096> buffer;
+    while (ifs.read(buffer.data(), buffer.size()) or ifs.gcount() > 0) {
+        EVP_DigestUpdate(ctx, buffer.data(), static_cast<std::size_t>(ifs.gcount()));
+    }
+    return true;
+}
+
+/// \brief Returns the hex encoded SHA-256 digest of the certificates at \p location, which is either a bundle file or
+/// a directory of certificates, or an empty string if they can not be read
+static std::string get_ca_bundle_digest(const std::filesystem::path& location) {
+    std::unique_ptr<EVP_MD_CTX> ctx(EVP_MD_CTX_new());
+    if (ctx == nullptr or EVP_DigestInit_ex(ctx.get(), EVP_sha256(), nullptr) != 1) {
+        return {};
+    }
+
+    std::error_code ec;
+    if (std::filesystem::is_directory(location, ec)) {
+        std::vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::directory_iterator(location, ec)) {
+            files.push_back(entry.path());
+        }
+        // the iteration order is unspecified
+        std::sort(files.begin(), files.end());
+        for (const auto& file : files) {
+            const auto name = file.filename().string();
+            EVP_DigestUpdate(ctx.get(), name.c_str(), name.size() + 1);
+            if (std::filesystem::is_regular_file(file, ec) and !digest_file(ctx.get(), file)) {
+                return {};
+            }
+        }
+    } else if (!digest_file(ctx.get(), location)) {
+        return {};
+    }
+
+    std::array<unsigned char, EVP_MAX_MD_SIZE> digest;
+    unsigned int digest_size = 0;
+    if (EVP_DigestFinal_ex(ctx.get(), digest.data(), &digest_size) != 1) {
+        return {};
+    }
+
+    static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+    std::string result;
+    for (unsigned int i = 0; i < digest_size; i++) {
+        result.push_back(HEX_DIGITS[digest[i] >> 4]);
+        result.push_back(HEX_DIGITS[digest[i] & 0x0F]);
+    }
+    return result;
+}
+
+std::string get_tls_session_key(const WebsocketConnectionOptions& options, const std::string& path_chain,
+                                const std::optional<std::string>& ca_location) {
+    auto uri = options.csms_uri;
+    std::string key = uri.get_hostname() + ":" + std::to_string(uri.get_port()) + ";" +
+                      std::to_string(options.security_profile) + ";" + path_chain;
+    if (!path_chain.empty()) {
+        // a renewed client certificate is often written to the same path, a session negotiated with the previous
+        // certificate must not be resumed
+        std::error_code ec;
+        const auto last_write_time = std::filesystem::last_write_time(path_chain, ec);
+        if (!ec) {
+            key += ";" + std::to_string(last_write_time.time_since_epoch().count());
+        }
+    }
+
+    // a resumed session skips the verification of the CSMS certificate, so it is only valid for the trust anchors and
+    // verification settings it has been verified with
+    key += ";" + std::to_string(options.use_ssl_default_verify_paths) +
+           std::to_string(options.verify_csms_common_name) + std::to_string(options.verify_csms_allow_wildcards);
+    if (ca_location.has_value()) {
+        key += ";" + ca_location.value() + ";" + get_ca_bundle_digest(ca_location.value());
+    }
+    return key;
+}
+
+#if !defined(LWS_WITHOUT_EXTENSIONS)
+static int callback_permessage_deflate(struct lws_context* context, const struct lws_extension* ext, struct lws* wsi,
+                                       enum lws_extension_callback_reasons reason, void* user, void* in, size_t len) {
+    if (reason == LWS_EXT_CB_PAYLOAD_TX) {
+        auto* data = static_cast<ConnectionData*>(lws_context_user(context));
+        const auto* ebufs = static_cast<const lws_ext_pm_deflate_rx_ebufs*>(in);
+
+        if (data != nullptr and ebufs != nullptr and ebufs->eb_in.len >= 0 and
+            skip_permessage_deflate(static_cast<std::size_t>(ebufs->eb_in.len), data->get_deflate_min_message_size())) {
+            return 0;
+        }
+    }
+
+    return lws_extension_callback_pm_deflate(context, ext, wsi, reason, user, in, len);
+}
+#endif
+
 static int private_key_callback(char* buf, int size, int rwflag, void* userdata) {
     const auto* password = static_cast<const std::string*>(userdata);
     const std::size_t max_pass_len = (size - 1); // we exclude the endline
@@ -435,6 +600,45 @@ static int private_key_callback(char* buf, int size, int rwflag, void* userdata)
     return max_copy_chars;
 }
 
+/// \brief Index of the WebsocketLibwebsockets owning an SSL_CTX in its ex data
+static int tls_session_owner_index() {
+    static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+    return index;
+}
+
+static int new_tls_session_callback(SSL* ssl, SSL_SESSION* session) {
+    auto* owner =
+        static_cast<WebsocketLibwebsockets*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), tls_session_owner_index()));
+    if (owner == nullptr) {
+        return 0;
+    }
+
+    // Returning 1 hands our reference of the session to the owner
+    owner->store_tls_session(session);
+    return 1;
+}
+
+static void tls_session_info_callback(const SSL* ssl, int where, int ret) {
+    // The session must be set before the ClientHello is written, which happens right after the handshake start
+    if (!(where & SSL_CB_HANDSHAKE_START) or !SSL_in_before(ssl)) {
+        return;
+    }
+
+    auto* owner =
+        static_cast<WebsocketLibwebsockets*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), tls_session_owner_index()));
+    if (owner == nullptr) {
+        return;
+    }
+
+    std::unique_ptr<SSL_SESSION> session(owner->get_tls_session());
+    if (session != nullptr and SSL_SESSION_is_resumable(session.get())) {
+        // SSL_set_session takes its own reference
+        if (SSL_set_session(const_cast<SSL*>(ssl), session.get()) == 1) {
+            EVLOG_debug << "Attempting to resume TLS session";
+        }
+    }
+}
+
 constexpr auto local_protocol_name = "lws-everest-client";
 static const struct lws_protocols protocols[] = {{local_protocol_name, callback_minimal, 0, 0, 0, NULL, 0},
                                                  LWS_PROTOCOL_LIST_TERM};
@@ -561,23 +765,21 @@ void WebsocketLibwebsockets::thread_websocket_message_recv_loop(std::shared_ptr<
 
     EVLOG_debug << "Init recv loop with ID: " << std::hex << std::this_thread::get_id();
 
-    while (!local_data->is_interupted()) {
-        // Process all messages
-        while (true) {
-            std::string message{};
-
-            {
-                if (recv_message_queue.empty())
-                    break;
+    std::vector<std::string> messages;
 
-                message = recv_message_queue.pop();
-            }
+    while (!local_data->is_interupted()) {
+        // Process all messages, the pending ones are taken out of the queue at once so the websocket
+        // thread pushing new messages does not have to wait for a lock handoff per message
+        recv_message_queue.drain_into(messages);
 
+        for (const auto& message : messages) {
             // Invoke our processing callback, that might trigger a send back that
             // can cause a deadlock if is not managed on a different thread
             this->message_callback(message);
         }
 
+        messages.clear();
+
         // While we are empty, sleep, only if we have not been interrupted in the
         // message_callback. An interrupt can be caused in the message callback
         // if we receive a certain message type that will cause the implementation
@@ -614,6 +816,14 @@ bool WebsocketLibwebsockets::initialize_connection_options(std::shared_ptr<Conne
 
     info.fd_limit_per_thread = 1 + 1 + 1;
 
+    if (this->connection_options.enable_permessage_deflate) {
+#if !defined(LWS_WITHOUT_EXTENSIONS)
+        info.extensions = local_data->init_extensions(this->connection_options, callback_permessage_deflate);
+#else
+        EVLOG_warning << "permessage-deflate is enabled, but libwebsockets has been built without extensions";
+#endif
+    }
+
     // Lifetime of this is important since we use the data from this in private_key_callback()
     std::optional<std::string> private_key_password;
     SSL_CTX* ssl_ctx = nullptr;
@@ -683,6 +893,14 @@ bool WebsocketLibwebsockets::initialize_connection_options(std::shared_ptr<Conne
             return false;
         }
 
+        if (this->connection_options.enable_tls_session_resumption) {
+            std::optional<std::string> ca_location;
+            if (this->evse_security->is_ca_certificate_installed(ocpp::CaCertificateType::CSMS)) {
+                ca_location = this->evse_security->get_verify_location(ocpp::CaCertificateType::CSMS);
+            }
+            this->init_tls_session_resumption(ssl_ctx, path_chain, ca_location);
+        }
+
         // Setup our context
         info.provided_client_ssl_ctx = ssl_ctx;
     }
@@ -698,6 +916,100 @@ bool WebsocketLibwebsockets::initialize_connection_options(std::shared_ptr<Conne
     return true;
 }
 
+void WebsocketLibwebsockets::init_tls_session_resumption(SSL_CTX* ctx, const std::string& path_chain,
+                                                         const std::optional<std::string>& ca_location) {
+    const auto key = get_tls_session_key(this->connection_options, path_chain, ca_location);
+
+    {
+        std::lock_guard<std::mutex> lock(this->tls_session_mutex);
+        if (this->tls_session_key != key) {
+            this->tls_session.reset();
+            this->tls_session_key = key;
+            this->load_tls_session_file();
+        }
+    }
+
+    // Sessions are only cached by us, the internal cache of the SSL_CTX is recreated on every reconnect
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_set_ex_data(ctx, tls_session_owner_index(), this);
+    SSL_CTX_sess_set_new_cb(ctx, new_tls_session_callback);
+    SSL_CTX_set_info_callback(ctx, tls_session_info_callback);
+}
+
+void WebsocketLibwebsockets::store_tls_session(SSL_SESSION* session) {
+    std::lock_guard<std::mutex> lock(this->tls_session_mutex);
+    this->tls_session.reset(session, SSL_SESSION_free);
+    this->save_tls_session_file();
+}
+
+SSL_SESSION* WebsocketLibwebsockets::get_tls_session() {
+    std::lock_guard<std::mutex> lock(this->tls_session_mutex);
+    if (this->tls_session == nullptr or SSL_SESSION_up_ref(this->tls_session.get()) != 1) {
+        return nullptr;
+    }
+    return this->tls_session.get();
+}
+
+void WebsocketLibwebsockets::load_tls_session_file() {
+    if (!this->connection_options.tls_session_file.has_value() or
+        !std::filesystem::exists(this->connection_options.tls_session_file.value())) {
+        return;
+    }
+
+    std::unique_ptr<BIO> bio(BIO_new_file(this->connection_options.tls_session_file.value().c_str(), "r"));
+    if (bio == nullptr) {
+        EVLOG_warning << "Could not open TLS session file: " << this->connection_options.tls_session_file.value();
+        return;
+    }
+
+    // The first line holds the key the session has been negotiated for, the PEM encoded session follows
+    std::array<char, 1024> line{};
+    if (BIO_gets(bio.get(), line.data(), line.size()) <= 0 or
+        std::string(line.data()) != this->tls_session_key + "\n") {
+        return;
+    }
+
+    auto* session = PEM_read_bio_SSL_SESSION(bio.get(), nullptr, nullptr, nullptr);
+    if (session != nullptr) {
+        this->tls_session.reset(session, SSL_SESSION_free);
+        EVLOG_info << "Loaded TLS session from: " << this->connection_options.tls_session_file.value();
+    }
+}
+
+void WebsocketLibwebsockets::save_tls_session_file() {
+    if (!this->connection_options.tls_session_file.has_value() or this->tls_session == nullptr) {
+        return;
+    }
+
+    // The session secret must not be readable by others, so the file is created with restricted permissions
+    const int fd = ::open(this->connection_options.tls_session_file.value().c_str(),
+                          O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        EVLOG_warning << "Could not open TLS session file: " << this->connection_options.tls_session_file.value();
+        return;
+    }
+
+    // The mode of an existing file is not changed by open, so it is restricted before the secret is written
+    if (::fchmod(fd, S_IRUSR | S_IWUSR) != 0) {
+        EVLOG_warning << "Could not restrict the permissions of TLS session file: "
+                      << this->connection_options.tls_session_file.value();
+        ::close(fd);
+        return;
+    }
+
+    std::unique_ptr<BIO> bio(BIO_new_fd(fd, BIO_CLOSE));
+    if (bio == nullptr) {
+        ::close(fd);
+        return;
+    }
+
+    const auto key_line = this->tls_session_key + "\n";
+    if (BIO_puts(bio.get(), key_line.c_str()) <= 0 or
+        PEM_write_bio_SSL_SESSION(bio.get(), this->tls_session.get()) != 1) {
+        EVLOG_warning << "Could not write TLS session file: " << this->connection_options.tls_session_file.value();
+    }
+}
+
 void WebsocketLibwebsockets::thread_websocket_client_loop(std::shared_ptr<ConnectionData> local_data) {
     if (local_data == nullptr) {
         EVLOG_AND_THROW(std::runtime_error("Null 'ConnectionData' in client thread, fatal error!"));
@@ -1139,6 +1451,7 @@ void WebsocketLibwebsockets::poll_message(const std::shared_ptr<WebsocketMessage
     }
 
     EVLOG_debug << "Queueing message over TLS websocket: " << msg->payload;
+    const auto queued_at = std::chrono::steady_clock::now();
     message_queue.push(msg);
 
     // Request a write callback
@@ -1148,6 +1461,8 @@ void WebsocketLibwebsockets::poll_message(const std::shared_ptr<WebsocketMessage
                                        std::chrono::seconds(MESSAGE_SEND_TIMEOUT_S));
 
     if (msg->message_sent) {
+        this->send_latency.record(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - queued_at));
         EVLOG_debug << "Successfully sent last message over TLS websocket!";
     } else {
         EVLOG_warning << "Could not send last message over TLS websocket!";
@@ -1671,26 +1986,29 @@ void WebsocketLibwebsockets::push_deferred_callback(const std::function<void()>&
 }
 
 void WebsocketLibwebsockets::thread_deferred_callback_queue() {
-    while (true) {
-        std::function<void()> callback;
-        {
-            this->deferred_callback_queue.wait_on_queue_element_or_predicate(
-                [this]() { return this->stop_deferred_handler.load(); });
+    std::vector<std::function<void()>> callbacks;
 
-            if (stop_deferred_handler and this->deferred_callback_queue.empty()) {
-                break;
-            }
+    while (true) {
+        this->deferred_callback_queue.wait_on_queue_element_or_predicate(
+            [this]() { return this->stop_deferred_handler.load(); });
 
-            callback = this->deferred_callback_queue.pop();
+        if (stop_deferred_handler and this->deferred_callback_queue.empty()) {
+            break;
         }
 
-        // This needs to be out of lock scope otherwise we still keep the mutex locked while executing the callback.
-        // This would block the callers of push_deferred_callback()
-        if (callback) {
-            callback();
-        } else {
-            EVLOG_error << "Stale callback in deferred queue!";
+        // The callbacks are executed out of the queue's lock, otherwise the callers of push_deferred_callback()
+        // would be blocked while a callback is executed
+        this->deferred_callback_queue.drain_into(callbacks);
+
+        for (const auto& callback : callbacks) {
+            if (callback) {
+                callback();
+            } else {
+                EVLOG_error << "Stale callback in deferred queue!";
+            }
         }
+
+        callbacks.clear();
     }
 }
 
@@ -1,5 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright Pionix GmbH and Contributors to EVerest
+#include <algorithm>
+#include <cctype>
 #include <fstream>
 #include <future>
 #include <mutex>
@@ -16,8 +18,16 @@
 namespace ocpp {
 namespace v16 {
 
+namespace {
+/// \brief Time to wait for further changes before the user config is written
+constexpr auto USER_CONFIG_WRITE_DELAY = std::chrono::milliseconds(500);
+/// \brief Maximum time a change of the user config is kept in memory while further changes keep coming in
+constexpr auto USER_CONFIG_MAX_WRITE_DELAY = std::chrono::seconds(5);
+} // namespace
+
 ChargePointConfiguration::ChargePointConfiguration(const std::string& config, const fs::path& ocpp_main_path,
-                                                   const fs::path& user_config_path) {
+                                                   const fs::path& user_config_path) :
+    user_config_writer_running(false) {
 
     this->user_config_path = user_config_path;
     if (!fs::exists(this->user_config_path)) {
@@ -186,6 +196,47 @@ ChargePointConfiguration::ChargePointConfiguration(const std::string& config, co
     this->supported_message_types_receiving.insert(MessageType::GetLocalListVersion);
     this->supported_message_types_receiving.insert(MessageType::SendLocalList);
     this->supported_message_types_receiving.insert(MessageType::ReserveNow);
+
+    this->publish_snapshot();
+    this->init_key_descriptors();
+
+    this->user_config_writer_running = true;
+    this->user_config_writer_thread = std::thread([this]() { this->run_user_config_writer(); });
+}
+
+ChargePointConfiguration::~ChargePointConfiguration() {
+    {
+        std::lock_guard<std::mutex> lock(this->user_config_mutex);
+        this->user_config_writer_running = false;
+    }
+    this->user_config_cv.notify_one();
+    if (this->user_config_writer_thread.joinable()) {
+        this->user_config_writer_thread.join();
+    }
+    this->flush_user_config();
+}
+
+std::shared_ptr<const ConfigurationSnapshot> ChargePointConfiguration::get_snapshot() const {
+    return std::atomic_load(&this->snapshot);
+}
+
+void ChargePointConfiguration::publish_snapshot() {
+    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
+    auto new_snapshot = std::make_shared<ConfigurationSnapshot>();
+    new_snapshot->number_of_connectors = this->config["Core"]["NumberOfConnectors"];
+    new_snapshot->heartbeat_interval = this->config["Core"]["HeartbeatInterval"];
+    new_snapshot->clock_aligned_data_interval = this->config["Core"]["ClockAlignedDataInterval"];
+    new_snapshot->meter_value_sample_interval = this->config["Core"]["MeterValueSampleInterval"];
+    new_snapshot->meter_values_aligned_data =
+        this->csv_to_measurand_with_phase_vector(this->config["Core"]["MeterValuesAlignedData"]);
+    new_snapshot->meter_values_sampled_data =
+        this->csv_to_measurand_with_phase_vector(this->config["Core"]["MeterValuesSampledData"]);
+    new_snapshot->meter_values_aligned_data_plan = MeterValueSamplingPlan(new_snapshot->meter_values_aligned_data);
+    new_snapshot->meter_values_sampled_data_plan = MeterValueSamplingPlan(new_snapshot->meter_values_sampled_data);
+    new_snapshot->websocket_ping_payload = this->config["Internal"]["WebsocketPingPayload"];
+    new_snapshot->supported_message_types_sending = this->supported_message_types_sending;
+    new_snapshot->supported_message_types_receiving = this->supported_message_types_receiving;
+    std::atomic_store(&this->snapshot, std::shared_ptr<const ConfigurationSnapshot>(std::move(new_snapshot)));
 }
 
 json ChargePointConfiguration::get_user_config() {
@@ -201,11 +252,62 @@ json ChargePointConfiguration::get_user_config() {
 }
 
 void ChargePointConfiguration::setInUserConfig(std::string profile, std::string key, const json value) {
-    json user_config = this->get_user_config();
-    user_config[profile][key] = value;
-    std::ofstream ofs(this->user_config_path.c_str());
-    ofs << user_config << std::endl;
-    ofs.close();
+    std::lock_guard<std::mutex> lock(this->user_config_mutex);
+    const auto now = std::chrono::steady_clock::now();
+    if (!this->user_config_first_change.has_value()) {
+        this->user_config_first_change = now;
+    }
+    this->pending_user_config[{profile, key}] = value;
+    this->user_config_write_deadline =
+        std::min(now + USER_CONFIG_WRITE_DELAY, this->user_config_first_change.value() + USER_CONFIG_MAX_WRITE_DELAY);
+    this->user_config_cv.notify_one();
+}
+
+void ChargePointConfiguration::write_pending_user_config() {
+    if (this->pending_user_config.empty()) {
+        this->user_config_first_change.reset();
+        this->user_config_write_deadline.reset();
+        return;
+    }
+
+    try {
+        json user_config = this->get_user_config();
+        for (const auto& [profile_and_key, value] : this->pending_user_config) {
+            user_config[profile_and_key.first][profile_and_key.second] = value;
+        }
+        if (write_file_atomically(this->user_config_path, user_config.dump() + "\n")) {
+            this->pending_user_config.clear();
+            this->user_config_first_change.reset();
+            this->user_config_write_deadline.reset();
+            return;
+        }
+        EVLOG_error << "Could not write user config file: " << this->user_config_path;
+    } catch (const json::exception& e) {
+        EVLOG_error << "Could not update user config file: " << e.what();
+    }
+
+    // keep the changes and try again later
+    this->user_config_write_deadline = std::chrono::steady_clock::now() + USER_CONFIG_MAX_WRITE_DELAY;
+}
+
+void ChargePointConfiguration::run_user_config_writer() {
+    std::unique_lock<std::mutex> lock(this->user_config_mutex);
+    while (this->user_config_writer_running) {
+        if (!this->user_config_write_deadline.has_value()) {
+            this->user_config_cv.wait(lock);
+            continue;
+        }
+        if (std::chrono::steady_clock::now() >= this->user_config_write_deadline.value()) {
+            this->write_pending_user_config();
+            continue;
+        }
+        this->user_config_cv.wait_until(lock, this->user_config_write_deadline.value());
+    }
+}
+
+void ChargePointConfiguration::flush_user_config() {
+    std::lock_guard<std::mutex> lock(this->user_config_mutex);
+    this->write_pending_user_config();
 }
 
 std::string to_csl(const std::vector<std::string>& vec) {
@@ -825,6 +927,41 @@ std::string ChargePointConfiguration::getTLSKeylogFile() {
     return this->config["Internal"]["TLSKeylogFile"];
 }
 
+bool ChargePointConfiguration::getEnablePermessageDeflate() {
+    return this->config["Internal"]["EnablePermessageDeflate"];
+}
+
+int ChargePointConfiguration::getPermessageDeflateClientMaxWindowBits() {
+    return this->config["Internal"]["PermessageDeflateClientMaxWindowBits"];
+}
+
+int ChargePointConfiguration::getPermessageDeflateServerMaxWindowBits() {
+    return this->config["Internal"]["PermessageDeflateServerMaxWindowBits"];
+}
+
+bool ChargePointConfiguration::getPermessageDeflateClientNoContextTakeover() {
+    return this->config["Internal"]["PermessageDeflateClientNoContextTakeover"];
+}
+
+bool ChargePointConfiguration::getPermessageDeflateServerNoContextTakeover() {
+    return this->config["Internal"]["PermessageDeflateServerNoContextTakeover"];
+}
+
+int ChargePointConfiguration::getPermessageDeflateMinMessageSize() {
+    return this->config["Internal"]["PermessageDeflateMinMessageSize"];
+}
+
+bool ChargePointConfiguration::getEnableTLSSessionResumption() {
+    return this->config["Internal"]["EnableTLSSessionResumption"];
+}
+
+std::optional<std::string> ChargePointConfiguration::getTLSSessionFile() {
+    if (this->config["Internal"].contains("TLSSessionFile")) {
+        return this->config["Internal"]["TLSSessionFile"];
+    }
+    return std::nullopt;
+}
+
 KeyValue ChargePointConfiguration::getWebsocketPingPayloadKeyValue() {
     KeyValue kv;
     kv.key = "WebsocketPingPayload";
@@ -1005,15 +1142,15 @@ bool ChargePointConfiguration::measurands_supported(std::string csv) {
 }
 
 std::set<MessageType> ChargePointConfiguration::getSupportedMessageTypesSending() {
-    return this->supported_message_types_sending;
+    return this->get_snapshot()->supported_message_types_sending;
 }
 
 std::set<MessageType> ChargePointConfiguration::getSupportedMessageTypesReceiving() {
-    return this->supported_message_types_receiving;
+    return this->get_snapshot()->supported_message_types_receiving;
 }
 
 std::string ChargePointConfiguration::getWebsocketPingPayload() {
-    return this->config["Internal"]["WebsocketPingPayload"];
+    return this->get_snapshot()->websocket_ping_payload;
 }
 
 int32_t ChargePointConfiguration::getWebsocketPongTimeout() {
@@ -1098,6 +1235,184 @@ std::optional<KeyValue> ChargePointConfiguration::getMessageQueueSizeThresholdKe
     return message_queue_size_threshold_kv;
 }
 
+std::optional<int> ChargePointConfiguration::getMaxPipelinedCalls() {
+    std::optional<int> max_pipelined_calls = std::nullopt;
+    if (this->config["Internal"].contains("MaxPipelinedCalls")) {
+        max_pipelined_calls.emplace(this->config["Internal"]["MaxPipelinedCalls"]);
+    }
+    return max_pipelined_calls;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMaxPipelinedCallsKeyValue() {
+    std::optional<KeyValue> max_pipelined_calls_kv = std::nullopt;
+    auto max_pipelined_calls = this->getMaxPipelinedCalls();
+    if (max_pipelined_calls.has_value()) {
+        KeyValue kv;
+        kv.key = "MaxPipelinedCalls";
+        kv.readonly = true;
+        kv.value.emplace(std::to_string(max_pipelined_calls.value()));
+        max_pipelined_calls_kv.emplace(kv);
+    }
+    return max_pipelined_calls_kv;
+}
+
+std::optional<std::string> ChargePointConfiguration::getPipelinedMessageTypes() {
+    if (this->config["Internal"].contains("PipelinedMessageTypes")) {
+        return this->config["Internal"]["PipelinedMessageTypes"];
+    }
+    return std::nullopt;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getPipelinedMessageTypesKeyValue() {
+    std::optional<KeyValue> pipelined_message_types_kv = std::nullopt;
+    auto pipelined_message_types = this->getPipelinedMessageTypes();
+    if (pipelined_message_types.has_value()) {
+        KeyValue kv;
+        kv.key = "PipelinedMessageTypes";
+        kv.readonly = true;
+        kv.value.emplace(pipelined_message_types.value());
+        pipelined_message_types_kv.emplace(kv);
+    }
+    return pipelined_message_types_kv;
+}
+
+std::optional<std::string> ChargePointConfiguration::getMessagePriorityWeights() {
+    if (this->config["Internal"].contains("MessagePriorityWeights")) {
+        return this->config["Internal"]["MessagePriorityWeights"];
+    }
+    return std::nullopt;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessagePriorityWeightsKeyValue() {
+    std::optional<KeyValue> message_priority_weights_kv = std::nullopt;
+    auto message_priority_weights = this->getMessagePriorityWeights();
+    if (message_priority_weights.has_value()) {
+        KeyValue kv;
+        kv.key = "MessagePriorityWeights";
+        kv.readonly = true;
+        kv.value.emplace(message_priority_weights.value());
+        message_priority_weights_kv.emplace(kv);
+    }
+    return message_priority_weights_kv;
+}
+
+std::optional<std::string> ChargePointConfiguration::getMessagePriorityQueueLimits() {
+    if (this->config["Internal"].contains("MessagePriorityQueueLimits")) {
+        return this->config["Internal"]["MessagePriorityQueueLimits"];
+    }
+    return std::nullopt;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessagePriorityQueueLimitsKeyValue() {
+    std::optional<KeyValue> message_priority_queue_limits_kv = std::nullopt;
+    auto message_priority_queue_limits = this->getMessagePriorityQueueLimits();
+    if (message_priority_queue_limits.has_value()) {
+        KeyValue kv;
+        kv.key = "MessagePriorityQueueLimits";
+        kv.readonly = true;
+        kv.value.emplace(message_priority_queue_limits.value());
+        message_priority_queue_limits_kv.emplace(kv);
+    }
+    return message_priority_queue_limits_kv;
+}
+
+std::optional<int> ChargePointConfiguration::getTransactionUpdateCompactionInterval() {
+    std::optional<int> transaction_update_compaction_interval = std::nullopt;
+    if (this->config["Internal"].contains("TransactionUpdateCompactionInterval")) {
+        transaction_update_compaction_interval.emplace(this->config["Internal"]["TransactionUpdateCompactionInterval"]);
+    }
+    return transaction_update_compaction_interval;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getTransactionUpdateCompactionIntervalKeyValue() {
+    std::optional<KeyValue> transaction_update_compaction_interval_kv = std::nullopt;
+    auto transaction_update_compaction_interval = this->getTransactionUpdateCompactionInterval();
+    if (transaction_update_compaction_interval.has_value()) {
+        KeyValue kv;
+        kv.key = "TransactionUpdateCompactionInterval";
+        kv.readonly = true;
+        kv.value.emplace(std::to_string(transaction_update_compaction_interval.value()));
+        transaction_update_compaction_interval_kv.emplace(kv);
+    }
+    return transaction_update_compaction_interval_kv;
+}
+
+std::optional<std::string> ChargePointConfiguration::getMessageQueueSegmentLogDirectory() {
+    if (this->config["Internal"].contains("MessageQueueSegmentLogDirectory")) {
+        return this->config["Internal"]["MessageQueueSegmentLogDirectory"];
+    }
+    return std::nullopt;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessageQueueSegmentLogDirectoryKeyValue() {
+    std::optional<KeyValue> message_queue_segment_log_directory_kv = std::nullopt;
+    auto message_queue_segment_log_directory = this->getMessageQueueSegmentLogDirectory();
+    if (message_queue_segment_log_directory.has_value()) {
+        KeyValue kv;
+        kv.key = "MessageQueueSegmentLogDirectory";
+        kv.readonly = true;
+        kv.value.emplace(message_queue_segment_log_directory.value());
+        message_queue_segment_log_directory_kv.emplace(kv);
+    }
+    return message_queue_segment_log_directory_kv;
+}
+
+std::optional<std::string> ChargePointConfiguration::getMessageQueueSegmentLogDirectoryInUse() {
+    if (this->config["Internal"].contains("MessageQueueSegmentLogDirectoryInUse")) {
+        return this->config["Internal"]["MessageQueueSegmentLogDirectoryInUse"];
+    }
+    return std::nullopt;
+}
+
+void ChargePointConfiguration::setMessageQueueSegmentLogDirectoryInUse(
+    const std::string& message_queue_segment_log_directory_in_use) {
+    this->config["Internal"]["MessageQueueSegmentLogDirectoryInUse"] = message_queue_segment_log_directory_in_use;
+    this->setInUserConfig("Internal", "MessageQueueSegmentLogDirectoryInUse",
+                          message_queue_segment_log_directory_in_use);
+}
+
+std::optional<int> ChargePointConfiguration::getMaxTransactionMeterValuesInMemory() {
+    std::optional<int> max_transaction_meter_values_in_memory = std::nullopt;
+    if (this->config["Internal"].contains("MaxTransactionMeterValuesInMemory")) {
+        max_transaction_meter_values_in_memory.emplace(this->config["Internal"]["MaxTransactionMeterValuesInMemory"]);
+    }
+    return max_transaction_meter_values_in_memory;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMaxTransactionMeterValuesInMemoryKeyValue() {
+    std::optional<KeyValue> max_transaction_meter_values_in_memory_kv = std::nullopt;
+    auto max_transaction_meter_values_in_memory = this->getMaxTransactionMeterValuesInMemory();
+    if (max_transaction_meter_values_in_memory.has_value()) {
+        KeyValue kv;
+        kv.key = "MaxTransactionMeterValuesInMemory";
+        kv.readonly = true;
+        kv.value.emplace(std::to_string(max_transaction_meter_values_in_memory.value()));
+        max_transaction_meter_values_in_memory_kv.emplace(kv);
+    }
+    return max_transaction_meter_values_in_memory_kv;
+}
+
+std::optional<int> ChargePointConfiguration::getExecutorThreads() {
+    std::optional<int> executor_threads = std::nullopt;
+    if (this->config["Internal"].contains("ExecutorThreads")) {
+        executor_threads.emplace(this->config["Internal"]["ExecutorThreads"]);
+    }
+    return executor_threads;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getExecutorThreadsKeyValue() {
+    std::optional<KeyValue> executor_threads_kv = std::nullopt;
+    auto executor_threads = this->getExecutorThreads();
+    if (executor_threads.has_value()) {
+        KeyValue kv;
+        kv.key = "ExecutorThreads";
+        kv.readonly = true;
+        kv.value.emplace(std::to_string(executor_threads.value()));
+        executor_threads_kv.emplace(kv);
+    }
+    return executor_threads_kv;
+}
+
 // Core Profile - optional
 std::optional<bool> ChargePointConfiguration::getAllowOfflineTxForUnknownId() {
     std::optional<bool> unknown_offline_auth = std::nullopt;
@@ -1197,11 +1512,12 @@ std::optional<KeyValue> ChargePointConfiguration::getBlinkRepeatKeyValue() {
 
 // Core Profile
 int32_t ChargePointConfiguration::getClockAlignedDataInterval() {
-    return this->config["Core"]["ClockAlignedDataInterval"];
+    return this->get_snapshot()->clock_aligned_data_interval;
 }
 void ChargePointConfiguration::setClockAlignedDataInterval(int32_t interval) {
     this->config["Core"]["ClockAlignedDataInterval"] = interval;
     this->setInUserConfig("Core", "ClockAlignedDataInterval", interval);
+    this->publish_snapshot();
 }
 KeyValue ChargePointConfiguration::getClockAlignedDataIntervalKeyValue() {
     KeyValue kv;
@@ -1278,11 +1594,12 @@ KeyValue ChargePointConfiguration::getGetConfigurationMaxKeysKeyValue() {
 
 // Core Profile
 int32_t ChargePointConfiguration::getHeartbeatInterval() {
-    return this->config["Core"]["HeartbeatInterval"];
+    return this->get_snapshot()->heartbeat_interval;
 }
 void ChargePointConfiguration::setHeartbeatInterval(int32_t interval) {
     this->config["Core"]["HeartbeatInterval"] = interval;
     this->setInUserConfig("Core", "HeartbeatInterval", interval);
+    this->publish_snapshot();
 }
 KeyValue ChargePointConfiguration::getHeartbeatIntervalKeyValue() {
     KeyValue kv;
@@ -1388,6 +1705,7 @@ bool ChargePointConfiguration::setMeterValuesAlignedData(std::string meter_value
     }
     this->config["Core"]["MeterValuesAlignedData"] = meter_values_aligned_data;
     this->setInUserConfig("Core", "MeterValuesAlignedData", meter_values_aligned_data);
+    this->publish_snapshot();
     return true;
 }
 KeyValue ChargePointConfiguration::getMeterValuesAlignedDataKeyValue() {
@@ -1398,7 +1716,7 @@ KeyValue ChargePointConfiguration::getMeterValuesAlignedDataKeyValue() {
     return kv;
 }
 std::vector<MeasurandWithPhase> ChargePointConfiguration::getMeterValuesAlignedDataVector() {
-    return this->csv_to_measurand_with_phase_vector(this->getMeterValuesAlignedData());
+    return this->get_snapshot()->meter_values_aligned_data;
 }
 
 // Core Profile - optional
@@ -1432,6 +1750,7 @@ bool ChargePointConfiguration::setMeterValuesSampledData(std::string meter_value
     }
     this->config["Core"]["MeterValuesSampledData"] = meter_values_sampled_data;
     this->setInUserConfig("Core", "MeterValuesSampledData", meter_values_sampled_data);
+    this->publish_snapshot();
     return true;
 }
 KeyValue ChargePointConfiguration::getMeterValuesSampledDataKeyValue() {
@@ -1442,7 +1761,7 @@ KeyValue ChargePointConfiguration::getMeterValuesSampledDataKeyValue() {
     return kv;
 }
 std::vector<MeasurandWithPhase> ChargePointConfiguration::getMeterValuesSampledDataVector() {
-    return this->csv_to_measurand_with_phase_vector(this->getMeterValuesSampledData());
+    return this->get_snapshot()->meter_values_sampled_data;
 }
 
 // Core Profile - optional
@@ -1468,11 +1787,12 @@ std::optional<KeyValue> ChargePointConfiguration::getMeterValuesSampledDataMaxLe
 
 // Core Profile
 int32_t ChargePointConfiguration::getMeterValueSampleInterval() {
-    return this->config["Core"]["MeterValueSampleInterval"];
+    return this->get_snapshot()->meter_value_sample_interval;
 }
 void ChargePointConfiguration::setMeterValueSampleInterval(int32_t interval) {
     this->config["Core"]["MeterValueSampleInterval"] = interval;
     this->setInUserConfig("Core", "MeterValueSampleInterval", interval);
+    this->publish_snapshot();
 }
 KeyValue ChargePointConfiguration::getMeterValueSampleIntervalKeyValue() {
     KeyValue kv;
@@ -1511,7 +1831,7 @@ std::optional<KeyValue> ChargePointConfiguration::getMinimumStatusDurationKeyVal
 
 // Core Profile
 int32_t ChargePointConfiguration::getNumberOfConnectors() {
-    return this->config["Core"]["NumberOfConnectors"];
+    return this->get_snapshot()->number_of_connectors;
 }
 KeyValue ChargePointConfiguration::getNumberOfConnectorsKeyValue() {
     KeyValue kv;
@@ -2986,399 +3306,201 @@ void ChargePointConfiguration::setCentralSystemURI(std::string centralSystemUri)
     this->setInUserConfig("Internal", "CentralSystemURI", centralSystemUri);
 }
 
-std::optional<KeyValue> ChargePointConfiguration::get(CiString<50> key) {
-    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
+void ChargePointConfiguration::init_key_descriptors() {
+    const auto add_getters = [this](std::optional<SupportedFeatureProfiles> profile,
+                                    std::initializer_list<std::pair<const char*, KeyGetter>> getters) {
+        for (const auto& [key, getter] : getters) {
+            auto& descriptor = this->key_descriptors[key];
+            descriptor.profile = profile;
+            descriptor.get = getter;
+        }
+    };
+
     // Internal Profile
-    if (key == "ChargePointId") {
-        return this->getChargePointIdKeyValue();
-    }
-    if (key == "CentralSystemURI") {
-        return this->getCentralSystemURIKeyValue();
-    }
-    if (key == "ChargeBoxSerialNumber") {
-        return this->getChargeBoxSerialNumberKeyValue();
-    }
-    if (key == "ChargePointModel") {
-        return this->getChargePointModelKeyValue();
-    }
-    if (key == "ChargePointSerialNumber") {
-        return this->getChargePointSerialNumberKeyValue();
-    }
-    if (key == "ChargePointVendor") {
-        return this->getChargePointVendorKeyValue();
-    }
-    if (key == "FirmwareVersion") {
-        return this->getFirmwareVersionKeyValue();
-    }
-    if (key == "ICCID") {
-        return this->getICCIDKeyValue();
-    }
-    if (key == "IMSI") {
-        return this->getIMSIKeyValue();
-    }
-    if (key == "MeterSerialNumber") {
-        return this->getMeterSerialNumberKeyValue();
-    }
-    if (key == "MeterType") {
-        return this->getMeterTypeKeyValue();
-    }
-    if (key == "SupportedCiphers12") {
-        return this->getSupportedCiphers12KeyValue();
-    }
-    if (key == "SupportedCiphers13") {
-        return this->getSupportedCiphers13KeyValue();
-    }
-    if (key == "RetryBackoffRandomRange") {
-        return this->getRetryBackoffRandomRangeKeyValue();
-    }
-    if (key == "RetryBackoffRepeatTimes") {
-        return this->getRetryBackoffRepeatTimesKeyValue();
-    }
-    if (key == "RetryBackoffWaitMinimum") {
-        return this->getRetryBackoffWaitMinimumKeyValue();
-    }
-    if (key == "AuthorizeConnectorZeroOnConnectorOne") {
-        return this->getAuthorizeConnectorZeroOnConnectorOneKeyValue();
-    }
-    if (key == "LogMessages") {
-        return this->getLogMessagesKeyValue();
-    }
-    if (key == "LogMessagesFormat") {
-        return this->getLogMessagesFormatKeyValue();
-    }
-    if (key == "SupportedChargingProfilePurposeTypes") {
-        return this->getSupportedChargingProfilePurposeTypesKeyValue();
-    }
-    if (key == "IgnoredProfilePurposesOffline") {
-        return this->getIgnoredProfilePurposesOfflineKeyValue();
-    }
-    if (key == "MaxCompositeScheduleDuration") {
-        return this->getMaxCompositeScheduleDurationKeyValue();
-    }
-    if (key == "CompositeScheduleDefaultLimitAmps") {
-        return this->getCompositeScheduleDefaultLimitAmpsKeyValue();
-    }
-    if (key == "CompositeScheduleDefaultLimitWatts") {
-        return this->getCompositeScheduleDefaultLimitWattsKeyValue();
-    }
-    if (key == "CompositeScheduleDefaultNumberPhases") {
-        return this->getCompositeScheduleDefaultNumberPhasesKeyValue();
-    }
-    if (key == "SupplyVoltage") {
-        return this->getSupplyVoltageKeyValue();
-    }
-    if (key == "WebsocketPingPayload") {
-        return this->getWebsocketPingPayloadKeyValue();
-    }
-    if (key == "WebsocketPongTimeout") {
-        return this->getWebsocketPongTimeoutKeyValue();
-    }
-    if (key == "UseSslDefaultVerifyPaths") {
-        return this->getUseSslDefaultVerifyPathsKeyValue();
-    }
-    if (key == "VerifyCsmsCommonName") {
-        return this->getVerifyCsmsCommonNameKeyValue();
-    }
-    if (key == "VerifyCsmsAllowWildcards") {
-        return this->getVerifyCsmsAllowWildcardsKeyValue();
-    }
-    if (key == "OcspRequestInterval") {
-        return this->getOcspRequestIntervalKeyValue();
-    }
-    if (key == "SeccLeafSubjectCommonName") {
-        return this->getSeccLeafSubjectCommonNameKeyValue();
-    }
-    if (key == "SeccLeafSubjectCountry") {
-        return this->getSeccLeafSubjectCountryKeyValue();
-    }
-    if (key == "SeccLeafSubjectOrganization") {
-        return this->getSeccLeafSubjectOrganizationKeyValue();
-    }
-    if (key == "ConnectorEvseIds") {
-        return this->getConnectorEvseIdsKeyValue();
-    }
-    if (key == "AllowChargingProfileWithoutStartSchedule") {
-        return this->getAllowChargingProfileWithoutStartScheduleKeyValue();
-    }
-    if (key == "WaitForStopTransactionsOnResetTimeout") {
-        return this->getWaitForStopTransactionsOnResetTimeoutKeyValue();
-    }
-    if (key == "HostName") {
-        return this->getHostNameKeyValue();
-    }
-    if (key == "SupportedMeasurands") {
-        return this->getSupportedMeasurandsKeyValue();
-    }
-    if (key == "MaxMessageSize") {
-        return this->getMaxMessageSizeKeyValue();
-    }
-    if (key == "QueueAllMessages") {
-        return this->getQueueAllMessagesKeyValue();
-    }
-    if (key == "MessageTypesDiscardForQueueing") {
-        return this->getMessageTypesDiscardForQueueingKeyValue();
-    }
-    if (key == "MessageQueueSizeThreshold") {
-        return this->getMessageQueueSizeThresholdKeyValue();
-    }
+    add_getters(std::nullopt,
+                {
+                    {"ChargePointId", [this]() { return this->getChargePointIdKeyValue(); }},
+                    {"CentralSystemURI", [this]() { return this->getCentralSystemURIKeyValue(); }},
+                    {"ChargeBoxSerialNumber", [this]() { return this->getChargeBoxSerialNumberKeyValue(); }},
+                    {"ChargePointModel", [this]() { return this->getChargePointModelKeyValue(); }},
+                    {"ChargePointSerialNumber", [this]() { return this->getChargePointSerialNumberKeyValue(); }},
+                    {"ChargePointVendor", [this]() { return this->getChargePointVendorKeyValue(); }},
+                    {"FirmwareVersion", [this]() { return this->getFirmwareVersionKeyValue(); }},
+                    {"ICCID", [this]() { return this->getICCIDKeyValue(); }},
+                    {"IMSI", [this]() { return this->getIMSIKeyValue(); }},
+                    {"MeterSerialNumber", [this]() { return this->getMeterSerialNumberKeyValue(); }},
+                    {"MeterType", [this]() { return this->getMeterTypeKeyValue(); }},
+                    {"SupportedCiphers12", [this]() { return this->getSupportedCiphers12KeyValue(); }},
+                    {"SupportedCiphers13", [this]() { return this->getSupportedCiphers13KeyValue(); }},
+                    {"RetryBackoffRandomRange", [this]() { return this->getRetryBackoffRandomRangeKeyValue(); }},
+                    {"RetryBackoffRepeatTimes", [this]() { return this->getRetryBackoffRepeatTimesKeyValue(); }},
+                    {"RetryBackoffWaitMinimum", [this]() { return this->getRetryBackoffWaitMinimumKeyValue(); }},
+                    {"AuthorizeConnectorZeroOnConnectorOne",
+                     [this]() { return this->getAuthorizeConnectorZeroOnConnectorOneKeyValue(); }},
+                    {"LogMessages", [this]() { return this->getLogMessagesKeyValue(); }},
+                    {"LogMessagesFormat", [this]() { return this->getLogMessagesFormatKeyValue(); }},
+                    {"SupportedChargingProfilePurposeTypes",
+                     [this]() { return this->getSupportedChargingProfilePurposeTypesKeyValue(); }},
+                    {"IgnoredProfilePurposesOffline",
+                     [this]() { return this->getIgnoredProfilePurposesOfflineKeyValue(); }},
+                    {"MaxCompositeScheduleDuration",
+                     [this]() { return this->getMaxCompositeScheduleDurationKeyValue(); }},
+                    {"CompositeScheduleDefaultLimitAmps",
+                     [this]() { return this->getCompositeScheduleDefaultLimitAmpsKeyValue(); }},
+                    {"CompositeScheduleDefaultLimitWatts",
+                     [this]() { return this->getCompositeScheduleDefaultLimitWattsKeyValue(); }},
+                    {"CompositeScheduleDefaultNumberPhases",
+                     [this]() { return this->getCompositeScheduleDefaultNumberPhasesKeyValue(); }},
+                    {"SupplyVoltage", [this]() { return this->getSupplyVoltageKeyValue(); }},
+                    {"WebsocketPingPayload", [this]() { return this->getWebsocketPingPayloadKeyValue(); }},
+                    {"WebsocketPongTimeout", [this]() { return this->getWebsocketPongTimeoutKeyValue(); }},
+                    {"UseSslDefaultVerifyPaths", [this]() { return this->getUseSslDefaultVerifyPathsKeyValue(); }},
+                    {"VerifyCsmsCommonName", [this]() { return this->getVerifyCsmsCommonNameKeyValue(); }},
+                    {"VerifyCsmsAllowWildcards", [this]() { return this->getVerifyCsmsAllowWildcardsKeyValue(); }},
+                    {"OcspRequestInterval", [this]() { return this->getOcspRequestIntervalKeyValue(); }},
+                    {"SeccLeafSubjectCommonName", [this]() { return this->getSeccLeafSubjectCommonNameKeyValue(); }},
+                    {"SeccLeafSubjectCountry", [this]() { return this->getSeccLeafSubjectCountryKeyValue(); }},
+                    {"SeccLeafSubjectOrganization",
+                     [this]() { return this->getSeccLeafSubjectOrganizationKeyValue(); }},
+                    {"ConnectorEvseIds", [this]() { return this->getConnectorEvseIdsKeyValue(); }},
+                    {"AllowChargingProfileWithoutStartSchedule",
+                     [this]() { return this->getAllowChargingProfileWithoutStartScheduleKeyValue(); }},
+                    {"WaitForStopTransactionsOnResetTimeout",
+                     [this]() { return this->getWaitForStopTransactionsOnResetTimeoutKeyValue(); }},
+                    {"HostName", [this]() { return this->getHostNameKeyValue(); }},
+                    {"SupportedMeasurands", [this]() { return this->getSupportedMeasurandsKeyValue(); }},
+                    {"MaxMessageSize", [this]() { return this->getMaxMessageSizeKeyValue(); }},
+                    {"QueueAllMessages", [this]() { return this->getQueueAllMessagesKeyValue(); }},
+                    {"MessageTypesDiscardForQueueing",
+                     [this]() { return this->getMessageTypesDiscardForQueueingKeyValue(); }},
+                    {"MessageQueueSizeThreshold", [this]() { return this->getMessageQueueSizeThresholdKeyValue(); }},
+                    {"MaxPipelinedCalls", [this]() { return this->getMaxPipelinedCallsKeyValue(); }},
+                    {"PipelinedMessageTypes", [this]() { return this->getPipelinedMessageTypesKeyValue(); }},
+                    {"MessagePriorityWeights", [this]() { return this->getMessagePriorityWeightsKeyValue(); }},
+                    {"MessagePriorityQueueLimits",
+                     [this]() { return this->getMessagePriorityQueueLimitsKeyValue(); }},
+                    {"TransactionUpdateCompactionInterval",
+                     [this]() { return this->getTransactionUpdateCompactionIntervalKeyValue(); }},
+                    {"MessageQueueSegmentLogDirectory",
+                     [this]() { return this->getMessageQueueSegmentLogDirectoryKeyValue(); }},
+                    {"MaxTransactionMeterValuesInMemory",
+                     [this]() { return this->getMaxTransactionMeterValuesInMemoryKeyValue(); }},
+                    {"ExecutorThreads", [this]() { return this->getExecutorThreadsKeyValue(); }}
+                });
 
     // Core Profile
-    if (key == "AllowOfflineTxForUnknownId") {
-        return this->getAllowOfflineTxForUnknownIdKeyValue();
-    }
-    if (key == "AuthorizationCacheEnabled") {
-        return this->getAuthorizationCacheEnabledKeyValue();
-    }
-    // we should not return an AuthorizationKey because it's readonly
-    // if (key == "AuthorizationKey") {
-    //     return this->getAuthorizationKeyKeyValue();
-    // }
-    if (key == "AuthorizeRemoteTxRequests") {
-        return this->getAuthorizeRemoteTxRequestsKeyValue();
-    }
-    if (key == "BlinkRepeat") {
-        return this->getBlinkRepeatKeyValue();
-    }
-    if (key == "ClockAlignedDataInterval") {
-        return this->getClockAlignedDataIntervalKeyValue();
-    }
-    if (key == "ConnectionTimeOut") {
-        return this->getConnectionTimeOutKeyValue();
-    }
-    if (key == "ConnectorPhaseRotation") {
-        return this->getConnectorPhaseRotationKeyValue();
-    }
-    if (key == "ConnectorPhaseRotationMaxLength") {
-        return this->getConnectorPhaseRotationMaxLengthKeyValue();
-    }
-    if (key == "CpoName") {
-        return this->getCpoNameKeyValue();
-    }
-    if (key == "GetConfigurationMaxKeys") {
-        return this->getGetConfigurationMaxKeysKeyValue();
-    }
-    if (key == "HeartbeatInterval") {
-        return this->getHeartbeatIntervalKeyValue();
-    }
-    if (key == "LightIntensity") {
-        return this->getLightIntensityKeyValue();
-    }
-    if (key == "LocalAuthorizeOffline") {
-        return this->getLocalAuthorizeOfflineKeyValue();
-    }
-    if (key == "LocalPreAuthorize") {
-        return this->getLocalPreAuthorizeKeyValue();
-    }
-    if (key == "MaxEnergyOnInvalidId") {
-        return this->getMaxEnergyOnInvalidIdKeyValue();
-    }
-    if (key == "MeterValuesAlignedData") {
-        return this->getMeterValuesAlignedDataKeyValue();
-    }
-    if (key == "MeterValuesAlignedDataMaxLength") {
-        return this->getMeterValuesAlignedDataMaxLengthKeyValue();
-    }
-    if (key == "MeterValuesSampledData") {
-        return this->getMeterValuesSampledDataKeyValue();
-    }
-    if (key == "MeterValuesSampledDataMaxLength") {
-        return this->getMeterValuesSampledDataMaxLengthKeyValue();
-    }
-    if (key == "MeterValueSampleInterval") {
-        return this->getMeterValueSampleIntervalKeyValue();
-    }
-    if (key == "MinimumStatusDuration") {
-        return this->getMinimumStatusDurationKeyValue();
-    }
-    if (key == "NumberOfConnectors") {
-        return this->getNumberOfConnectorsKeyValue();
-    }
-    if (key == "ReserveConnectorZeroSupported") {
-        return this->getReserveConnectorZeroSupportedKeyValue();
-    }
-    if (key == "ResetRetries") {
-        return this->getResetRetriesKeyValue();
-    }
-    if (key == "SecurityProfile") {
-        return this->getSecurityProfileKeyValue();
-    }
-    if (key == "DisableSecurityEventNotifications") {
-        return this->getDisableSecurityEventNotificationsKeyValue();
-    }
-    if (key == "StopTransactionOnEVSideDisconnect") {
-        return this->getStopTransactionOnEVSideDisconnectKeyValue();
-    }
-    if (key == "StopTransactionOnInvalidId") {
-        return this->getStopTransactionOnInvalidIdKeyValue();
-    }
-    if (key == "StopTxnAlignedData") {
-        return this->getStopTxnAlignedDataKeyValue();
-    }
-    if (key == "StopTxnAlignedDataMaxLength") {
-        return this->getStopTxnAlignedDataMaxLengthKeyValue();
-    }
-    if (key == "StopTxnSampledData") {
-        return this->getStopTxnSampledDataKeyValue();
-    }
-    if (key == "StopTxnSampledDataMaxLength") {
-        return this->getStopTxnSampledDataMaxLengthKeyValue();
-    }
-    if (key == "SupportedFeatureProfiles") {
-        return this->getSupportedFeatureProfilesKeyValue();
-    }
-    if (key == "SupportedFeatureProfilesMaxLength") {
-        return this->getSupportedFeatureProfilesMaxLengthKeyValue();
-    }
-    if (key == "TransactionMessageAttempts") {
-        return this->getTransactionMessageAttemptsKeyValue();
-    }
-    if (key == "TransactionMessageRetryInterval") {
-        return this->getTransactionMessageRetryIntervalKeyValue();
-    }
-    if (key == "UnlockConnectorOnEVSideDisconnect") {
-        return this->getUnlockConnectorOnEVSideDisconnectKeyValue();
-    }
-    if (key == "WebsocketPingInterval") {
-        return this->getWebsocketPingIntervalKeyValue();
-    }
+    add_getters(std::nullopt,
+                {
+                    {"AllowOfflineTxForUnknownId", [this]() { return this->getAllowOfflineTxForUnknownIdKeyValue(); }},
+                    {"AuthorizationCacheEnabled", [this]() { return this->getAuthorizationCacheEnabledKeyValue(); }},
+                    {"AuthorizeRemoteTxRequests", [this]() { return this->getAuthorizeRemoteTxRequestsKeyValue(); }},
+                    {"BlinkRepeat", [this]() { return this->getBlinkRepeatKeyValue(); }},
+                    {"ClockAlignedDataInterval", [this]() { return this->getClockAlignedDataIntervalKeyValue(); }},
+                    {"ConnectionTimeOut", [this]() { return this->getConnectionTimeOutKeyValue(); }},
+                    {"ConnectorPhaseRotation", [this]() { return this->getConnectorPhaseRotationKeyValue(); }},
+                    {"ConnectorPhaseRotationMaxLength",
+                     [this]() { return this->getConnectorPhaseRotationMaxLengthKeyValue(); }},
+                    {"CpoName", [this]() { return this->getCpoNameKeyValue(); }},
+                    {"GetConfigurationMaxKeys", [this]() { return this->getGetConfigurationMaxKeysKeyValue(); }},
+                    {"HeartbeatInterval", [this]() { return this->getHeartbeatIntervalKeyValue(); }},
+                    {"LightIntensity", [this]() { return this->getLightIntensityKeyValue(); }},
+                    {"LocalAuthorizeOffline", [this]() { return this->getLocalAuthorizeOfflineKeyValue(); }},
+                    {"LocalPreAuthorize", [this]() { return this->getLocalPreAuthorizeKeyValue(); }},
+                    {"MaxEnergyOnInvalidId", [this]() { return this->getMaxEnergyOnInvalidIdKeyValue(); }},
+                    {"MeterValuesAlignedData", [this]() { return this->getMeterValuesAlignedDataKeyValue(); }},
+                    {"MeterValuesAlignedDataMaxLength",
+                     [this]() { return this->getMeterValuesAlignedDataMaxLengthKeyValue(); }},
+                    {"MeterValuesSampledData", [this]() { return this->getMeterValuesSampledDataKeyValue(); }},
+                    {"MeterValuesSampledDataMaxLength",
+                     [this]() { return this->getMeterValuesSampledDataMaxLengthKeyValue(); }},
+                    {"MeterValueSampleInterval", [this]() { return this->getMeterValueSampleIntervalKeyValue(); }},
+                    {"MinimumStatusDuration", [this]() { return this->getMinimumStatusDurationKeyValue(); }},
+                    {"NumberOfConnectors", [this]() { return this->getNumberOfConnectorsKeyValue(); }},
+                    {"ReserveConnectorZeroSupported",
+                     [this]() { return this->getReserveConnectorZeroSupportedKeyValue(); }},
+                    {"ResetRetries", [this]() { return this->getResetRetriesKeyValue(); }},
+                    {"SecurityProfile", [this]() { return this->getSecurityProfileKeyValue(); }},
+                    {"DisableSecurityEventNotifications",
+                     [this]() { return this->getDisableSecurityEventNotificationsKeyValue(); }},
+                    {"StopTransactionOnEVSideDisconnect",
+                     [this]() { return this->getStopTransactionOnEVSideDisconnectKeyValue(); }},
+                    {"StopTransactionOnInvalidId", [this]() { return this->getStopTransactionOnInvalidIdKeyValue(); }},
+                    {"StopTxnAlignedData", [this]() { return this->getStopTxnAlignedDataKeyValue(); }},
+                    {"StopTxnAlignedDataMaxLength",
+                     [this]() { return this->getStopTxnAlignedDataMaxLengthKeyValue(); }},
+                    {"StopTxnSampledData", [this]() { return this->getStopTxnSampledDataKeyValue(); }},
+                    {"StopTxnSampledDataMaxLength",
+                     [this]() { return this->getStopTxnSampledDataMaxLengthKeyValue(); }},
+                    {"SupportedFeatureProfiles", [this]() { return this->getSupportedFeatureProfilesKeyValue(); }},
+                    {"SupportedFeatureProfilesMaxLength",
+                     [this]() { return this->getSupportedFeatureProfilesMaxLengthKeyValue(); }},
+                    {"TransactionMessageAttempts", [this]() { return this->getTransactionMessageAttemptsKeyValue(); }},
+                    {"TransactionMessageRetryInterval",
+                     [this]() { return this->getTransactionMessageRetryIntervalKeyValue(); }},
+                    {"UnlockConnectorOnEVSideDisconnect",
+                     [this]() { return this->getUnlockConnectorOnEVSideDisconnectKeyValue(); }},
+                    {"WebsocketPingInterval", [this]() { return this->getWebsocketPingIntervalKeyValue(); }}
+                });
 
     // PnC
-    if (this->supported_feature_profiles.count(SupportedFeatureProfiles::PnC)) {
-        if (key == "ISO15118PnCEnabled") {
-            return this->getISO15118PnCEnabledKeyValue();
-        }
-        if (key == "CentralContractValidationAllowed") {
-            return this->getCentralContractValidationAllowedKeyValue();
-        }
-        if (key == "CertSigningWaitMinimum") {
-            return this->getCertSigningWaitMinimumKeyValue();
-        }
-        if (key == "CertSigningRepeatTimes") {
-            return this->getCertSigningRepeatTimesKeyValue();
-        }
-        if (key == "ContractValidationOffline") {
-            return this->getContractValidationOfflineKeyValue();
-        }
-    }
+    add_getters(SupportedFeatureProfiles::PnC,
+                {
+                    {"ISO15118PnCEnabled", [this]() { return this->getISO15118PnCEnabledKeyValue(); }},
+                    {"CentralContractValidationAllowed",
+                     [this]() { return this->getCentralContractValidationAllowedKeyValue(); }},
+                    {"CertSigningWaitMinimum", [this]() { return this->getCertSigningWaitMinimumKeyValue(); }},
+                    {"CertSigningRepeatTimes", [this]() { return this->getCertSigningRepeatTimesKeyValue(); }},
+                    {"ContractValidationOffline", [this]() { return this->getContractValidationOfflineKeyValue(); }}
+                });
 
     // Smart Charging
-    if (this->supported_feature_profiles.count(SupportedFeatureProfiles::SmartCharging)) {
-        if (key == "ChargeProfileMaxStackLevel") {
-            return this->getChargeProfileMaxStackLevelKeyValue();
-        }
-        if (key == "ChargingScheduleAllowedChargingRateUnit") {
-            return this->getChargingScheduleAllowedChargingRateUnitKeyValue();
-        }
-        if (key == "ChargingScheduleMaxPeriods") {
-            return this->getChargingScheduleMaxPeriodsKeyValue();
-        }
-        if (key == "ConnectorSwitch3to1PhaseSupported") {
-            return this->getConnectorSwitch3to1PhaseSupportedKeyValue();
-        }
-        if (key == "MaxChargingProfilesInstalled") {
-            return this->getMaxChargingProfilesInstalledKeyValue();
-        }
-    }
-
-    // Local Auth List Managementg
-    if (this->supported_feature_profiles.count(SupportedFeatureProfiles::LocalAuthListManagement)) {
-        if (key == "LocalAuthListEnabled") {
-            return this->getLocalAuthListEnabledKeyValue();
-        }
-        if (key == "LocalAuthListMaxLength") {
-            return this->getLocalAuthListMaxLengthKeyValue();
-        }
-        if (key == "SendLocalListMaxLength") {
-            return this->getSendLocalListMaxLengthKeyValue();
-        }
-    }
-
-    if (this->supported_feature_profiles.count(SupportedFeatureProfiles::CostAndPrice)) {
-        // California Pricing
-        if (key == "CustomDisplayCostAndPrice") {
-            return this->getCustomDisplayCostAndPriceEnabledKeyValue();
-        }
+    add_getters(SupportedFeatureProfiles::SmartCharging,
+                {
+                    {"ChargeProfileMaxStackLevel", [this]() { return this->getChargeProfileMaxStackLevelKeyValue(); }},
+                    {"ChargingScheduleAllowedChargingRateUnit",
+                     [this]() { return this->getChargingScheduleAllowedChargingRateUnitKeyValue(); }},
+                    {"ChargingScheduleMaxPeriods", [this]() { return this->getChargingScheduleMaxPeriodsKeyValue(); }},
+                    {"ConnectorSwitch3to1PhaseSupported",
+                     [this]() { return this->getConnectorSwitch3to1PhaseSupportedKeyValue(); }},
+                    {"MaxChargingProfilesInstalled",
+                     [this]() { return this->getMaxChargingProfilesInstalledKeyValue(); }}
+                });
 
-        if (key == "NumberOfDecimalsForCostValues") {
-            return this->getPriceNumberOfDecimalsForCostValuesKeyValue();
-        }
-        if (key == "DefaultPrice") {
-            return this->getDefaultPriceKeyValue();
-        }
-        if (key.get().find("DefaultPriceText") == 0 and this->getCustomMultiLanguageMessagesEnabled().has_value() and
-            this->getCustomMultiLanguageMessagesEnabled().value()) {
-            const std::vector<std::string> message_language = split_string(key, ',');
-            if (message_language.size() > 1) {
-                return this->getDefaultPriceTextKeyValue(message_language.at(1));
-            }
-        }
-        if (key == "TimeOffset") {
-            return this->getDisplayTimeOffsetKeyValue();
-        }
-        if (key == "NextTimeOffsetTransitionDateTime") {
-            return this->getNextTimeOffsetTransitionDateTimeKeyValue();
-        }
-        if (key == "TimeOffsetNextTransition") {
-            return this->getTimeOffsetNextTransitionKeyValue();
-        }
-        if (key == "CustomIdleFeeAfterStop") {
-            return this->getCustomIdleFeeAfterStopKeyValue();
-        }
-        if (key == "SupportedLanguages") {
-            return this->getMultiLanguageSupportedLanguagesKeyValue();
-        }
-        if (key == "CustomMultiLanguageMessages") {
-            return this->getCustomMultiLanguageMessagesEnabledKeyValue();
-        }
-        if (key == "Language") {
-            return this->getLanguageKeyValue();
-        }
-    }
-
-    if (this->supported_feature_profiles.count(SupportedFeatureProfiles::Custom)) {
-        return this->getCustomKeyValue(key);
-    }
-
-    return std::nullopt;
-}
-
-std::vector<KeyValue> ChargePointConfiguration::get_all_key_value() {
-    std::vector<KeyValue> all;
-    for (auto feature_profile : this->getSupportedFeatureProfilesSet()) {
-        auto feature_profile_string = conversions::supported_feature_profiles_to_string(feature_profile);
-        if (this->config.contains(feature_profile_string)) {
-            auto& feature_config = this->config[feature_profile_string];
-            for (auto& feature_config_entry : feature_config.items()) {
-                const auto config_key = CiString<50>(feature_config_entry.key());
-                // DefaultPriceText is a special here, as it has multiple possible languages which are all separate
-                // key value pairs.
-                if (config_key.get().find("DefaultPriceText") == 0) {
-                    const auto price_text_key_values = getAllDefaultPriceTextKeyValues();
-                    if (price_text_key_values.has_value()) {
-                        for (const auto& kv : price_text_key_values.value()) {
-                            all.push_back(kv);
-                        }
-                    }
-                } else {
-                    auto config_value = this->get(config_key);
-                    if (config_value != std::nullopt) {
-                        all.push_back(config_value.value());
-                    }
-                }
-            }
-        }
-    }
-    return all;
-}
-
-ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500> value) {
-    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
-    if (key == "IgnoredProfilePurposesOffline") {
+    // Local Auth List Management
+    add_getters(SupportedFeatureProfiles::LocalAuthListManagement,
+                {
+                    {"LocalAuthListEnabled", [this]() { return this->getLocalAuthListEnabledKeyValue(); }},
+                    {"LocalAuthListMaxLength", [this]() { return this->getLocalAuthListMaxLengthKeyValue(); }},
+                    {"SendLocalListMaxLength", [this]() { return this->getSendLocalListMaxLengthKeyValue(); }}
+                });
+
+    // California Pricing
+    add_getters(SupportedFeatureProfiles::CostAndPrice,
+                {
+                    {"CustomDisplayCostAndPrice",
+                     [this]() { return this->getCustomDisplayCostAndPriceEnabledKeyValue(); }},
+                    {"NumberOfDecimalsForCostValues",
+                     [this]() { return this->getPriceNumberOfDecimalsForCostValuesKeyValue(); }},
+                    {"DefaultPrice", [this]() { return this->getDefaultPriceKeyValue(); }},
+                    {"TimeOffset", [this]() { return this->getDisplayTimeOffsetKeyValue(); }},
+                    {"NextTimeOffsetTransitionDateTime",
+                     [this]() { return this->getNextTimeOffsetTransitionDateTimeKeyValue(); }},
+                    {"TimeOffsetNextTransition", [this]() { return this->getTimeOffsetNextTransitionKeyValue(); }},
+                    {"CustomIdleFeeAfterStop", [this]() { return this->getCustomIdleFeeAfterStopKeyValue(); }},
+                    {"SupportedLanguages", [this]() { return this->getMultiLanguageSupportedLanguagesKeyValue(); }},
+                    {"CustomMultiLanguageMessages",
+                     [this]() { return this->getCustomMultiLanguageMessagesEnabledKeyValue(); }},
+                    {"Language", [this]() { return this->getLanguageKeyValue(); }}
+                });
+
+    // Writable keys
+    this->key_descriptors["IgnoredProfilePurposesOffline"].set = [this](const CiString<500>& value) {
         if (this->setIgnoredProfilePurposesOffline(value) == false) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "AllowOfflineTxForUnknownId") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["AllowOfflineTxForUnknownId"].set = [this](const CiString<500>& value) {
         if (this->getAllowOfflineTxForUnknownId() == std::nullopt) {
             return ConfigurationStatus::NotSupported;
         }
@@ -3387,8 +3509,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } else {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "AuthorizationCacheEnabled") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["AuthorizationCacheEnabled"].set = [this](const CiString<500>& value) {
         if (this->getAuthorizationCacheEnabled() == std::nullopt) {
             return ConfigurationStatus::NotSupported;
         }
@@ -3397,8 +3520,10 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } else {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "AuthorizationKey") {
+        return ConfigurationStatus::Accepted;
+    };
+    // AuthorizationKey is write-only, so it has no getter
+    this->key_descriptors["AuthorizationKey"].set = [this](const CiString<500>& value) {
         std::string authorization_key = value.get();
         if (authorization_key.length() >= 8) {
             this->setAuthorizationKey(value.get());
@@ -3407,11 +3532,12 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
             EVLOG_warning << "Attempt to change AuthorizationKey to value with < 8 characters";
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "AuthorizeRemoteTxRequests") {
+    };
+    this->key_descriptors["AuthorizeRemoteTxRequests"].set = [this](const CiString<500>& value) {
         this->setAuthorizeRemoteTxRequests(ocpp::conversions::string_to_bool(value.get()));
-    }
-    if (key == "BlinkRepeat") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["BlinkRepeat"].set = [this](const CiString<500>& value) {
         if (this->getBlinkRepeat() == std::nullopt) {
             return ConfigurationStatus::NotSupported;
         }
@@ -3426,8 +3552,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "ClockAlignedDataInterval") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["ClockAlignedDataInterval"].set = [this](const CiString<500>& value) {
         try {
             auto [valid, interval] = is_positive_integer(value.get());
             if (!valid) {
@@ -3439,8 +3566,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "ConnectionTimeOut") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["ConnectionTimeOut"].set = [this](const CiString<500>& value) {
         try {
             auto [valid, timeout] = is_positive_integer(value.get());
             if (!valid) {
@@ -3452,22 +3580,25 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "ConnectorPhaseRotation") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["ConnectorPhaseRotation"].set = [this](const CiString<500>& value) {
         if (this->isConnectorPhaseRotationValid(value.get())) {
             this->setConnectorPhaseRotation(value.get());
         } else {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "CentralContractValidationAllowed") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["CentralContractValidationAllowed"].set = [this](const CiString<500>& value) {
         if (this->getCentralContractValidationAllowed() == std::nullopt) {
             return ConfigurationStatus::NotSupported;
         } else {
             this->setContractValidationOffline(ocpp::conversions::string_to_bool(value.get()));
         }
-    }
-    if (key == "CertSigningWaitMinimum") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["CertSigningWaitMinimum"].set = [this](const CiString<500>& value) {
         if (this->getCertSigningWaitMinimum() == std::nullopt) {
             return ConfigurationStatus::NotSupported;
         } else {
@@ -3483,8 +3614,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
                 return ConfigurationStatus::Rejected;
             }
         }
-    }
-    if (key == "CertSigningRepeatTimes") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["CertSigningRepeatTimes"].set = [this](const CiString<500>& value) {
         if (this->getCertSigningRepeatTimes() == std::nullopt) {
             return ConfigurationStatus::NotSupported;
         } else {
@@ -3500,17 +3632,21 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
                 return ConfigurationStatus::Rejected;
             }
         }
-    }
-    if (key == "ContractValidationOffline") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["ContractValidationOffline"].set = [this](const CiString<500>& value) {
         this->setContractValidationOffline(ocpp::conversions::string_to_bool(value.get()));
-    }
-    if (key == "CpoName") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["CpoName"].set = [this](const CiString<500>& value) {
         this->setCpoName(value.get());
-    }
-    if (key == "DisableSecurityEventNotifications") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["DisableSecurityEventNotifications"].set = [this](const CiString<500>& value) {
         this->setDisableSecurityEventNotifications(ocpp::conversions::string_to_bool(value.get()));
-    }
-    if (key == "HeartbeatInterval") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["HeartbeatInterval"].set = [this](const CiString<500>& value) {
         try {
             auto [valid, interval] = is_positive_integer(value.get());
             if (!valid) {
@@ -3522,11 +3658,13 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "ISO15118PnCEnabled") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["ISO15118PnCEnabled"].set = [this](const CiString<500>& value) {
         this->setISO15118PnCEnabled(ocpp::conversions::string_to_bool(value.get()));
-    }
-    if (key == "LightIntensity") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["LightIntensity"].set = [this](const CiString<500>& value) {
         if (this->getLightIntensity() == std::nullopt) {
             return ConfigurationStatus::NotSupported;
         }
@@ -3541,22 +3679,25 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "LocalAuthorizeOffline") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["LocalAuthorizeOffline"].set = [this](const CiString<500>& value) {
         if (isBool(value.get())) {
             this->setLocalAuthorizeOffline(ocpp::conversions::string_to_bool(value.get()));
         } else {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "LocalPreAuthorize") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["LocalPreAuthorize"].set = [this](const CiString<500>& value) {
         if (isBool(value.get())) {
             this->setLocalPreAuthorize(ocpp::conversions::string_to_bool(value.get()));
         } else {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "MaxEnergyOnInvalidId") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["MaxEnergyOnInvalidId"].set = [this](const CiString<500>& value) {
         if (this->getMaxEnergyOnInvalidId() == std::nullopt) {
             return ConfigurationStatus::NotSupported;
         }
@@ -3571,18 +3712,21 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "MeterValuesAlignedData") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["MeterValuesAlignedData"].set = [this](const CiString<500>& value) {
         if (!this->setMeterValuesAlignedData(value.get())) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "MeterValuesSampledData") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["MeterValuesSampledData"].set = [this](const CiString<500>& value) {
         if (!this->setMeterValuesSampledData(value.get())) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "MeterValueSampleInterval") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["MeterValueSampleInterval"].set = [this](const CiString<500>& value) {
         try {
             auto [valid, meter_value_sample_interval] = is_positive_integer(value.get());
             if (!valid) {
@@ -3594,8 +3738,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "MinimumStatusDuration") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["MinimumStatusDuration"].set = [this](const CiString<500>& value) {
         if (this->getMinimumStatusDuration() == std::nullopt) {
             return ConfigurationStatus::NotSupported;
         }
@@ -3610,8 +3755,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "OcspRequestInterval") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["OcspRequestInterval"].set = [this](const CiString<500>& value) {
         try {
             auto [valid, ocsp_request_interval] = is_positive_integer(value.get());
             if (!valid or ocsp_request_interval < 86400) {
@@ -3623,8 +3769,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "WaitForStopTransactionsOnResetTimeout") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["WaitForStopTransactionsOnResetTimeout"].set = [this](const CiString<500>& value) {
         try {
             auto [valid, wait_for_stop_transactions_on_reset_timeout] = is_positive_integer(value.get());
             if (!valid) {
@@ -3636,8 +3783,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "ResetRetries") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["ResetRetries"].set = [this](const CiString<500>& value) {
         try {
             auto [valid, reset_retries] = is_positive_integer(value.get());
             if (!valid) {
@@ -3649,32 +3797,37 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "StopTransactionOnEVSideDisconnect") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["StopTransactionOnEVSideDisconnect"].set = [this](const CiString<500>& value) {
         if (isBool(value.get())) {
             this->setStopTransactionOnEVSideDisconnect(ocpp::conversions::string_to_bool(value.get()));
         } else {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "StopTransactionOnInvalidId") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["StopTransactionOnInvalidId"].set = [this](const CiString<500>& value) {
         if (isBool(value.get())) {
             this->setStopTransactionOnInvalidId(ocpp::conversions::string_to_bool(value.get()));
         } else {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "StopTxnAlignedData") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["StopTxnAlignedData"].set = [this](const CiString<500>& value) {
         if (!this->setStopTxnAlignedData(value.get())) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "StopTxnSampledData") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["StopTxnSampledData"].set = [this](const CiString<500>& value) {
         if (!this->setStopTxnSampledData(value.get())) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "TransactionMessageAttempts") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["TransactionMessageAttempts"].set = [this](const CiString<500>& value) {
         try {
             auto [valid, message_attempts] = is_positive_integer(value.get());
             if (!valid) {
@@ -3686,8 +3839,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "TransactionMessageRetryInterval") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["TransactionMessageRetryInterval"].set = [this](const CiString<500>& value) {
         try {
             auto [valid, retry_inverval] = is_positive_integer(value.get());
             if (!valid) {
@@ -3699,15 +3853,17 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "UnlockConnectorOnEVSideDisconnect") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["UnlockConnectorOnEVSideDisconnect"].set = [this](const CiString<500>& value) {
         if (isBool(value.get())) {
             this->setUnlockConnectorOnEVSideDisconnect(ocpp::conversions::string_to_bool(value.get()));
         } else {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "WebsocketPingInterval") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["WebsocketPingInterval"].set = [this](const CiString<500>& value) {
         if (this->getWebsocketPingInterval() == std::nullopt) {
             return ConfigurationStatus::NotSupported;
         }
@@ -3722,10 +3878,10 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-
+        return ConfigurationStatus::Accepted;
+    };
     // Local Auth List Management
-    if (key == "LocalAuthListEnabled") {
+    this->key_descriptors["LocalAuthListEnabled"].set = [this](const CiString<500>& value) {
         if (this->supported_feature_profiles.count(SupportedFeatureProfiles::LocalAuthListManagement)) {
             if (isBool(value.get())) {
                 this->setLocalAuthListEnabled(ocpp::conversions::string_to_bool(value.get()));
@@ -3735,9 +3891,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } else {
             return ConfigurationStatus::NotSupported;
         }
-    }
-
-    if (key == "CompositeScheduleDefaultLimitAmps") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["CompositeScheduleDefaultLimitAmps"].set = [this](const CiString<500>& value) {
         if (not this->getCompositeScheduleDefaultLimitAmps().has_value()) {
             return ConfigurationStatus::NotSupported;
         }
@@ -3752,8 +3908,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "CompositeScheduleDefaultLimitWatts") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["CompositeScheduleDefaultLimitWatts"].set = [this](const CiString<500>& value) {
         if (not this->getCompositeScheduleDefaultLimitWatts().has_value()) {
             return ConfigurationStatus::NotSupported;
         }
@@ -3768,8 +3925,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "CompositeScheduleDefaultNumberPhases") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["CompositeScheduleDefaultNumberPhases"].set = [this](const CiString<500>& value) {
         if (not this->getCompositeScheduleDefaultNumberPhases().has_value()) {
             return ConfigurationStatus::NotSupported;
         }
@@ -3784,8 +3942,9 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-    if (key == "SupplyVoltage") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["SupplyVoltage"].set = [this](const CiString<500>& value) {
         if (not this->getSupplyVoltage().has_value()) {
             return ConfigurationStatus::NotSupported;
         }
@@ -3800,39 +3959,42 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } catch (const std::out_of_range& e) {
             return ConfigurationStatus::Rejected;
         }
-    }
-
-    if (key == "VerifyCsmsAllowWildcards") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["VerifyCsmsAllowWildcards"].set = [this](const CiString<500>& value) {
         if (isBool(value.get())) {
             this->setVerifyCsmsAllowWildcards(ocpp::conversions::string_to_bool(value.get()));
         } else {
             return ConfigurationStatus::Rejected;
         }
-    }
-
+        return ConfigurationStatus::Accepted;
+    };
     // Hubject PnC Extension keys
-    if (key == "SeccLeafSubjectCommonName") {
+    this->key_descriptors["SeccLeafSubjectCommonName"].set = [this](const CiString<500>& value) {
         if (this->getSeccLeafSubjectCommonName().has_value()) {
             this->setSeccLeafSubjectCommonName(value.get());
         } else {
             return ConfigurationStatus::NotSupported;
         }
-    }
-    if (key == "SeccLeafSubjectCountry") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["SeccLeafSubjectCountry"].set = [this](const CiString<500>& value) {
         if (this->getSeccLeafSubjectCountry().has_value()) {
             this->setSeccLeafSubjectCountry(value.get());
         } else {
             return ConfigurationStatus::NotSupported;
         }
-    }
-    if (key == "SeccLeafSubjectOrganization") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["SeccLeafSubjectOrganization"].set = [this](const CiString<500>& value) {
         if (this->getSeccLeafSubjectOrganization().has_value()) {
             this->setSeccLeafSubjectOrganization(value.get());
         } else {
             return ConfigurationStatus::NotSupported;
         }
-    }
-    if (key == "ConnectorEvseIds") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["ConnectorEvseIds"].set = [this](const CiString<500>& value) {
         if (this->getConnectorEvseIds().has_value()) {
             if (validate_connector_evse_ids(value.get())) {
                 this->setConnectorEvseIds(value.get());
@@ -3842,61 +4004,146 @@ ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500
         } else {
             return ConfigurationStatus::NotSupported;
         }
-    }
-    if (key == "AllowChargingProfileWithoutStartSchedule") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["AllowChargingProfileWithoutStartSchedule"].set = [this](const CiString<500>& value) {
         if (this->getAllowChargingProfileWithoutStartSchedule().has_value()) {
             this->setAllowChargingProfileWithoutStartSchedule(ocpp::conversions::string_to_bool(value.get()));
         } else {
             return ConfigurationStatus::NotSupported;
         }
-    }
-
-    if (key.get().find("DefaultPriceText") == 0) {
-        const ConfigurationStatus result = this->setDefaultPriceText(key, value);
-        if (result != ConfigurationStatus::Accepted) {
-            return result;
-        }
-    }
-
-    if (key == "DefaultPrice") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["DefaultPrice"].set = [this](const CiString<500>& value) {
         const ConfigurationStatus result = this->setDefaultPrice(value);
         if (result != ConfigurationStatus::Accepted) {
             return result;
         }
-    }
-
-    if (key == "TimeOffset") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["TimeOffset"].set = [this](const CiString<500>& value) {
         const ConfigurationStatus result = this->setDisplayTimeOffset(value);
         if (result != ConfigurationStatus::Accepted) {
             return result;
         }
-    }
-
-    if (key == "NextTimeOffsetTransitionDateTime") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["NextTimeOffsetTransitionDateTime"].set = [this](const CiString<500>& value) {
         const ConfigurationStatus result = this->setNextTimeOffsetTransitionDateTime(value);
         if (result != ConfigurationStatus::Accepted) {
             return result;
         }
-    }
-
-    if (key == "TimeOffsetNextTransition") {
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["TimeOffsetNextTransition"].set = [this](const CiString<500>& value) {
         const ConfigurationStatus result = this->setTimeOffsetNextTransition(value);
         if (result != ConfigurationStatus::Accepted) {
             return result;
         }
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["CustomIdleFeeAfterStop"].set = [this](const CiString<500>& value) {
+        this->setCustomIdleFeeAfterStop(ocpp::conversions::string_to_bool(value));
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["Language"].set = [this](const CiString<500>& value) {
+        this->setLanguage(value);
+        return ConfigurationStatus::Accepted;
+    };
+    this->key_descriptors["CentralSystemURI"].set = [this](const CiString<500>& value) {
+        this->setCentralSystemURI(value.get());
+        return ConfigurationStatus::RebootRequired;
+    };
+}
+
+std::size_t ChargePointConfiguration::CaseInsensitiveKeyHash::operator()(const std::string& key) const {
+    // FNV-1a over the lower-cased key
+    std::size_t hash = 14695981039346656037ULL;
+    for (const auto c : key) {
+        hash ^= static_cast<std::size_t>(std::tolower(static_cast<unsigned char>(c)));
+        hash *= 1099511628211ULL;
     }
+    return hash;
+}
 
-    if (key == "CustomIdleFeeAfterStop") {
-        this->setCustomIdleFeeAfterStop(ocpp::conversions::string_to_bool(value));
+bool ChargePointConfiguration::CaseInsensitiveKeyEqual::operator()(const std::string& lhs,
+                                                                   const std::string& rhs) const {
+    return lhs.size() == rhs.size() and
+           std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](unsigned char a, unsigned char b) {
+               return std::tolower(a) == std::tolower(b);
+           });
+}
+
+std::optional<KeyValue> ChargePointConfiguration::get(CiString<50> key) {
+    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
+    const auto descriptor = this->key_descriptors.find(key.get());
+    if (descriptor != this->key_descriptors.end() and descriptor->second.get != nullptr) {
+        const auto& profile = descriptor->second.profile;
+        if (!profile.has_value() or this->supported_feature_profiles.count(profile.value())) {
+            return descriptor->second.get();
+        }
     }
 
-    if (key == "Language") {
-        this->setLanguage(value);
+    if (this->supported_feature_profiles.count(SupportedFeatureProfiles::CostAndPrice) and
+        key.get().find("DefaultPriceText") == 0 and this->getCustomMultiLanguageMessagesEnabled().has_value() and
+        this->getCustomMultiLanguageMessagesEnabled().value()) {
+        const std::vector<std::string> message_language = split_string(key, ',');
+        if (message_language.size() > 1) {
+            return this->getDefaultPriceTextKeyValue(message_language.at(1));
+        }
     }
 
-    if (key == "CentralSystemURI") {
-        this->setCentralSystemURI(value.get());
-        return ConfigurationStatus::RebootRequired;
+    if (this->supported_feature_profiles.count(SupportedFeatureProfiles::Custom)) {
+        return this->getCustomKeyValue(key);
+    }
+
+    return std::nullopt;
+}
+
+std::vector<KeyValue> ChargePointConfiguration::get_all_key_value() {
+    std::vector<KeyValue> all;
+    for (auto feature_profile : this->getSupportedFeatureProfilesSet()) {
+        auto feature_profile_string = conversions::supported_feature_profiles_to_string(feature_profile);
+        if (this->config.contains(feature_profile_string)) {
+            auto& feature_config = this->config[feature_profile_string];
+            for (auto& feature_config_entry : feature_config.items()) {
+                const auto config_key = CiString<50>(feature_config_entry.key());
+                // DefaultPriceText is a special here, as it has multiple possible languages which are all separate
+                // key value pairs.
+                if (config_key.get().find("DefaultPriceText") == 0) {
+                    const auto price_text_key_values = getAllDefaultPriceTextKeyValues();
+                    if (price_text_key_values.has_value()) {
+                        for (const auto& kv : price_text_key_values.value()) {
+                            all.push_back(kv);
+                        }
+                    }
+                } else {
+                    auto config_value = this->get(config_key);
+                    if (config_value != std::nullopt) {
+                        all.push_back(config_value.value());
+                    }
+                }
+            }
+        }
+    }
+    return all;
+}
+
+ConfigurationStatus ChargePointConfiguration::set(CiString<50> key, CiString<500> value) {
+    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
+    const auto descriptor = this->key_descriptors.find(key.get());
+    if (descriptor != this->key_descriptors.end() and descriptor->second.set != nullptr) {
+        const ConfigurationStatus result = descriptor->second.set(value);
+        if (result != ConfigurationStatus::Accepted) {
+            return result;
+        }
+    }
+
+    if (key.get().find("DefaultPriceText") == 0) {
+        const ConfigurationStatus result = this->setDefaultPriceText(key, value);
+        if (result != ConfigurationStatus::Accepted) {
+            return result;
+        }
     }
 
     if (this->config.contains("Custom") and this->config["Custom"].contains(key.get())) {
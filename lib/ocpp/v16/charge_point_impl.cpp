@@ -7,6 +7,7 @@
 
 #include <everest/logging.hpp>
 #include <ocpp/common/constants.hpp>
+#include <ocpp/common/message_queue_segment_log.hpp>
 #include <ocpp/common/websocket/websocket.hpp>
 #include <ocpp/v16/charge_point.hpp>
 #include <ocpp/v16/charge_point_configuration.hpp>
@@ -35,6 +36,21 @@ const auto DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD = 2E5;
 const auto DEFAULT_BOOT_NOTIFICATION_INTERVAL_S = 60; // fallback interval if BootNotification returns interval of 0.
 const auto DEFAULT_PRICE_NUMBER_OF_DECIMALS = 3;
 
+namespace {
+/// \brief Sampling plan for meter values sent on status, time and kWh pricing triggers
+const MeterValueSamplingPlan& energy_import_sampling_plan() {
+    static const MeterValueSamplingPlan plan({{Measurand::Energy_Active_Import_Register, std::nullopt}});
+    return plan;
+}
+
+/// \brief Sampling plan for meter values sent on power pricing triggers
+const MeterValueSamplingPlan& energy_and_power_import_sampling_plan() {
+    static const MeterValueSamplingPlan plan(
+        {{Measurand::Energy_Active_Import_Register, std::nullopt}, {Measurand::Power_Active_Import, std::nullopt}});
+    return plan;
+}
+} // namespace
+
 ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& share_path,
                                  const fs::path& user_config_path, const fs::path& database_path,
                                  const fs::path& sql_init_path, const fs::path& message_log_path,
@@ -50,7 +66,8 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
     message_log_path(message_log_path.string()), // .string() for compatibility with boost::filesystem
     switch_security_profile_callback(nullptr) {
     this->configuration = std::make_shared<ocpp::v16::ChargePointConfiguration>(config, share_path, user_config_path);
-    this->heartbeat_timer = std::make_unique<Everest::SteadyTimer>(&this->io_service, [this]() { this->heartbeat(); });
+    this->executor->set_number_of_threads(this->configuration->getExecutorThreads().value_or(1));
+    this->heartbeat_timer = std::make_unique<BatchedTimer>(this->timer_service, [this]() { this->heartbeat(); });
     this->heartbeat_interval = this->configuration->getHeartbeatInterval();
     auto database_connection =
         std::make_unique<common::DatabaseConnection>(database_path / (this->configuration->getChargePointId() + ".db"));
@@ -92,16 +109,18 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
     }
 
     this->boot_notification_timer =
-        std::make_unique<Everest::SteadyTimer>(&this->io_service, [this]() { this->boot_notification(); });
+        std::make_unique<BatchedTimer>(this->timer_service, [this]() { this->boot_notification(); });
 
     for (int32_t connector = 0; connector < this->configuration->getNumberOfConnectors() + 1; connector++) {
-        this->status_notification_timers.push_back(std::make_unique<Everest::SteadyTimer>(&this->io_service));
+        this->status_notification_timers.push_back(
+            std::make_unique<BatchedTimer>(this->timer_service, nullptr, this->executor->get_strand(connector)));
     }
 
+    // the timer runs on the io_service directly, the sampling of each connector is posted to its strand
     this->clock_aligned_meter_values_timer =
         std::make_unique<ClockAlignedTimer>(&this->io_service, [this]() { this->clock_aligned_meter_values_sample(); });
 
-    this->client_certificate_timer = std::make_unique<Everest::SteadyTimer>(&this->io_service, [this]() {
+    this->client_certificate_timer = std::make_unique<BatchedTimer>(this->timer_service, [this]() {
         EVLOG_info << "Checking if CSMS client certificate has expired";
         int expiry_days_count = this->evse_security->get_leaf_expiry_days_count(
             ocpp::CertificateSigningUseEnum::ChargingStationCertificate);
@@ -115,7 +134,7 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
         this->client_certificate_timer->interval(CLIENT_CERTIFICATE_TIMER_INTERVAL);
     });
 
-    this->v2g_certificate_timer = std::make_unique<Everest::SteadyTimer>(&this->io_service, [this]() {
+    this->v2g_certificate_timer = std::make_unique<BatchedTimer>(this->timer_service, [this]() {
         EVLOG_info << "Checking if V2GCertificate has expired";
         int expiry_days_count =
             this->evse_security->get_leaf_expiry_days_count(ocpp::CertificateSigningUseEnum::V2GCertificate);
@@ -155,8 +174,8 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
 
             for (const auto& cp_status : c->trigger_metervalue_on_status.value()) {
                 if (status == cp_status && (!c->previous_status.has_value() || c->previous_status.value() != status)) {
-                    const std::optional<MeterValue>& meter_value = get_latest_meter_value(
-                        connector, {{Measurand::Energy_Active_Import_Register, std::nullopt}}, ReadingContext::Other);
+                    const std::optional<MeterValue>& meter_value =
+                        get_latest_meter_value(connector, energy_import_sampling_plan(), ReadingContext::Other);
                     if (!meter_value.has_value()) {
                         EVLOG_error << "Send latest meter value because of chargepoint status trigger failed";
                     } else {
@@ -199,7 +218,7 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
             [this](ocpp::Call<ocpp::v16::DataTransferRequest> call) {
                 this->handle_data_transfer_install_certificate(call);
             };
-        this->ocsp_request_timer = std::make_unique<Everest::SteadyTimer>(&this->io_service, [this]() {
+        this->ocsp_request_timer = std::make_unique<BatchedTimer>(this->timer_service, [this]() {
             this->update_ocsp_cache();
             this->ocsp_request_timer->interval(OCSP_REQUEST_TIMER_INTERVAL);
         });
@@ -273,14 +292,66 @@ std::unique_ptr<ocpp::MessageQueue<v16::MessageType>> ChargePointImpl::create_me
         }
     }
 
-    return std::make_unique<ocpp::MessageQueue<v16::MessageType>>(
-        [this](json message) -> bool { return this->websocket->send(message.dump()); },
-        MessageQueueConfig<v16::MessageType>{
-            this->configuration->getTransactionMessageAttempts(),
-            this->configuration->getTransactionMessageRetryInterval(),
-            this->configuration->getMessageQueueSizeThreshold().value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
-            this->configuration->getQueueAllMessages().value_or(false), message_types_discard_for_queueing},
-        this->external_notify, this->database_handler, start_transaction_message_retry_callback);
+    MessageQueueConfig<v16::MessageType> config{
+        this->configuration->getTransactionMessageAttempts(), this->configuration->getTransactionMessageRetryInterval(),
+        this->configuration->getMessageQueueSizeThreshold().value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
+        this->configuration->getQueueAllMessages().value_or(false), message_types_discard_for_queueing};
+    config.max_pipelined_calls = this->configuration->getMaxPipelinedCalls().value_or(1);
+    config.transaction_update_compaction_interval_seconds =
+        this->configuration->getTransactionUpdateCompactionInterval().value_or(0);
+
+    if (this->configuration->getPipelinedMessageTypes().has_value()) {
+        try {
+            const auto pipelined_message_types_csl =
+                ocpp::split_string(this->configuration->getPipelinedMessageTypes().value(), ',');
+            std::transform(pipelined_message_types_csl.begin(), pipelined_message_types_csl.end(),
+                           std::inserter(config.pipelined_message_types, config.pipelined_message_types.end()),
+                           [](const std::string element) { return conversions::string_to_messagetype(element); });
+        } catch (const StringToEnumException& e) {
+            EVLOG_warning << "Could not convert configured MessageType value of PipelinedMessageTypes: " << e.what();
+            config.pipelined_message_types.clear();
+        }
+    }
+
+    config.message_priorities = {{v16::MessageType::Authorize, MessagePriority::High},
+                                 {v16::MessageType::StatusNotification, MessagePriority::High},
+                                 {v16::MessageType::Heartbeat, MessagePriority::Low},
+                                 {v16::MessageType::DiagnosticsStatusNotification, MessagePriority::Low}};
+    try {
+        config.priority_weights =
+            parse_message_priority_values(this->configuration->getMessagePriorityWeights().value_or(""));
+        config.priority_queue_limits =
+            parse_message_priority_values(this->configuration->getMessagePriorityQueueLimits().value_or(""));
+    } catch (const std::exception& e) {
+        EVLOG_warning << "Could not parse configured MessagePriorityWeights or MessagePriorityQueueLimits: "
+                      << e.what();
+        config.priority_weights.clear();
+        config.priority_queue_limits.clear();
+    }
+
+    // messages queued in the storage used before are moved, so changing the configured storage does not abandon them
+    std::optional<fs::path> segment_log_directory;
+    if (this->configuration->getMessageQueueSegmentLogDirectory().has_value()) {
+        segment_log_directory = this->configuration->getMessageQueueSegmentLogDirectory().value();
+    }
+    std::optional<fs::path> segment_log_directory_in_use;
+    const auto directory_in_use = this->configuration->getMessageQueueSegmentLogDirectoryInUse().value_or("");
+    if (!directory_in_use.empty()) {
+        segment_log_directory_in_use = directory_in_use;
+    }
+    const auto selection = common::open_message_queue_persistence(this->database_handler, segment_log_directory,
+                                                                  segment_log_directory_in_use);
+    if (selection.segment_log_directory != segment_log_directory_in_use) {
+        this->configuration->setMessageQueueSegmentLogDirectoryInUse(
+            selection.segment_log_directory.value_or("").string());
+    }
+
+    auto message_queue = std::make_unique<ocpp::MessageQueue<v16::MessageType>>(
+        [this](json message) -> bool { return this->websocket->send(message.dump()); }, config, this->external_notify,
+        selection.persistence, start_transaction_message_retry_callback);
+    message_queue->set_serialized_send_callback(
+        [this](const std::string& message) -> bool { return this->websocket->send(message); });
+    return message_queue;
 }
 
 void ChargePointImpl::init_websocket() {
@@ -392,6 +463,21 @@ WebsocketConnectionOptions ChargePointImpl::get_ws_connection_options() {
                                                   this->configuration->getIFace(),
                                                   this->configuration->getEnableTLSKeylog(),
                                                   this->configuration->getTLSKeylogFile()};
+
+    connection_options.enable_permessage_deflate = this->configuration->getEnablePermessageDeflate();
+    connection_options.deflate_client_max_window_bits = this->configuration->getPermessageDeflateClientMaxWindowBits();
+    connection_options.deflate_server_max_window_bits = this->configuration->getPermessageDeflateServerMaxWindowBits();
+    connection_options.deflate_client_no_context_takeover =
+        this->configuration->getPermessageDeflateClientNoContextTakeover();
+    connection_options.deflate_server_no_context_takeover =
+        this->configuration->getPermessageDeflateServerNoContextTakeover();
+    connection_options.deflate_min_message_size = this->configuration->getPermessageDeflateMinMessageSize();
+
+    connection_options.enable_tls_session_resumption = this->configuration->getEnableTLSSessionResumption();
+    const auto tls_session_file = this->configuration->getTLSSessionFile();
+    if (tls_session_file.has_value()) {
+        connection_options.tls_session_file = tls_session_file.value();
+    }
     return connection_options;
 }
 
@@ -440,18 +526,22 @@ void ChargePointImpl::boot_notification(bool initiated_by_trigger_message) {
 
 void ChargePointImpl::clock_aligned_meter_values_sample() {
     EVLOG_debug << "Sending clock aligned meter values";
-    for (int32_t connector = 1; connector < this->configuration->getNumberOfConnectors() + 1; connector++) {
-        auto meter_value = this->get_latest_meter_value(
-            connector, this->configuration->getMeterValuesAlignedDataVector(), ReadingContext::Sample_Clock);
-        if (meter_value.has_value()) {
-            if (this->transaction_handler->transaction_active(connector)) {
-                this->transaction_handler->get_transaction(connector)->add_meter_value(meter_value.value());
+    const auto snapshot = this->configuration->get_snapshot();
+    for (int32_t connector = 1; connector < snapshot->number_of_connectors + 1; connector++) {
+        // sample on the strand of the connector, so it does not run concurrently with its other timers
+        this->executor->post(connector, [this, snapshot, connector]() {
+            auto meter_value = this->get_latest_meter_value(connector, snapshot->meter_values_aligned_data_plan,
+                                                            ReadingContext::Sample_Clock);
+            if (meter_value.has_value()) {
+                if (this->transaction_handler->transaction_active(connector)) {
+                    this->transaction_handler->get_transaction(connector)->add_meter_value(meter_value.value());
+                }
+                this->send_meter_value(connector, meter_value.value());
+            } else {
+                EVLOG_warning << "Could not send clock aligned meter value for uninitialized measurement at connector#"
+                              << connector;
             }
-            this->send_meter_value(connector, meter_value.value());
-        } else {
-            EVLOG_warning << "Could not send clock aligned meter value for uninitialized measurement at connector#"
-                          << connector;
-        }
+        });
     }
 }
 
@@ -490,6 +580,7 @@ void ChargePointImpl::try_resume_transactions(const std::set<std::string>& resum
             this->transaction_handler->get_negative_random_transaction_id(), transaction_entry.connector,
             transaction_entry.session_id, CiString<20>(transaction_entry.id_tag_start), transaction_entry.meter_start,
             transaction_entry.reservation_id, ocpp::DateTime(transaction_entry.time_start), nullptr);
+        this->enable_meter_values_spilling(transaction);
         ocpp::DateTime timestamp;
         int meter_stop = 0;
         if (transaction_entry.time_end.has_value() and transaction_entry.meter_stop.has_value()) {
@@ -575,378 +666,18 @@ void ChargePointImpl::load_charging_profiles() {
 }
 
 std::optional<MeterValue> ChargePointImpl::get_latest_meter_value(int32_t connector,
-                                                                  std::vector<MeasurandWithPhase> values_of_interest,
+                                                                  const MeterValueSamplingPlan& sampling_plan,
                                                                   ReadingContext context) {
     std::lock_guard<std::mutex> lock(measurement_mutex);
-    std::optional<MeterValue> filtered_meter_value_opt;
     // TODO(kai): also support readings from the charge point measurement at "connector 0"
-    if (this->connectors.find(connector) != this->connectors.end() &&
-        this->connectors.at(connector)->measurement.has_value()) {
-        MeterValue filtered_meter_value;
-        const auto measurement = this->connectors.at(connector)->measurement.value();
-        const auto power_meter = measurement.power_meter;
-        const auto timestamp = power_meter.timestamp;
-        filtered_meter_value.timestamp = ocpp::DateTime(timestamp);
-        EVLOG_debug << "Measurement value for connector: " << connector << ": " << measurement;
-        for (auto configured_measurand : values_of_interest) {
-            EVLOG_debug << "Value of interest: " << conversions::measurand_to_string(configured_measurand.measurand);
-            // constructing sampled value
-            SampledValue sample;
-
-            sample.context.emplace(context);
-            sample.format.emplace(ValueFormat::Raw); // TODO(kai): support signed data as well
-
-            sample.measurand.emplace(configured_measurand.measurand);
-            if (configured_measurand.phase) {
-                EVLOG_debug << "  there is a phase configured: "
-                            << conversions::phase_to_string(configured_measurand.phase.value());
-            }
-            switch (configured_measurand.measurand) {
-            case Measurand::Energy_Active_Import_Register: {
-                const auto energy_Wh_import = power_meter.energy_Wh_import;
-
-                // Imported energy in Wh (from grid)
-                sample.unit.emplace(UnitOfMeasure::Wh);
-                sample.location.emplace(Location::Outlet);
-
-                if (configured_measurand.phase) {
-                    // phase available and it makes sense here
-                    auto phase = configured_measurand.phase.value();
-                    sample.phase.emplace(phase);
-                    if (phase == Phase::L1) {
-                        if (energy_Wh_import.L1) {
-                            sample.value = ocpp::conversions::double_to_string((double)energy_Wh_import.L1.value());
-                        } else {
-                            EVLOG_debug
-                                << "Power meter does not contain energy_Wh_import configured measurand for phase L1";
-                        }
-                    } else if (phase == Phase::L2) {
-                        if (energy_Wh_import.L2) {
-                            sample.value = ocpp::conversions::double_to_string((double)energy_Wh_import.L2.value());
-                        } else {
-                            EVLOG_debug
-                                << "Power meter does not contain energy_Wh_import configured measurand for phase L2";
-                        }
-                    } else if (phase == Phase::L3) {
-                        if (energy_Wh_import.L3) {
-                            sample.value = ocpp::conversions::double_to_string((double)energy_Wh_import.L3.value());
-                        } else {
-                            EVLOG_debug
-                                << "Power meter does not contain energy_Wh_import configured measurand for phase L3";
-                        }
-                    }
-                } else {
-                    // store total value
-                    sample.value = ocpp::conversions::double_to_string((double)energy_Wh_import.total);
-                }
-                break;
-            }
-            case Measurand::Energy_Active_Export_Register: {
-                const auto energy_Wh_export = power_meter.energy_Wh_export;
-                // Exported energy in Wh (to grid)
-                sample.unit.emplace(UnitOfMeasure::Wh);
-                // TODO: which location is appropriate here? Inlet?
-                // sample.location.emplace(Location::Outlet);
-                if (energy_Wh_export) {
-                    if (configured_measurand.phase) {
-                        // phase available and it makes sense here
-                        auto phase = configured_measurand.phase.value();
-                        sample.phase.emplace(phase);
-                        if (phase == Phase::L1) {
-                            if (energy_Wh_export.value().L1) {
-                                sample.value =
-                                    ocpp::conversions::double_to_string((double)energy_Wh_export.value().L1.value());
-                            } else {
-                                EVLOG_debug << "Power meter does not contain energy_Wh_export configured measurand "
-                                               "for phase L1";
-                            }
-                        } else if (phase == Phase::L2) {
-                            if (energy_Wh_export.value().L2) {
-                                sample.value =
-                                    ocpp::conversions::double_to_string((double)energy_Wh_export.value().L2.value());
-                            } else {
-                                EVLOG_debug << "Power meter does not contain energy_Wh_export configured measurand "
-                                               "for phase L2";
-                            }
-                        } else if (phase == Phase::L3) {
-                            if (energy_Wh_export.value().L3) {
-                                sample.value =
-                                    ocpp::conversions::double_to_string((double)energy_Wh_export.value().L3.value());
-                            } else {
-                                EVLOG_debug << "Power meter does not contain energy_Wh_export configured measurand "
-                                               "for phase L3";
-                            }
-                        }
-                    } else {
-                        // store total value
-                        sample.value = ocpp::conversions::double_to_string((double)energy_Wh_export.value().total);
-                    }
-                } else {
-                    EVLOG_debug << "Power meter does not contain energy_Wh_export configured measurand";
-                }
-                break;
-            }
-            case Measurand::Power_Active_Import: {
-                const auto power_W = power_meter.power_W;
-                // power flow to EV, Instantaneous power in Watt
-                sample.unit.emplace(UnitOfMeasure::W);
-                sample.location.emplace(Location::Outlet);
-                if (power_W) {
-                    if (configured_measurand.phase) {
-                        // phase available and it makes sense here
-                        auto phase = configured_measurand.phase.value();
-                        sample.phase.emplace(phase);
-                        if (phase == Phase::L1) {
-                            if (power_W.value().L1) {
-                                sample.value = ocpp::conversions::double_to_string((double)power_W.value().L1.value());
-                            } else {
-                                EVLOG_debug << "Power meter does not contain power_W configured measurand for phase L1";
-                            }
-                        } else if (phase == Phase::L2) {
-                            if (power_W.value().L2) {
-                                sample.value = ocpp::conversions::double_to_string((double)power_W.value().L2.value());
-                            } else {
-                                EVLOG_debug << "Power meter does not contain power_W configured measurand for phase L2";
-                            }
-                        } else if (phase == Phase::L3) {
-                            if (power_W.value().L3) {
-                                sample.value = ocpp::conversions::double_to_string((double)power_W.value().L3.value());
-                            } else {
-                                EVLOG_debug << "Power meter does not contain power_W configured measurand for phase L3";
-                            }
-                        }
-                    } else {
-                        // store total value
-                        sample.value = ocpp::conversions::double_to_string((double)power_W.value().total);
-                    }
-                } else {
-                    EVLOG_debug << "Power meter does not contain power_W configured measurand";
-                }
-                break;
-            }
-            case Measurand::Voltage: {
-                const auto voltage_V = power_meter.voltage_V;
-                // AC supply voltage, Voltage in Volts
-                sample.unit.emplace(UnitOfMeasure::V);
-                sample.location.emplace(Location::Outlet);
-                if (voltage_V) {
-                    if (configured_measurand.phase) {
-                        // phase available and it makes sense here
-                        auto phase = configured_measurand.phase.value();
-                        sample.phase.emplace(phase);
-                        if (phase == Phase::L1) {
-                            if (voltage_V.value().L1) {
-                                sample.value =
-                                    ocpp::conversions::double_to_string((double)voltage_V.value().L1.value());
-                            } else {
-                                EVLOG_debug
-                                    << "Power meter does not contain voltage_V configured measurand for phase L1";
-                            }
-                        } else if (phase == Phase::L2) {
-                            if (voltage_V.value().L2) {
-                                sample.value =
-                                    ocpp::conversions::double_to_string((double)voltage_V.value().L2.value());
-                            } else {
-                                EVLOG_debug
-                                    << "Power meter does not contain voltage_V configured measurand for phase L2";
-                            }
-                        } else if (phase == Phase::L3) {
-                            if (voltage_V.value().L3) {
-                                sample.value =
-                                    ocpp::conversions::double_to_string((double)voltage_V.value().L3.value());
-                            } else {
-                                EVLOG_debug
-                                    << "Power meter does not contain voltage_V configured measurand for phase L3";
-                            }
-                        }
-                    }
-                    // report DC value if set. This is a workaround for the fact that the power meter does not report
-                    // AC (Dc charging)
-                    else if (voltage_V.value().DC) {
-                        sample.value = ocpp::conversions::double_to_string((double)voltage_V.value().DC.value());
-                    }
-
-                } else {
-                    EVLOG_debug << "Power meter does not contain voltage_V configured measurand";
-                }
-                break;
-            }
-            case Measurand::Current_Import: {
-                const auto current_A = power_meter.current_A;
-                // current flow to EV in A
-                sample.unit.emplace(UnitOfMeasure::A);
-                sample.location.emplace(Location::Outlet);
-                if (current_A) {
-                    if (configured_measurand.phase) {
-                        // phase available and it makes sense here
-                        auto phase = configured_measurand.phase.value();
-                        sample.phase.emplace(phase);
-                        if (phase == Phase::L1) {
-                            if (current_A.value().L1) {
-                                sample.value =
-                                    ocpp::conversions::double_to_string((double)current_A.value().L1.value());
-                            } else {
-                                EVLOG_debug
-                                    << "Power meter does not contain current_A configured measurand for phase L1";
-                            }
-                        } else if (phase == Phase::L2) {
-                            if (current_A.value().L2) {
-                                sample.value =
-                                    ocpp::conversions::double_to_string((double)current_A.value().L2.value());
-                            } else {
-                                EVLOG_debug
-                                    << "Power meter does not contain current_A configured measurand for phase L2";
-                            }
-                        } else if (phase == Phase::L3) {
-                            if (current_A.value().L3) {
-                                sample.value =
-                                    ocpp::conversions::double_to_string((double)current_A.value().L3.value());
-                            } else {
-                                EVLOG_debug
-                                    << "Power meter does not contain current_A configured measurand for phase L3";
-                            }
-                        }
-                    }
-                    // report DC value if set. This is a workaround for the fact that the power meter does not report
-                    // AC (DC charging)
-                    else if (current_A.value().DC) {
-                        sample.value = ocpp::conversions::double_to_string((double)current_A.value().DC.value());
-                    }
-                } else {
-                    EVLOG_debug << "Power meter does not contain current_A configured measurand";
-                }
-
-                break;
-            }
-            case Measurand::Frequency: {
-                const auto frequency_Hz = power_meter.frequency_Hz;
-                // Grid frequency in Hertz
-                // TODO: which location is appropriate here? Inlet?
-                // sample.location.emplace(Location::Outlet);
-                if (frequency_Hz) {
-                    if (configured_measurand.phase) {
-                        // phase available and it makes sense here
-                        auto phase = configured_measurand.phase.value();
-                        sample.phase.emplace(phase);
-                        if (phase == Phase::L1) {
-                            sample.value = ocpp::conversions::double_to_string((double)frequency_Hz.value().L1);
-                        } else if (phase == Phase::L2) {
-                            if (frequency_Hz.value().L2) {
-                                sample.value =
-                                    ocpp::conversions::double_to_string((double)frequency_Hz.value().L2.value());
-                            } else {
-                                EVLOG_debug
-                                    << "Power meter does not contain frequency_Hz configured measurand for phase L2";
-                            }
-                        } else if (phase == Phase::L3) {
-                            if (frequency_Hz.value().L3) {
-                                sample.value =
-                                    ocpp::conversions::double_to_string((double)frequency_Hz.value().L3.value());
-                            } else {
-                                EVLOG_debug
-                                    << "Power meter does not contain frequency_Hz configured measurand for phase L3";
-                            }
-                        }
-                    }
-                } else {
-                    EVLOG_debug << "Power meter does not contain frequency_Hz configured measurand";
-                }
-                break;
-            }
-            case Measurand::Current_Offered: {
-                // current offered to EV
-                sample.unit.emplace(UnitOfMeasure::A);
-                sample.location.emplace(Location::Outlet);
-
-                sample.value = ocpp::conversions::double_to_string(this->connectors.at(connector)->max_current_offered);
-                break;
-            }
-            case Measurand::Power_Offered: {
-                // power offered to EV
-                sample.unit.emplace(UnitOfMeasure::W);
-                sample.location.emplace(Location::Outlet);
-
-                sample.value = ocpp::conversions::double_to_string(this->connectors.at(connector)->max_power_offered);
-                break;
-            }
-            case Measurand::SoC: {
-                // state of charge
-                const auto soc = measurement.soc_Percent;
-                if (soc) {
-                    sample.unit.emplace(UnitOfMeasure::Percent);
-                    sample.value = ocpp::conversions::double_to_string(soc.value().value);
-
-                    if (soc.value().location.has_value()) {
-                        sample.location.emplace(conversions::string_to_location(soc.value().location.value()));
-                    } else {
-                        sample.location.emplace(Location::EV);
-                    }
-                } else {
-                    EVLOG_debug << "Measurement does not contain soc_Percent configured measurand";
-                }
-                break;
-            }
-
-            case Measurand::Temperature: {
-                // temperature
-                for (const auto temperature : measurement.temperature_C) {
-                    sample.unit.emplace(UnitOfMeasure::Celsius);
-                    if (temperature.location.has_value()) {
-                        try {
-                            sample.location.emplace(conversions::string_to_location(temperature.location.value()));
-                        } catch (const StringToEnumException& e) {
-                            EVLOG_debug << "Could not convert string: " << temperature.location.value()
-                                        << " to Location";
-                        }
-                    } else {
-                        sample.location = std::nullopt;
-                    }
-                    sample.value = ocpp::conversions::double_to_string(temperature.value);
-                    filtered_meter_value.sampledValue.push_back(sample);
-                    sample.value.clear();
-                }
-                if (measurement.temperature_C.empty()) {
-                    EVLOG_debug << "Measurement does not contain temperature_C configured measurand";
-                }
-                break;
-            }
-
-            case Measurand::RPM: {
-                // RPM
-                const auto rpm = measurement.rpm;
-                if (rpm) {
-                    if (rpm.value().location.has_value()) {
-                        sample.location.emplace(conversions::string_to_location(rpm.value().location.value()));
-                    } else {
-                        sample.location.emplace(Location::EV);
-                    }
-                    sample.value = ocpp::conversions::double_to_string(rpm.value().value);
-                } else {
-                    EVLOG_debug << "Measurement does not contain rpm configured measurand";
-                }
-                break;
-            }
-            case Measurand::Energy_Reactive_Export_Register:
-            case Measurand::Energy_Reactive_Import_Register:
-            case Measurand::Energy_Active_Export_Interval:
-            case Measurand::Energy_Active_Import_Interval:
-            case Measurand::Energy_Reactive_Export_Interval:
-            case Measurand::Energy_Reactive_Import_Interval:
-            case Measurand::Power_Active_Export:
-            case Measurand::Power_Reactive_Export:
-            case Measurand::Power_Reactive_Import:
-            case Measurand::Power_Factor:
-            case Measurand::Current_Export:
-                break;
-            }
-            // only add if value is set
-            if (!sample.value.empty()) {
-                filtered_meter_value.sampledValue.push_back(sample);
-            }
-        }
-        filtered_meter_value_opt.emplace(filtered_meter_value);
+    const auto it = this->connectors.find(connector);
+    if (it == this->connectors.end() or !it->second->measurement.has_value()) {
+        return std::nullopt;
     }
-    return filtered_meter_value_opt;
+    const auto& measurement = it->second->measurement.value();
+    EVLOG_debug << "Measurement value for connector: " << connector << ": " << measurement;
+    return sampling_plan.sample({measurement, it->second->max_current_offered, it->second->max_power_offered},
+                                context);
 }
 
 MeterValue ChargePointImpl::get_signed_meter_value(const std::string& signed_value, const ReadingContext& context,
@@ -1003,9 +734,8 @@ void ChargePointImpl::send_meter_value_on_pricing_trigger(const int32_t connecto
         if (static_cast<double>(measurement.power_meter.energy_Wh_import.total) >=
             (connector->trigger_metervalue_on_energy_kwh.value() * 1000)) {
 
-            MeasurandWithPhase measurand;
-            measurand.measurand = Measurand::Energy_Active_Import_Register;
-            const auto& meter_value = get_latest_meter_value(connector_number, {measurand}, ReadingContext::Other);
+            const auto& meter_value =
+                get_latest_meter_value(connector_number, energy_import_sampling_plan(), ReadingContext::Other);
 
             if (meter_value.has_value()) {
                 EVLOG_debug << "Sending meter value because of kWh pricing trigger";
@@ -1041,10 +771,8 @@ void ChargePointImpl::send_meter_value_on_pricing_trigger(const int32_t connecto
              current_power_kw <= (trigger_metervalue_kw - hysteresis_kw))) {
 
             // Power threshold is crossed, send metervalues.
-            const auto& meter_value = get_latest_meter_value(connector_number,
-                                                             {{Measurand::Energy_Active_Import_Register, std::nullopt},
-                                                              {Measurand::Power_Active_Import, std::nullopt}},
-                                                             ReadingContext::Other);
+            const auto& meter_value = get_latest_meter_value(
+                connector_number, energy_and_power_import_sampling_plan(), ReadingContext::Other);
             if (!meter_value.has_value()) {
                 EVLOG_error << "Send latest meter value because of power (Wh) trigger failed";
             } else {
@@ -1055,10 +783,8 @@ void ChargePointImpl::send_meter_value_on_pricing_trigger(const int32_t connecto
         }
     } else {
         // Send metervalue anyway since we have no previous metervalue stored and don't know if we should send any
-        const auto& meter_value = get_latest_meter_value(
-            connector_number,
-            {{Measurand::Energy_Active_Import_Register, std::nullopt}, {Measurand::Power_Active_Import, std::nullopt}},
-            ReadingContext::Other);
+        const auto& meter_value =
+            get_latest_meter_value(connector_number, energy_and_power_import_sampling_plan(), ReadingContext::Other);
         if (!meter_value.has_value()) {
             EVLOG_error << "Send latest meter value because of power (Wh) trigger failed";
         } else {
@@ -1228,6 +954,7 @@ bool ChargePointImpl::stop() {
 
         this->stop_all_transactions();
 
+        this->configuration->flush_user_config();
         this->database_handler->close_connection();
         this->websocket->disconnect(WebsocketCloseReason::Normal);
         this->message_queue->stop();
@@ -1294,7 +1021,8 @@ void ChargePointImpl::message_callback(const std::string& message) {
     this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message);
     try {
         // reject unsupported messages
-        if (this->configuration->getSupportedMessageTypesReceiving().count(enhanced_message.messageType) == 0) {
+        if (this->configuration->get_snapshot()->supported_message_types_receiving.count(
+                enhanced_message.messageType) == 0) {
             EVLOG_warning << "Received an unsupported message: " << enhanced_message.messageType;
             // FIXME(kai): however, only send a CALLERROR when it is a CALL message we just received
             if (enhanced_message.messageTypeId == MessageTypeId::CALL) {
@@ -2524,7 +2252,8 @@ void ChargePointImpl::handleTriggerMessageRequest(ocpp::Call<TriggerMessageReque
     case MessageTrigger::MeterValues: {
         const auto send_meter_value_func = [this](const int32_t connector_id) {
             auto meter_value = this->get_latest_meter_value(
-                connector_id, this->configuration->getMeterValuesSampledDataVector(), ReadingContext::Trigger);
+                connector_id, this->configuration->get_snapshot()->meter_values_sampled_data_plan,
+                ReadingContext::Trigger);
             if (meter_value.has_value()) {
                 this->send_meter_value(connector_id, meter_value.value(), true);
             } else {
@@ -2651,7 +2380,7 @@ void ChargePointImpl::handleExtendedTriggerMessageRequest(ocpp::Call<ExtendedTri
         break;
     case MessageTriggerEnumType::MeterValues: {
         const auto meter_value = this->get_latest_meter_value(
-            connector, this->configuration->getMeterValuesSampledDataVector(), ReadingContext::Trigger);
+            connector, this->configuration->get_snapshot()->meter_values_sampled_data_plan, ReadingContext::Trigger);
         if (meter_value.has_value()) {
             this->send_meter_value(connector, meter_value.value(), true);
         } else {
@@ -3286,15 +3015,18 @@ void ChargePointImpl::set_connector_trigger_metervalue_timer(const DateTime& dat
     DateTime d(now);
     int32_t connector_id = connector->id;
 
+    // the timer runs on the io_service directly, so its work is posted to the strand of the connector
     connector->trigger_metervalue_at_time_timer =
         std::make_unique<Everest::SystemTimer>(&this->io_service, [this, connector_id]() {
-            const std::optional<MeterValue>& meter_value = get_latest_meter_value(
-                connector_id, {{Measurand::Energy_Active_Import_Register, std::nullopt}}, ReadingContext::Other);
-            if (!meter_value.has_value()) {
-                EVLOG_error << "Send latest meter value because of chargepoint time trigger failed";
-            } else {
-                send_meter_value(connector_id, meter_value.value());
-            }
+            this->executor->post(connector_id, [this, connector_id]() {
+                const std::optional<MeterValue>& meter_value =
+                    get_latest_meter_value(connector_id, energy_import_sampling_plan(), ReadingContext::Other);
+                if (!meter_value.has_value()) {
+                    EVLOG_error << "Send latest meter value because of chargepoint time trigger failed";
+                } else {
+                    send_meter_value(connector_id, meter_value.value());
+                }
+            });
         });
     connector->trigger_metervalue_at_time_timer->at(trigger_timepoint);
 }
@@ -3312,10 +3044,12 @@ void ChargePointImpl::set_time_offset_timer(const std::string& date_time) {
     }
 
     this->change_time_offset_timer = std::make_unique<Everest::SystemTimer>(&this->io_service, [this]() {
-        const std::optional<std::string> next_offset = this->configuration->getTimeOffsetNextTransition();
-        if (next_offset.has_value()) {
-            this->configuration->setDisplayTimeOffset(next_offset.value());
-        }
+        this->executor->post([this]() {
+            const std::optional<std::string> next_offset = this->configuration->getTimeOffsetNextTransition();
+            if (next_offset.has_value()) {
+                this->configuration->setDisplayTimeOffset(next_offset.value());
+            }
+        });
     });
 
     this->change_time_offset_timer->at(d.to_time_point());
@@ -4157,9 +3891,11 @@ void ChargePointImpl::on_transaction_started(const int32_t& connector, const std
         this->status->submit_event(connector, FSMEvent::UsageInitiated, ocpp::DateTime());
     }
 
-    auto meter_values_sample_timer = std::make_unique<Everest::SteadyTimer>(&this->io_service, [this, connector]() {
-        const auto meter_value = this->get_latest_meter_value(
-            connector, this->configuration->getMeterValuesSampledDataVector(), ReadingContext::Sample_Periodic);
+    // sampling runs on the strand of the connector, so a slow database update only delays this connector
+    auto sample_meter_values = [this, connector]() {
+        const auto meter_value =
+            this->get_latest_meter_value(connector, this->configuration->get_snapshot()->meter_values_sampled_data_plan,
+                                         ReadingContext::Sample_Periodic);
         if (meter_value.has_value()) {
             this->transaction_handler->add_meter_value(connector, meter_value.value());
             this->send_meter_value(connector, meter_value.value());
@@ -4189,11 +3925,14 @@ void ChargePointImpl::on_transaction_started(const int32_t& connector, const std
                 << "Could not send and add meter value to transaction for uninitialized measurement at connector#"
                 << connector;
         }
-    });
+    };
+    auto meter_values_sample_timer = std::make_unique<BatchedTimer>(this->timer_service, sample_meter_values,
+                                                                    this->executor->get_strand(connector));
     meter_values_sample_timer->interval(std::chrono::seconds(this->configuration->getMeterValueSampleInterval()));
     std::shared_ptr<Transaction> transaction = std::make_shared<Transaction>(
         this->transaction_handler->get_negative_random_transaction_id(), connector, session_id, CiString<20>(id_token),
         meter_start, reservation_id, timestamp, std::move(meter_values_sample_timer));
+    this->enable_meter_values_spilling(transaction);
     if (signed_meter_value) {
         const auto meter_value =
             this->get_signed_meter_value(signed_meter_value.value(), ReadingContext::Transaction_Begin, timestamp);
@@ -4297,12 +4036,21 @@ void ChargePointImpl::stop_transaction(int32_t connector, Reason reason, std::op
     try {
         this->database_handler->update_transaction(transaction->get_session_id(), req.meterStop,
                                                    req.timestamp.to_rfc3339(), id_tag_end, reason, message_id.get());
+        // the meter values are part of the queued StopTransaction.req now
+        this->database_handler->delete_transaction_meter_values(transaction->get_session_id());
     } catch (const QueryExecutionException& e) {
         EVLOG_warning << "Could not update transaction with session_id " << transaction->get_session_id()
                       << " in the database: " << e.what();
     }
 }
 
+void ChargePointImpl::enable_meter_values_spilling(const std::shared_ptr<Transaction>& transaction) {
+    const auto max_meter_values_in_memory = this->configuration->getMaxTransactionMeterValuesInMemory();
+    if (max_meter_values_in_memory.has_value()) {
+        transaction->enable_meter_values_spilling(this->database_handler, max_meter_values_in_memory.value());
+    }
+}
+
 std::vector<Measurand> ChargePointImpl::get_measurands_vec(const std::string& measurands_csv) {
     std::vector<Measurand> measurands;
     std::vector<std::string> measurands_strings = ocpp::split_string(measurands_csv, ',');
@@ -14,7 +14,8 @@ namespace v16 {
 DatabaseHandler::DatabaseHandler(std::unique_ptr<DatabaseConnectionInterface> database,
                                  const fs::path& sql_migration_files_path, int32_t number_of_connectors) :
     DatabaseHandlerCommon(std::move(database), sql_migration_files_path, MIGRATION_FILE_VERSION_V16),
-    number_of_connectors(number_of_connectors) {
+    number_of_connectors(number_of_connectors),
+    local_authorization_list_index([this]() { return this->get_local_authorization_list_keys(); }) {
 }
 
 void DatabaseHandler::init_sql() {
@@ -24,6 +25,7 @@ void DatabaseHandler::init_sql() {
     } catch (const QueryExecutionException& e) {
         EVLOG_warning << "Could not insert or ignore version into AUTH_LIST_VERSION table: " << e.what();
     }
+    this->local_authorization_list_index.invalidate();
 }
 
 void DatabaseHandler::init_connector_table() {
@@ -223,6 +225,57 @@ std::vector<TransactionEntry> DatabaseHandler::get_transactions(bool filter_inco
     return transactions;
 }
 
+void DatabaseHandler::insert_transaction_meter_values(const std::string& session_id,
+                                                      const std::vector<MeterValue>& meter_values) {
+    auto transaction = this->database->begin_transaction();
+
+    std::string sql =
+        "INSERT INTO TRANSACTION_METER_VALUES (SESSION_ID, METER_VALUE) VALUES (@session_id, @meter_value)";
+    auto insert_stmt = this->database->new_statement(sql);
+
+    for (const auto& meter_value : meter_values) {
+        insert_stmt->bind_text("@session_id", session_id);
+        insert_stmt->bind_text("@meter_value", json(meter_value).dump(), SQLiteString::Transient);
+
+        if (insert_stmt->step() != SQLITE_DONE) {
+            throw QueryExecutionException(this->database->get_error_message());
+        }
+
+        insert_stmt->reset();
+    }
+
+    transaction->commit();
+}
+
+std::vector<MeterValue> DatabaseHandler::get_transaction_meter_values(const std::string& session_id) {
+    std::vector<MeterValue> meter_values;
+
+    std::string sql = "SELECT METER_VALUE FROM TRANSACTION_METER_VALUES WHERE SESSION_ID==@session_id ORDER BY ID";
+    auto stmt = this->database->new_statement(sql);
+    stmt->bind_text("@session_id", session_id);
+
+    int status;
+    while ((status = stmt->step()) == SQLITE_ROW) {
+        meter_values.push_back(json::parse(stmt->column_text(0)));
+    }
+
+    if (status != SQLITE_DONE) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+
+    return meter_values;
+}
+
+void DatabaseHandler::delete_transaction_meter_values(const std::string& session_id) {
+    std::string sql = "DELETE FROM TRANSACTION_METER_VALUES WHERE SESSION_ID==@session_id";
+    auto stmt = this->database->new_statement(sql);
+    stmt->bind_text("@session_id", session_id);
+
+    if (stmt->step() != SQLITE_DONE) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+}
+
 // authorization cache
 void DatabaseHandler::insert_or_update_authorization_cache_entry(const CiString<20>& id_tag,
                                                                  const v16::IdTagInfo& id_tag_info) {
@@ -414,27 +467,71 @@ void DatabaseHandler::insert_or_update_local_authorization_list_entry(const CiSt
         stmt->bind_text("@parent_id_tag", id_tag_info.parentIdTag.value().get(), SQLiteString::Transient);
     }
 
-    if (stmt->step() != SQLITE_DONE) {
-        EVLOG_error << "Could not insert or update local authorization list entry into the database";
-        throw QueryExecutionException(this->database->get_error_message());
-    }
+    this->local_authorization_list_index.update({id_tag.get()}, {}, [&]() {
+        if (stmt->step() != SQLITE_DONE) {
+            EVLOG_error << "Could not insert or update local authorization list entry into the database";
+            throw QueryExecutionException(this->database->get_error_message());
+        }
+    });
 }
 
 void DatabaseHandler::insert_or_update_local_authorization_list(
     std::vector<v16::LocalAuthorizationList> local_authorization_list) {
     bool success = true; // indicates if all database operations succeeded
-    for (const auto& authorization_data : local_authorization_list) {
-        try {
+    std::vector<std::string> inserted_keys;
+    std::vector<std::string> removed_keys;
+
+    {
+        // apply the whole list within one transaction and reuse the prepared statements for every entry
+        auto transaction = this->database->begin_transaction();
+        auto insert_stmt = this->database->new_statement(
+            "INSERT OR REPLACE INTO AUTH_LIST (ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG) VALUES "
+            "(@id_tag, @auth_status, @expiry_date, @parent_id_tag)");
+        auto delete_stmt = this->database->new_statement("DELETE FROM AUTH_LIST WHERE ID_TAG = @id_tag;");
+
+        for (const auto& authorization_data : local_authorization_list) {
+            const auto& id_tag = authorization_data.idTag.get();
             if (authorization_data.idTagInfo) {
-                this->insert_or_update_local_authorization_list_entry(authorization_data.idTag,
-                                                                      authorization_data.idTagInfo.value());
+                const auto& id_tag_info = authorization_data.idTagInfo.value();
+                insert_stmt->bind_text("@id_tag", id_tag, SQLiteString::Transient);
+                insert_stmt->bind_text("@auth_status",
+                                       v16::conversions::authorization_status_to_string(id_tag_info.status),
+                                       SQLiteString::Transient);
+                // bindings survive a reset, so optional columns have to be set to NULL explicitly
+                if (id_tag_info.expiryDate.has_value()) {
+                    insert_stmt->bind_text("@expiry_date", id_tag_info.expiryDate.value().to_rfc3339(),
+                                           SQLiteString::Transient);
+                } else {
+                    insert_stmt->bind_null("@expiry_date");
+                }
+                if (id_tag_info.parentIdTag.has_value()) {
+                    insert_stmt->bind_text("@parent_id_tag", id_tag_info.parentIdTag.value().get(),
+                                           SQLiteString::Transient);
+                } else {
+                    insert_stmt->bind_null("@parent_id_tag");
+                }
+
+                if (insert_stmt->step() == SQLITE_DONE) {
+                    inserted_keys.push_back(id_tag);
+                } else {
+                    // continue with remaining entries
+                    EVLOG_error << "Could not insert or update local authorization list entry into the database";
+                    success = false;
+                }
+                insert_stmt->reset();
             } else {
-                this->delete_local_authorization_list_entry(authorization_data.idTag.get().c_str());
+                delete_stmt->bind_text("@id_tag", id_tag, SQLiteString::Transient);
+                if (delete_stmt->step() == SQLITE_DONE) {
+                    removed_keys.push_back(id_tag);
+                } else {
+                    // continue with remaining entries
+                    success = false;
+                }
+                delete_stmt->reset();
             }
-        } catch (const QueryExecutionException& e) {
-            // catch but continue with remaining entries
-            success = false;
         }
+
+        this->local_authorization_list_index.update(inserted_keys, removed_keys, [&]() { transaction->commit(); });
     }
 
     if (!success) {
@@ -447,12 +544,18 @@ void DatabaseHandler::delete_local_authorization_list_entry(const std::string& i
     auto stmt = this->database->new_statement(sql);
 
     stmt->bind_text("@id_tag", id_tag);
-    if (stmt->step() != SQLITE_DONE) {
-        throw QueryExecutionException(this->database->get_error_message());
-    }
+    this->local_authorization_list_index.update({}, {id_tag}, [&]() {
+        if (stmt->step() != SQLITE_DONE) {
+            throw QueryExecutionException(this->database->get_error_message());
+        }
+    });
 }
 
 std::optional<v16::IdTagInfo> DatabaseHandler::get_local_authorization_list_entry(const CiString<20>& id_tag) {
+    if (!this->local_authorization_list_index.may_contain(id_tag.get())) {
+        return std::nullopt;
+    }
+
     std::string sql = "SELECT ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG FROM AUTH_LIST WHERE ID_TAG = @id_tag";
     auto stmt = this->database->new_statement(sql);
 
@@ -499,8 +602,26 @@ std::optional<v16::IdTagInfo> DatabaseHandler::get_local_authorization_list_entr
 void DatabaseHandler::clear_local_authorization_list() {
     const auto retval = this->database->clear_table("AUTH_LIST");
     if (retval == false) {
+        this->local_authorization_list_index.invalidate();
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+    this->local_authorization_list_index.clear();
+}
+
+std::vector<std::string> DatabaseHandler::get_local_authorization_list_keys() {
+    auto stmt = this->database->new_statement("SELECT ID_TAG FROM AUTH_LIST;");
+
+    std::vector<std::string> keys;
+    int status;
+    while ((status = stmt->step()) == SQLITE_ROW) {
+        keys.push_back(stmt->column_text(0));
+    }
+
+    if (status != SQLITE_DONE) {
         throw QueryExecutionException(this->database->get_error_message());
     }
+
+    return keys;
 }
 
 int32_t DatabaseHandler::get_local_authorization_list_number_of_entries() {
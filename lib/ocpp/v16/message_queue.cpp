@@ -34,6 +34,29 @@ template <> bool ControlMessage<v16::MessageType>::is_transaction_update_message
     return (this->messageType == v16::MessageType::MeterValues);
 }
 
+template <> bool ControlMessage<v16::MessageType>::is_periodic_transaction_update_message() const {
+    if (!this->is_transaction_update_message()) {
+        return false;
+    }
+    for (const auto& meter_value : this->message.at(CALL_PAYLOAD).value("meterValue", json::array())) {
+        for (const auto& sampled_value : meter_value.value("sampledValue", json::array())) {
+            // the default context of a sampled value is Sample.Periodic
+            const auto context = sampled_value.value("context", "Sample.Periodic");
+            if ((context != "Sample.Periodic" and context != "Sample.Clock") or
+                sampled_value.value("format", "Raw") == "SignedData") {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <> std::string ControlMessage<v16::MessageType>::get_transaction_key() const {
+    // MeterValue.req queued while the transactionId is unknown do not contain it, so the connector is part of the key
+    const auto& payload = this->message.at(CALL_PAYLOAD);
+    return payload.value("connectorId", json()).dump() + ":" + payload.value("transactionId", json()).dump();
+}
+
 template <> v16::MessageType MessageQueue<v16::MessageType>::string_to_messagetype(const std::string& s) {
     return v16::conversions::string_to_messagetype(s);
 }
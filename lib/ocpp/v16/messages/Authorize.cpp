@@ -32,6 +32,13 @@ void from_json(const json& j, AuthorizeRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const AuthorizeRequest& k) {
+    writer.start_object();
+    writer.key("idTag");
+    write_json(writer, k.idTag);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given AuthorizeRequest \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeRequest written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeRequest& k) {
@@ -58,6 +65,13 @@ void from_json(const json& j, AuthorizeResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const AuthorizeResponse& k) {
+    writer.start_object();
+    writer.key("idTagInfo");
+    write_json(writer, k.idTagInfo);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given AuthorizeResponse \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeResponse written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeResponse& k) {
@@ -76,6 +76,43 @@ void from_json(const json& j, BootNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const BootNotificationRequest& k) {
+    writer.start_object();
+    if (k.chargeBoxSerialNumber) {
+        writer.key("chargeBoxSerialNumber");
+        write_json(writer, k.chargeBoxSerialNumber.value());
+    }
+    writer.key("chargePointModel");
+    write_json(writer, k.chargePointModel);
+    if (k.chargePointSerialNumber) {
+        writer.key("chargePointSerialNumber");
+        write_json(writer, k.chargePointSerialNumber.value());
+    }
+    writer.key("chargePointVendor");
+    write_json(writer, k.chargePointVendor);
+    if (k.firmwareVersion) {
+        writer.key("firmwareVersion");
+        write_json(writer, k.firmwareVersion.value());
+    }
+    if (k.iccid) {
+        writer.key("iccid");
+        write_json(writer, k.iccid.value());
+    }
+    if (k.imsi) {
+        writer.key("imsi");
+        write_json(writer, k.imsi.value());
+    }
+    if (k.meterSerialNumber) {
+        writer.key("meterSerialNumber");
+        write_json(writer, k.meterSerialNumber.value());
+    }
+    if (k.meterType) {
+        writer.key("meterType");
+        write_json(writer, k.meterType.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given BootNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationRequest& k) {
@@ -106,6 +143,17 @@ void from_json(const json& j, BootNotificationResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const BootNotificationResponse& k) {
+    writer.start_object();
+    writer.key("currentTime");
+    write_json(writer, k.currentTime);
+    writer.key("interval");
+    write_json(writer, k.interval);
+    writer.key("status");
+    writer.value(conversions::registration_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given BootNotificationResponse \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationResponse& k) {
@@ -31,6 +31,13 @@ void from_json(const json& j, CancelReservationRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CancelReservationRequest& k) {
+    writer.start_object();
+    writer.key("reservationId");
+    write_json(writer, k.reservationId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CancelReservationRequest \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationRequest written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationRequest& k) {
@@ -57,6 +64,13 @@ void from_json(const json& j, CancelReservationResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CancelReservationResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::cancel_reservation_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CancelReservationResponse \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationResponse written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationResponse& k) {
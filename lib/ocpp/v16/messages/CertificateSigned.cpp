@@ -31,6 +31,13 @@ void from_json(const json& j, CertificateSignedRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedRequest& k) {
+    writer.start_object();
+    writer.key("certificateChain");
+    write_json(writer, k.certificateChain);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CertificateSignedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedRequest written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedRequest& k) {
@@ -57,6 +64,13 @@ void from_json(const json& j, CertificateSignedResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::certificate_signed_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CertificateSignedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedResponse written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedResponse& k) {
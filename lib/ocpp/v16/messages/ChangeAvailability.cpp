@@ -33,6 +33,15 @@ void from_json(const json& j, ChangeAvailabilityRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeAvailabilityRequest& k) {
+    writer.start_object();
+    writer.key("connectorId");
+    write_json(writer, k.connectorId);
+    writer.key("type");
+    writer.value(conversions::availability_type_to_string(k.type));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ChangeAvailabilityRequest \p k to the given output stream \p os
 /// \returns an output stream with the ChangeAvailabilityRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityRequest& k) {
@@ -59,6 +68,13 @@ void from_json(const json& j, ChangeAvailabilityResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeAvailabilityResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::availability_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ChangeAvailabilityResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeAvailabilityResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityResponse& k) {
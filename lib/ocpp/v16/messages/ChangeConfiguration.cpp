@@ -33,6 +33,15 @@ void from_json(const json& j, ChangeConfigurationRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeConfigurationRequest& k) {
+    writer.start_object();
+    writer.key("key");
+    write_json(writer, k.key);
+    writer.key("value");
+    write_json(writer, k.value);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ChangeConfigurationRequest \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationRequest& k) {
@@ -59,6 +68,13 @@ void from_json(const json& j, ChangeConfigurationResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeConfigurationResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::configuration_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ChangeConfigurationResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationResponse& k) {
@@ -32,6 +32,12 @@ void from_json(const json& j, ClearCacheRequest& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const ClearCacheRequest& k) {
+    writer.start_object();
+    (void)k; // no elements to write, silence unused parameter warning
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearCacheRequest \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheRequest& k) {
@@ -58,6 +64,13 @@ void from_json(const json& j, ClearCacheResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ClearCacheResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::clear_cache_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearCacheResponse \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheResponse& k) {
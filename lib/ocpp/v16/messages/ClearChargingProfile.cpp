@@ -55,6 +55,27 @@ void from_json(const json& j, ClearChargingProfileRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearChargingProfileRequest& k) {
+    writer.start_object();
+    if (k.chargingProfilePurpose) {
+        writer.key("chargingProfilePurpose");
+        writer.value(conversions::charging_profile_purpose_type_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.connectorId) {
+        writer.key("connectorId");
+        write_json(writer, k.connectorId.value());
+    }
+    if (k.id) {
+        writer.key("id");
+        write_json(writer, k.id.value());
+    }
+    if (k.stackLevel) {
+        writer.key("stackLevel");
+        write_json(writer, k.stackLevel.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearChargingProfileRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileRequest& k) {
@@ -81,6 +102,13 @@ void from_json(const json& j, ClearChargingProfileResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ClearChargingProfileResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::clear_charging_profile_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileResponse& k) {
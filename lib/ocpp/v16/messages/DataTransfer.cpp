@@ -44,6 +44,21 @@ void from_json(const json& j, DataTransferRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DataTransferRequest& k) {
+    writer.start_object();
+    if (k.data) {
+        writer.key("data");
+        write_json(writer, k.data.value());
+    }
+    if (k.messageId) {
+        writer.key("messageId");
+        write_json(writer, k.messageId.value());
+    }
+    writer.key("vendorId");
+    write_json(writer, k.vendorId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DataTransferRequest \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferRequest written to
 std::ostream& operator<<(std::ostream& os, const DataTransferRequest& k) {
@@ -76,6 +91,17 @@ void from_json(const json& j, DataTransferResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DataTransferResponse& k) {
+    writer.start_object();
+    if (k.data) {
+        writer.key("data");
+        write_json(writer, k.data.value());
+    }
+    writer.key("status");
+    writer.value(conversions::data_transfer_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DataTransferResponse \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferResponse written to
 std::ostream& operator<<(std::ostream& os, const DataTransferResponse& k) {
@@ -31,6 +31,13 @@ void from_json(const json& j, DeleteCertificateRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const DeleteCertificateRequest& k) {
+    writer.start_object();
+    writer.key("certificateHashData");
+    write_json(writer, k.certificateHashData);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DeleteCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateRequest& k) {
@@ -57,6 +64,13 @@ void from_json(const json& j, DeleteCertificateResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const DeleteCertificateResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::delete_certificate_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DeleteCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateResponse& k) {
@@ -31,6 +31,13 @@ void from_json(const json& j, DiagnosticsStatusNotificationRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationRequest& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::diagnostics_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationRequest& k) {
@@ -58,6 +65,12 @@ void from_json(const json& j, DiagnosticsStatusNotificationResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationResponse& k) {
+    writer.start_object();
+    (void)k; // no elements to write, silence unused parameter warning
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationResponse& k) {
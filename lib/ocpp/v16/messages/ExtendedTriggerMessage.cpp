@@ -38,6 +38,17 @@ void from_json(const json& j, ExtendedTriggerMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageRequest& k) {
+    writer.start_object();
+    if (k.connectorId) {
+        writer.key("connectorId");
+        write_json(writer, k.connectorId.value());
+    }
+    writer.key("requestedMessage");
+    writer.value(conversions::message_trigger_enum_type_to_string(k.requestedMessage));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageRequest \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageRequest& k) {
@@ -64,6 +75,13 @@ void from_json(const json& j, ExtendedTriggerMessageResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::trigger_message_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageResponse \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageResponse& k) {
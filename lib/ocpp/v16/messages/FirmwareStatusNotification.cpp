@@ -31,6 +31,13 @@ void from_json(const json& j, FirmwareStatusNotificationRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationRequest& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::firmware_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationRequest& k) {
@@ -58,6 +65,12 @@ void from_json(const json& j, FirmwareStatusNotificationResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationResponse& k) {
+    writer.start_object();
+    (void)k; // no elements to write, silence unused parameter warning
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationResponse& k) {
@@ -40,6 +40,19 @@ void from_json(const json& j, GetCompositeScheduleRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCompositeScheduleRequest& k) {
+    writer.start_object();
+    if (k.chargingRateUnit) {
+        writer.key("chargingRateUnit");
+        writer.value(conversions::charging_rate_unit_to_string(k.chargingRateUnit.value()));
+    }
+    writer.key("connectorId");
+    write_json(writer, k.connectorId);
+    writer.key("duration");
+    write_json(writer, k.duration);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetCompositeScheduleRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleRequest& k) {
@@ -84,6 +97,25 @@ void from_json(const json& j, GetCompositeScheduleResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCompositeScheduleResponse& k) {
+    writer.start_object();
+    if (k.chargingSchedule) {
+        writer.key("chargingSchedule");
+        write_json(writer, k.chargingSchedule.value());
+    }
+    if (k.connectorId) {
+        writer.key("connectorId");
+        write_json(writer, k.connectorId.value());
+    }
+    if (k.scheduleStart) {
+        writer.key("scheduleStart");
+        write_json(writer, k.scheduleStart.value());
+    }
+    writer.key("status");
+    writer.value(conversions::get_composite_schedule_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetCompositeScheduleResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleResponse& k) {
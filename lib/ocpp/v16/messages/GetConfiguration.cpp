@@ -47,6 +47,15 @@ void from_json(const json& j, GetConfigurationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetConfigurationRequest& k) {
+    writer.start_object();
+    if (k.key) {
+        writer.key("key");
+        write_json(writer, k.key.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetConfigurationRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationRequest& k) {
@@ -106,6 +115,19 @@ void from_json(const json& j, GetConfigurationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetConfigurationResponse& k) {
+    writer.start_object();
+    if (k.configurationKey) {
+        writer.key("configurationKey");
+        write_json(writer, k.configurationKey.value());
+    }
+    if (k.unknownKey) {
+        writer.key("unknownKey");
+        write_json(writer, k.unknownKey.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetConfigurationResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationResponse& k) {
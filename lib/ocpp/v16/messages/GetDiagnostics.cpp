@@ -56,6 +56,29 @@ void from_json(const json& j, GetDiagnosticsRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDiagnosticsRequest& k) {
+    writer.start_object();
+    writer.key("location");
+    write_json(writer, k.location);
+    if (k.retries) {
+        writer.key("retries");
+        write_json(writer, k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        write_json(writer, k.retryInterval.value());
+    }
+    if (k.startTime) {
+        writer.key("startTime");
+        write_json(writer, k.startTime.value());
+    }
+    if (k.stopTime) {
+        writer.key("stopTime");
+        write_json(writer, k.stopTime.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetDiagnosticsRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsRequest& k) {
@@ -85,6 +108,15 @@ void from_json(const json& j, GetDiagnosticsResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDiagnosticsResponse& k) {
+    writer.start_object();
+    if (k.fileName) {
+        writer.key("fileName");
+        write_json(writer, k.fileName.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetDiagnosticsResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsResponse& k) {
@@ -32,6 +32,13 @@ void from_json(const json& j, GetInstalledCertificateIdsRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsRequest& k) {
+    writer.start_object();
+    writer.key("certificateType");
+    writer.value(conversions::certificate_use_enum_type_to_string(k.certificateType));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsRequest \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsRequest& k) {
@@ -72,6 +79,17 @@ void from_json(const json& j, GetInstalledCertificateIdsResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsResponse& k) {
+    writer.start_object();
+    if (k.certificateHashData) {
+        writer.key("certificateHashData");
+        write_json(writer, k.certificateHashData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::get_installed_certificate_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsResponse \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsResponse& k) {
@@ -32,6 +32,12 @@ void from_json(const json& j, GetLocalListVersionRequest& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const GetLocalListVersionRequest& k) {
+    writer.start_object();
+    (void)k; // no elements to write, silence unused parameter warning
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetLocalListVersionRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionRequest& k) {
@@ -58,6 +64,13 @@ void from_json(const json& j, GetLocalListVersionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const GetLocalListVersionResponse& k) {
+    writer.start_object();
+    writer.key("listVersion");
+    write_json(writer, k.listVersion);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetLocalListVersionResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionResponse& k) {
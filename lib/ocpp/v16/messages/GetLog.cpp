@@ -48,6 +48,25 @@ void from_json(const json& j, GetLogRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLogRequest& k) {
+    writer.start_object();
+    writer.key("log");
+    write_json(writer, k.log);
+    writer.key("logType");
+    writer.value(conversions::log_enum_type_to_string(k.logType));
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    if (k.retries) {
+        writer.key("retries");
+        write_json(writer, k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        write_json(writer, k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetLogRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetLogRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLogRequest& k) {
@@ -80,6 +99,17 @@ void from_json(const json& j, GetLogResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLogResponse& k) {
+    writer.start_object();
+    if (k.filename) {
+        writer.key("filename");
+        write_json(writer, k.filename.value());
+    }
+    writer.key("status");
+    writer.value(conversions::log_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetLogResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetLogResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLogResponse& k) {
@@ -32,6 +32,12 @@ void from_json(const json& j, HeartbeatRequest& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const HeartbeatRequest& k) {
+    writer.start_object();
+    (void)k; // no elements to write, silence unused parameter warning
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given HeartbeatRequest \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatRequest written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatRequest& k) {
@@ -58,6 +64,13 @@ void from_json(const json& j, HeartbeatResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const HeartbeatResponse& k) {
+    writer.start_object();
+    writer.key("currentTime");
+    write_json(writer, k.currentTime);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given HeartbeatResponse \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatResponse written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatResponse& k) {
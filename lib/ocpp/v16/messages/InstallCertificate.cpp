@@ -33,6 +33,15 @@ void from_json(const json& j, InstallCertificateRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k) {
+    writer.start_object();
+    writer.key("certificate");
+    write_json(writer, k.certificate);
+    writer.key("certificateType");
+    writer.value(conversions::certificate_use_enum_type_to_string(k.certificateType));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given InstallCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the InstallCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateRequest& k) {
@@ -59,6 +68,13 @@ void from_json(const json& j, InstallCertificateResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::install_certificate_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given InstallCertificateResponse \p k to the given output stream \p
 /// os \returns an output stream with the InstallCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateResponse& k) {
@@ -38,6 +38,17 @@ void from_json(const json& j, LogStatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const LogStatusNotificationRequest& k) {
+    writer.start_object();
+    if (k.requestId) {
+        writer.key("requestId");
+        write_json(writer, k.requestId.value());
+    }
+    writer.key("status");
+    writer.value(conversions::upload_log_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given LogStatusNotificationRequest \p k to the given output stream \p
 /// os \returns an output stream with the LogStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationRequest& k) {
@@ -65,6 +76,12 @@ void from_json(const json& j, LogStatusNotificationResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const LogStatusNotificationResponse& k) {
+    writer.start_object();
+    (void)k; // no elements to write, silence unused parameter warning
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given LogStatusNotificationResponse \p k to the given output stream
 /// \p os \returns an output stream with the LogStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationResponse& k) {
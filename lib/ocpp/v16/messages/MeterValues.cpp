@@ -42,6 +42,19 @@ void from_json(const json& j, MeterValuesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const MeterValuesRequest& k) {
+    writer.start_object();
+    writer.key("connectorId");
+    write_json(writer, k.connectorId);
+    writer.key("meterValue");
+    write_json(writer, k.meterValue);
+    if (k.transactionId) {
+        writer.key("transactionId");
+        write_json(writer, k.transactionId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given MeterValuesRequest \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesRequest written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesRequest& k) {
@@ -69,6 +82,12 @@ void from_json(const json& j, MeterValuesResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const MeterValuesResponse& k) {
+    writer.start_object();
+    (void)k; // no elements to write, silence unused parameter warning
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given MeterValuesResponse \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesResponse written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesResponse& k) {
@@ -44,6 +44,21 @@ void from_json(const json& j, RemoteStartTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RemoteStartTransactionRequest& k) {
+    writer.start_object();
+    if (k.chargingProfile) {
+        writer.key("chargingProfile");
+        write_json(writer, k.chargingProfile.value());
+    }
+    if (k.connectorId) {
+        writer.key("connectorId");
+        write_json(writer, k.connectorId.value());
+    }
+    writer.key("idTag");
+    write_json(writer, k.idTag);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RemoteStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionRequest& k) {
@@ -70,6 +85,13 @@ void from_json(const json& j, RemoteStartTransactionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const RemoteStartTransactionResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::remote_start_stop_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RemoteStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionResponse& k) {
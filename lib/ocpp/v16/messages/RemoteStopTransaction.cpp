@@ -31,6 +31,13 @@ void from_json(const json& j, RemoteStopTransactionRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const RemoteStopTransactionRequest& k) {
+    writer.start_object();
+    writer.key("transactionId");
+    write_json(writer, k.transactionId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RemoteStopTransactionRequest \p k to the given output stream \p
 /// os \returns an output stream with the RemoteStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionRequest& k) {
@@ -57,6 +64,13 @@ void from_json(const json& j, RemoteStopTransactionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const RemoteStopTransactionResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::remote_start_stop_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RemoteStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionResponse& k) {
@@ -44,6 +44,23 @@ void from_json(const json& j, ReserveNowRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReserveNowRequest& k) {
+    writer.start_object();
+    writer.key("connectorId");
+    write_json(writer, k.connectorId);
+    writer.key("expiryDate");
+    write_json(writer, k.expiryDate);
+    writer.key("idTag");
+    write_json(writer, k.idTag);
+    if (k.parentIdTag) {
+        writer.key("parentIdTag");
+        write_json(writer, k.parentIdTag.value());
+    }
+    writer.key("reservationId");
+    write_json(writer, k.reservationId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReserveNowRequest \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowRequest written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowRequest& k) {
@@ -70,6 +87,13 @@ void from_json(const json& j, ReserveNowResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ReserveNowResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::reservation_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReserveNowResponse \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowResponse written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowResponse& k) {
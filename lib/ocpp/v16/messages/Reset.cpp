@@ -31,6 +31,13 @@ void from_json(const json& j, ResetRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ResetRequest& k) {
+    writer.start_object();
+    writer.key("type");
+    writer.value(conversions::reset_type_to_string(k.type));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ResetRequest \p k to the given output stream \p os
 /// \returns an output stream with the ResetRequest written to
 std::ostream& operator<<(std::ostream& os, const ResetRequest& k) {
@@ -57,6 +64,13 @@ void from_json(const json& j, ResetResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ResetResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::reset_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ResetResponse \p k to the given output stream \p os
 /// \returns an output stream with the ResetResponse written to
 std::ostream& operator<<(std::ostream& os, const ResetResponse& k) {
@@ -40,6 +40,19 @@ void from_json(const json& j, SecurityEventNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SecurityEventNotificationRequest& k) {
+    writer.start_object();
+    if (k.techInfo) {
+        writer.key("techInfo");
+        write_json(writer, k.techInfo.value());
+    }
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    writer.key("type");
+    write_json(writer, k.type);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SecurityEventNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationRequest& k) {
@@ -67,6 +80,12 @@ void from_json(const json& j, SecurityEventNotificationResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const SecurityEventNotificationResponse& k) {
+    writer.start_object();
+    (void)k; // no elements to write, silence unused parameter warning
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SecurityEventNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationResponse& k) {
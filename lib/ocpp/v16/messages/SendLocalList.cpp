@@ -48,6 +48,19 @@ void from_json(const json& j, SendLocalListRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SendLocalListRequest& k) {
+    writer.start_object();
+    writer.key("listVersion");
+    write_json(writer, k.listVersion);
+    if (k.localAuthorizationList) {
+        writer.key("localAuthorizationList");
+        write_json(writer, k.localAuthorizationList.value());
+    }
+    writer.key("updateType");
+    writer.value(conversions::update_type_to_string(k.updateType));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SendLocalListRequest \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListRequest written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListRequest& k) {
@@ -74,6 +87,13 @@ void from_json(const json& j, SendLocalListResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SendLocalListResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::update_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SendLocalListResponse \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListResponse written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListResponse& k) {
@@ -34,6 +34,15 @@ void from_json(const json& j, SetChargingProfileRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k) {
+    writer.start_object();
+    writer.key("connectorId");
+    write_json(writer, k.connectorId);
+    writer.key("csChargingProfiles");
+    write_json(writer, k.csChargingProfiles);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileRequest& k) {
@@ -60,6 +69,13 @@ void from_json(const json& j, SetChargingProfileResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::charging_profile_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileResponse& k) {
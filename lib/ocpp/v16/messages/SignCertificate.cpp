@@ -31,6 +31,13 @@ void from_json(const json& j, SignCertificateRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SignCertificateRequest& k) {
+    writer.start_object();
+    writer.key("csr");
+    write_json(writer, k.csr);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateRequest& k) {
@@ -57,6 +64,13 @@ void from_json(const json& j, SignCertificateResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SignCertificateResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::generic_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateResponse& k) {
@@ -38,6 +38,17 @@ void from_json(const json& j, SignedFirmwareStatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationRequest& k) {
+    writer.start_object();
+    if (k.requestId) {
+        writer.key("requestId");
+        write_json(writer, k.requestId.value());
+    }
+    writer.key("status");
+    writer.value(conversions::firmware_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignedFirmwareStatusNotificationRequest \p k to the given
 /// output stream \p os \returns an output stream with the SignedFirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const SignedFirmwareStatusNotificationRequest& k) {
@@ -65,6 +76,12 @@ void from_json(const json& j, SignedFirmwareStatusNotificationResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationResponse& k) {
+    writer.start_object();
+    (void)k; // no elements to write, silence unused parameter warning
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignedFirmwareStatusNotificationResponse \p k to the given
 /// output stream \p os \returns an output stream with the SignedFirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const SignedFirmwareStatusNotificationResponse& k) {
@@ -46,6 +46,23 @@ void from_json(const json& j, SignedUpdateFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareRequest& k) {
+    writer.start_object();
+    writer.key("firmware");
+    write_json(writer, k.firmware);
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    if (k.retries) {
+        writer.key("retries");
+        write_json(writer, k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        write_json(writer, k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareRequest \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareRequest& k) {
@@ -72,6 +89,13 @@ void from_json(const json& j, SignedUpdateFirmwareResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::update_firmware_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareResponse \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareResponse& k) {
@@ -44,6 +44,23 @@ void from_json(const json& j, StartTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StartTransactionRequest& k) {
+    writer.start_object();
+    writer.key("connectorId");
+    write_json(writer, k.connectorId);
+    writer.key("idTag");
+    write_json(writer, k.idTag);
+    writer.key("meterStart");
+    write_json(writer, k.meterStart);
+    if (k.reservationId) {
+        writer.key("reservationId");
+        write_json(writer, k.reservationId.value());
+    }
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StartTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionRequest& k) {
@@ -72,6 +89,15 @@ void from_json(const json& j, StartTransactionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const StartTransactionResponse& k) {
+    writer.start_object();
+    writer.key("idTagInfo");
+    write_json(writer, k.idTagInfo);
+    writer.key("transactionId");
+    write_json(writer, k.transactionId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StartTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionResponse& k) {
@@ -60,6 +60,33 @@ void from_json(const json& j, StatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StatusNotificationRequest& k) {
+    writer.start_object();
+    writer.key("connectorId");
+    write_json(writer, k.connectorId);
+    writer.key("errorCode");
+    writer.value(conversions::charge_point_error_code_to_string(k.errorCode));
+    if (k.info) {
+        writer.key("info");
+        write_json(writer, k.info.value());
+    }
+    writer.key("status");
+    writer.value(conversions::charge_point_status_to_string(k.status));
+    if (k.timestamp) {
+        writer.key("timestamp");
+        write_json(writer, k.timestamp.value());
+    }
+    if (k.vendorErrorCode) {
+        writer.key("vendorErrorCode");
+        write_json(writer, k.vendorErrorCode.value());
+    }
+    if (k.vendorId) {
+        writer.key("vendorId");
+        write_json(writer, k.vendorId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StatusNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the StatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationRequest& k) {
@@ -87,6 +114,12 @@ void from_json(const json& j, StatusNotificationResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const StatusNotificationResponse& k) {
+    writer.start_object();
+    (void)k; // no elements to write, silence unused parameter warning
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StatusNotificationResponse \p k to the given output stream \p
 /// os \returns an output stream with the StatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationResponse& k) {
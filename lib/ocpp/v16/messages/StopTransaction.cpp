@@ -62,6 +62,29 @@ void from_json(const json& j, StopTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StopTransactionRequest& k) {
+    writer.start_object();
+    if (k.idTag) {
+        writer.key("idTag");
+        write_json(writer, k.idTag.value());
+    }
+    writer.key("meterStop");
+    write_json(writer, k.meterStop);
+    if (k.reason) {
+        writer.key("reason");
+        writer.value(conversions::reason_to_string(k.reason.value()));
+    }
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    if (k.transactionData) {
+        writer.key("transactionData");
+        write_json(writer, k.transactionData.value());
+    }
+    writer.key("transactionId");
+    write_json(writer, k.transactionId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StopTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionRequest& k) {
@@ -91,6 +114,15 @@ void from_json(const json& j, StopTransactionResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StopTransactionResponse& k) {
+    writer.start_object();
+    if (k.idTagInfo) {
+        writer.key("idTagInfo");
+        write_json(writer, k.idTagInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StopTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionResponse& k) {
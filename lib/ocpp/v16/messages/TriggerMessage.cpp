@@ -38,6 +38,17 @@ void from_json(const json& j, TriggerMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TriggerMessageRequest& k) {
+    writer.start_object();
+    if (k.connectorId) {
+        writer.key("connectorId");
+        write_json(writer, k.connectorId.value());
+    }
+    writer.key("requestedMessage");
+    writer.value(conversions::message_trigger_to_string(k.requestedMessage));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given TriggerMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageRequest& k) {
@@ -64,6 +75,13 @@ void from_json(const json& j, TriggerMessageResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const TriggerMessageResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::trigger_message_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given TriggerMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageResponse& k) {
@@ -31,6 +31,13 @@ void from_json(const json& j, UnlockConnectorRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const UnlockConnectorRequest& k) {
+    writer.start_object();
+    writer.key("connectorId");
+    write_json(writer, k.connectorId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UnlockConnectorRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorRequest written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorRequest& k) {
@@ -57,6 +64,13 @@ void from_json(const json& j, UnlockConnectorResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const UnlockConnectorResponse& k) {
+    writer.start_object();
+    writer.key("status");
+    writer.value(conversions::unlock_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UnlockConnectorResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorResponse written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorResponse& k) {
@@ -46,6 +46,23 @@ void from_json(const json& j, UpdateFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UpdateFirmwareRequest& k) {
+    writer.start_object();
+    writer.key("location");
+    write_json(writer, k.location);
+    if (k.retries) {
+        writer.key("retries");
+        write_json(writer, k.retries.value());
+    }
+    writer.key("retrieveDate");
+    write_json(writer, k.retrieveDate);
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        write_json(writer, k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UpdateFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareRequest& k) {
@@ -73,6 +90,12 @@ void from_json(const json& j, UpdateFirmwareResponse& k) {
     (void)k;
 }
 
+void write_json(JsonWriter& writer, const UpdateFirmwareResponse& k) {
+    writer.start_object();
+    (void)k; // no elements to write, silence unused parameter warning
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UpdateFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareResponse& k) {
@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <everest/logging.hpp>
+
+#include <ocpp/v16/meter_value_sampling_plan.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+namespace {
+using ValueAccessor = std::function<std::optional<double>(const MeterValueSamplingSource& source)>;
+
+std::optional<double> to_double(const std::optional<float>& value) {
+    if (value.has_value()) {
+        return value.value();
+    }
+    return std::nullopt;
+}
+
+/// \brief Returns the member of \p T holding the value of \p phase or nullptr if \p T has no value for this phase
+template <typename T> std::optional<float> T::*get_phase_member(const Phase phase) {
+    if (phase == Phase::L1) {
+        return &T::L1;
+    } else if (phase == Phase::L2) {
+        return &T::L2;
+    } else if (phase == Phase::L3) {
+        return &T::L3;
+    }
+    return nullptr;
+}
+
+/// \brief Accessor for \p member of the power meter value \p field
+template <typename T> ValueAccessor member_accessor(T Powermeter::*field, std::optional<float> T::*member) {
+    return [field, member](const MeterValueSamplingSource& source) {
+        return to_double(source.measurement.power_meter.*field.*member);
+    };
+}
+
+/// \brief Accessor for \p member of the optional power meter value \p field
+template <typename T>
+ValueAccessor member_accessor(std::optional<T> Powermeter::*field, std::optional<float> T::*member) {
+    return [field, member](const MeterValueSamplingSource& source) -> std::optional<double> {
+        const auto& value = source.measurement.power_meter.*field;
+        if (!value.has_value()) {
+            return std::nullopt;
+        }
+        return to_double(value.value().*member);
+    };
+}
+
+/// \brief Accessor for the per phase value of the power meter value \p field, an empty accessor if \p T has no value
+/// for \p phase
+template <typename T, typename Field> ValueAccessor phase_accessor(Field field, const Phase phase) {
+    const auto member = get_phase_member<T>(phase);
+    if (member == nullptr) {
+        return nullptr;
+    }
+    return member_accessor(field, member);
+}
+} // namespace
+
+MeterValueSamplingPlan::MeterValueSamplingPlan(const std::vector<MeasurandWithPhase>& measurands) {
+    this->steps.reserve(measurands.size());
+    for (const auto& measurand : measurands) {
+        this->add_step(measurand);
+    }
+}
+
+void MeterValueSamplingPlan::add_step(const MeasurandWithPhase& configured_measurand) {
+    Step step;
+    step.type = StepType::Value;
+    step.prototype.format.emplace(ValueFormat::Raw); // TODO(kai): support signed data as well
+    step.prototype.measurand.emplace(configured_measurand.measurand);
+    const auto& phase = configured_measurand.phase;
+
+    switch (configured_measurand.measurand) {
+    case Measurand::Energy_Active_Import_Register:
+        // Imported energy in Wh (from grid)
+        step.prototype.unit.emplace(UnitOfMeasure::Wh);
+        step.prototype.location.emplace(Location::Outlet);
+        if (phase.has_value()) {
+            step.prototype.phase = phase;
+            step.accessor = phase_accessor<Energy>(&Powermeter::energy_Wh_import, phase.value());
+        } else {
+            step.accessor = [](const MeterValueSamplingSource& source) -> std::optional<double> {
+                return source.measurement.power_meter.energy_Wh_import.total;
+            };
+        }
+        break;
+    case Measurand::Energy_Active_Export_Register:
+        // Exported energy in Wh (to grid)
+        step.prototype.unit.emplace(UnitOfMeasure::Wh);
+        // TODO: which location is appropriate here? Inlet?
+        if (phase.has_value()) {
+            step.prototype.phase = phase;
+            step.accessor = phase_accessor<Energy>(&Powermeter::energy_Wh_export, phase.value());
+        } else {
+            step.accessor = [](const MeterValueSamplingSource& source) -> std::optional<double> {
+                const auto& energy_Wh_export = source.measurement.power_meter.energy_Wh_export;
+                if (!energy_Wh_export.has_value()) {
+                    return std::nullopt;
+                }
+                return energy_Wh_export.value().total;
+            };
+        }
+        break;
+    case Measurand::Power_Active_Import:
+        // power flow to EV, Instantaneous power in Watt
+        step.prototype.unit.emplace(UnitOfMeasure::W);
+        step.prototype.location.emplace(Location::Outlet);
+        if (phase.has_value()) {
+            step.prototype.phase = phase;
+            step.accessor = phase_accessor<Power>(&Powermeter::power_W, phase.value());
+        } else {
+            step.accessor = [](const MeterValueSamplingSource& source) -> std::optional<double> {
+                const auto& power_W = source.measurement.power_meter.power_W;
+                if (!power_W.has_value()) {
+                    return std::nullopt;
+                }
+                return power_W.value().total;
+            };
+        }
+        break;
+    case Measurand::Voltage:
+        // AC supply voltage, Voltage in Volts
+        step.prototype.unit.emplace(UnitOfMeasure::V);
+        step.prototype.location.emplace(Location::Outlet);
+        if (phase.has_value()) {
+            step.prototype.phase = phase;
+            step.accessor = phase_accessor<Voltage>(&Powermeter::voltage_V, phase.value());
+        } else {
+            // report DC value if set. This is a workaround for the fact that the power meter does not report AC (DC
+            // charging)
+            step.accessor = member_accessor(&Powermeter::voltage_V, &Voltage::DC);
+        }
+        break;
+    case Measurand::Current_Import:
+        // current flow to EV in A
+        step.prototype.unit.emplace(UnitOfMeasure::A);
+        step.prototype.location.emplace(Location::Outlet);
+        if (phase.has_value()) {
+            step.prototype.phase = phase;
+            step.accessor = phase_accessor<Current>(&Powermeter::current_A, phase.value());
+        } else {
+            // report DC value if set. This is a workaround for the fact that the power meter does not report AC (DC
+            // charging)
+            step.accessor = member_accessor(&Powermeter::current_A, &Current::DC);
+        }
+        break;
+    case Measurand::Frequency:
+        // Grid frequency in Hertz, only reported per phase
+        // TODO: which location is appropriate here? Inlet?
+        if (phase.has_value()) {
+            step.prototype.phase = phase;
+            if (phase.value() == Phase::L1) {
+                step.accessor = [](const MeterValueSamplingSource& source) -> std::optional<double> {
+                    const auto& frequency_Hz = source.measurement.power_meter.frequency_Hz;
+                    if (!frequency_Hz.has_value()) {
+                        return std::nullopt;
+                    }
+                    return frequency_Hz.value().L1;
+                };
+            } else if (phase.value() == Phase::L2) {
+                step.accessor = member_accessor(&Powermeter::frequency_Hz, &Frequency::L2);
+            } else if (phase.value() == Phase::L3) {
+                step.accessor = member_accessor(&Powermeter::frequency_Hz, &Frequency::L3);
+            }
+        }
+        break;
+    case Measurand::Current_Offered:
+        // current offered to EV
+        step.prototype.unit.emplace(UnitOfMeasure::A);
+        step.prototype.location.emplace(Location::Outlet);
+        step.accessor = [](const MeterValueSamplingSource& source) -> std::optional<double> {
+            return source.max_current_offered;
+        };
+        break;
+    case Measurand::Power_Offered:
+        // power offered to EV
+        step.prototype.unit.emplace(UnitOfMeasure::W);
+        step.prototype.location.emplace(Location::Outlet);
+        step.accessor = [](const MeterValueSamplingSource& source) -> std::optional<double> {
+            return source.max_power_offered;
+        };
+        break;
+    case Measurand::SoC:
+        step.type = StepType::StateOfCharge;
+        step.prototype.unit.emplace(UnitOfMeasure::Percent);
+        break;
+    case Measurand::Temperature:
+        step.type = StepType::Temperature;
+        step.prototype.unit.emplace(UnitOfMeasure::Celsius);
+        break;
+    case Measurand::RPM:
+        step.type = StepType::Rpm;
+        break;
+    case Measurand::Energy_Reactive_Export_Register:
+    case Measurand::Energy_Reactive_Import_Register:
+    case Measurand::Energy_Active_Export_Interval:
+    case Measurand::Energy_Active_Import_Interval:
+    case Measurand::Energy_Reactive_Export_Interval:
+    case Measurand::Energy_Reactive_Import_Interval:
+    case Measurand::Power_Active_Export:
+    case Measurand::Power_Reactive_Export:
+    case Measurand::Power_Reactive_Import:
+    case Measurand::Power_Factor:
+    case Measurand::Current_Export:
+        break;
+    }
+
+    if (step.type == StepType::Value and step.accessor == nullptr) {
+        EVLOG_debug << "Measurand " << conversions::measurand_to_string(configured_measurand.measurand)
+                    << (phase.has_value() ? " with phase " + conversions::phase_to_string(phase.value()) : "")
+                    << " can not be sampled";
+        return;
+    }
+
+    this->steps.push_back(std::move(step));
+}
+
+MeterValue MeterValueSamplingPlan::sample(const MeterValueSamplingSource& source, ReadingContext context) const {
+    const auto& measurement = source.measurement;
+    MeterValue meter_value;
+    meter_value.timestamp = ocpp::DateTime(measurement.power_meter.timestamp);
+    meter_value.sampledValue.reserve(this->steps.size());
+
+    for (const auto& step : this->steps) {
+        switch (step.type) {
+        case StepType::Value: {
+            const auto value = step.accessor(source);
+            // only add if value is set
+            if (value.has_value()) {
+                auto& sample = meter_value.sampledValue.emplace_back(step.prototype);
+                sample.context.emplace(context);
+                sample.value = ocpp::conversions::double_to_string(value.value());
+            }
+            break;
+        }
+        case StepType::StateOfCharge: {
+            const auto& soc = measurement.soc_Percent;
+            if (soc.has_value()) {
+                auto& sample = meter_value.sampledValue.emplace_back(step.prototype);
+                sample.context.emplace(context);
+                sample.value = ocpp::conversions::double_to_string(soc.value().value);
+                if (soc.value().location.has_value()) {
+                    sample.location.emplace(conversions::string_to_location(soc.value().location.value()));
+                } else {
+                    sample.location.emplace(Location::EV);
+                }
+            }
+            break;
+        }
+        case StepType::Rpm: {
+            const auto& rpm = measurement.rpm;
+            if (rpm.has_value()) {
+                auto& sample = meter_value.sampledValue.emplace_back(step.prototype);
+                sample.context.emplace(context);
+                if (rpm.value().location.has_value()) {
+                    sample.location.emplace(conversions::string_to_location(rpm.value().location.value()));
+                } else {
+                    sample.location.emplace(Location::EV);
+                }
+                sample.value = ocpp::conversions::double_to_string(rpm.value().value);
+            }
+            break;
+        }
+        case StepType::Temperature: {
+            SampledValue sample = step.prototype;
+            sample.context.emplace(context);
+            for (const auto& temperature : measurement.temperature_C) {
+                if (temperature.location.has_value()) {
+                    try {
+                        sample.location.emplace(conversions::string_to_location(temperature.location.value()));
+                    } catch (const StringToEnumException& e) {
+                        EVLOG_debug << "Could not convert string: " << temperature.location.value() << " to Location";
+                    }
+                } else {
+                    sample.location = std::nullopt;
+                }
+                sample.value = ocpp::conversions::double_to_string(temperature.value);
+                meter_value.sampledValue.push_back(sample);
+            }
+            break;
+        }
+        }
+    }
+
+    return meter_value;
+}
+
+std::size_t MeterValueSamplingPlan::size() const {
+    return this->steps.size();
+}
+
+} // namespace v16
+} // namespace ocpp
@@ -44,6 +44,22 @@ void from_json(const json& j, IdTagInfo& k) {
     }
 }
 
+/// \brief Writes the given IdTagInfo \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const IdTagInfo& k) {
+    writer.start_object();
+    if (k.expiryDate) {
+        writer.key("expiryDate");
+        write_json(writer, k.expiryDate.value());
+    }
+    if (k.parentIdTag) {
+        writer.key("parentIdTag");
+        write_json(writer, k.parentIdTag.value());
+    }
+    writer.key("status");
+    writer.value(conversions::authorization_status_to_string(k.status));
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given IdTagInfo \p k to the given output stream \p os
 /// \returns an output stream with the IdTagInfo written to
 std::ostream& operator<<(std::ostream& os, const IdTagInfo& k) {
@@ -74,6 +90,20 @@ void from_json(const json& j, CertificateHashDataType& k) {
     // the optional parts of the message
 }
 
+/// \brief Writes the given CertificateHashDataType \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataType& k) {
+    writer.start_object();
+    writer.key("hashAlgorithm");
+    writer.value(conversions::hash_algorithm_enum_type_to_string(k.hashAlgorithm));
+    writer.key("issuerKeyHash");
+    write_json(writer, k.issuerKeyHash);
+    writer.key("issuerNameHash");
+    write_json(writer, k.issuerNameHash);
+    writer.key("serialNumber");
+    write_json(writer, k.serialNumber);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given CertificateHashDataType \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataType written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataType& k) {
@@ -106,6 +136,20 @@ void from_json(const json& j, ChargingSchedulePeriod& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedulePeriod \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k) {
+    writer.start_object();
+    writer.key("limit");
+    write_json(writer, k.limit);
+    if (k.numberPhases) {
+        writer.key("numberPhases");
+        write_json(writer, k.numberPhases.value());
+    }
+    writer.key("startPeriod");
+    write_json(writer, k.startPeriod);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingSchedulePeriod \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedulePeriod written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedulePeriod& k) {
@@ -152,6 +196,28 @@ void from_json(const json& j, ChargingSchedule& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedule \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedule& k) {
+    writer.start_object();
+    writer.key("chargingRateUnit");
+    writer.value(conversions::charging_rate_unit_to_string(k.chargingRateUnit));
+    writer.key("chargingSchedulePeriod");
+    write_json(writer, k.chargingSchedulePeriod);
+    if (k.duration) {
+        writer.key("duration");
+        write_json(writer, k.duration.value());
+    }
+    if (k.minChargingRate) {
+        writer.key("minChargingRate");
+        write_json(writer, k.minChargingRate.value());
+    }
+    if (k.startSchedule) {
+        writer.key("startSchedule");
+        write_json(writer, k.startSchedule.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingSchedule \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedule written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedule& k) {
@@ -184,6 +250,20 @@ void from_json(const json& j, KeyValue& k) {
     }
 }
 
+/// \brief Writes the given KeyValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const KeyValue& k) {
+    writer.start_object();
+    writer.key("key");
+    write_json(writer, k.key);
+    writer.key("readonly");
+    write_json(writer, k.readonly);
+    if (k.value) {
+        writer.key("value");
+        write_json(writer, k.value.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given KeyValue \p k to the given output stream \p os
 /// \returns an output stream with the KeyValue written to
 std::ostream& operator<<(std::ostream& os, const KeyValue& k) {
@@ -220,6 +300,22 @@ void from_json(const json& j, LogParametersType& k) {
     }
 }
 
+/// \brief Writes the given LogParametersType \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const LogParametersType& k) {
+    writer.start_object();
+    if (k.latestTimestamp) {
+        writer.key("latestTimestamp");
+        write_json(writer, k.latestTimestamp.value());
+    }
+    if (k.oldestTimestamp) {
+        writer.key("oldestTimestamp");
+        write_json(writer, k.oldestTimestamp.value());
+    }
+    writer.key("remoteLocation");
+    write_json(writer, k.remoteLocation);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given LogParametersType \p k to the given output stream \p os
 /// \returns an output stream with the LogParametersType written to
 std::ostream& operator<<(std::ostream& os, const LogParametersType& k) {
@@ -280,6 +376,38 @@ void from_json(const json& j, SampledValue& k) {
     }
 }
 
+/// \brief Writes the given SampledValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SampledValue& k) {
+    writer.start_object();
+    if (k.context) {
+        writer.key("context");
+        writer.value(conversions::reading_context_to_string(k.context.value()));
+    }
+    if (k.format) {
+        writer.key("format");
+        writer.value(conversions::value_format_to_string(k.format.value()));
+    }
+    if (k.location) {
+        writer.key("location");
+        writer.value(conversions::location_to_string(k.location.value()));
+    }
+    if (k.measurand) {
+        writer.key("measurand");
+        writer.value(conversions::measurand_to_string(k.measurand.value()));
+    }
+    if (k.phase) {
+        writer.key("phase");
+        writer.value(conversions::phase_to_string(k.phase.value()));
+    }
+    if (k.unit) {
+        writer.key("unit");
+        writer.value(conversions::unit_of_measure_to_string(k.unit.value()));
+    }
+    writer.key("value");
+    write_json(writer, k.value);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
 /// \returns an output stream with the SampledValue written to
 std::ostream& operator<<(std::ostream& os, const SampledValue& k) {
@@ -308,6 +436,16 @@ void from_json(const json& j, MeterValue& k) {
     // the optional parts of the message
 }
 
+/// \brief Writes the given MeterValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MeterValue& k) {
+    writer.start_object();
+    writer.key("sampledValue");
+    write_json(writer, k.sampledValue);
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given MeterValue \p k to the given output stream \p os
 /// \returns an output stream with the MeterValue written to
 std::ostream& operator<<(std::ostream& os, const MeterValue& k) {
@@ -364,6 +502,38 @@ void from_json(const json& j, ChargingProfile& k) {
     }
 }
 
+/// \brief Writes the given ChargingProfile \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfile& k) {
+    writer.start_object();
+    writer.key("chargingProfileId");
+    write_json(writer, k.chargingProfileId);
+    writer.key("chargingProfileKind");
+    writer.value(conversions::charging_profile_kind_type_to_string(k.chargingProfileKind));
+    writer.key("chargingProfilePurpose");
+    writer.value(conversions::charging_profile_purpose_type_to_string(k.chargingProfilePurpose));
+    writer.key("chargingSchedule");
+    write_json(writer, k.chargingSchedule);
+    if (k.recurrencyKind) {
+        writer.key("recurrencyKind");
+        writer.value(conversions::recurrency_kind_type_to_string(k.recurrencyKind.value()));
+    }
+    writer.key("stackLevel");
+    write_json(writer, k.stackLevel);
+    if (k.transactionId) {
+        writer.key("transactionId");
+        write_json(writer, k.transactionId.value());
+    }
+    if (k.validFrom) {
+        writer.key("validFrom");
+        write_json(writer, k.validFrom.value());
+    }
+    if (k.validTo) {
+        writer.key("validTo");
+        write_json(writer, k.validTo.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfile& k) {
@@ -394,6 +564,18 @@ void from_json(const json& j, LocalAuthorizationList& k) {
     }
 }
 
+/// \brief Writes the given LocalAuthorizationList \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const LocalAuthorizationList& k) {
+    writer.start_object();
+    writer.key("idTag");
+    write_json(writer, k.idTag);
+    if (k.idTagInfo) {
+        writer.key("idTagInfo");
+        write_json(writer, k.idTagInfo.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given LocalAuthorizationList \p k to the given output stream \p os
 /// \returns an output stream with the LocalAuthorizationList written to
 std::ostream& operator<<(std::ostream& os, const LocalAuthorizationList& k) {
@@ -430,6 +612,24 @@ void from_json(const json& j, FirmwareType& k) {
     }
 }
 
+/// \brief Writes the given FirmwareType \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const FirmwareType& k) {
+    writer.start_object();
+    if (k.installDateTime) {
+        writer.key("installDateTime");
+        write_json(writer, k.installDateTime.value());
+    }
+    writer.key("location");
+    write_json(writer, k.location);
+    writer.key("retrieveDateTime");
+    write_json(writer, k.retrieveDateTime);
+    writer.key("signature");
+    write_json(writer, k.signature);
+    writer.key("signingCertificate");
+    write_json(writer, k.signingCertificate);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given FirmwareType \p k to the given output stream \p os
 /// \returns an output stream with the FirmwareType written to
 std::ostream& operator<<(std::ostream& os, const FirmwareType& k) {
@@ -458,6 +658,16 @@ void from_json(const json& j, TransactionData& k) {
     // the optional parts of the message
 }
 
+/// \brief Writes the given TransactionData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const TransactionData& k) {
+    writer.start_object();
+    writer.key("sampledValue");
+    write_json(writer, k.sampledValue);
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given TransactionData \p k to the given output stream \p os
 /// \returns an output stream with the TransactionData written to
 std::ostream& operator<<(std::ostream& os, const TransactionData& k) {
@@ -4,6 +4,7 @@
 
 #include <everest/logging.hpp>
 
+#include <ocpp/v16/database_handler.hpp>
 #include <ocpp/v16/transaction.hpp>
 
 namespace ocpp {
@@ -11,8 +12,7 @@ namespace v16 {
 
 Transaction::Transaction(const int32_t internal_transaction_id, const int32_t& connector, const std::string& session_id,
                          const CiString<20>& id_token, const double meter_start, std::optional<int32_t> reservation_id,
-                         const ocpp::DateTime& timestamp,
-                         std::unique_ptr<Everest::SteadyTimer> meter_values_sample_timer) :
+                         const ocpp::DateTime& timestamp, std::unique_ptr<BatchedTimer> meter_values_sample_timer) :
     internal_transaction_id(internal_transaction_id),
     connector(connector),
     session_id(session_id),
@@ -24,7 +24,8 @@ Transaction::Transaction(const int32_t internal_transaction_id, const int32_t& c
     has_signed_meter_values(false),
     meter_values_sample_timer(std::move(meter_values_sample_timer)),
     start_transaction_message_id(""),
-    stop_transaction_message_id("") {
+    stop_transaction_message_id(""),
+    max_meter_values_in_memory(0) {
 }
 
 int32_t Transaction::get_connector() {
@@ -35,10 +36,37 @@ CiString<20> Transaction::get_id_tag() {
     return this->id_token;
 }
 
+void Transaction::enable_meter_values_spilling(std::shared_ptr<DatabaseHandler> database_handler,
+                                               std::size_t max_meter_values_in_memory) {
+    std::lock_guard<std::mutex> lock(this->meter_values_mutex);
+    this->database_handler = database_handler;
+    this->max_meter_values_in_memory = std::max(max_meter_values_in_memory, std::size_t(1));
+    this->spill_meter_values();
+}
+
+void Transaction::spill_meter_values() {
+    if (this->database_handler == nullptr or this->meter_values.size() <= this->max_meter_values_in_memory) {
+        return;
+    }
+
+    // move the older half of the window at once, so the database is written once every max / 2 meter values
+    const auto number_to_keep = this->max_meter_values_in_memory / 2;
+    const auto spill_end = this->meter_values.end() - number_to_keep;
+    try {
+        this->database_handler->insert_transaction_meter_values(
+            this->session_id, std::vector<MeterValue>(this->meter_values.begin(), spill_end));
+        this->meter_values.erase(this->meter_values.begin(), spill_end);
+    } catch (const common::QueryExecutionException& e) {
+        EVLOG_warning << "Could not move meter values of transaction with session_id " << this->session_id
+                      << " to the database, keeping them in memory: " << e.what();
+    }
+}
+
 void Transaction::add_meter_value(MeterValue meter_value) {
     if (this->active) {
         std::lock_guard<std::mutex> lock(this->meter_values_mutex);
         this->meter_values.push_back(meter_value);
+        this->spill_meter_values();
 
         if (std::find_if(meter_value.sampledValue.begin(), meter_value.sampledValue.end(),
                          [](SampledValue const& SampledValueItem) {
@@ -51,7 +79,19 @@ void Transaction::add_meter_value(MeterValue meter_value) {
 
 std::vector<MeterValue> Transaction::get_meter_values() {
     std::lock_guard<std::mutex> lock(this->meter_values_mutex);
-    return this->meter_values;
+    if (this->database_handler == nullptr) {
+        return this->meter_values;
+    }
+
+    std::vector<MeterValue> meter_values;
+    try {
+        meter_values = this->database_handler->get_transaction_meter_values(this->session_id);
+    } catch (const common::QueryExecutionException& e) {
+        EVLOG_warning << "Could not read meter values of transaction with session_id " << this->session_id
+                      << " from the database: " << e.what();
+    }
+    meter_values.insert(meter_values.end(), this->meter_values.begin(), this->meter_values.end());
+    return meter_values;
 }
 
 bool Transaction::change_meter_values_sample_interval(int32_t interval) {
@@ -93,11 +133,13 @@ void Transaction::set_transaction_id(int32_t transaction_id) {
 
 std::vector<TransactionData> Transaction::get_transaction_data() {
     std::vector<TransactionData> transaction_data_vec;
-    for (auto meter_value : this->get_meter_values()) {
+    auto meter_values = this->get_meter_values();
+    transaction_data_vec.reserve(meter_values.size());
+    for (auto& meter_value : meter_values) {
         TransactionData transaction_data;
         transaction_data.timestamp = meter_value.timestamp;
-        transaction_data.sampledValue = meter_value.sampledValue;
-        transaction_data_vec.push_back(transaction_data);
+        transaction_data.sampledValue = std::move(meter_value.sampledValue);
+        transaction_data_vec.push_back(std::move(transaction_data));
     }
     return transaction_data_vec;
 }
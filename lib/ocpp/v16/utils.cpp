@@ -12,13 +12,62 @@ size_t get_message_size(const ocpp::Call<StopTransactionRequest>& call) {
     return json(call).at(CALL_PAYLOAD).dump().length();
 }
 
+namespace {
+/// \brief Returns the index of the \p i th of \p number_to_keep entries evenly spaced over \p number_of_entries
+/// entries, starting with the first and ending with the last entry
+size_t evenly_spaced_index(size_t i, size_t number_to_keep, size_t number_of_entries) {
+    if (number_to_keep <= 1) {
+        return 0;
+    }
+    return (i * (number_of_entries - 1) + (number_to_keep - 1) / 2) / (number_to_keep - 1);
+}
+} // namespace
+
 void drop_transaction_data(size_t max_message_size, ocpp::Call<StopTransactionRequest>& call) {
+    if (!call.msg.transactionData.has_value()) {
+        return;
+    }
     auto& transaction_data = call.msg.transactionData.value();
-    while (get_message_size(call) > max_message_size && transaction_data.size() > 2) {
-        for (size_t i = 1; i < transaction_data.size() - 1; i = i + 2) {
-            transaction_data.erase(transaction_data.begin() + i);
+    const auto number_of_entries = transaction_data.size();
+    if (number_of_entries <= 2 or get_message_size(call) <= max_message_size) {
+        return;
+    }
+
+    // every entry is serialized once, the size of a selection is then the sum of the sizes of its entries
+    std::vector<size_t> entry_sizes;
+    entry_sizes.reserve(number_of_entries);
+    for (const auto& entry : transaction_data) {
+        entry_sizes.push_back(json(entry).dump().length());
+    }
+    auto entries = std::move(transaction_data);
+    transaction_data.clear();
+    const auto empty_message_size = get_message_size(call);
+
+    const auto message_size = [&](size_t number_to_keep) {
+        // entries are separated by a comma
+        size_t size = empty_message_size + number_to_keep - 1;
+        for (size_t i = 0; i < number_to_keep; i++) {
+            size += entry_sizes.at(evenly_spaced_index(i, number_to_keep, number_of_entries));
+        }
+        return size;
+    };
+
+    // find the largest number of evenly spaced entries that fits, but always keep the first and the last entry
+    size_t lower = 2;
+    size_t upper = number_of_entries - 1;
+    while (lower < upper) {
+        const auto middle = lower + (upper - lower + 1) / 2;
+        if (message_size(middle) <= max_message_size) {
+            lower = middle;
+        } else {
+            upper = middle - 1;
         }
     }
+
+    transaction_data.reserve(lower);
+    for (size_t i = 0; i < lower; i++) {
+        transaction_data.push_back(std::move(entries.at(evenly_spaced_index(i, lower, number_of_entries))));
+    }
 }
 
 bool is_critical(const std::string& security_event) {
@@ -4,6 +4,7 @@
 #include <ocpp/v2/charge_point.hpp>
 
 #include <ocpp/common/constants.hpp>
+#include <ocpp/common/message_queue_segment_log.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v2/ctrlr_component_variables.hpp>
 #include <ocpp/v2/database_handler.hpp>
@@ -46,6 +47,9 @@ namespace ocpp {
 namespace v2 {
 
 const auto DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD = 2E5;
+const auto OCSP_CACHE_UPDATE_INTERVAL = std::chrono::hours(167);
+const auto OCSP_CACHE_UPDATE_RETRY_INTERVAL = std::chrono::hours(24);
+const std::size_t OCSP_MAX_CONCURRENT_REQUESTS = 4;
 
 ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_structure,
                          std::shared_ptr<DeviceModel> device_model, std::shared_ptr<DatabaseHandler> database_handler,
@@ -60,8 +64,11 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
     skip_invalid_csms_certificate_notifications(false),
     upload_log_status(UploadLogStatusEnum::Idle),
     bootreason(BootReasonEnum::PowerUp),
-    ocsp_updater(this->evse_security, this->send_callback<GetCertificateStatusRequest, GetCertificateStatusResponse>(
-                                          MessageType::GetCertificateStatusResponse)),
+    ocsp_updater(this->evse_security,
+                 this->send_callback<GetCertificateStatusRequest, GetCertificateStatusResponse>(
+                     MessageType::GetCertificateStatusResponse),
+                 OCSP_CACHE_UPDATE_INTERVAL, OCSP_CACHE_UPDATE_RETRY_INTERVAL, this->database_handler,
+                 OCSP_MAX_CONCURRENT_REQUESTS),
     callbacks(callbacks) {
 
     if (!this->device_model) {
@@ -427,11 +434,11 @@ void ChargePoint::initialize(const std::map<int32_t, int32_t>& evse_connector_st
             return;
         }
 
-        const auto filter_vec = utils::get_measurands_vec(this->device_model->get_value<std::string>(
+        const auto filter = this->meter_values->get_measurand_filter(
             type == ReadingContextEnum::Sample_Clock ? ControllerComponentVariables::AlignedDataMeasurands
-                                                     : ControllerComponentVariables::SampledDataTxUpdatedMeasurands));
+                                                     : ControllerComponentVariables::SampledDataTxUpdatedMeasurands);
 
-        const auto filtered_meter_value = utils::get_meter_value_with_measurands_applied(_meter_value, filter_vec);
+        const auto filtered_meter_value = utils::get_meter_value_with_measurands_applied(_meter_value, filter);
 
         if (!filtered_meter_value.sampledValue.empty()) {
             const auto trigger = type == ReadingContextEnum::Sample_Clock ? TriggerReasonEnum::MeterValueClock
@@ -482,18 +489,88 @@ void ChargePoint::initialize(const std::map<int32_t, int32_t>& evse_connector_st
             EVLOG_warning << "Could not apply MessageTypesDiscardForQueueing configuration";
         }
 
+        MessageQueueConfig<v2::MessageType> config{
+            this->device_model->get_value<int>(ControllerComponentVariables::MessageAttempts),
+            this->device_model->get_value<int>(ControllerComponentVariables::MessageAttemptInterval),
+            this->device_model->get_optional_value<int>(ControllerComponentVariables::MessageQueueSizeThreshold)
+                .value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
+            this->device_model->get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages)
+                .value_or(false),
+            message_types_discard_for_queueing,
+            this->device_model->get_value<int>(ControllerComponentVariables::MessageTimeout)};
+        config.max_pipelined_calls =
+            this->device_model->get_optional_value<int>(ControllerComponentVariables::MaxPipelinedCalls).value_or(1);
+        config.transaction_update_compaction_interval_seconds =
+            this->device_model
+                ->get_optional_value<int>(ControllerComponentVariables::TransactionUpdateCompactionInterval)
+                .value_or(0);
+        try {
+            const auto pipelined_message_types_csl = ocpp::split_string(
+                this->device_model->get_optional_value<std::string>(ControllerComponentVariables::PipelinedMessageTypes)
+                    .value_or(""),
+                ',');
+            std::transform(pipelined_message_types_csl.begin(), pipelined_message_types_csl.end(),
+                           std::inserter(config.pipelined_message_types, config.pipelined_message_types.end()),
+                           [](const std::string element) { return conversions::string_to_messagetype(element); });
+        } catch (const StringToEnumException& e) {
+            EVLOG_warning << "Could not convert configured MessageType value of PipelinedMessageTypes: " << e.what();
+            config.pipelined_message_types.clear();
+        }
+
+        config.message_priorities = {{MessageType::Authorize, MessagePriority::High},
+                                     {MessageType::StatusNotification, MessagePriority::High},
+                                     {MessageType::MeterValues, MessagePriority::Low},
+                                     {MessageType::NotifyReport, MessagePriority::Low},
+                                     {MessageType::NotifyMonitoringReport, MessagePriority::Low},
+                                     {MessageType::NotifyCustomerInformation, MessagePriority::Low},
+                                     {MessageType::Heartbeat, MessagePriority::Low}};
+        try {
+            config.priority_weights = parse_message_priority_values(
+                this->device_model
+                    ->get_optional_value<std::string>(ControllerComponentVariables::MessagePriorityWeights)
+                    .value_or(""));
+            config.priority_queue_limits = parse_message_priority_values(
+                this->device_model
+                    ->get_optional_value<std::string>(ControllerComponentVariables::MessagePriorityQueueLimits)
+                    .value_or(""));
+        } catch (const std::exception& e) {
+            EVLOG_warning << "Could not parse configured MessagePriorityWeights or MessagePriorityQueueLimits: "
+                          << e.what();
+            config.priority_weights.clear();
+            config.priority_queue_limits.clear();
+        }
+
+        // messages queued in the storage used before are moved, so changing the configured storage does not abandon
+        // them
+        std::optional<fs::path> segment_log_directory;
+        const auto configured_directory = this->device_model->get_optional_value<std::string>(
+            ControllerComponentVariables::MessageQueueSegmentLogDirectory);
+        if (configured_directory.has_value()) {
+            segment_log_directory = configured_directory.value();
+        }
+        std::optional<fs::path> segment_log_directory_in_use;
+        const auto directory_in_use =
+            this->device_model
+                ->get_optional_value<std::string>(ControllerComponentVariables::MessageQueueSegmentLogDirectoryInUse)
+                .value_or("");
+        if (!directory_in_use.empty()) {
+            segment_log_directory_in_use = directory_in_use;
+        }
+        const auto selection = common::open_message_queue_persistence(this->database_handler, segment_log_directory,
+                                                                      segment_log_directory_in_use);
+        if (selection.segment_log_directory != segment_log_directory_in_use) {
+            const auto& component_variable = ControllerComponentVariables::MessageQueueSegmentLogDirectoryInUse;
+            this->device_model->set_value(component_variable.component, component_variable.variable.value(),
+                                          AttributeEnum::Actual, selection.segment_log_directory.value_or("").string(),
+                                          VARIABLE_ATTRIBUTE_VALUE_SOURCE_INTERNAL, true);
+        }
+
         this->message_queue = std::make_unique<ocpp::MessageQueue<v2::MessageType>>(
             [this](json message) -> bool { return this->connectivity_manager->send_to_websocket(message.dump()); },
-            MessageQueueConfig<v2::MessageType>{
-                this->device_model->get_value<int>(ControllerComponentVariables::MessageAttempts),
-                this->device_model->get_value<int>(ControllerComponentVariables::MessageAttemptInterval),
-                this->device_model->get_optional_value<int>(ControllerComponentVariables::MessageQueueSizeThreshold)
-                    .value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
-                this->device_model->get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages)
-                    .value_or(false),
-                message_types_discard_for_queueing,
-                this->device_model->get_value<int>(ControllerComponentVariables::MessageTimeout)},
-            this->database_handler);
+            config, selection.persistence);
+        this->message_queue->set_serialized_send_callback([this](const std::string& message) -> bool {
+            return this->connectivity_manager->send_to_websocket(message);
+        });
     }
 
     this->message_dispatcher =
@@ -555,7 +632,7 @@ void ChargePoint::initialize(const std::map<int32_t, int32_t>& evse_connector_st
 
     this->transaction = std::make_unique<TransactionBlock>(
         *this->functional_block_context, *this->message_queue, *this->authorization, *this->availability,
-        *this->smart_charging, *this->tariff_and_cost, this->callbacks.stop_transaction_callback,
+        *this->smart_charging, *this->tariff_and_cost, *this->meter_values, this->callbacks.stop_transaction_callback,
         this->callbacks.pause_charging_callback, this->callbacks.transaction_event_callback,
         this->callbacks.transaction_event_response_callback, this->callbacks.reset_callback);
 
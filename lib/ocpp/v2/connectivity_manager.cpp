@@ -3,6 +3,8 @@
 
 #include <ocpp/v2/connectivity_manager.hpp>
 
+#include <netdb.h>
+
 #include <everest/logging.hpp>
 #include <ocpp/v2/ctrlr_component_variables.hpp>
 #include <ocpp/v2/device_model.hpp>
@@ -13,6 +15,25 @@ const std::string VARIABLE_ATTRIBUTE_VALUE_SOURCE_INTERNAL = "internal";
 /// \brief Default timeout for the return value (future) of the `configure_network_connection_profile_callback`
 ///        function.
 constexpr int32_t default_network_config_timeout_seconds = 60;
+
+const std::string WARM_STANDBY_RESOLVE = "Resolve";
+const std::string WARM_STANDBY_CONNECT = "Connect";
+
+/// \brief Resolves \p hostname, so the lookup during a failover can be answered from the resolver's cache
+/// \note The result is not kept, this only helps if a caching resolver (e.g. nscd or systemd-resolved) is used
+bool resolve_hostname(const std::string& hostname) {
+    addrinfo hints{};
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* result = nullptr;
+    const auto rc = getaddrinfo(hostname.c_str(), nullptr, &hints, &result);
+    if (rc != 0) {
+        EVLOG_warning << "Could not resolve host of warm standby network connection profile " << hostname << ": "
+                      << gai_strerror(rc);
+        return false;
+    }
+    freeaddrinfo(result);
+    return true;
+}
 } // namespace
 
 namespace ocpp {
@@ -34,15 +55,24 @@ ConnectivityManager::ConnectivityManager(DeviceModel& device_model, std::shared_
 }
 
 void ConnectivityManager::set_websocket_authorization_key(const std::string& authorization_key) {
-    if (this->websocket != nullptr) {
-        this->websocket->set_authorization_key(authorization_key);
-        this->websocket->disconnect(WebsocketCloseReason::ServiceRestart);
+    // the standby is prepared again with the new key once the active websocket is connected
+    this->stop_warm_standby();
+    const auto websocket = this->get_websocket();
+    if (websocket != nullptr) {
+        websocket->set_authorization_key(authorization_key);
+        websocket->disconnect(WebsocketCloseReason::ServiceRestart);
     }
 }
 
 void ConnectivityManager::set_websocket_connection_options(const WebsocketConnectionOptions& connection_options) {
-    if (this->websocket != nullptr) {
-        this->websocket->set_connection_options(connection_options);
+    // the standby was prepared with the previous options, so it is prepared again with the new ones
+    this->stop_warm_standby();
+    const auto websocket = this->get_websocket();
+    if (websocket != nullptr) {
+        websocket->set_connection_options(connection_options);
+        if (websocket->is_connected()) {
+            this->standby_timer.timeout([this]() { this->prepare_warm_standby(); }, WEBSOCKET_INIT_DELAY);
+        }
     }
 }
 
@@ -114,7 +144,8 @@ const std::vector<int>& ConnectivityManager::get_network_connection_slots() cons
 }
 
 bool ConnectivityManager::is_websocket_connected() {
-    return this->websocket != nullptr && this->websocket->is_connected();
+    const auto websocket = this->get_websocket();
+    return websocket != nullptr && websocket->is_connected();
 }
 
 void ConnectivityManager::connect(std::optional<int32_t> configuration_slot_opt) {
@@ -132,9 +163,11 @@ void ConnectivityManager::connect(std::optional<int32_t> configuration_slot_opt)
 
     this->wants_to_be_connected = true;
     this->pending_configuration_slot = configuration_slot;
-    if (this->websocket != nullptr && this->is_websocket_connected()) {
+    this->stop_warm_standby();
+    const auto websocket = this->get_websocket();
+    if (websocket != nullptr && websocket->is_connected()) {
         // After the websocket gets closed a reconnect will be triggered
-        this->websocket->disconnect(WebsocketCloseReason::ServiceRestart);
+        websocket->disconnect(WebsocketCloseReason::ServiceRestart);
     } else {
         this->try_connect_websocket();
     }
@@ -143,8 +176,10 @@ void ConnectivityManager::connect(std::optional<int32_t> configuration_slot_opt)
 void ConnectivityManager::disconnect() {
     this->wants_to_be_connected = false;
     this->websocket_timer.stop();
-    if (this->websocket != nullptr) {
-        this->websocket->disconnect(WebsocketCloseReason::Normal);
+    this->stop_warm_standby();
+    const auto websocket = this->get_websocket();
+    if (websocket != nullptr) {
+        websocket->disconnect(WebsocketCloseReason::Normal);
     }
 }
 
@@ -223,34 +258,201 @@ void ConnectivityManager::try_connect_websocket() {
                << this->active_network_configuration_priority + 1 << " which is configurationSlot "
                << configuration_slot_to_set;
 
+    this->set_active_network_profile(configuration_slot_to_set);
+
+    auto websocket = this->get_websocket();
+    if (websocket == nullptr) {
+        websocket = this->create_websocket(connection_options.value());
+        std::lock_guard<std::mutex> lock(this->websocket_mutex);
+        this->websocket = websocket;
+    } else {
+        websocket->set_connection_options(connection_options.value());
+    }
+
+    websocket->start_connecting();
+}
+
+std::unique_ptr<Websocket> ConnectivityManager::make_websocket(const WebsocketConnectionOptions& connection_options) {
+    return std::make_unique<Websocket>(connection_options, this->evse_security, this->logging);
+}
+
+std::shared_ptr<Websocket> ConnectivityManager::get_websocket() const {
+    std::lock_guard<std::mutex> lock(this->websocket_mutex);
+    return this->websocket;
+}
+
+std::shared_ptr<Websocket>
+ConnectivityManager::create_websocket(const WebsocketConnectionOptions& connection_options) {
+    std::shared_ptr<Websocket> websocket = this->make_websocket(connection_options);
+    const Websocket* websocket_ptr = websocket.get();
+
+    enum class Role {
+        Active,
+        Standby,
+        Replaced
+    };
+    const auto get_role = [this, websocket_ptr]() {
+        std::lock_guard<std::mutex> lock(this->websocket_mutex);
+        if (this->websocket.get() == websocket_ptr) {
+            return Role::Active;
+        }
+        return this->standby_websocket.get() == websocket_ptr ? Role::Standby : Role::Replaced;
+    };
+
+    websocket->register_connected_callback([this, websocket_ptr, get_role](OcppProtocolVersion protocol) {
+        if (get_role() == Role::Active) {
+            this->on_websocket_connected(protocol);
+            return;
+        }
+        // checked again under the lock, so a standby that has been replaced in the meantime is not marked connected
+        std::lock_guard<std::mutex> lock(this->websocket_mutex);
+        if (this->standby_websocket.get() == websocket_ptr) {
+            EVLOG_info << "Warm standby websocket connected";
+            this->standby_ocpp_version = protocol;
+            this->standby_connected = true;
+        }
+    });
+    websocket->register_disconnected_callback([this, websocket_ptr, get_role]() {
+        if (get_role() == Role::Active) {
+            this->on_websocket_disconnected();
+            return;
+        }
+        std::lock_guard<std::mutex> lock(this->websocket_mutex);
+        if (this->standby_websocket.get() == websocket_ptr) {
+            this->standby_connected = false;
+        }
+    });
+    websocket->register_stopped_connecting_callback([this, get_role](ocpp::WebsocketCloseReason reason) {
+        if (get_role() == Role::Active) {
+            this->on_websocket_stopped_connecting(reason);
+        }
+    });
+    websocket->register_connection_failed_callback([this, get_role](ConnectionFailedReason reason) {
+        if (get_role() == Role::Active and this->websocket_connection_failed_callback.has_value()) {
+            this->websocket_connection_failed_callback.value()(reason);
+        }
+    });
+    websocket->register_message_callback([this, get_role](const std::string& message) {
+        if (get_role() == Role::Active) {
+            this->message_callback(message);
+        } else {
+            EVLOG_warning << "Dropping message received on a websocket that is not active: " << message;
+        }
+    });
+
+    return websocket;
+}
+
+void ConnectivityManager::set_active_network_profile(int32_t configuration_slot) {
     if (const auto& active_network_profile_cv = ControllerComponentVariables::ActiveNetworkProfile;
         active_network_profile_cv.variable.has_value()) {
         this->device_model.set_read_only_value(
             active_network_profile_cv.component, active_network_profile_cv.variable.value(), AttributeEnum::Actual,
-            std::to_string(configuration_slot_to_set), VARIABLE_ATTRIBUTE_VALUE_SOURCE_INTERNAL);
+            std::to_string(configuration_slot), VARIABLE_ATTRIBUTE_VALUE_SOURCE_INTERNAL);
+    }
+}
+
+void ConnectivityManager::prepare_warm_standby() {
+    const auto mode = this->device_model.get_optional_value<std::string>(
+        ControllerComponentVariables::NetworkProfileWarmStandby);
+    if (!mode.has_value() or (mode.value() != WARM_STANDBY_RESOLVE and mode.value() != WARM_STANDBY_CONNECT) or
+        this->network_connection_slots.size() < 2 or !this->wants_to_be_connected) {
+        return;
     }
 
-    if (this->websocket == nullptr) {
-        this->websocket = std::make_unique<Websocket>(connection_options.value(), this->evse_security, this->logging);
+    const auto active_priority = static_cast<std::size_t>(this->active_network_configuration_priority);
+    const auto standby_priority = static_cast<int32_t>((active_priority + 1) % this->network_connection_slots.size());
+    const int32_t standby_slot = this->get_configuration_slot_from_priority(standby_priority);
+    const auto network_connection_profile = this->get_network_connection_profile(standby_slot);
+    if (!network_connection_profile.has_value()) {
+        return;
+    }
+    auto connection_options = this->get_ws_connection_options(standby_slot);
+    if (!connection_options.has_value()) {
+        return;
+    }
 
-        this->websocket->register_connected_callback(
-            [this](OcppProtocolVersion protocol) { this->on_websocket_connected(protocol); });
-        this->websocket->register_disconnected_callback(
-            std::bind(&ConnectivityManager::on_websocket_disconnected, this));
-        this->websocket->register_stopped_connecting_callback(
-            std::bind(&ConnectivityManager::on_websocket_stopped_connecting, this, std::placeholders::_1));
-    } else {
-        this->websocket->set_connection_options(connection_options.value());
+    if (mode.value() == WARM_STANDBY_RESOLVE) {
+        if (resolve_hostname(connection_options->csms_uri.get_hostname())) {
+            EVLOG_info << "Resolved host of warm standby configurationSlot " << standby_slot;
+        }
+        return;
     }
 
-    // Attach external callbacks everytime since they might have changed
-    if (websocket_connection_failed_callback.has_value()) {
-        this->websocket->register_connection_failed_callback(websocket_connection_failed_callback.value());
+    {
+        std::lock_guard<std::mutex> lock(this->websocket_mutex);
+        if (this->standby_websocket != nullptr and this->standby_configuration_slot == standby_slot) {
+            return;
+        }
     }
+    this->stop_warm_standby();
 
-    this->websocket->register_message_callback([this](const std::string& message) { this->message_callback(message); });
+    if (this->configure_network_connection_profile_callback.has_value()) {
+        const auto config = this->handle_configure_network_connection_profile_callback(
+            standby_slot, network_connection_profile.value());
+        if (!config.has_value() or !config->success) {
+            EVLOG_warning << "Could not configure warm standby configurationSlot " << standby_slot;
+            return;
+        }
+        connection_options->iface = config->interface_address;
+    }
 
-    this->websocket->start_connecting();
+    EVLOG_info << "Connecting warm standby websocket of configurationSlot " << standby_slot;
+    const auto standby_websocket = this->create_websocket(connection_options.value());
+    {
+        std::lock_guard<std::mutex> lock(this->websocket_mutex);
+        this->standby_websocket = standby_websocket;
+        this->standby_configuration_slot = standby_slot;
+        this->standby_network_configuration_priority = standby_priority;
+    }
+    standby_websocket->start_connecting();
+}
+
+void ConnectivityManager::stop_warm_standby() {
+    std::shared_ptr<Websocket> standby_websocket;
+    {
+        std::lock_guard<std::mutex> lock(this->websocket_mutex);
+        standby_websocket = std::move(this->standby_websocket);
+        this->standby_configuration_slot.reset();
+        this->standby_connected = false;
+    }
+
+    // Disconnected outside of the lock, its callbacks are dropped since it is neither active nor standby anymore
+    if (standby_websocket != nullptr) {
+        standby_websocket->disconnect(WebsocketCloseReason::Normal);
+    }
+}
+
+void ConnectivityManager::switch_to_standby_websocket() {
+    std::shared_ptr<Websocket> replaced_websocket;
+    int32_t configuration_slot = 0;
+    OcppProtocolVersion protocol = OcppProtocolVersion::Unknown;
+    {
+        std::lock_guard<std::mutex> lock(this->websocket_mutex);
+        if (!this->wants_to_be_connected or this->pending_configuration_slot.has_value() or
+            this->standby_websocket == nullptr or !this->standby_connected or
+            !this->standby_configuration_slot.has_value() or
+            (this->websocket != nullptr and this->websocket->is_connected())) {
+            return;
+        }
+        configuration_slot = this->standby_configuration_slot.value();
+        protocol = this->standby_ocpp_version;
+        replaced_websocket = std::move(this->websocket);
+        this->websocket = std::move(this->standby_websocket);
+        this->active_network_configuration_priority = this->standby_network_configuration_priority;
+        this->standby_configuration_slot.reset();
+        this->standby_connected = false;
+    }
+
+    EVLOG_info << "Switching over to warm standby websocket of configurationSlot " << configuration_slot;
+    if (replaced_websocket != nullptr) {
+        // Other threads may still hold a copy, it is destroyed when the last of them releases it
+        replaced_websocket->disconnect(WebsocketCloseReason::Normal);
+        replaced_websocket.reset();
+    }
+
+    this->set_active_network_profile(configuration_slot);
+    this->on_websocket_connected(protocol);
 }
 
 std::optional<ConfigNetworkResult>
@@ -290,11 +492,12 @@ int ConnectivityManager::get_next_configuration_slot(int32_t configuration_slot)
 }
 
 bool ConnectivityManager::send_to_websocket(const std::string& message) {
-    if (this->websocket == nullptr) {
+    const auto websocket = this->get_websocket();
+    if (websocket == nullptr) {
         return false;
     }
 
-    return this->websocket->send(message);
+    return websocket->send(message);
 }
 
 void ConnectivityManager::on_network_disconnected(OCPPInterfaceEnum ocpp_interface) {
@@ -305,17 +508,23 @@ void ConnectivityManager::on_network_disconnected(OCPPInterfaceEnum ocpp_interfa
 
     if (!network_connection_profile.has_value()) {
         EVLOG_warning << "Network disconnected. No network connection profile configured";
-    } else if (ocpp_interface == network_connection_profile.value().ocppInterface && this->websocket != nullptr) {
-        // Since there is no connection anymore: disconnect the websocket, the manager will try to connect with the next
-        // available network connection profile as we enable reconnects.
-        this->websocket->disconnect(ocpp::WebsocketCloseReason::GoingAway);
+    } else if (ocpp_interface == network_connection_profile.value().ocppInterface) {
+        const auto websocket = this->get_websocket();
+        if (websocket != nullptr) {
+            // Since there is no connection anymore: disconnect the websocket, the manager will try to connect with the
+            // next available network connection profile as we enable reconnects.
+            websocket->disconnect(ocpp::WebsocketCloseReason::GoingAway);
+        }
     }
 }
 
 void ConnectivityManager::on_charging_station_certificate_changed() {
-    if (this->websocket != nullptr) {
+    // the standby is prepared again with the new certificate once the active websocket is connected
+    this->stop_warm_standby();
+    const auto websocket = this->get_websocket();
+    if (websocket != nullptr) {
         // After the websocket gets closed a reconnect will be triggered
-        this->websocket->disconnect(WebsocketCloseReason::ServiceRestart);
+        websocket->disconnect(WebsocketCloseReason::ServiceRestart);
     }
 }
 
@@ -365,6 +574,38 @@ ConnectivityManager::get_ws_connection_options(const int32_t configuration_slot)
             this->device_model.get_optional_value<bool>(ControllerComponentVariables::EnableTLSKeylog).value_or(false),
             this->device_model.get_optional_value<std::string>(ControllerComponentVariables::TLSKeylogFile)};
 
+        connection_options.enable_permessage_deflate =
+            this->device_model.get_optional_value<bool>(ControllerComponentVariables::EnablePermessageDeflate)
+                .value_or(false);
+        connection_options.deflate_client_max_window_bits =
+            this->device_model
+                .get_optional_value<int>(ControllerComponentVariables::PermessageDeflateClientMaxWindowBits)
+                .value_or(15);
+        connection_options.deflate_server_max_window_bits =
+            this->device_model
+                .get_optional_value<int>(ControllerComponentVariables::PermessageDeflateServerMaxWindowBits)
+                .value_or(15);
+        connection_options.deflate_client_no_context_takeover =
+            this->device_model
+                .get_optional_value<bool>(ControllerComponentVariables::PermessageDeflateClientNoContextTakeover)
+                .value_or(false);
+        connection_options.deflate_server_no_context_takeover =
+            this->device_model
+                .get_optional_value<bool>(ControllerComponentVariables::PermessageDeflateServerNoContextTakeover)
+                .value_or(false);
+        connection_options.deflate_min_message_size =
+            this->device_model.get_optional_value<int>(ControllerComponentVariables::PermessageDeflateMinMessageSize)
+                .value_or(0);
+
+        connection_options.enable_tls_session_resumption =
+            this->device_model.get_optional_value<bool>(ControllerComponentVariables::EnableTLSSessionResumption)
+                .value_or(false);
+        const auto tls_session_file =
+            this->device_model.get_optional_value<std::string>(ControllerComponentVariables::TLSSessionFile);
+        if (tls_session_file.has_value()) {
+            connection_options.tls_session_file = tls_session_file.value();
+        }
+
         return connection_options;
 
     } catch (const std::invalid_argument& e) {
@@ -384,6 +625,9 @@ void ConnectivityManager::on_websocket_connected(OcppProtocolVersion protocol) {
         this->websocket_connected_callback.value()(actual_configuration_slot, network_connection_profile.value(),
                                                    this->connected_ocpp_version);
     }
+
+    // Resolving or connecting may block, so it must not run on the websocket thread
+    this->standby_timer.timeout([this]() { this->prepare_warm_standby(); }, WEBSOCKET_INIT_DELAY);
 }
 
 void ConnectivityManager::on_websocket_disconnected() {
@@ -394,6 +638,11 @@ void ConnectivityManager::on_websocket_disconnected() {
         this->websocket_disconnected_callback.value()(this->get_active_network_configuration_slot(),
                                                       network_connection_profile.value(), this->connected_ocpp_version);
     }
+
+    if (this->standby_connected) {
+        // The disconnected websocket can not be closed from its own thread
+        this->standby_timer.timeout([this]() { this->switch_to_standby_websocket(); }, std::chrono::seconds(0));
+    }
 }
 
 void ConnectivityManager::on_websocket_stopped_connecting(ocpp::WebsocketCloseReason reason) {
@@ -205,6 +205,13 @@ const ComponentVariable NetworkConfigTimeout = {
         "NetworkConfigTimeout",
     }),
 };
+const ComponentVariable NetworkProfileWarmStandby = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "NetworkProfileWarmStandby",
+    }),
+};
 const ComponentVariable SupportedChargingProfilePurposeTypes = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
@@ -282,6 +289,62 @@ const ComponentVariable TLSKeylogFile = {
         "TLSKeylogFile",
     }),
 };
+const ComponentVariable EnablePermessageDeflate = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "EnablePermessageDeflate",
+    }),
+};
+const ComponentVariable PermessageDeflateClientMaxWindowBits = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "PermessageDeflateClientMaxWindowBits",
+    }),
+};
+const ComponentVariable PermessageDeflateServerMaxWindowBits = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "PermessageDeflateServerMaxWindowBits",
+    }),
+};
+const ComponentVariable PermessageDeflateClientNoContextTakeover = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "PermessageDeflateClientNoContextTakeover",
+    }),
+};
+const ComponentVariable PermessageDeflateServerNoContextTakeover = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "PermessageDeflateServerNoContextTakeover",
+    }),
+};
+const ComponentVariable PermessageDeflateMinMessageSize = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "PermessageDeflateMinMessageSize",
+    }),
+};
+const ComponentVariable EnableTLSSessionResumption = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "EnableTLSSessionResumption",
+    }),
+};
+const ComponentVariable TLSSessionFile = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "TLSSessionFile",
+    }),
+};
 const ComponentVariable OcspRequestInterval = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
@@ -352,6 +415,55 @@ const ComponentVariable MessageQueueSizeThreshold = {
         "MessageQueueSizeThreshold",
     }),
 };
+const ComponentVariable MaxPipelinedCalls = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MaxPipelinedCalls",
+    }),
+};
+const ComponentVariable PipelinedMessageTypes = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "PipelinedMessageTypes",
+    }),
+};
+const ComponentVariable MessagePriorityWeights = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessagePriorityWeights",
+    }),
+};
+const ComponentVariable TransactionUpdateCompactionInterval = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "TransactionUpdateCompactionInterval",
+    }),
+};
+const ComponentVariable MessageQueueSegmentLogDirectory = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessageQueueSegmentLogDirectory",
+    }),
+};
+const ComponentVariable MessageQueueSegmentLogDirectoryInUse = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessageQueueSegmentLogDirectoryInUse",
+    }),
+};
+const ComponentVariable MessagePriorityQueueLimits = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessagePriorityQueueLimits",
+    }),
+};
 const ComponentVariable MaxMessageSize = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
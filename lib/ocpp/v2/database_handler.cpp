@@ -23,7 +23,8 @@ namespace v2 {
 
 DatabaseHandler::DatabaseHandler(std::unique_ptr<DatabaseConnectionInterface> database,
                                  const fs::path& sql_migration_files_path) :
-    DatabaseHandlerCommon(std::move(database), sql_migration_files_path, MIGRATION_FILE_VERSION_V2) {
+    DatabaseHandlerCommon(std::move(database), sql_migration_files_path, MIGRATION_FILE_VERSION_V2),
+    local_authorization_list_index([this]() { return this->get_local_authorization_list_keys(); }) {
 }
 
 void DatabaseHandler::init_sql() {
@@ -37,6 +38,7 @@ void DatabaseHandler::init_sql() {
     } else {
         this->inintialize_enum_tables();
     }
+    this->local_authorization_list_index.invalidate();
 }
 
 void DatabaseHandler::inintialize_enum_tables() {
@@ -284,29 +286,57 @@ void DatabaseHandler::insert_or_update_local_authorization_list_entry(const IdTo
                       "VALUES (@id_token_hash, @id_token_info)";
     auto stmt = this->database->new_statement(sql);
 
-    stmt->bind_text("@id_token_hash", utils::generate_token_hash(id_token), SQLiteString::Transient);
+    const auto id_token_hash = utils::generate_token_hash(id_token);
+    stmt->bind_text("@id_token_hash", id_token_hash, SQLiteString::Transient);
     stmt->bind_text("@id_token_info", json(id_token_info).dump(), SQLiteString::Transient);
 
-    if (stmt->step() != SQLITE_DONE) {
-        throw QueryExecutionException(this->database->get_error_message());
-    }
+    this->local_authorization_list_index.update({id_token_hash}, {}, [&]() {
+        if (stmt->step() != SQLITE_DONE) {
+            throw QueryExecutionException(this->database->get_error_message());
+        }
+    });
 }
 
 void DatabaseHandler::insert_or_update_local_authorization_list(
     const std::vector<AuthorizationData>& local_authorization_list) {
     bool success = true; // indicates if all database operations succeeded
-    for (const auto& authorization_data : local_authorization_list) {
-        try {
+    std::vector<std::string> inserted_keys;
+    std::vector<std::string> removed_keys;
+
+    {
+        // apply the whole list within one transaction and reuse the prepared statements for every entry
+        auto transaction = this->database->begin_transaction();
+        auto insert_stmt = this->database->new_statement("INSERT OR REPLACE INTO AUTH_LIST (ID_TOKEN_HASH, "
+                                                         "ID_TOKEN_INFO) VALUES (@id_token_hash, @id_token_info)");
+        auto delete_stmt =
+            this->database->new_statement("DELETE FROM AUTH_LIST WHERE ID_TOKEN_HASH = @id_token_hash;");
+
+        for (const auto& authorization_data : local_authorization_list) {
+            auto id_token_hash = utils::generate_token_hash(authorization_data.idToken);
             if (authorization_data.idTokenInfo.has_value()) {
-                this->insert_or_update_local_authorization_list_entry(authorization_data.idToken,
-                                                                      authorization_data.idTokenInfo.value());
+                insert_stmt->bind_text("@id_token_hash", id_token_hash, SQLiteString::Transient);
+                insert_stmt->bind_text("@id_token_info", json(authorization_data.idTokenInfo.value()).dump(),
+                                       SQLiteString::Transient);
+                if (insert_stmt->step() == SQLITE_DONE) {
+                    inserted_keys.push_back(std::move(id_token_hash));
+                } else {
+                    // continue with remaining entries
+                    success = false;
+                }
+                insert_stmt->reset();
             } else {
-                this->delete_local_authorization_list_entry(authorization_data.idToken);
+                delete_stmt->bind_text("@id_token_hash", id_token_hash, SQLiteString::Transient);
+                if (delete_stmt->step() == SQLITE_DONE) {
+                    removed_keys.push_back(std::move(id_token_hash));
+                } else {
+                    // continue with remaining entries
+                    success = false;
+                }
+                delete_stmt->reset();
             }
-        } catch (const QueryExecutionException& e) {
-            // catch but continue with remaining entries
-            success = false;
         }
+
+        this->local_authorization_list_index.update(inserted_keys, removed_keys, [&]() { transaction->commit(); });
     }
 
     if (!success) {
@@ -318,19 +348,26 @@ void DatabaseHandler::delete_local_authorization_list_entry(const IdToken& id_to
     std::string sql = "DELETE FROM AUTH_LIST WHERE ID_TOKEN_HASH = @id_token_hash;";
     auto stmt = this->database->new_statement(sql);
 
-    stmt->bind_text("@id_token_hash", utils::generate_token_hash(id_token), SQLiteString::Transient);
+    const auto id_token_hash = utils::generate_token_hash(id_token);
+    stmt->bind_text("@id_token_hash", id_token_hash, SQLiteString::Transient);
 
-    if (stmt->step() != SQLITE_DONE) {
-        throw QueryExecutionException(this->database->get_error_message());
-    }
+    this->local_authorization_list_index.update({}, {id_token_hash}, [&]() {
+        if (stmt->step() != SQLITE_DONE) {
+            throw QueryExecutionException(this->database->get_error_message());
+        }
+    });
 }
 
 std::optional<IdTokenInfo> DatabaseHandler::get_local_authorization_list_entry(const IdToken& id_token) {
+    const auto id_token_hash = utils::generate_token_hash(id_token);
+    if (!this->local_authorization_list_index.may_contain(id_token_hash)) {
+        return std::nullopt;
+    }
 
     std::string sql = "SELECT ID_TOKEN_INFO FROM AUTH_LIST WHERE ID_TOKEN_HASH = @id_token_hash;";
     auto stmt = this->database->new_statement(sql);
 
-    stmt->bind_text("@id_token_hash", utils::generate_token_hash(id_token), SQLiteString::Transient);
+    stmt->bind_text("@id_token_hash", id_token_hash, SQLiteString::Transient);
 
     int status = stmt->step();
 
@@ -348,8 +385,26 @@ std::optional<IdTokenInfo> DatabaseHandler::get_local_authorization_list_entry(c
 void DatabaseHandler::clear_local_authorization_list() {
     const auto retval = this->database->clear_table("AUTH_LIST");
     if (retval == false) {
+        this->local_authorization_list_index.invalidate();
         throw QueryExecutionException(this->database->get_error_message());
     }
+    this->local_authorization_list_index.clear();
+}
+
+std::vector<std::string> DatabaseHandler::get_local_authorization_list_keys() {
+    auto stmt = this->database->new_statement("SELECT ID_TOKEN_HASH FROM AUTH_LIST;");
+
+    std::vector<std::string> keys;
+    int status;
+    while ((status = stmt->step()) == SQLITE_ROW) {
+        keys.push_back(stmt->column_text(0));
+    }
+
+    if (status != SQLITE_DONE) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+
+    return keys;
 }
 
 int32_t DatabaseHandler::get_local_authorization_list_number_of_entries() {
@@ -474,95 +529,154 @@ void DatabaseHandler::transaction_metervalues_insert(const std::string& transact
 }
 
 std::vector<MeterValue> DatabaseHandler::transaction_metervalues_get_all(const std::string& transaction_id) {
+    return this->transaction_metervalues_get(transaction_id, std::nullopt);
+}
 
-    std::string sql1 = "SELECT * FROM METER_VALUES WHERE TRANSACTION_ID = @transaction_id;";
-    std::string sql2 = "SELECT * FROM METER_VALUE_ITEMS WHERE METER_VALUE_ID = @row_id;";
-    auto select_stmt = this->database->new_statement(sql1);
-    auto select_stmt2 = this->database->new_statement(sql2);
+std::vector<MeterValue>
+DatabaseHandler::transaction_metervalues_get_tx_ended(const std::string& transaction_id,
+                                                      const utils::TxEndedMeterValueFilter& filter) {
+    return this->transaction_metervalues_get(transaction_id, filter);
+}
 
+std::vector<MeterValue>
+DatabaseHandler::transaction_metervalues_get(const std::string& transaction_id,
+                                             const std::optional<utils::TxEndedMeterValueFilter>& filter) {
+    // One row per item, grouped by metervalue. This replaces a query for the items of every metervalue
+    std::string sql = "SELECT mv.ROWID, mv.TIMESTAMP, mv.READING_CONTEXT, mv.CUSTOM_DATA, i.VALUE, i.MEASURAND, "
+                      "i.PHASE, i.LOCATION, i.CUSTOM_DATA, i.UNIT_CUSTOM_DATA, i.UNIT_TEXT, i.UNIT_MULTIPLIER, "
+                      "i.SIGNED_METER_DATA, i.SIGNING_METHOD, i.ENCODING_METHOD, i.PUBLIC_KEY "
+                      "FROM METER_VALUES mv JOIN METER_VALUE_ITEMS i ON i.METER_VALUE_ID = mv.ROWID "
+                      "WHERE mv.TRANSACTION_ID = @transaction_id";
+    if (filter.has_value()) {
+        sql += " AND mv.TIMESTAMP <= @max_timestamp";
+    }
+    sql += " ORDER BY mv.ROWID, i.ROWID;";
+
+    auto select_stmt = this->database->new_statement(sql);
     select_stmt->bind_text("@transaction_id", transaction_id);
+    if (filter.has_value()) {
+        select_stmt->bind_datetime("@max_timestamp", filter.value().max_timestamp);
+    }
 
     std::vector<MeterValue> result;
+    std::optional<int> current_row_id;
+    MeterValue value;
+    ReadingContextEnum context = ReadingContextEnum::Other;
+    const utils::MeasurandMask* measurands_mask = nullptr;
+    bool include_signed = true;
+    bool skip_meter_value = false;
+
+    const auto finish_meter_value = [&]() {
+        // a filtered metervalue without any items left is omitted
+        if (current_row_id.has_value() and !skip_meter_value and
+            (!filter.has_value() or !value.sampledValue.empty())) {
+            result.push_back(std::move(value));
+        }
+    };
 
     int status;
     while ((status = select_stmt->step()) == SQLITE_ROW) {
-        MeterValue value;
-
-        value.timestamp = select_stmt->column_datetime(2);
-
-        if (select_stmt->column_type(4) == SQLITE_TEXT) {
-            value.customData = CustomData{select_stmt->column_text(4)};
+        const auto row_id = select_stmt->column_int(0);
+        if (current_row_id != row_id) {
+            finish_meter_value();
+            current_row_id = row_id;
+            value = MeterValue();
+            value.timestamp = select_stmt->column_datetime(1);
+            if (select_stmt->column_type(3) == SQLITE_TEXT) {
+                value.customData = CustomData{select_stmt->column_text(3)};
+            }
+            context = static_cast<ReadingContextEnum>(select_stmt->column_int(2));
+
+            skip_meter_value = false;
+            if (filter.has_value()) {
+                switch (context) {
+                case ReadingContextEnum::Transaction_Begin:
+                case ReadingContextEnum::Interruption_Begin:
+                case ReadingContextEnum::Transaction_End:
+                case ReadingContextEnum::Interruption_End:
+                case ReadingContextEnum::Sample_Periodic:
+                    measurands_mask = &filter.value().sampled_measurands;
+                    include_signed = filter.value().include_sampled_signed;
+                    break;
+                case ReadingContextEnum::Sample_Clock:
+                    measurands_mask = &filter.value().aligned_measurands;
+                    include_signed = filter.value().include_aligned_signed;
+                    break;
+                case ReadingContextEnum::Other:
+                case ReadingContextEnum::Trigger:
+                    skip_meter_value = true;
+                    break;
+                }
+            }
         }
 
-        auto row_id = select_stmt->column_int(0);
-        auto context = static_cast<ReadingContextEnum>(select_stmt->column_int(3));
+        if (skip_meter_value) {
+            continue;
+        }
 
-        select_stmt2->bind_int("@row_id", row_id);
+        std::optional<MeasurandEnum> measurand;
+        if (select_stmt->column_type(5) == SQLITE_INTEGER) {
+            measurand = static_cast<MeasurandEnum>(select_stmt->column_int(5));
+        }
+        // SampledValues without a measurand are omitted by the filter as well
+        if (filter.has_value() and
+            (!measurand.has_value() or !measurands_mask->test(static_cast<std::size_t>(measurand.value())))) {
+            continue;
+        }
 
-        while ((status = select_stmt2->step()) == SQLITE_ROW) {
-            SampledValue sampled_value;
+        SampledValue sampled_value;
 
-            sampled_value.value = select_stmt2->column_double(1);
-            sampled_value.context = context;
+        sampled_value.value = select_stmt->column_double(4);
+        sampled_value.context = context;
+        sampled_value.measurand = measurand;
 
-            if (select_stmt2->column_type(2) == SQLITE_INTEGER) {
-                sampled_value.measurand = static_cast<MeasurandEnum>(select_stmt2->column_int(2));
-            }
+        if (select_stmt->column_type(6) == SQLITE_INTEGER) {
+            sampled_value.phase = static_cast<PhaseEnum>(select_stmt->column_int(6));
+        }
 
-            if (select_stmt2->column_type(3) == SQLITE_INTEGER) {
-                sampled_value.phase = static_cast<PhaseEnum>(select_stmt2->column_int(3));
-            }
+        if (select_stmt->column_type(7) == SQLITE_INTEGER) {
+            sampled_value.location = static_cast<LocationEnum>(select_stmt->column_int(7));
+        }
 
-            if (select_stmt2->column_type(4) == SQLITE_INTEGER) {
-                sampled_value.location = static_cast<LocationEnum>(select_stmt2->column_int(4));
-            }
+        if (select_stmt->column_type(8) == SQLITE_TEXT) {
+            sampled_value.customData = CustomData{select_stmt->column_text(8)};
+        }
 
-            if (select_stmt2->column_type(5) == SQLITE_TEXT) {
-                sampled_value.customData = CustomData{select_stmt->column_text(5)};
+        if (select_stmt->column_type(9) == SQLITE_TEXT or select_stmt->column_type(10) == SQLITE_TEXT or
+            select_stmt->column_type(11) == SQLITE_INTEGER) {
+            UnitOfMeasure unit;
+            if (select_stmt->column_type(9) == SQLITE_TEXT) {
+                unit.customData = CustomData{select_stmt->column_text(9)};
             }
-
-            if (select_stmt2->column_type(6) == SQLITE_TEXT or select_stmt2->column_type(7) == SQLITE_TEXT or
-                select_stmt2->column_type(8) == SQLITE_INTEGER) {
-                UnitOfMeasure unit;
-                if (select_stmt2->column_type(6) == SQLITE_TEXT) {
-                    unit.customData = CustomData{select_stmt2->column_text(6)};
-                }
-                if (select_stmt2->column_type(7) == SQLITE_TEXT) {
-                    unit.unit = select_stmt2->column_text(7);
-                }
-                if (select_stmt2->column_type(8) == SQLITE_INTEGER) {
-                    unit.multiplier = select_stmt2->column_int(8);
-                }
-                sampled_value.unitOfMeasure.emplace(unit);
+            if (select_stmt->column_type(10) == SQLITE_TEXT) {
+                unit.unit = select_stmt->column_text(10);
             }
-
-            if (select_stmt2->column_type(9) == SQLITE_TEXT and select_stmt2->column_type(10) == SQLITE_TEXT and
-                select_stmt2->column_type(11) == SQLITE_TEXT and select_stmt2->column_type(12) == SQLITE_TEXT) {
-                SignedMeterValue signed_meter_value;
-                signed_meter_value.signedMeterData = select_stmt2->column_text(9);
-                signed_meter_value.signingMethod = select_stmt2->column_text(10);
-                signed_meter_value.encodingMethod = select_stmt2->column_text(11);
-                signed_meter_value.publicKey = select_stmt2->column_text(12);
-
-                sampled_value.signedMeterValue.emplace(signed_meter_value);
+            if (select_stmt->column_type(11) == SQLITE_INTEGER) {
+                unit.multiplier = select_stmt->column_int(11);
             }
-
-            value.sampledValue.push_back(std::move(sampled_value));
+            sampled_value.unitOfMeasure.emplace(unit);
         }
 
-        if (status != SQLITE_DONE) {
-            throw QueryExecutionException(this->database->get_error_message());
-        }
+        if (include_signed and select_stmt->column_type(12) == SQLITE_TEXT and
+            select_stmt->column_type(13) == SQLITE_TEXT and select_stmt->column_type(14) == SQLITE_TEXT and
+            select_stmt->column_type(15) == SQLITE_TEXT) {
+            SignedMeterValue signed_meter_value;
+            signed_meter_value.signedMeterData = select_stmt->column_text(12);
+            signed_meter_value.signingMethod = select_stmt->column_text(13);
+            signed_meter_value.encodingMethod = select_stmt->column_text(14);
+            signed_meter_value.publicKey = select_stmt->column_text(15);
 
-        result.push_back(std::move(value));
+            sampled_value.signedMeterValue.emplace(signed_meter_value);
+        }
 
-        select_stmt2->reset();
+        value.sampledValue.push_back(std::move(sampled_value));
     }
 
     if (status != SQLITE_DONE) {
         throw QueryExecutionException(this->database->get_error_message());
     }
 
+    finish_meter_value();
     return result;
 }
 
@@ -1003,6 +1117,48 @@ ChargingLimitSourceEnum DatabaseHandler::get_charging_limit_source_for_profile(c
     return res;
 }
 
+void DatabaseHandler::ocsp_refresh_state_insert_or_update(const std::string& certificate_key,
+                                                          const DateTime& next_refresh) {
+    std::string sql = "INSERT OR REPLACE INTO OCSP_REFRESH_STATE (CERTIFICATE_KEY, NEXT_REFRESH) VALUES "
+                      "(@certificate_key, @next_refresh)";
+    auto insert_stmt = this->database->new_statement(sql);
+
+    insert_stmt->bind_text("@certificate_key", certificate_key);
+    insert_stmt->bind_datetime("@next_refresh", next_refresh);
+
+    if (insert_stmt->step() != SQLITE_DONE) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+}
+
+std::map<std::string, DateTime> DatabaseHandler::ocsp_refresh_state_get_all() {
+    std::string sql = "SELECT CERTIFICATE_KEY, NEXT_REFRESH FROM OCSP_REFRESH_STATE";
+    auto select_stmt = this->database->new_statement(sql);
+
+    std::map<std::string, DateTime> refresh_state;
+    int status;
+    while ((status = select_stmt->step()) == SQLITE_ROW) {
+        refresh_state.emplace(select_stmt->column_text(0), select_stmt->column_datetime(1));
+    }
+
+    if (status != SQLITE_DONE) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+
+    return refresh_state;
+}
+
+void DatabaseHandler::ocsp_refresh_state_delete(const std::string& certificate_key) {
+    std::string sql = "DELETE FROM OCSP_REFRESH_STATE WHERE CERTIFICATE_KEY = @certificate_key";
+    auto delete_stmt = this->database->new_statement(sql);
+
+    delete_stmt->bind_text("@certificate_key", certificate_key);
+
+    if (delete_stmt->step() != SQLITE_DONE) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+}
+
 std::unique_ptr<SQLiteStatementInterface> DatabaseHandler::new_statement(const std::string& sql) {
     return this->database->new_statement(sql);
 }
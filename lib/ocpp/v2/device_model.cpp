@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
+#include <cmath>
+#include <limits>
+
 #include <ocpp/common/database/database_exceptions.hpp>
 #include <ocpp/common/utils.hpp>
 #include <ocpp/v2/ctrlr_component_variables.hpp>
@@ -119,7 +122,24 @@ bool DeviceModel::component_variables_match(const std::vector<ComponentVariable>
                }) != component_variables.end();
 }
 
-bool validate_value(const VariableCharacteristics& characteristics, const std::string& value, bool allow_zero) {
+std::optional<NumericValue> parse_numeric_value(DataEnum data_type, const std::string& value) {
+    try {
+        if (data_type == DataEnum::integer and is_integer(value)) {
+            return static_cast<std::int64_t>(std::stoll(value));
+        }
+        if (data_type == DataEnum::decimal and is_decimal_number(value)) {
+            return std::stod(value);
+        }
+    } catch (const std::logic_error& e) {
+        // Out of range, or only a sign or decimal point without digits
+    }
+    return std::nullopt;
+}
+
+/// \brief Validates the \p value of a variable against its \p characteristics. For numeric variables \p value_numeric
+/// holds the already parsed \p value
+bool validate_value(const VariableCharacteristics& characteristics, const std::string& value,
+                    const std::optional<NumericValue>& value_numeric, bool allow_zero) {
     switch (characteristics.dataType) {
     case DataEnum::string:
         if (characteristics.minLimit.has_value() and value.size() < characteristics.minLimit.value()) {
@@ -130,10 +150,13 @@ bool validate_value(const VariableCharacteristics& characteristics, const std::s
         }
         return true;
     case DataEnum::decimal: {
-        if (!is_decimal_number(value)) {
+        if (!value_numeric.has_value()) {
+            return false;
+        }
+        const auto f = static_cast<float>(std::get<double>(value_numeric.value()));
+        if (!std::isfinite(f)) {
             return false;
         }
-        float f = std::stof(value);
 
         if (allow_zero and f == 0) {
             return true;
@@ -147,11 +170,16 @@ bool validate_value(const VariableCharacteristics& characteristics, const std::s
         return true;
     }
     case DataEnum::integer: {
-        if (!is_integer(value)) {
+        if (!value_numeric.has_value()) {
             return false;
         }
 
-        int i = std::stoi(value);
+        // Integer variables are read as int
+        const auto value_int64 = std::get<std::int64_t>(value_numeric.value());
+        if (value_int64 < std::numeric_limits<int>::min() or value_int64 > std::numeric_limits<int>::max()) {
+            return false;
+        }
+        const auto i = static_cast<int>(value_int64);
 
         if (allow_zero and i == 0) {
             return true;
@@ -264,19 +292,23 @@ SetVariableStatusEnum DeviceModel::set_value(const Component& component, const V
                                              const AttributeEnum& attribute_enum, const std::string& value,
                                              const std::string& source, bool allow_read_only) {
 
-    if (this->device_model_map.find(component) == this->device_model_map.end()) {
+    const auto component_it = this->device_model_map.find(component);
+    if (component_it == this->device_model_map.end()) {
         return SetVariableStatusEnum::UnknownComponent;
     }
 
-    auto variable_map = this->device_model_map[component];
+    const auto& variable_map = component_it->second;
+    const auto variable_it = variable_map.find(variable);
 
-    if (variable_map.find(variable) == variable_map.end()) {
+    if (variable_it == variable_map.end()) {
         return SetVariableStatusEnum::UnknownVariable;
     }
 
-    const auto& characteristics = variable_map[variable].characteristics;
+    const auto& characteristics = variable_it->second.characteristics;
+    // Parsed only once, for the validation and the monitors of the variable
+    const auto value_numeric = parse_numeric_value(characteristics.dataType, value);
     try {
-        if (!validate_value(characteristics, value, allow_zero(component, variable))) {
+        if (!validate_value(characteristics, value, value_numeric, allow_zero(component, variable))) {
             return SetVariableStatusEnum::Rejected;
         }
     } catch (const std::exception& e) {
@@ -302,7 +334,7 @@ SetVariableStatusEnum DeviceModel::set_value(const Component& component, const V
 
     // Only trigger for actual values
     if ((attribute_enum == AttributeEnum::Actual) && success && variable_listener) {
-        const auto& monitors = variable_map[variable].monitors;
+        const auto& monitors = variable_it->second.monitors;
 
         // If we had a variable value change, trigger the listener
         if (!monitors.empty()) {
@@ -313,7 +345,7 @@ SetVariableStatusEnum DeviceModel::set_value(const Component& component, const V
 
             if (value_previous != value_current) {
                 variable_listener(monitors, component, variable, characteristics, attribute.value(), value_previous,
-                                  value_current);
+                                  value_current, value_numeric);
             }
         }
     }
@@ -627,7 +659,9 @@ std::vector<SetMonitoringResult> DeviceModel::set_monitors(const std::vector<Set
                 valid_value = true;
             } else {
                 try {
-                    valid_value = validate_value(characteristics, std::to_string(request.value),
+                    const auto monitor_value = std::to_string(request.value);
+                    valid_value = validate_value(characteristics, monitor_value,
+                                                 parse_numeric_value(characteristics.dataType, monitor_value),
                                                  allow_zero(request.component, request.variable));
                 } catch (const std::exception& e) {
                     EVLOG_warning << "Could not validate monitor value: " << request.value
@@ -668,9 +702,8 @@ std::vector<SetMonitoringResult> DeviceModel::set_monitors(const std::vector<Set
             auto monitor_meta = this->device_model->set_monitoring_data(request, type);
 
             if (monitor_meta.has_value()) {
-                // N07.FR.11
-                // In case of an existing monitor update
-                if (request_has_id && monitor_update_listener) {
+                // Notify about new monitors as well as about updates of existing monitors (N07.FR.11)
+                if (monitor_update_listener) {
                     auto attribute = this->device_model->get_variable_attribute(component_it->first, variable_it->first,
                                                                                 AttributeEnum::Actual);
 
@@ -829,6 +862,10 @@ std::vector<ClearMonitoringResult> DeviceModel::clear_monitors(const std::vector
                         variable_metadata.monitors.erase(static_cast<int64_t>(id));
                     }
                 }
+
+                if (monitor_clear_listener) {
+                    monitor_clear_listener(id);
+                }
             }
 
             clear_monitor_res.status = clear_result;
@@ -853,6 +890,9 @@ int32_t DeviceModel::clear_custom_monitors() {
                 // Delete while iterating all custom monitors
                 for (auto it = variable_metadata.monitors.begin(); it != variable_metadata.monitors.end();) {
                     if (it->second.type == VariableMonitorType::CustomMonitor) {
+                        if (monitor_clear_listener) {
+                            monitor_clear_listener(it->second.monitor.id);
+                        }
                         it = variable_metadata.monitors.erase(it);
                     } else {
                         ++it;
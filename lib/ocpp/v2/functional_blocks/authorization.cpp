@@ -25,8 +25,18 @@
 static bool has_duplicate_in_list(const std::vector<ocpp::v2::AuthorizationData>& list);
 static bool has_no_token_info(const ocpp::v2::AuthorizationData& item);
 
+///
+/// \brief Convert the hex encoded \p id_token_hash to its binary representation.
+/// \param id_token_hash Lower case hex encoded SHA-256 hash, as created by utils::generate_token_hash.
+/// \return The binary digest or std::nullopt if the hash is not a lower case hex encoded SHA-256 hash.
+///
+static std::optional<ocpp::v2::IdTokenHashDigest> to_id_token_hash_digest(const std::string& id_token_hash);
+
 ocpp::v2::Authorization::Authorization(const FunctionalBlockContext& context) :
-    context(context), auth_cache_cleanup_handler_running(false) {
+    context(context),
+    auth_cache_cleanup_required(false),
+    auth_cache_cleanup_handler_running(false),
+    auth_cache_generation(0) {
 }
 
 ocpp::v2::Authorization::~Authorization() {
@@ -133,18 +143,153 @@ bool ocpp::v2::Authorization::is_auth_cache_ctrlr_enabled() {
 
 void ocpp::v2::Authorization::authorization_cache_insert_entry(const std::string& id_token_hash,
                                                                const IdTokenInfo& id_token_info) {
+    const auto digest = to_id_token_hash_digest(id_token_hash);
+    if (digest.has_value()) {
+        this->authorization_cache_insert_entry(digest.value(), id_token_info);
+        return;
+    }
+
+    // Not a hash that can be held in memory, only write it to the database
+    std::scoped_lock lk(this->auth_cache_write_mutex);
     this->context.database_handler.authorization_cache_insert_entry(id_token_hash, id_token_info);
 }
 
 std::optional<ocpp::v2::AuthorizationCacheEntry>
 ocpp::v2::Authorization::authorization_cache_get_entry(const std::string& id_token_hash) {
-    return this->context.database_handler.authorization_cache_get_entry(id_token_hash);
+    const auto digest = to_id_token_hash_digest(id_token_hash);
+    if (!digest.has_value()) {
+        return this->context.database_handler.authorization_cache_get_entry(id_token_hash);
+    }
+
+    return this->authorization_cache_get_entry(digest.value());
 }
 
 void ocpp::v2::Authorization::authorization_cache_delete_entry(const std::string& id_token_hash) {
+    const auto digest = to_id_token_hash_digest(id_token_hash);
+    if (digest.has_value()) {
+        this->authorization_cache_delete_entry(digest.value());
+        return;
+    }
+
+    std::scoped_lock lk(this->auth_cache_write_mutex);
     this->context.database_handler.authorization_cache_delete_entry(id_token_hash);
 }
 
+std::optional<ocpp::v2::AuthorizationCacheEntry>
+ocpp::v2::Authorization::authorization_cache_get_entry(const IdTokenHashDigest& digest) {
+    std::uint64_t generation;
+    {
+        std::scoped_lock lk(this->auth_cache_mutex);
+        const auto it = this->auth_cache_index.find(digest);
+        if (it != this->auth_cache_index.end()) {
+            // Move the entry to the front, it is the most recently used one now
+            this->auth_cache_entries.splice(this->auth_cache_entries.begin(), this->auth_cache_entries, it->second);
+            return AuthorizationCacheEntry{it->second->id_token_info, it->second->last_used};
+        }
+        generation = this->auth_cache_generation;
+    }
+
+    auto entry = this->context.database_handler.authorization_cache_get_entry(utils::to_hex_string(digest));
+    if (entry.has_value()) {
+        std::scoped_lock lk(this->auth_cache_mutex);
+        // The entry might have been replaced or deleted while it was read from the database
+        if (generation == this->auth_cache_generation) {
+            this->authorization_cache_memory_insert(digest, entry->id_token_info, entry->last_used);
+        }
+    }
+    return entry;
+}
+
+void ocpp::v2::Authorization::authorization_cache_insert_entry(const IdTokenHashDigest& digest,
+                                                               const IdTokenInfo& id_token_info) {
+    std::scoped_lock write_lk(this->auth_cache_write_mutex);
+    this->context.database_handler.authorization_cache_insert_entry(utils::to_hex_string(digest), id_token_info);
+
+    std::scoped_lock lk(this->auth_cache_mutex);
+    this->authorization_cache_memory_insert(digest, id_token_info, DateTime());
+    // The insert already wrote the last used timestamp
+    this->auth_cache_last_used_dirty.erase(digest);
+}
+
+void ocpp::v2::Authorization::authorization_cache_delete_entry(const IdTokenHashDigest& digest) {
+    std::scoped_lock write_lk(this->auth_cache_write_mutex);
+    this->context.database_handler.authorization_cache_delete_entry(utils::to_hex_string(digest));
+
+    std::scoped_lock lk(this->auth_cache_mutex);
+    this->authorization_cache_memory_erase(digest);
+    this->auth_cache_last_used_dirty.erase(digest);
+}
+
+void ocpp::v2::Authorization::authorization_cache_update_last_used(const IdTokenHashDigest& digest) {
+    {
+        std::scoped_lock lk(this->auth_cache_mutex);
+        const auto it = this->auth_cache_index.find(digest);
+        if (it != this->auth_cache_index.end()) {
+            it->second->last_used = DateTime();
+            this->auth_cache_entries.splice(this->auth_cache_entries.begin(), this->auth_cache_entries, it->second);
+        }
+
+        if (this->auth_cache_cleanup_handler_running) {
+            // Written to the database with the next flush of the cleanup thread
+            this->auth_cache_last_used_dirty.insert(digest);
+            return;
+        }
+    }
+
+    // Without the cleanup thread there is no one to write back the timestamp later
+    this->context.database_handler.authorization_cache_update_last_used(utils::to_hex_string(digest));
+}
+
+void ocpp::v2::Authorization::authorization_cache_flush_last_used() {
+    std::unordered_set<IdTokenHashDigest, IdTokenHashDigestHash> dirty;
+    {
+        std::scoped_lock lk(this->auth_cache_mutex);
+        std::swap(dirty, this->auth_cache_last_used_dirty);
+    }
+
+    std::scoped_lock write_lk(this->auth_cache_write_mutex);
+    for (const auto& digest : dirty) {
+        try {
+            this->context.database_handler.authorization_cache_update_last_used(utils::to_hex_string(digest));
+        } catch (const common::DatabaseException& e) {
+            EVLOG_warning << "Could not update last used timestamp of authorization cache entry: " << e.what();
+        }
+    }
+}
+
+void ocpp::v2::Authorization::authorization_cache_memory_insert(const IdTokenHashDigest& digest,
+                                                                const IdTokenInfo& id_token_info,
+                                                                const DateTime& last_used) {
+    this->authorization_cache_memory_erase(digest);
+    this->auth_cache_generation++;
+
+    this->auth_cache_entries.push_front(InMemoryAuthorizationCacheEntry{digest, id_token_info, last_used});
+    this->auth_cache_index[digest] = this->auth_cache_entries.begin();
+
+    // Evict the least recently used entries, they are still available in the database
+    while (this->auth_cache_entries.size() > AUTH_CACHE_MAX_ENTRIES_IN_MEMORY) {
+        this->auth_cache_index.erase(this->auth_cache_entries.back().digest);
+        this->auth_cache_entries.pop_back();
+    }
+}
+
+void ocpp::v2::Authorization::authorization_cache_memory_erase(const IdTokenHashDigest& digest) {
+    this->auth_cache_generation++;
+
+    const auto it = this->auth_cache_index.find(digest);
+    if (it != this->auth_cache_index.end()) {
+        this->auth_cache_entries.erase(it->second);
+        this->auth_cache_index.erase(it);
+    }
+}
+
+void ocpp::v2::Authorization::authorization_cache_memory_clear() {
+    this->auth_cache_generation++;
+    this->auth_cache_entries.clear();
+    this->auth_cache_index.clear();
+    this->auth_cache_last_used_dirty.clear();
+}
+
 ocpp::v2::AuthorizeResponse
 ocpp::v2::Authorization::validate_token(const IdToken id_token, const std::optional<CiString<5500>>& certificate,
                                         const std::optional<std::vector<OCSPRequestData>>& ocsp_request_data) {
@@ -319,12 +464,12 @@ ocpp::v2::Authorization::validate_token(const IdToken id_token, const std::optio
         }
     }
 
-    const auto hashed_id_token = utils::generate_token_hash(id_token);
+    const auto id_token_digest = utils::generate_token_hash_digest(id_token);
     const auto auth_cache_enabled = this->is_auth_cache_ctrlr_enabled();
 
     if (auth_cache_enabled) {
         try {
-            const auto cache_entry = this->authorization_cache_get_entry(hashed_id_token);
+            const auto cache_entry = this->authorization_cache_get_entry(id_token_digest);
             if (cache_entry.has_value()) {
                 const auto now = DateTime();
                 const IdTokenInfo& id_token_info = cache_entry->id_token_info;
@@ -341,13 +486,13 @@ ocpp::v2::Authorization::validate_token(const IdToken id_token, const std::optio
                     EVLOG_info << "Found valid entry in AuthCache but "
                                << (lifetime_expired ? "lifetime expired" : "expiry date passed")
                                << ": Removing from cache and sending new request";
-                    this->authorization_cache_delete_entry(hashed_id_token);
+                    this->authorization_cache_delete_entry(id_token_digest);
                     this->update_authorization_cache_size();
                 } else if (this->context.device_model.get_value<bool>(
                                ControllerComponentVariables::LocalPreAuthorize) and
                            id_token_info.status == AuthorizationStatusEnum::Accepted) {
                     EVLOG_info << "Found valid entry in AuthCache";
-                    this->context.database_handler.authorization_cache_update_last_used(hashed_id_token);
+                    this->authorization_cache_update_last_used(id_token_digest);
                     response.idTokenInfo = id_token_info;
                     return response;
                 } else if (this->context.device_model
@@ -386,7 +531,7 @@ ocpp::v2::Authorization::validate_token(const IdToken id_token, const std::optio
 
         if (auth_cache_enabled) {
             try {
-                this->authorization_cache_insert_entry(hashed_id_token, response.idTokenInfo);
+                this->authorization_cache_insert_entry(id_token_digest, response.idTokenInfo);
             } catch (const common::DatabaseException& e) {
                 EVLOG_error << "Could not insert into authorization cache entry: " << e.what();
             }
@@ -413,6 +558,9 @@ void ocpp::v2::Authorization::stop_auth_cache_cleanup_thread() {
         if (this->auth_cache_cleanup_thread.joinable()) {
             this->auth_cache_cleanup_thread.join();
         }
+
+        // Entries might have been marked as used while the thread was stopping
+        this->authorization_cache_flush_last_used();
     }
 }
 
@@ -422,7 +570,12 @@ void ocpp::v2::Authorization::handle_clear_cache_req(Call<ClearCacheRequest> cal
 
     if (this->is_auth_cache_ctrlr_enabled()) {
         try {
-            this->context.database_handler.authorization_cache_clear();
+            {
+                std::scoped_lock write_lk(this->auth_cache_write_mutex);
+                this->context.database_handler.authorization_cache_clear();
+                std::scoped_lock lk(this->auth_cache_mutex);
+                this->authorization_cache_memory_clear();
+            }
             this->update_authorization_cache_size();
             response.status = ClearCacheStatusEnum::Accepted;
         } catch (common::DatabaseException& e) {
@@ -441,27 +594,44 @@ void ocpp::v2::Authorization::cache_cleanup_handler() {
     // Run the update once so the ram variable gets initialized
     this->update_authorization_cache_size();
 
+    auto next_cleanup = std::chrono::steady_clock::now() + std::chrono::minutes(15);
+    auto next_flush = std::chrono::steady_clock::now() + AUTH_CACHE_LAST_USED_FLUSH_INTERVAL;
+
     while (true) {
+        bool cleanup_required = false;
         {
-            // Wait for next wakeup or timeout
+            // Wait for next wakeup, the next flush of the last used timestamps or the next cleanup
             std::unique_lock lk(this->auth_cache_cleanup_mutex);
-            if (this->auth_cache_cleanup_cv.wait_for(lk, std::chrono::minutes(15), [&]() {
-                    return !this->auth_cache_cleanup_handler_running or this->auth_cache_cleanup_required;
-                })) {
+            this->auth_cache_cleanup_cv.wait_until(lk, std::min(next_cleanup, next_flush), [&]() {
+                return !this->auth_cache_cleanup_handler_running or this->auth_cache_cleanup_required;
+            });
+            if (this->auth_cache_cleanup_required) {
                 EVLOG_debug << "Triggered authorization cache cleanup";
-            } else {
+                cleanup_required = true;
+            } else if (std::chrono::steady_clock::now() >= next_cleanup) {
                 EVLOG_debug << "Time based authorization cache cleanup";
+                cleanup_required = true;
             }
             this->auth_cache_cleanup_required = false;
         }
 
+        // Write back the last used timestamps first, so the cleanup removes the right entries
+        this->authorization_cache_flush_last_used();
+        next_flush = std::chrono::steady_clock::now() + AUTH_CACHE_LAST_USED_FLUSH_INTERVAL;
+
         if (!this->auth_cache_cleanup_handler_running) {
             break;
         }
 
+        if (!cleanup_required) {
+            continue;
+        }
+        next_cleanup = std::chrono::steady_clock::now() + std::chrono::minutes(15);
+
         auto lifetime =
             this->context.device_model.get_optional_value<int>(ControllerComponentVariables::AuthCacheLifeTime);
         try {
+            std::scoped_lock write_lk(this->auth_cache_write_mutex);
             this->context.database_handler.authorization_cache_delete_expired_entries(
                 lifetime.has_value() ? std::optional<std::chrono::seconds>(*lifetime) : std::nullopt);
 
@@ -472,8 +642,16 @@ void ocpp::v2::Authorization::cache_cleanup_handler() {
             if (meta_data.has_value()) {
                 auto max_storage = meta_data->characteristics.maxLimit;
                 if (max_storage.has_value()) {
+                    bool entries_evicted = false;
                     while (this->context.database_handler.authorization_cache_get_binary_size() > max_storage.value()) {
                         this->context.database_handler.authorization_cache_delete_nr_of_oldest_entries(1);
+                        entries_evicted = true;
+                    }
+
+                    // The evicted entries are not known here, so drop the in memory cache to stay consistent
+                    if (entries_evicted) {
+                        std::scoped_lock lk(this->auth_cache_mutex);
+                        this->authorization_cache_memory_clear();
                     }
                 }
             }
@@ -615,3 +793,31 @@ static bool has_duplicate_in_list(const std::vector<ocpp::v2::AuthorizationData>
 static bool has_no_token_info(const ocpp::v2::AuthorizationData& item) {
     return !item.idTokenInfo.has_value();
 };
+
+static std::optional<ocpp::v2::IdTokenHashDigest> to_id_token_hash_digest(const std::string& id_token_hash) {
+    ocpp::v2::IdTokenHashDigest digest;
+    if (id_token_hash.size() != digest.size() * 2) {
+        return std::nullopt;
+    }
+
+    const auto hex_value = [](const char c) -> int {
+        if (c >= '0' and c <= '9') {
+            return c - '0';
+        }
+        if (c >= 'a' and c <= 'f') {
+            return c - 'a' + 10;
+        }
+        return -1;
+    };
+
+    for (std::size_t i = 0; i < digest.size(); i++) {
+        const auto high = hex_value(id_token_hash[2 * i]);
+        const auto low = hex_value(id_token_hash[2 * i + 1]);
+        if (high < 0 or low < 0) {
+            return std::nullopt;
+        }
+        digest[i] = static_cast<std::uint8_t>((high << 4) | low);
+    }
+
+    return digest;
+}
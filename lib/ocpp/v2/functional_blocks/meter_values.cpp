@@ -100,14 +100,33 @@ void ocpp::v2::MeterValues::on_meter_value(const int32_t evse_id, const MeterVal
 ocpp::v2::MeterValue
 ocpp::v2::MeterValues::get_latest_meter_value_filtered(const MeterValue& meter_value, ReadingContextEnum context,
                                                        const RequiredComponentVariable& component_variable) {
-    auto filtered_meter_value = utils::get_meter_value_with_measurands_applied(
-        meter_value, utils::get_measurands_vec(this->context.device_model.get_value<std::string>(component_variable)));
+    auto filtered_meter_value =
+        utils::get_meter_value_with_measurands_applied(meter_value, this->get_measurand_filter(component_variable));
     for (auto& sampled_value : filtered_meter_value.sampledValue) {
         sampled_value.context = context;
     }
     return filtered_meter_value;
 }
 
+ocpp::v2::utils::MeasurandMask
+ocpp::v2::MeterValues::get_measurand_filter(const RequiredComponentVariable& component_variable) {
+    std::lock_guard<std::mutex> lk(this->measurand_filters_mutex);
+    const auto it = this->measurand_filters.find(component_variable);
+    if (it != this->measurand_filters.end()) {
+        return it->second;
+    }
+
+    const auto mask =
+        utils::get_measurands_mask(this->context.device_model.get_value<std::string>(component_variable));
+    this->measurand_filters.emplace(component_variable, mask);
+    return mask;
+}
+
+void ocpp::v2::MeterValues::update_measurand_filter(const ComponentVariable& component_variable) {
+    std::lock_guard<std::mutex> lk(this->measurand_filters_mutex);
+    this->measurand_filters.erase(component_variable);
+}
+
 void ocpp::v2::MeterValues::meter_values_req(const int32_t evse_id, const std::vector<MeterValue>& meter_values,
                                              const bool initiated_by_trigger_message) {
     MeterValuesRequest req;
@@ -534,6 +534,14 @@ void Provisioning::handle_variable_changed(const SetVariableData& set_variable_d
         this->meter_values.update_aligned_data_interval();
     }
 
+    if (component_variable == ControllerComponentVariables::AlignedDataMeasurands or
+        component_variable == ControllerComponentVariables::AlignedDataTxEndedMeasurands or
+        component_variable == ControllerComponentVariables::SampledDataTxStartedMeasurands or
+        component_variable == ControllerComponentVariables::SampledDataTxUpdatedMeasurands or
+        component_variable == ControllerComponentVariables::SampledDataTxEndedMeasurands) {
+        this->meter_values.update_measurand_filter(component_variable);
+    }
+
     if (component_variable_change_requires_websocket_option_update_without_reconnect(component_variable)) {
         EVLOG_debug << "Reconfigure websocket due to relevant change of ControllerComponentVariable";
         this->context.connectivity_manager.set_websocket_connection_options_without_reconnect();
@@ -12,6 +12,7 @@
 
 #include <ocpp/v2/functional_blocks/authorization.hpp>
 #include <ocpp/v2/functional_blocks/availability.hpp>
+#include <ocpp/v2/functional_blocks/meter_values.hpp>
 #include <ocpp/v2/functional_blocks/smart_charging.hpp>
 #include <ocpp/v2/functional_blocks/tariff_and_cost.hpp>
 
@@ -22,8 +23,9 @@ namespace ocpp::v2 {
 TransactionBlock::TransactionBlock(
     const FunctionalBlockContext& functional_block_context, MessageQueue<v2::MessageType>& message_queue,
     AuthorizationInterface& authorization, AvailabilityInterface& availability, SmartChargingInterface& smart_charging,
-    TariffAndCostInterface& tariff_and_cost, StopTransactionCallback stop_transaction_callback,
-    PauseChargingCallback pause_charging_callback, std::optional<TransactionEventCallback> transaction_event_callback,
+    TariffAndCostInterface& tariff_and_cost, MeterValuesInterface& meter_values,
+    StopTransactionCallback stop_transaction_callback, PauseChargingCallback pause_charging_callback,
+    std::optional<TransactionEventCallback> transaction_event_callback,
     std::optional<TransactionEventResponseCallback> transaction_event_response_callback, ResetCallback reset_callback) :
     context(functional_block_context),
     message_queue(message_queue),
@@ -31,6 +33,7 @@ TransactionBlock::TransactionBlock(
     availability(availability),
     smart_charging(smart_charging),
     tariff_and_cost(tariff_and_cost),
+    meter_values(meter_values),
     stop_transaction_callback(stop_transaction_callback),
     pause_charging_callback(pause_charging_callback),
     transaction_event_callback(transaction_event_callback),
@@ -63,8 +66,8 @@ void TransactionBlock::on_transaction_started(
                                  reservation_id, charging_state);
 
     const auto meter_value = utils::get_meter_value_with_measurands_applied(
-        meter_start, utils::get_measurands_vec(this->context.device_model.get_value<std::string>(
-                         ControllerComponentVariables::SampledDataTxStartedMeasurands)));
+        meter_start,
+        this->meter_values.get_measurand_filter(ControllerComponentVariables::SampledDataTxStartedMeasurands));
 
     const auto& enhanced_transaction = evse_handle.get_transaction();
     Transaction transaction{enhanced_transaction->transactionId};
@@ -108,17 +111,21 @@ void TransactionBlock::on_transaction_finished(const int32_t evse_id, const Date
 
     std::optional<std::vector<ocpp::v2::MeterValue>> meter_values = std::nullopt;
     try {
-        meter_values = std::make_optional(utils::get_meter_values_with_measurands_applied(
-            this->context.database_handler.transaction_metervalues_get_all(enhanced_transaction->transactionId.get()),
-            utils::get_measurands_vec(this->context.device_model.get_value<std::string>(
-                ControllerComponentVariables::SampledDataTxEndedMeasurands)),
-            utils::get_measurands_vec(this->context.device_model.get_value<std::string>(
-                ControllerComponentVariables::AlignedDataTxEndedMeasurands)),
-            timestamp,
+        utils::TxEndedMeterValueFilter filter;
+        filter.sampled_measurands =
+            this->meter_values.get_measurand_filter(ControllerComponentVariables::SampledDataTxEndedMeasurands);
+        filter.aligned_measurands =
+            this->meter_values.get_measurand_filter(ControllerComponentVariables::AlignedDataTxEndedMeasurands);
+        filter.max_timestamp = timestamp;
+        filter.include_sampled_signed =
             this->context.device_model.get_optional_value<bool>(ControllerComponentVariables::SampledDataSignReadings)
-                .value_or(false),
+                .value_or(false);
+        filter.include_aligned_signed =
             this->context.device_model.get_optional_value<bool>(ControllerComponentVariables::AlignedDataSignReadings)
-                .value_or(false)));
+                .value_or(false);
+        // the filter is applied while the metervalues are read from the database
+        meter_values = std::make_optional(this->context.database_handler.transaction_metervalues_get_tx_ended(
+            enhanced_transaction->transactionId.get(), filter));
 
         if (meter_values.value().empty()) {
             meter_values.reset();
@@ -8,6 +8,10 @@ namespace ocpp {
 namespace v2 {
 
 void MessageDispatcher::dispatch_call(const json& call, bool triggered) {
+    this->dispatch_serialized_call(call, std::string(), triggered);
+}
+
+void MessageDispatcher::dispatch_serialized_call(const json& call, const std::string& serialized_call, bool triggered) {
     const auto message_type = conversions::string_to_messagetype(call.at(CALL_ACTION));
     const auto message_transmission_priority = get_message_transmission_priority(
         is_boot_notification_message(message_type), triggered,
@@ -15,10 +19,10 @@ void MessageDispatcher::dispatch_call(const json& call, bool triggered) {
         this->device_model.get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages).value_or(false));
     switch (message_transmission_priority) {
     case MessageTransmissionPriority::SendImmediately:
-        this->message_queue.push_call(call);
+        this->message_queue.push_serialized_call(call, serialized_call);
         return;
     case MessageTransmissionPriority::SendAfterRegistrationStatusAccepted:
-        this->message_queue.push_call(call, true);
+        this->message_queue.push_serialized_call(call, serialized_call, true);
         return;
     case MessageTransmissionPriority::Discard:
         return;
@@ -28,6 +32,12 @@ void MessageDispatcher::dispatch_call(const json& call, bool triggered) {
 
 std::future<ocpp::EnhancedMessage<MessageType>> MessageDispatcher::dispatch_call_async(const json& call,
                                                                                        bool triggered) {
+    return this->dispatch_serialized_call_async(call, std::string(), triggered);
+}
+
+std::future<ocpp::EnhancedMessage<MessageType>>
+MessageDispatcher::dispatch_serialized_call_async(const json& call, const std::string& serialized_call,
+                                                  bool triggered) {
     const auto message_type = conversions::string_to_messagetype(call.at(CALL_ACTION));
     const auto message_transmission_priority = get_message_transmission_priority(
         is_boot_notification_message(message_type), false,
@@ -35,7 +45,7 @@ std::future<ocpp::EnhancedMessage<MessageType>> MessageDispatcher::dispatch_call
         this->device_model.get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages).value_or(false));
     switch (message_transmission_priority) {
     case MessageTransmissionPriority::SendImmediately:
-        return this->message_queue.push_call_async(call);
+        return this->message_queue.push_serialized_call_async(call, serialized_call);
     case MessageTransmissionPriority::SendAfterRegistrationStatusAccepted:
     case MessageTransmissionPriority::Discard:
         auto promise = std::promise<EnhancedMessage<MessageType>>();
@@ -51,6 +61,10 @@ void MessageDispatcher::dispatch_call_result(const json& call_result) {
     this->message_queue.push_call_result(call_result);
 }
 
+void MessageDispatcher::dispatch_serialized_call_result(const std::string& call_result, const MessageId& unique_id) {
+    this->message_queue.push_serialized_call_result(call_result, unique_id);
+}
+
 void MessageDispatcher::dispatch_call_error(const json& call_error) {
     this->message_queue.push_call_error(call_error);
 }
@@ -28,6 +28,30 @@ template <> bool ControlMessage<v2::MessageType>::is_transaction_update_message(
     return false;
 }
 
+template <> bool ControlMessage<v2::MessageType>::is_periodic_transaction_update_message() const {
+    if (!this->is_transaction_update_message()) {
+        return false;
+    }
+    const auto& payload = this->message.at(CALL_PAYLOAD);
+    const auto trigger_reason = payload.at("triggerReason").get<std::string>();
+    if ((trigger_reason != "MeterValuePeriodic" and trigger_reason != "MeterValueClock") or
+        payload.contains("idToken") or payload.at("transactionInfo").contains("chargingState")) {
+        return false;
+    }
+    for (const auto& meter_value : payload.value("meterValue", json::array())) {
+        for (const auto& sampled_value : meter_value.value("sampledValue", json::array())) {
+            if (sampled_value.contains("signedMeterValue")) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <> std::string ControlMessage<v2::MessageType>::get_transaction_key() const {
+    return this->message.at(CALL_PAYLOAD).at("transactionInfo").at("transactionId").get<std::string>();
+}
+
 template <>
 ControlMessage<v2::MessageType>::ControlMessage(const json& message, const bool stall_until_accepted) :
     message(message.get<json::array_t>()),
@@ -58,6 +58,25 @@ void from_json(const json& j, AuthorizeRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const AuthorizeRequest& k) {
+    writer.start_object();
+    if (k.certificate) {
+        writer.key("certificate");
+        write_json(writer, k.certificate.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("idToken");
+    write_json(writer, k.idToken);
+    if (k.iso15118CertificateHashData) {
+        writer.key("iso15118CertificateHashData");
+        write_json(writer, k.iso15118CertificateHashData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given AuthorizeRequest \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeRequest written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeRequest& k) {
@@ -97,6 +116,21 @@ void from_json(const json& j, AuthorizeResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const AuthorizeResponse& k) {
+    writer.start_object();
+    if (k.certificateStatus) {
+        writer.key("certificateStatus");
+        writer.value(conversions::authorize_certificate_status_enum_to_string(k.certificateStatus.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("idTokenInfo");
+    write_json(writer, k.idTokenInfo);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given AuthorizeResponse \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeResponse written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeResponse& k) {
@@ -40,6 +40,19 @@ void from_json(const json& j, BootNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const BootNotificationRequest& k) {
+    writer.start_object();
+    writer.key("chargingStation");
+    write_json(writer, k.chargingStation);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("reason");
+    writer.value(conversions::boot_reason_enum_to_string(k.reason));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given BootNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationRequest& k) {
@@ -82,6 +95,25 @@ void from_json(const json& j, BootNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const BootNotificationResponse& k) {
+    writer.start_object();
+    writer.key("currentTime");
+    write_json(writer, k.currentTime);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("interval");
+    write_json(writer, k.interval);
+    writer.key("status");
+    writer.value(conversions::registration_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given BootNotificationResponse \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationResponse& k) {
@@ -38,6 +38,17 @@ void from_json(const json& j, CancelReservationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CancelReservationRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("reservationId");
+    write_json(writer, k.reservationId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CancelReservationRequest \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationRequest written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationRequest& k) {
@@ -76,6 +87,21 @@ void from_json(const json& j, CancelReservationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CancelReservationResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::cancel_reservation_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CancelReservationResponse \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationResponse written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationResponse& k) {
@@ -44,6 +44,21 @@ void from_json(const json& j, CertificateSignedRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedRequest& k) {
+    writer.start_object();
+    writer.key("certificateChain");
+    write_json(writer, k.certificateChain);
+    if (k.certificateType) {
+        writer.key("certificateType");
+        writer.value(conversions::certificate_signing_use_enum_to_string(k.certificateType.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CertificateSignedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedRequest written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedRequest& k) {
@@ -82,6 +97,21 @@ void from_json(const json& j, CertificateSignedResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::certificate_signed_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CertificateSignedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedResponse written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedResponse& k) {
@@ -35,6 +35,15 @@ void from_json(const json& j, ClearCacheRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearCacheRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearCacheRequest \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheRequest& k) {
@@ -73,6 +82,21 @@ void from_json(const json& j, ClearCacheResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearCacheResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::clear_cache_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearCacheResponse \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheResponse& k) {
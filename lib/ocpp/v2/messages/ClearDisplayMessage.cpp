@@ -38,6 +38,17 @@ void from_json(const json& j, ClearDisplayMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearDisplayMessageRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("id");
+    write_json(writer, k.id);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearDisplayMessageRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageRequest& k) {
@@ -76,6 +87,21 @@ void from_json(const json& j, ClearDisplayMessageResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearDisplayMessageResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::clear_message_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearDisplayMessageResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageResponse& k) {
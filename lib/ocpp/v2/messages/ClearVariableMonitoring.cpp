@@ -40,6 +40,17 @@ void from_json(const json& j, ClearVariableMonitoringRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearVariableMonitoringRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("id");
+    write_json(writer, k.id);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringRequest \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringRequest& k) {
@@ -74,6 +85,17 @@ void from_json(const json& j, ClearVariableMonitoringResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearVariableMonitoringResponse& k) {
+    writer.start_object();
+    writer.key("clearMonitoringResult");
+    write_json(writer, k.clearMonitoringResult);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringResponse& k) {
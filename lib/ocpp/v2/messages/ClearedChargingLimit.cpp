@@ -44,6 +44,21 @@ void from_json(const json& j, ClearedChargingLimitRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearedChargingLimitRequest& k) {
+    writer.start_object();
+    writer.key("chargingLimitSource");
+    writer.value(conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        write_json(writer, k.evseId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearedChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitRequest& k) {
@@ -73,6 +88,15 @@ void from_json(const json& j, ClearedChargingLimitResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearedChargingLimitResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearedChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitResponse& k) {
@@ -40,6 +40,19 @@ void from_json(const json& j, CostUpdatedRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CostUpdatedRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("totalCost");
+    write_json(writer, k.totalCost);
+    writer.key("transactionId");
+    write_json(writer, k.transactionId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CostUpdatedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedRequest written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedRequest& k) {
@@ -69,6 +82,15 @@ void from_json(const json& j, CostUpdatedResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CostUpdatedResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CostUpdatedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedResponse written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedResponse& k) {
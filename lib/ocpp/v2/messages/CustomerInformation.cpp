@@ -60,6 +60,33 @@ void from_json(const json& j, CustomerInformationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CustomerInformationRequest& k) {
+    writer.start_object();
+    writer.key("clear");
+    write_json(writer, k.clear);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.customerCertificate) {
+        writer.key("customerCertificate");
+        write_json(writer, k.customerCertificate.value());
+    }
+    if (k.customerIdentifier) {
+        writer.key("customerIdentifier");
+        write_json(writer, k.customerIdentifier.value());
+    }
+    if (k.idToken) {
+        writer.key("idToken");
+        write_json(writer, k.idToken.value());
+    }
+    writer.key("report");
+    write_json(writer, k.report);
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CustomerInformationRequest \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationRequest& k) {
@@ -98,6 +125,21 @@ void from_json(const json& j, CustomerInformationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CustomerInformationResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::customer_information_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CustomerInformationResponse \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationResponse& k) {
@@ -50,6 +50,25 @@ void from_json(const json& j, DataTransferRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DataTransferRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.data) {
+        writer.key("data");
+        write_json(writer, k.data.value());
+    }
+    if (k.messageId) {
+        writer.key("messageId");
+        write_json(writer, k.messageId.value());
+    }
+    writer.key("vendorId");
+    write_json(writer, k.vendorId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DataTransferRequest \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferRequest written to
 std::ostream& operator<<(std::ostream& os, const DataTransferRequest& k) {
@@ -94,6 +113,25 @@ void from_json(const json& j, DataTransferResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DataTransferResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.data) {
+        writer.key("data");
+        write_json(writer, k.data.value());
+    }
+    writer.key("status");
+    writer.value(conversions::data_transfer_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DataTransferResponse \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferResponse written to
 std::ostream& operator<<(std::ostream& os, const DataTransferResponse& k) {
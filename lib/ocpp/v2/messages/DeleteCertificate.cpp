@@ -38,6 +38,17 @@ void from_json(const json& j, DeleteCertificateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DeleteCertificateRequest& k) {
+    writer.start_object();
+    writer.key("certificateHashData");
+    write_json(writer, k.certificateHashData);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DeleteCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateRequest& k) {
@@ -76,6 +87,21 @@ void from_json(const json& j, DeleteCertificateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DeleteCertificateResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::delete_certificate_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DeleteCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateResponse& k) {
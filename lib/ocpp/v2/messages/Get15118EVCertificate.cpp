@@ -42,6 +42,21 @@ void from_json(const json& j, Get15118EVCertificateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const Get15118EVCertificateRequest& k) {
+    writer.start_object();
+    writer.key("action");
+    writer.value(conversions::certificate_action_enum_to_string(k.action));
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("exiRequest");
+    write_json(writer, k.exiRequest);
+    writer.key("iso15118SchemaVersion");
+    write_json(writer, k.iso15118SchemaVersion);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given Get15118EVCertificateRequest \p k to the given output stream \p
 /// os \returns an output stream with the Get15118EVCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateRequest& k) {
@@ -82,6 +97,23 @@ void from_json(const json& j, Get15118EVCertificateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const Get15118EVCertificateResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("exiResponse");
+    write_json(writer, k.exiResponse);
+    writer.key("status");
+    writer.value(conversions::iso15118evcertificate_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given Get15118EVCertificateResponse \p k to the given output stream
 /// \p os \returns an output stream with the Get15118EVCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateResponse& k) {
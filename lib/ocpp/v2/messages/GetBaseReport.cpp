@@ -40,6 +40,19 @@ void from_json(const json& j, GetBaseReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetBaseReportRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("reportBase");
+    writer.value(conversions::report_base_enum_to_string(k.reportBase));
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetBaseReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportRequest& k) {
@@ -78,6 +91,21 @@ void from_json(const json& j, GetBaseReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetBaseReportResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_device_model_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetBaseReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportResponse& k) {
@@ -38,6 +38,17 @@ void from_json(const json& j, GetCertificateStatusRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCertificateStatusRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("ocspRequestData");
+    write_json(writer, k.ocspRequestData);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetCertificateStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusRequest& k) {
@@ -82,6 +93,25 @@ void from_json(const json& j, GetCertificateStatusResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCertificateStatusResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.ocspResult) {
+        writer.key("ocspResult");
+        write_json(writer, k.ocspResult.value());
+    }
+    writer.key("status");
+    writer.value(conversions::get_certificate_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetCertificateStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusResponse& k) {
@@ -46,6 +46,23 @@ void from_json(const json& j, GetChargingProfilesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetChargingProfilesRequest& k) {
+    writer.start_object();
+    writer.key("chargingProfile");
+    write_json(writer, k.chargingProfile);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        write_json(writer, k.evseId.value());
+    }
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetChargingProfilesRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesRequest& k) {
@@ -84,6 +101,21 @@ void from_json(const json& j, GetChargingProfilesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetChargingProfilesResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::get_charging_profile_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetChargingProfilesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesResponse& k) {
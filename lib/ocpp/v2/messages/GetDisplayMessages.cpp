@@ -64,6 +64,29 @@ void from_json(const json& j, GetDisplayMessagesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDisplayMessagesRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.id) {
+        writer.key("id");
+        write_json(writer, k.id.value());
+    }
+    if (k.priority) {
+        writer.key("priority");
+        writer.value(conversions::message_priority_enum_to_string(k.priority.value()));
+    }
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    if (k.state) {
+        writer.key("state");
+        writer.value(conversions::message_state_enum_to_string(k.state.value()));
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetDisplayMessagesRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetDisplayMessagesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesRequest& k) {
@@ -102,6 +125,21 @@ void from_json(const json& j, GetDisplayMessagesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDisplayMessagesResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::get_display_messages_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetDisplayMessagesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesResponse& k) {
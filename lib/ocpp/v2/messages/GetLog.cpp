@@ -54,6 +54,29 @@ void from_json(const json& j, GetLogRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLogRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("log");
+    write_json(writer, k.log);
+    writer.key("logType");
+    writer.value(conversions::log_enum_to_string(k.logType));
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    if (k.retries) {
+        writer.key("retries");
+        write_json(writer, k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        write_json(writer, k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetLogRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetLogRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLogRequest& k) {
@@ -98,6 +121,25 @@ void from_json(const json& j, GetLogResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLogResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.filename) {
+        writer.key("filename");
+        write_json(writer, k.filename.value());
+    }
+    writer.key("status");
+    writer.value(conversions::log_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetLogResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetLogResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLogResponse& k) {
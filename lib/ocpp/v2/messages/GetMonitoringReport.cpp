@@ -66,6 +66,29 @@ void from_json(const json& j, GetMonitoringReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetMonitoringReportRequest& k) {
+    writer.start_object();
+    if (k.componentVariable) {
+        writer.key("componentVariable");
+        write_json(writer, k.componentVariable.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.monitoringCriteria) {
+        writer.key("monitoringCriteria");
+        writer.start_array();
+        for (const auto& val : k.monitoringCriteria.value()) {
+            writer.value(conversions::monitoring_criterion_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetMonitoringReportRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportRequest& k) {
@@ -104,6 +127,21 @@ void from_json(const json& j, GetMonitoringReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetMonitoringReportResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_device_model_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetMonitoringReportResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportResponse& k) {
@@ -66,6 +66,29 @@ void from_json(const json& j, GetReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetReportRequest& k) {
+    writer.start_object();
+    if (k.componentCriteria) {
+        writer.key("componentCriteria");
+        writer.start_array();
+        for (const auto& val : k.componentCriteria.value()) {
+            writer.value(conversions::component_criterion_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    if (k.componentVariable) {
+        writer.key("componentVariable");
+        write_json(writer, k.componentVariable.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetReportRequest& k) {
@@ -104,6 +127,21 @@ void from_json(const json& j, GetReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetReportResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_device_model_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetReportResponse& k) {
@@ -41,6 +41,19 @@ void from_json(const json& j, GetTransactionStatusRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetTransactionStatusRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.transactionId) {
+        writer.key("transactionId");
+        write_json(writer, k.transactionId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetTransactionStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusRequest& k) {
@@ -79,6 +92,21 @@ void from_json(const json& j, GetTransactionStatusResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetTransactionStatusResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("messagesInQueue");
+    write_json(writer, k.messagesInQueue);
+    if (k.ongoingIndicator) {
+        writer.key("ongoingIndicator");
+        write_json(writer, k.ongoingIndicator.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetTransactionStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusResponse& k) {
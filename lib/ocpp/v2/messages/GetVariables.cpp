@@ -40,6 +40,17 @@ void from_json(const json& j, GetVariablesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetVariablesRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("getVariableData");
+    write_json(writer, k.getVariableData);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesRequest& k) {
@@ -74,6 +85,17 @@ void from_json(const json& j, GetVariablesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetVariablesResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("getVariableResult");
+    write_json(writer, k.getVariableResult);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesResponse& k) {
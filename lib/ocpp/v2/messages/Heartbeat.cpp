@@ -35,6 +35,15 @@ void from_json(const json& j, HeartbeatRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const HeartbeatRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given HeartbeatRequest \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatRequest written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatRequest& k) {
@@ -67,6 +76,17 @@ void from_json(const json& j, HeartbeatResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const HeartbeatResponse& k) {
+    writer.start_object();
+    writer.key("currentTime");
+    write_json(writer, k.currentTime);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given HeartbeatResponse \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatResponse written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatResponse& k) {
@@ -40,6 +40,19 @@ void from_json(const json& j, InstallCertificateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k) {
+    writer.start_object();
+    writer.key("certificate");
+    write_json(writer, k.certificate);
+    writer.key("certificateType");
+    writer.value(conversions::install_certificate_use_enum_to_string(k.certificateType));
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given InstallCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the InstallCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateRequest& k) {
@@ -78,6 +91,21 @@ void from_json(const json& j, InstallCertificateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::install_certificate_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given InstallCertificateResponse \p k to the given output stream \p
 /// os \returns an output stream with the InstallCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateResponse& k) {
@@ -58,6 +58,25 @@ void from_json(const json& j, NotifyChargingLimitRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyChargingLimitRequest& k) {
+    writer.start_object();
+    writer.key("chargingLimit");
+    write_json(writer, k.chargingLimit);
+    if (k.chargingSchedule) {
+        writer.key("chargingSchedule");
+        write_json(writer, k.chargingSchedule.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        write_json(writer, k.evseId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitRequest& k) {
@@ -87,6 +106,15 @@ void from_json(const json& j, NotifyChargingLimitResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyChargingLimitResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitResponse& k) {
@@ -50,6 +50,27 @@ void from_json(const json& j, NotifyCustomerInformationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyCustomerInformationRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("data");
+    write_json(writer, k.data);
+    writer.key("generatedAt");
+    write_json(writer, k.generatedAt);
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    writer.key("seqNo");
+    write_json(writer, k.seqNo);
+    if (k.tbc) {
+        writer.key("tbc");
+        write_json(writer, k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationRequest \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationRequest& k) {
@@ -79,6 +100,15 @@ void from_json(const json& j, NotifyCustomerInformationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyCustomerInformationResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationResponse& k) {
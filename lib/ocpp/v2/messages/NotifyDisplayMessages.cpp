@@ -58,6 +58,25 @@ void from_json(const json& j, NotifyDisplayMessagesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.messageInfo) {
+        writer.key("messageInfo");
+        write_json(writer, k.messageInfo.value());
+    }
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    if (k.tbc) {
+        writer.key("tbc");
+        write_json(writer, k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyDisplayMessagesRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesRequest& k) {
@@ -87,6 +106,15 @@ void from_json(const json& j, NotifyDisplayMessagesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesResponse& k) {
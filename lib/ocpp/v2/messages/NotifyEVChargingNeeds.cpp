@@ -46,6 +46,23 @@ void from_json(const json& j, NotifyEVChargingNeedsRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsRequest& k) {
+    writer.start_object();
+    writer.key("chargingNeeds");
+    write_json(writer, k.chargingNeeds);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("evseId");
+    write_json(writer, k.evseId);
+    if (k.maxScheduleTuples) {
+        writer.key("maxScheduleTuples");
+        write_json(writer, k.maxScheduleTuples.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyEVChargingNeedsRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsRequest& k) {
@@ -84,6 +101,21 @@ void from_json(const json& j, NotifyEVChargingNeedsResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::notify_evcharging_needs_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingNeedsResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsResponse& k) {
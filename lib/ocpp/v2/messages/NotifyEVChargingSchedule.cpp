@@ -42,6 +42,21 @@ void from_json(const json& j, NotifyEVChargingScheduleRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleRequest& k) {
+    writer.start_object();
+    writer.key("chargingSchedule");
+    write_json(writer, k.chargingSchedule);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("evseId");
+    write_json(writer, k.evseId);
+    writer.key("timeBase");
+    write_json(writer, k.timeBase);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleRequest& k) {
@@ -80,6 +95,21 @@ void from_json(const json& j, NotifyEVChargingScheduleResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyEVChargingScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleResponse& k) {
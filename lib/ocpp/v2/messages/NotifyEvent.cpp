@@ -50,6 +50,25 @@ void from_json(const json& j, NotifyEventRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEventRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("eventData");
+    write_json(writer, k.eventData);
+    writer.key("generatedAt");
+    write_json(writer, k.generatedAt);
+    writer.key("seqNo");
+    write_json(writer, k.seqNo);
+    if (k.tbc) {
+        writer.key("tbc");
+        write_json(writer, k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventRequest& k) {
@@ -79,6 +98,15 @@ void from_json(const json& j, NotifyEventResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEventResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventResponse& k) {
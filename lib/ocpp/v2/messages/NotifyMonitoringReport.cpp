@@ -62,6 +62,29 @@ void from_json(const json& j, NotifyMonitoringReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyMonitoringReportRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("generatedAt");
+    write_json(writer, k.generatedAt);
+    if (k.monitor) {
+        writer.key("monitor");
+        write_json(writer, k.monitor.value());
+    }
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    writer.key("seqNo");
+    write_json(writer, k.seqNo);
+    if (k.tbc) {
+        writer.key("tbc");
+        write_json(writer, k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportRequest& k) {
@@ -91,6 +114,15 @@ void from_json(const json& j, NotifyMonitoringReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyMonitoringReportResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportResponse& k) {
@@ -62,6 +62,29 @@ void from_json(const json& j, NotifyReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyReportRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("generatedAt");
+    write_json(writer, k.generatedAt);
+    if (k.reportData) {
+        writer.key("reportData");
+        write_json(writer, k.reportData.value());
+    }
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    writer.key("seqNo");
+    write_json(writer, k.seqNo);
+    if (k.tbc) {
+        writer.key("tbc");
+        write_json(writer, k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportRequest& k) {
@@ -91,6 +114,15 @@ void from_json(const json& j, NotifyReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyReportResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportResponse& k) {
@@ -54,6 +54,29 @@ void from_json(const json& j, PublishFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareRequest& k) {
+    writer.start_object();
+    writer.key("checksum");
+    write_json(writer, k.checksum);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("location");
+    write_json(writer, k.location);
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    if (k.retries) {
+        writer.key("retries");
+        write_json(writer, k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        write_json(writer, k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareRequest& k) {
@@ -92,6 +115,21 @@ void from_json(const json& j, PublishFirmwareResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareResponse& k) {
@@ -58,6 +58,25 @@ void from_json(const json& j, PublishFirmwareStatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.location) {
+        writer.key("location");
+        write_json(writer, k.location.value());
+    }
+    if (k.requestId) {
+        writer.key("requestId");
+        write_json(writer, k.requestId.value());
+    }
+    writer.key("status");
+    writer.value(conversions::publish_firmware_status_enum_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationRequest \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationRequest& k) {
@@ -87,6 +106,15 @@ void from_json(const json& j, PublishFirmwareStatusNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationResponse \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationResponse& k) {
@@ -52,6 +52,27 @@ void from_json(const json& j, ReportChargingProfilesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReportChargingProfilesRequest& k) {
+    writer.start_object();
+    writer.key("chargingLimitSource");
+    writer.value(conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    writer.key("chargingProfile");
+    write_json(writer, k.chargingProfile);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("evseId");
+    write_json(writer, k.evseId);
+    writer.key("requestId");
+    write_json(writer, k.requestId);
+    if (k.tbc) {
+        writer.key("tbc");
+        write_json(writer, k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReportChargingProfilesRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesRequest& k) {
@@ -81,6 +102,15 @@ void from_json(const json& j, ReportChargingProfilesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReportChargingProfilesResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReportChargingProfilesResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesResponse& k) {
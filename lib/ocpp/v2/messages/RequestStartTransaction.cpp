@@ -58,6 +58,31 @@ void from_json(const json& j, RequestStartTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStartTransactionRequest& k) {
+    writer.start_object();
+    if (k.chargingProfile) {
+        writer.key("chargingProfile");
+        write_json(writer, k.chargingProfile.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        write_json(writer, k.evseId.value());
+    }
+    if (k.groupIdToken) {
+        writer.key("groupIdToken");
+        write_json(writer, k.groupIdToken.value());
+    }
+    writer.key("idToken");
+    write_json(writer, k.idToken);
+    writer.key("remoteStartId");
+    write_json(writer, k.remoteStartId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RequestStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionRequest& k) {
@@ -102,6 +127,25 @@ void from_json(const json& j, RequestStartTransactionResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStartTransactionResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::request_start_stop_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    if (k.transactionId) {
+        writer.key("transactionId");
+        write_json(writer, k.transactionId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RequestStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionResponse& k) {
@@ -38,6 +38,17 @@ void from_json(const json& j, RequestStopTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStopTransactionRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("transactionId");
+    write_json(writer, k.transactionId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RequestStopTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionRequest& k) {
@@ -76,6 +87,21 @@ void from_json(const json& j, RequestStopTransactionResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStopTransactionResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::request_start_stop_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RequestStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionResponse& k) {
@@ -40,6 +40,19 @@ void from_json(const json& j, ReservationStatusUpdateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReservationStatusUpdateRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("reservationId");
+    write_json(writer, k.reservationId);
+    writer.key("reservationUpdateStatus");
+    writer.value(conversions::reservation_update_status_enum_to_string(k.reservationUpdateStatus));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateRequest written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateRequest& k) {
@@ -69,6 +82,15 @@ void from_json(const json& j, ReservationStatusUpdateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReservationStatusUpdateResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateResponse written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateResponse& k) {
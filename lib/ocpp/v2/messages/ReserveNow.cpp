@@ -60,6 +60,33 @@ void from_json(const json& j, ReserveNowRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReserveNowRequest& k) {
+    writer.start_object();
+    if (k.connectorType) {
+        writer.key("connectorType");
+        writer.value(conversions::connector_enum_to_string(k.connectorType.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        write_json(writer, k.evseId.value());
+    }
+    writer.key("expiryDateTime");
+    write_json(writer, k.expiryDateTime);
+    if (k.groupIdToken) {
+        writer.key("groupIdToken");
+        write_json(writer, k.groupIdToken.value());
+    }
+    writer.key("id");
+    write_json(writer, k.id);
+    writer.key("idToken");
+    write_json(writer, k.idToken);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReserveNowRequest \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowRequest written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowRequest& k) {
@@ -98,6 +125,21 @@ void from_json(const json& j, ReserveNowResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReserveNowResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::reserve_now_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReserveNowResponse \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowResponse written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowResponse& k) {
@@ -54,6 +54,23 @@ void from_json(const json& j, SendLocalListRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SendLocalListRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.localAuthorizationList) {
+        writer.key("localAuthorizationList");
+        write_json(writer, k.localAuthorizationList.value());
+    }
+    writer.key("updateType");
+    writer.value(conversions::update_enum_to_string(k.updateType));
+    writer.key("versionNumber");
+    write_json(writer, k.versionNumber);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SendLocalListRequest \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListRequest written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListRequest& k) {
@@ -92,6 +109,21 @@ void from_json(const json& j, SendLocalListResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SendLocalListResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::send_local_list_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SendLocalListResponse \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListResponse written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListResponse& k) {
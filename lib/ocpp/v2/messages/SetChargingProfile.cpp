@@ -40,6 +40,19 @@ void from_json(const json& j, SetChargingProfileRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k) {
+    writer.start_object();
+    writer.key("chargingProfile");
+    write_json(writer, k.chargingProfile);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("evseId");
+    write_json(writer, k.evseId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileRequest& k) {
@@ -78,6 +91,21 @@ void from_json(const json& j, SetChargingProfileResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::charging_profile_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileResponse& k) {
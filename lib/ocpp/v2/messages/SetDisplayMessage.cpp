@@ -38,6 +38,17 @@ void from_json(const json& j, SetDisplayMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetDisplayMessageRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("message");
+    write_json(writer, k.message);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetDisplayMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageRequest& k) {
@@ -76,6 +87,21 @@ void from_json(const json& j, SetDisplayMessageResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetDisplayMessageResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::display_message_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetDisplayMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageResponse& k) {
@@ -38,6 +38,17 @@ void from_json(const json& j, SetMonitoringBaseRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringBaseRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("monitoringBase");
+    writer.value(conversions::monitoring_base_enum_to_string(k.monitoringBase));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetMonitoringBaseRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseRequest& k) {
@@ -76,6 +87,21 @@ void from_json(const json& j, SetMonitoringBaseResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringBaseResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_device_model_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetMonitoringBaseResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseResponse& k) {
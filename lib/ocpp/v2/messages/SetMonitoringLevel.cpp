@@ -38,6 +38,17 @@ void from_json(const json& j, SetMonitoringLevelRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringLevelRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("severity");
+    write_json(writer, k.severity);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetMonitoringLevelRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringLevelRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelRequest& k) {
@@ -76,6 +87,21 @@ void from_json(const json& j, SetMonitoringLevelResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringLevelResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetMonitoringLevelResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetMonitoringLevelResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelResponse& k) {
@@ -40,6 +40,19 @@ void from_json(const json& j, SetNetworkProfileRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetNetworkProfileRequest& k) {
+    writer.start_object();
+    writer.key("configurationSlot");
+    write_json(writer, k.configurationSlot);
+    writer.key("connectionData");
+    write_json(writer, k.connectionData);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetNetworkProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileRequest& k) {
@@ -78,6 +91,21 @@ void from_json(const json& j, SetNetworkProfileResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetNetworkProfileResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::set_network_profile_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetNetworkProfileResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileResponse& k) {
@@ -40,6 +40,17 @@ void from_json(const json& j, SetVariableMonitoringRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariableMonitoringRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("setMonitoringData");
+    write_json(writer, k.setMonitoringData);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetVariableMonitoringRequest \p k to the given output stream \p
 /// os \returns an output stream with the SetVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringRequest& k) {
@@ -74,6 +85,17 @@ void from_json(const json& j, SetVariableMonitoringResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariableMonitoringResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("setMonitoringResult");
+    write_json(writer, k.setMonitoringResult);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the SetVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringResponse& k) {
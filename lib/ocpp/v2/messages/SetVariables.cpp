@@ -40,6 +40,17 @@ void from_json(const json& j, SetVariablesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariablesRequest& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("setVariableData");
+    write_json(writer, k.setVariableData);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesRequest& k) {
@@ -74,6 +85,17 @@ void from_json(const json& j, SetVariablesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariablesResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("setVariableResult");
+    write_json(writer, k.setVariableResult);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesResponse& k) {
@@ -44,6 +44,21 @@ void from_json(const json& j, SignCertificateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SignCertificateRequest& k) {
+    writer.start_object();
+    if (k.certificateType) {
+        writer.key("certificateType");
+        writer.value(conversions::certificate_signing_use_enum_to_string(k.certificateType.value()));
+    }
+    writer.key("csr");
+    write_json(writer, k.csr);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateRequest& k) {
@@ -82,6 +97,21 @@ void from_json(const json& j, SignCertificateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SignCertificateResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateResponse& k) {
@@ -96,6 +96,53 @@ void from_json(const json& j, TransactionEventRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TransactionEventRequest& k) {
+    writer.start_object();
+    if (k.cableMaxCurrent) {
+        writer.key("cableMaxCurrent");
+        write_json(writer, k.cableMaxCurrent.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("eventType");
+    writer.value(conversions::transaction_event_enum_to_string(k.eventType));
+    if (k.evse) {
+        writer.key("evse");
+        write_json(writer, k.evse.value());
+    }
+    if (k.idToken) {
+        writer.key("idToken");
+        write_json(writer, k.idToken.value());
+    }
+    if (k.meterValue) {
+        writer.key("meterValue");
+        write_json(writer, k.meterValue.value());
+    }
+    if (k.numberOfPhasesUsed) {
+        writer.key("numberOfPhasesUsed");
+        write_json(writer, k.numberOfPhasesUsed.value());
+    }
+    if (k.offline) {
+        writer.key("offline");
+        write_json(writer, k.offline.value());
+    }
+    if (k.reservationId) {
+        writer.key("reservationId");
+        write_json(writer, k.reservationId.value());
+    }
+    writer.key("seqNo");
+    write_json(writer, k.seqNo);
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    writer.key("transactionInfo");
+    write_json(writer, k.transactionInfo);
+    writer.key("triggerReason");
+    writer.value(conversions::trigger_reason_enum_to_string(k.triggerReason));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given TransactionEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventRequest written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventRequest& k) {
@@ -149,6 +196,31 @@ void from_json(const json& j, TransactionEventResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TransactionEventResponse& k) {
+    writer.start_object();
+    if (k.chargingPriority) {
+        writer.key("chargingPriority");
+        write_json(writer, k.chargingPriority.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.idTokenInfo) {
+        writer.key("idTokenInfo");
+        write_json(writer, k.idTokenInfo.value());
+    }
+    if (k.totalCost) {
+        writer.key("totalCost");
+        write_json(writer, k.totalCost.value());
+    }
+    if (k.updatedPersonalMessage) {
+        writer.key("updatedPersonalMessage");
+        write_json(writer, k.updatedPersonalMessage.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given TransactionEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventResponse written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventResponse& k) {
@@ -38,6 +38,17 @@ void from_json(const json& j, UnpublishFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UnpublishFirmwareRequest& k) {
+    writer.start_object();
+    writer.key("checksum");
+    write_json(writer, k.checksum);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UnpublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareRequest& k) {
@@ -70,6 +81,17 @@ void from_json(const json& j, UnpublishFirmwareResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UnpublishFirmwareResponse& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::unpublish_firmware_status_enum_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UnpublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareResponse& k) {
@@ -3,44 +3,59 @@
 
 #include <ocpp/v2/monitoring_updater.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 
 #include <ocpp/v2/ctrlr_component_variables.hpp>
-#include <ocpp/v2/device_model.hpp>
 #include <ocpp/v2/utils.hpp>
 
 namespace ocpp::v2 {
 
-template <DataEnum T>
-bool triggers_monitor(const VariableMonitoringMeta& monitor_meta, const std::string& value_old,
-                      const std::string& value_new) {
-    if constexpr (T == DataEnum::boolean) {
-        return (value_old != value_new);
-    } else {
-        auto raw_val_current = to_specific_type_auto<T>(value_new);
+bool is_numeric_data_type(DataEnum data_type) {
+    return (data_type == DataEnum::decimal) || (data_type == DataEnum::integer);
+}
 
-        if (monitor_meta.monitor.type == MonitorEnum::Delta) {
-            if (monitor_meta.reference_value.has_value()) {
-                auto raw_val_reference = to_specific_type_auto<T>(monitor_meta.reference_value.value());
-                auto delta = std::abs(raw_val_reference - raw_val_current);
+double to_double(const NumericValue& value) {
+    return std::visit([](const auto numeric_value) { return static_cast<double>(numeric_value); }, value);
+}
 
-                return (delta > monitor_meta.monitor.value);
-            } else {
-                EVLOG_error << "Invalid reference value for monitor: " << monitor_meta.monitor;
-                return false;
-            }
-        } else if (monitor_meta.monitor.type == MonitorEnum::LowerThreshold) {
-            return (raw_val_current < monitor_meta.monitor.value);
-        } else if (monitor_meta.monitor.type == MonitorEnum::UpperThreshold) {
-            return (raw_val_current > monitor_meta.monitor.value);
+/// \brief Returns the absolute difference of \p a and \p b. The difference of two integers is computed exactly, so that
+/// deltas of large integer values are not lost
+double get_numeric_distance(const NumericValue& a, const NumericValue& b) {
+    if (std::holds_alternative<std::int64_t>(a) and std::holds_alternative<std::int64_t>(b)) {
+        const auto a_value = std::get<std::int64_t>(a);
+        const auto b_value = std::get<std::int64_t>(b);
+
+        // Computed unsigned, so that the difference of values with different signs does not overflow
+        const auto distance = static_cast<std::uint64_t>(std::max(a_value, b_value)) -
+                              static_cast<std::uint64_t>(std::min(a_value, b_value));
+        return static_cast<double>(distance);
+    }
+
+    return std::abs(to_double(a) - to_double(b));
+}
+
+bool triggers_numeric_monitor(const VariableMonitoringMeta& monitor_meta, const NumericValue& value_current,
+                              const std::optional<NumericValue>& value_reference) {
+    if (monitor_meta.monitor.type == MonitorEnum::Delta) {
+        if (value_reference.has_value()) {
+            auto delta = get_numeric_distance(value_reference.value(), value_current);
+
+            return (delta > monitor_meta.monitor.value);
         } else {
-            EVLOG_error << "Requested unsupported trigger monitor of type: "
-                        << conversions::monitor_enum_to_string(monitor_meta.monitor.type);
+            EVLOG_error << "Invalid reference value for monitor: " << monitor_meta.monitor;
             return false;
         }
+    } else if (monitor_meta.monitor.type == MonitorEnum::LowerThreshold) {
+        return (to_double(value_current) < monitor_meta.monitor.value);
+    } else if (monitor_meta.monitor.type == MonitorEnum::UpperThreshold) {
+        return (to_double(value_current) > monitor_meta.monitor.value);
+    } else {
+        EVLOG_error << "Requested unsupported trigger monitor of type: "
+                    << conversions::monitor_enum_to_string(monitor_meta.monitor.type);
+        return false;
     }
-
-    return false;
 }
 
 bool is_monitor_active(MonitoringBaseEnum active_monitoring_base, const VariableMonitoringMeta& monitor_meta) {
@@ -64,11 +79,13 @@ bool is_monitor_active(MonitoringBaseEnum active_monitoring_base, const Variable
     return true;
 }
 
-std::chrono::time_point<std::chrono::system_clock> get_next_clock_aligned_point(float monitor_interval) {
+/// \brief Returns the first clock aligned point of the \p monitor_interval at or after the second of \p sys_time_now
+std::chrono::time_point<std::chrono::system_clock>
+get_next_clock_aligned_point(float monitor_interval,
+                             std::chrono::system_clock::time_point sys_time_now = std::chrono::system_clock::now()) {
     auto monitor_seconds =
         std::chrono::duration_cast<std::chrono::seconds>(std::chrono::duration<float>(monitor_interval));
 
-    auto sys_time_now = std::chrono::system_clock::now();
     auto hours_now = std::chrono::floor<std::chrono::hours>(sys_time_now);
     auto seconds_now = std::chrono::duration_cast<std::chrono::seconds>(sys_time_now - hours_now);
 
@@ -149,7 +166,7 @@ void MonitoringUpdater::start_monitoring() {
     // Bind function to this instance
     auto fn = std::bind(&MonitoringUpdater::on_variable_changed, this, std::placeholders::_1, std::placeholders::_2,
                         std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6,
-                        std::placeholders::_7);
+                        std::placeholders::_7, std::placeholders::_8);
     device_model.register_variable_listener(std::move(fn));
 
     auto fn_monitor =
@@ -157,6 +174,11 @@ void MonitoringUpdater::start_monitoring() {
                   std::placeholders::_3, std::placeholders::_4, std::placeholders::_5, std::placeholders::_6);
     device_model.register_monitor_listener(std::move(fn_monitor));
 
+    device_model.register_monitor_cleared_listener(
+        [this](const std::int32_t monitor_id) { this->on_monitor_cleared(monitor_id); });
+
+    this->rebuild_periodic_monitors_internal();
+
     // No point in starting the monitor if this variable does not exist. It will never start to exist later on.
     if (this->device_model.get_optional_value<bool>(ControllerComponentVariables::MonitoringCtrlrEnabled)
             .value_or(false)) {
@@ -182,6 +204,15 @@ void MonitoringUpdater::process_triggered_monitors() {
 void MonitoringUpdater::on_monitor_updated(const VariableMonitoringMeta& updated_monitor, const Component& component,
                                            const Variable& variable, const VariableCharacteristics& characteristics,
                                            const VariableAttribute& attribute, const std::string& current_value) {
+    if (updated_monitor.monitor.type == MonitorEnum::Periodic or
+        updated_monitor.monitor.type == MonitorEnum::PeriodicClockAligned) {
+        std::lock_guard<std::mutex> lk(this->periodic_monitors_mutex);
+        this->add_periodic_monitor_internal(updated_monitor, component, variable);
+    } else {
+        // The monitor could have been a periodic one before the update
+        this->on_monitor_cleared(updated_monitor.monitor.id);
+    }
+
     auto it = updater_monitors_meta.find(updated_monitor.monitor.id);
 
     // Not contained, ignored
@@ -200,14 +231,54 @@ void MonitoringUpdater::on_monitor_updated(const VariableMonitoringMeta& updated
         updated_monitor.monitor.type == MonitorEnum::UpperThreshold) {
         // Re-evaluate the monitor
         evaluate_monitor(updated_monitor, component, variable, characteristics, attribute, current_value,
-                         current_value);
+                         current_value, parse_numeric_value(characteristics.dataType, current_value));
+    }
+}
+
+void MonitoringUpdater::on_monitor_cleared(const std::int32_t monitor_id) {
+    {
+        std::lock_guard<std::mutex> lk(this->delta_references_mutex);
+        this->delta_references.erase(monitor_id);
+    }
+
+    std::lock_guard<std::mutex> lk(this->periodic_monitors_mutex);
+
+    // The stale entry in the schedule is skipped once it is popped
+    this->periodic_monitors_meta.erase(monitor_id);
+    this->periodic_monitors_pending.erase(monitor_id);
+}
+
+std::optional<NumericValue> MonitoringUpdater::get_delta_reference(const VariableMonitoringMeta& monitor_meta,
+                                                                   DataEnum data_type) {
+    if (!monitor_meta.reference_value.has_value()) {
+        return std::nullopt;
+    }
+
+    const auto& reference_value = monitor_meta.reference_value.value();
+
+    std::lock_guard<std::mutex> lk(this->delta_references_mutex);
+    auto it = this->delta_references.find(monitor_meta.monitor.id);
+
+    // Only parse the reference again if it was changed
+    if (it != std::end(this->delta_references) && it->second.reference_value == reference_value) {
+        return it->second.value;
+    }
+
+    const auto value = parse_numeric_value(data_type, reference_value);
+    if (!value.has_value()) {
+        EVLOG_error << "Invalid reference value: [" << reference_value << "] for monitor: " << monitor_meta.monitor;
+        return std::nullopt;
     }
+
+    this->delta_references[monitor_meta.monitor.id] = {reference_value, value.value()};
+    return value;
 }
 
 void MonitoringUpdater::evaluate_monitor(const VariableMonitoringMeta& monitor_meta, const Component& component,
                                          const Variable& variable, const VariableCharacteristics& characteristics,
                                          const VariableAttribute& attribute, const std::string& value_previous,
-                                         const std::string& value_current) {
+                                         const std::string& value_current,
+                                         const std::optional<NumericValue>& value_current_numeric) {
     // Don't care about periodic
     if (monitor_meta.monitor.type == MonitorEnum::Periodic or
         monitor_meta.monitor.type == MonitorEnum::PeriodicClockAligned) {
@@ -222,12 +293,21 @@ void MonitoringUpdater::evaluate_monitor(const VariableMonitoringMeta& monitor_m
     if ((characteristics.dataType == DataEnum::boolean) || (characteristics.dataType == DataEnum::string) ||
         (characteristics.dataType == DataEnum::dateTime) || (characteristics.dataType == DataEnum::OptionList) ||
         (characteristics.dataType == DataEnum::MemberList) || (characteristics.dataType == DataEnum::SequenceList)) {
-        monitor_triggered = triggers_monitor<DataEnum::boolean>(monitor_meta, value_previous, value_current);
+        monitor_triggered = (value_previous != value_current);
         monitor_trivial = true;
-    } else if (characteristics.dataType == DataEnum::decimal) {
-        monitor_triggered = triggers_monitor<DataEnum::decimal>(monitor_meta, value_previous, value_current);
-    } else if (characteristics.dataType == DataEnum::integer) {
-        monitor_triggered = triggers_monitor<DataEnum::integer>(monitor_meta, value_previous, value_current);
+    } else if (is_numeric_data_type(characteristics.dataType)) {
+        if (!value_current_numeric.has_value()) {
+            EVLOG_error << "Could not convert value: [" << value_current << "] of variable: " << variable.name.get()
+                        << " to a number, monitor: " << monitor_meta.monitor << " is not evaluated";
+            return;
+        }
+
+        std::optional<NumericValue> value_reference;
+        if (monitor_meta.monitor.type == MonitorEnum::Delta) {
+            value_reference = get_delta_reference(monitor_meta, characteristics.dataType);
+        }
+
+        monitor_triggered = triggers_numeric_monitor(monitor_meta, value_current_numeric.value(), value_reference);
     } else {
         EVLOG_error << "Requested unsupported 'DataEnum' type: "
                     << conversions::data_enum_to_string(characteristics.dataType);
@@ -343,7 +423,8 @@ void MonitoringUpdater::on_variable_changed(const std::unordered_map<int64_t, Va
                                             const Component& component, const Variable& variable,
                                             const VariableCharacteristics& characteristics,
                                             const VariableAttribute& attribute, const std::string& value_previous,
-                                            const std::string& value_current) {
+                                            const std::string& value_current,
+                                            const std::optional<NumericValue>& value_current_numeric) {
     EVLOG_debug << "Variable: " << variable.name.get() << " changed value from: [" << value_previous << "] to: ["
                 << value_current << "]";
 
@@ -355,85 +436,109 @@ void MonitoringUpdater::on_variable_changed(const std::unordered_map<int64_t, Va
     // Iterate monitors and search for a triggered monitor
     for (const auto& [monitor_id, monitor_meta] : monitors) {
         // Evaluate the monitor
-        evaluate_monitor(monitor_meta, component, variable, characteristics, attribute, value_previous, value_current);
+        evaluate_monitor(monitor_meta, component, variable, characteristics, attribute, value_previous, value_current,
+                         value_current_numeric);
     }
 }
 
-void MonitoringUpdater::update_periodic_monitors_internal() {
-    // Update the list of periodic monitors
-    auto periodic_monitors = this->device_model.get_periodic_monitors();
+void MonitoringUpdater::rebuild_periodic_monitors_internal() {
+    std::lock_guard<std::mutex> lk(this->periodic_monitors_mutex);
 
-    for (auto& component_variable_monitors : periodic_monitors) {
-        for (auto& periodic_monitor_meta : component_variable_monitors.monitors) {
-            // See if we already have the local monitor
-            auto it = this->updater_monitors_meta.find(periodic_monitor_meta.monitor.id);
+    this->periodic_monitors_meta.clear();
+    this->periodic_monitors_pending.clear();
+    this->periodic_monitors_schedule = {};
 
-            if (it != std::end(this->updater_monitors_meta)) {
-                // If we already contain it inside, skip
-                continue;
-            }
+    for (const auto& component_variable_monitors : this->device_model.get_periodic_monitors()) {
+        for (const auto& periodic_monitor_meta : component_variable_monitors.monitors) {
+            this->add_periodic_monitor_internal(periodic_monitor_meta, component_variable_monitors.component,
+                                                component_variable_monitors.variable);
+        }
+    }
+}
 
-            // If it is not found, add a new entry to our managed monitor list
-            UpdaterMonitorMeta periodic_meta;
-
-            periodic_meta.type = UpdateMonitorMetaType::PERIODIC;
-            periodic_meta.monitor_id = periodic_monitor_meta.monitor.id;
-            periodic_meta.component = component_variable_monitors.component;
-            periodic_meta.variable = component_variable_monitors.variable;
-            periodic_meta.monitor_meta = periodic_monitor_meta;
-            periodic_meta.is_writeonly = 0;
-
-            if (periodic_monitor_meta.monitor.type == MonitorEnum::Periodic) {
-                // Set the trigger to the current time
-                periodic_meta.meta_periodic.last_trigger_steady = std::chrono::steady_clock::now();
-            } else if (periodic_monitor_meta.monitor.type == MonitorEnum::PeriodicClockAligned) {
-                // Snap to the closest monitor multiple
-                periodic_meta.meta_periodic.next_trigger_clock_aligned =
-                    get_next_clock_aligned_point(periodic_meta.monitor_meta.monitor.value);
-                EVLOG_debug << "First aligned timepoint for monitor ID: " << periodic_monitor_meta.monitor.id;
-            } else {
-                EVLOG_AND_THROW(std::runtime_error("Invalid type in periodic monitor list, should never happen!"));
-            }
+void MonitoringUpdater::add_periodic_monitor_internal(const VariableMonitoringMeta& monitor_meta,
+                                                      const Component& component, const Variable& variable) {
+    auto it = this->periodic_monitors_meta.find(monitor_meta.monitor.id);
 
-            auto res = this->updater_monitors_meta.insert(
-                std::pair{periodic_monitor_meta.monitor.id, std::move(periodic_meta)});
+    if (it != std::end(this->periodic_monitors_meta)) {
+        auto& periodic_meta = it->second;
+        const bool schedule_changed = (periodic_meta.monitor_meta.monitor.type != monitor_meta.monitor.type) or
+                                      (periodic_meta.monitor_meta.monitor.value != monitor_meta.monitor.value);
 
-            if (!res.second) {
-                EVLOG_warning << "Could not insert periodic monitor to internal monitor map!";
-                continue;
-            }
+        // Refresh the monitor, the schedule only has to change if the interval changed
+        periodic_meta.monitor_meta = monitor_meta;
+        if (!schedule_changed) {
+            return;
         }
+
+        this->periodic_monitors_meta.erase(it);
     }
 
-    // Remove the monitors in our list that don't exist any more in the database
-    for (auto it = std::begin(updater_monitors_meta); it != std::end(updater_monitors_meta);) {
-        std::int32_t updater_meta_id = it->first;
-        auto updater_meta_data = it->second;
+    UpdaterMonitorMeta periodic_meta;
+
+    periodic_meta.type = UpdateMonitorMetaType::PERIODIC;
+    periodic_meta.monitor_id = monitor_meta.monitor.id;
+    periodic_meta.component = component;
+    periodic_meta.variable = variable;
+    periodic_meta.monitor_meta = monitor_meta;
+    periodic_meta.is_writeonly = 0;
+
+    if (monitor_meta.monitor.type == MonitorEnum::Periodic) {
+        // Set the trigger to the current time
+        periodic_meta.meta_periodic.last_trigger_steady = std::chrono::steady_clock::now();
+    } else if (monitor_meta.monitor.type == MonitorEnum::PeriodicClockAligned) {
+        // Snap to the closest monitor multiple
+        periodic_meta.meta_periodic.next_trigger_clock_aligned =
+            get_next_clock_aligned_point(periodic_meta.monitor_meta.monitor.value);
+        EVLOG_debug << "First aligned timepoint for monitor ID: " << monitor_meta.monitor.id;
+    } else {
+        EVLOG_AND_THROW(std::runtime_error("Invalid type in periodic monitor list, should never happen!"));
+    }
 
-        // Ignore triggers
-        if (updater_meta_data.type == UpdateMonitorMetaType::TRIGGER) {
-            ++it;
-            continue;
-        }
+    auto res = this->periodic_monitors_meta.insert(std::pair{monitor_meta.monitor.id, std::move(periodic_meta)});
+
+    if (!res.second) {
+        EVLOG_warning << "Could not insert periodic monitor to internal monitor map!";
+        return;
+    }
 
-        bool found_in_new_periodics =
-            std::find_if(std::begin(periodic_monitors), std::end(periodic_monitors),
-                         [&updater_meta_id](const auto& periodic_monitor) {
-                             const auto& monitors = periodic_monitor.monitors;
+    this->schedule_periodic_monitor_internal(res.first->second);
+}
 
-                             return std::find_if(std::begin(monitors), std::end(monitors),
-                                                 [&updater_meta_id](const auto& monitor_meta) {
-                                                     return (updater_meta_id == monitor_meta.monitor.id);
-                                                 }) != std::end(monitors);
-                         }) != std::end(periodic_monitors);
+void MonitoringUpdater::schedule_periodic_monitor_internal(UpdaterMonitorMeta& updater_meta_data) {
+    const auto& monitor = updater_meta_data.monitor_meta.monitor;
+    auto& meta_periodic = updater_meta_data.meta_periodic;
 
-        // If not found, erse from our list as not being relevant
-        if (!found_in_new_periodics) {
-            it = updater_monitors_meta.erase(it);
-        } else {
-            ++it;
+    if (monitor.type == MonitorEnum::Periodic) {
+        const auto interval =
+            std::chrono::duration_cast<std::chrono::seconds>(std::chrono::duration<float>(monitor.value));
+        const auto now = std::chrono::steady_clock::now();
+
+        meta_periodic.next_trigger_steady = meta_periodic.last_trigger_steady + interval;
+
+        // A due monitor that was not triggered (e.g. because it is not active) keeps its last trigger time, schedule
+        // it from now so that it is not popped again on every processing interval
+        if (meta_periodic.next_trigger_steady <= now) {
+            meta_periodic.next_trigger_steady = now + interval;
         }
+    } else {
+        const auto now = std::chrono::system_clock::now();
+
+        // A due monitor that was not triggered keeps its aligned point, move it to the next aligned point after now
+        // so that it is not popped again on every processing interval. The aligned points are whole seconds, so the
+        // first one after now is at or after the next second
+        if (meta_periodic.next_trigger_clock_aligned <= now) {
+            meta_periodic.next_trigger_clock_aligned =
+                get_next_clock_aligned_point(monitor.value, now + std::chrono::seconds(1));
+        }
+
+        // Clock aligned monitors are due on the system clock, translate the remaining time to the steady clock
+        const auto remaining = meta_periodic.next_trigger_clock_aligned - now;
+        meta_periodic.next_trigger_steady = std::chrono::steady_clock::now() +
+                                            std::chrono::duration_cast<std::chrono::steady_clock::duration>(remaining);
     }
+
+    this->periodic_monitors_schedule.push({meta_periodic.next_trigger_steady, updater_meta_data.monitor_id});
 }
 
 void MonitoringUpdater::process_monitor_meta_internal(UpdaterMonitorMeta& updater_meta_data) {
@@ -453,7 +558,7 @@ void MonitoringUpdater::process_monitor_meta_internal(UpdaterMonitorMeta& update
             auto current_time = std::chrono::steady_clock::now();
             auto delta = current_time - updater_meta_data.meta_periodic.last_trigger_steady;
 
-            if (delta > monitor_seconds) {
+            if (delta >= monitor_seconds) {
                 // Update last time
                 updater_meta_data.meta_periodic.last_trigger_steady = current_time;
                 matches_time = true;
@@ -466,7 +571,7 @@ void MonitoringUpdater::process_monitor_meta_internal(UpdaterMonitorMeta& update
             // trigger event notices at 0, 15, 30 and 45 minutes after the hour, every hour.
             auto current_time = std::chrono::system_clock::now();
 
-            if (current_time > updater_meta_data.meta_periodic.next_trigger_clock_aligned) {
+            if (current_time >= updater_meta_data.meta_periodic.next_trigger_clock_aligned) {
                 auto distance = std::chrono::duration_cast<std::chrono::seconds>(
                                     current_time - updater_meta_data.meta_periodic.next_trigger_clock_aligned)
                                     .count();
@@ -576,21 +681,106 @@ void MonitoringUpdater::process_monitors_internal(bool allow_periodics, bool all
                 << " and triggers: " << allow_trigger;
 
     if (allow_periodics) {
-        // Rebuild the periodic monitor information
-        update_periodic_monitors_internal();
+        process_periodic_monitors_internal(is_offline, offline_severity, active_monitoring_level,
+                                           active_monitoring_base);
+    }
+
+    if (allow_trigger) {
+        process_trigger_monitors_internal(is_offline, offline_severity, active_monitoring_level,
+                                          active_monitoring_base);
+    }
+}
+
+void MonitoringUpdater::process_periodic_monitors_internal(bool is_offline, int offline_severity,
+                                                           int active_monitoring_level,
+                                                           MonitoringBaseEnum active_monitoring_base) {
+    std::vector<std::vector<EventData>> events_to_send;
+
+    {
+        std::lock_guard<std::mutex> lk(this->periodic_monitors_mutex);
+
+        // Collect the due monitors first, processing them pushes new entries to the schedule
+        std::set<std::int32_t> due_monitor_ids = this->periodic_monitors_pending;
+        const auto now = std::chrono::steady_clock::now();
+
+        while (!this->periodic_monitors_schedule.empty() and
+               this->periodic_monitors_schedule.top().next_trigger <= now) {
+            const auto entry = this->periodic_monitors_schedule.top();
+            this->periodic_monitors_schedule.pop();
+
+            auto it = this->periodic_monitors_meta.find(entry.monitor_id);
+
+            // Skip entries of removed or rescheduled monitors
+            if (it == std::end(this->periodic_monitors_meta) or
+                it->second.meta_periodic.next_trigger_steady != entry.next_trigger) {
+                continue;
+            }
+
+            due_monitor_ids.insert(entry.monitor_id);
+        }
+
+        for (const auto monitor_id : due_monitor_ids) {
+            auto it = this->periodic_monitors_meta.find(monitor_id);
+            if (it == std::end(this->periodic_monitors_meta)) {
+                this->periodic_monitors_pending.erase(monitor_id);
+                continue;
+            }
+
+            auto& updater_monitor_meta = it->second;
+            const bool is_due = updater_monitor_meta.meta_periodic.next_trigger_steady <= now;
+
+            bool should_process = is_monitor_active(active_monitoring_base, updater_monitor_meta.monitor_meta);
+
+            // If we are offline, discard monitors that have a severity > than 'offline_severity', if we are
+            // online discard the monitors that have a severity > than 'active_monitoring_level'
+            if (updater_monitor_meta.monitor_meta.monitor.severity >
+                (is_offline ? offline_severity : active_monitoring_level)) {
+                should_process = false;
+            }
+
+            EVLOG_debug << "Monitor: " << updater_monitor_meta.monitor_meta.monitor << " processed: " << should_process;
+
+            if (!should_process) {
+                // Just clear the events, since we don't require them cached
+                updater_monitor_meta.generated_monitor_events.clear();
+            } else if (is_due) {
+                process_monitor_meta_internal(updater_monitor_meta);
+            }
+
+            if (is_due) {
+                schedule_periodic_monitor_internal(updater_monitor_meta);
+            }
+
+            if (!updater_monitor_meta.generated_monitor_events.empty() and !is_offline) {
+                EVLOG_debug << "Sent data for monitor: " << updater_monitor_meta.monitor_meta.monitor;
+                events_to_send.push_back(std::move(updater_monitor_meta.generated_monitor_events));
+                updater_monitor_meta.generated_monitor_events.clear();
+            }
+
+            if (updater_monitor_meta.generated_monitor_events.empty()) {
+                this->periodic_monitors_pending.erase(monitor_id);
+            } else {
+                // If we are offline but we passed the 'should_process' test, it means that
+                // we should keep the generated events and send them at a further occasion
+                EVLOG_debug << "We are offline, cached generated events for later!";
+                this->periodic_monitors_pending.insert(monitor_id);
+            }
+        }
+    }
+
+    for (const auto& events : events_to_send) {
+        notify_csms_events(events);
     }
+}
 
+void MonitoringUpdater::process_trigger_monitors_internal(bool is_offline, int offline_severity,
+                                                          int active_monitoring_level,
+                                                          MonitoringBaseEnum active_monitoring_base) {
     // Iterate all internal monitors and process them
     for (auto it = std::begin(updater_monitors_meta); it != std::end(updater_monitors_meta);) {
         auto& updater_monitor_meta = it->second;
-        const auto& meta_monitor_id = it->first;
         const auto& monitor_meta = updater_monitor_meta.monitor_meta;
 
-        if (((allow_periodics == false) && (updater_monitor_meta.type == UpdateMonitorMetaType::PERIODIC)) ||
-            ((allow_trigger == false) && (updater_monitor_meta.type == UpdateMonitorMetaType::TRIGGER))) {
-            continue;
-        }
-
         bool should_process = true;
 
         // Skip non-active monitors
@@ -613,14 +803,8 @@ void MonitoringUpdater::process_monitors_internal(bool allow_periodics, bool all
         EVLOG_debug << "Monitor: " << updater_monitor_meta.monitor_meta.monitor << " processed: " << should_process;
 
         if (!should_process) {
-            if (updater_monitor_meta.type == UpdateMonitorMetaType::TRIGGER) {
-                // The triggers that are not active, should simply pe discarded
-                it = updater_monitors_meta.erase(it);
-            } else if (updater_monitor_meta.type == UpdateMonitorMetaType::PERIODIC) {
-                // Just clear the events, since we don't require them cached
-                updater_monitor_meta.generated_monitor_events.clear();
-            }
-
+            // The triggers that are not active, should simply pe discarded
+            it = updater_monitors_meta.erase(it);
             continue;
         }
 
@@ -636,17 +820,14 @@ void MonitoringUpdater::process_monitors_internal(bool allow_periodics, bool all
                 notify_csms_events(updater_monitor_meta.generated_monitor_events);
                 updater_monitor_meta.generated_monitor_events.clear();
 
-                if (updater_monitor_meta.type == UpdateMonitorMetaType::TRIGGER) {
-                    // If we have a trigger mark the events as being sent
-                    // for the curent state
-                    updater_monitor_meta.meta_trigger.is_csms_sent = true;
-
-                    // If this was a state trigger, them also mark that
-                    // we sent this 'dangerous' state to the CSMS at least once
-                    // since in that case the clear logic changes
-                    if (updater_monitor_meta.meta_trigger.is_cleared == false) {
-                        updater_monitor_meta.meta_trigger.is_csms_sent_triggered = true;
-                    }
+                // Mark the events as being sent for the curent state
+                updater_monitor_meta.meta_trigger.is_csms_sent = true;
+
+                // If this was a state trigger, them also mark that
+                // we sent this 'dangerous' state to the CSMS at least once
+                // since in that case the clear logic changes
+                if (updater_monitor_meta.meta_trigger.is_cleared == false) {
+                    updater_monitor_meta.meta_trigger.is_csms_sent_triggered = true;
                 }
             }
         } else {
@@ -40,6 +40,20 @@ void from_json(const json& j, AdditionalInfo& k) {
     }
 }
 
+/// \brief Writes the given AdditionalInfo \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const AdditionalInfo& k) {
+    writer.start_object();
+    writer.key("additionalIdToken");
+    write_json(writer, k.additionalIdToken);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("type");
+    write_json(writer, k.type);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given AdditionalInfo \p k to the given output stream \p os
 /// \returns an output stream with the AdditionalInfo written to
 std::ostream& operator<<(std::ostream& os, const AdditionalInfo& k) {
@@ -86,6 +100,24 @@ void from_json(const json& j, IdToken& k) {
     }
 }
 
+/// \brief Writes the given IdToken \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const IdToken& k) {
+    writer.start_object();
+    if (k.additionalInfo) {
+        writer.key("additionalInfo");
+        write_json(writer, k.additionalInfo.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("idToken");
+    write_json(writer, k.idToken);
+    writer.key("type");
+    writer.value(conversions::id_token_enum_to_string(k.type));
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given IdToken \p k to the given output stream \p os
 /// \returns an output stream with the IdToken written to
 std::ostream& operator<<(std::ostream& os, const IdToken& k) {
@@ -124,6 +156,26 @@ void from_json(const json& j, OCSPRequestData& k) {
     }
 }
 
+/// \brief Writes the given OCSPRequestData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const OCSPRequestData& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("hashAlgorithm");
+    writer.value(conversions::hash_algorithm_enum_to_string(k.hashAlgorithm));
+    writer.key("issuerKeyHash");
+    write_json(writer, k.issuerKeyHash);
+    writer.key("issuerNameHash");
+    write_json(writer, k.issuerNameHash);
+    writer.key("responderURL");
+    write_json(writer, k.responderURL);
+    writer.key("serialNumber");
+    write_json(writer, k.serialNumber);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given OCSPRequestData \p k to the given output stream \p os
 /// \returns an output stream with the OCSPRequestData written to
 std::ostream& operator<<(std::ostream& os, const OCSPRequestData& k) {
@@ -162,6 +214,24 @@ void from_json(const json& j, MessageContent& k) {
     }
 }
 
+/// \brief Writes the given MessageContent \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MessageContent& k) {
+    writer.start_object();
+    writer.key("content");
+    write_json(writer, k.content);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("format");
+    writer.value(conversions::message_format_enum_to_string(k.format));
+    if (k.language) {
+        writer.key("language");
+        write_json(writer, k.language.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given MessageContent \p k to the given output stream \p os
 /// \returns an output stream with the MessageContent written to
 std::ostream& operator<<(std::ostream& os, const MessageContent& k) {
@@ -242,6 +312,46 @@ void from_json(const json& j, IdTokenInfo& k) {
     }
 }
 
+/// \brief Writes the given IdTokenInfo \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const IdTokenInfo& k) {
+    writer.start_object();
+    if (k.cacheExpiryDateTime) {
+        writer.key("cacheExpiryDateTime");
+        write_json(writer, k.cacheExpiryDateTime.value());
+    }
+    if (k.chargingPriority) {
+        writer.key("chargingPriority");
+        write_json(writer, k.chargingPriority.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        write_json(writer, k.evseId.value());
+    }
+    if (k.groupIdToken) {
+        writer.key("groupIdToken");
+        write_json(writer, k.groupIdToken.value());
+    }
+    if (k.language1) {
+        writer.key("language1");
+        write_json(writer, k.language1.value());
+    }
+    if (k.language2) {
+        writer.key("language2");
+        write_json(writer, k.language2.value());
+    }
+    if (k.personalMessage) {
+        writer.key("personalMessage");
+        write_json(writer, k.personalMessage.value());
+    }
+    writer.key("status");
+    writer.value(conversions::authorization_status_enum_to_string(k.status));
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given IdTokenInfo \p k to the given output stream \p os
 /// \returns an output stream with the IdTokenInfo written to
 std::ostream& operator<<(std::ostream& os, const IdTokenInfo& k) {
@@ -281,6 +391,24 @@ void from_json(const json& j, Modem& k) {
     }
 }
 
+/// \brief Writes the given Modem \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Modem& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.iccid) {
+        writer.key("iccid");
+        write_json(writer, k.iccid.value());
+    }
+    if (k.imsi) {
+        writer.key("imsi");
+        write_json(writer, k.imsi.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Modem \p k to the given output stream \p os
 /// \returns an output stream with the Modem written to
 std::ostream& operator<<(std::ostream& os, const Modem& k) {
@@ -331,6 +459,32 @@ void from_json(const json& j, ChargingStation& k) {
     }
 }
 
+/// \brief Writes the given ChargingStation \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingStation& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.firmwareVersion) {
+        writer.key("firmwareVersion");
+        write_json(writer, k.firmwareVersion.value());
+    }
+    writer.key("model");
+    write_json(writer, k.model);
+    if (k.modem) {
+        writer.key("modem");
+        write_json(writer, k.modem.value());
+    }
+    if (k.serialNumber) {
+        writer.key("serialNumber");
+        write_json(writer, k.serialNumber.value());
+    }
+    writer.key("vendorName");
+    write_json(writer, k.vendorName);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingStation \p k to the given output stream \p os
 /// \returns an output stream with the ChargingStation written to
 std::ostream& operator<<(std::ostream& os, const ChargingStation& k) {
@@ -367,6 +521,22 @@ void from_json(const json& j, StatusInfo& k) {
     }
 }
 
+/// \brief Writes the given StatusInfo \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const StatusInfo& k) {
+    writer.start_object();
+    if (k.additionalInfo) {
+        writer.key("additionalInfo");
+        write_json(writer, k.additionalInfo.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("reasonCode");
+    write_json(writer, k.reasonCode);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given StatusInfo \p k to the given output stream \p os
 /// \returns an output stream with the StatusInfo written to
 std::ostream& operator<<(std::ostream& os, const StatusInfo& k) {
@@ -403,6 +573,22 @@ void from_json(const json& j, EVSE& k) {
     }
 }
 
+/// \brief Writes the given EVSE \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const EVSE& k) {
+    writer.start_object();
+    if (k.connectorId) {
+        writer.key("connectorId");
+        write_json(writer, k.connectorId.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("id");
+    write_json(writer, k.id);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given EVSE \p k to the given output stream \p os
 /// \returns an output stream with the EVSE written to
 std::ostream& operator<<(std::ostream& os, const EVSE& k) {
@@ -450,6 +636,28 @@ void from_json(const json& j, ClearChargingProfile& k) {
     }
 }
 
+/// \brief Writes the given ClearChargingProfile \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearChargingProfile& k) {
+    writer.start_object();
+    if (k.chargingProfilePurpose) {
+        writer.key("chargingProfilePurpose");
+        writer.value(conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        write_json(writer, k.evseId.value());
+    }
+    if (k.stackLevel) {
+        writer.key("stackLevel");
+        write_json(writer, k.stackLevel.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ClearChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ClearChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfile& k) {
@@ -488,6 +696,24 @@ void from_json(const json& j, ClearMonitoringResult& k) {
     }
 }
 
+/// \brief Writes the given ClearMonitoringResult \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ClearMonitoringResult& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("id");
+    write_json(writer, k.id);
+    writer.key("status");
+    writer.value(conversions::clear_monitoring_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ClearMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the ClearMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const ClearMonitoringResult& k) {
@@ -524,6 +750,24 @@ void from_json(const json& j, CertificateHashDataType& k) {
     }
 }
 
+/// \brief Writes the given CertificateHashDataType \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataType& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("hashAlgorithm");
+    writer.value(conversions::hash_algorithm_enum_to_string(k.hashAlgorithm));
+    writer.key("issuerKeyHash");
+    write_json(writer, k.issuerKeyHash);
+    writer.key("issuerNameHash");
+    write_json(writer, k.issuerNameHash);
+    writer.key("serialNumber");
+    write_json(writer, k.serialNumber);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given CertificateHashDataType \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataType written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataType& k) {
@@ -601,6 +845,36 @@ void from_json(const json& j, ChargingProfileCriterion& k) {
     }
 }
 
+/// \brief Writes the given ChargingProfileCriterion \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfileCriterion& k) {
+    writer.start_object();
+    if (k.chargingLimitSource) {
+        writer.key("chargingLimitSource");
+        writer.start_array();
+        for (const auto& val : k.chargingLimitSource.value()) {
+            writer.value(conversions::charging_limit_source_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    if (k.chargingProfileId) {
+        writer.key("chargingProfileId");
+        write_json(writer, k.chargingProfileId.value());
+    }
+    if (k.chargingProfilePurpose) {
+        writer.key("chargingProfilePurpose");
+        writer.value(conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.stackLevel) {
+        writer.key("stackLevel");
+        write_json(writer, k.stackLevel.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingProfileCriterion \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfileCriterion written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfileCriterion& k) {
@@ -645,6 +919,28 @@ void from_json(const json& j, ChargingSchedulePeriod& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedulePeriod \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("limit");
+    write_json(writer, k.limit);
+    if (k.numberPhases) {
+        writer.key("numberPhases");
+        write_json(writer, k.numberPhases.value());
+    }
+    if (k.phaseToUse) {
+        writer.key("phaseToUse");
+        write_json(writer, k.phaseToUse.value());
+    }
+    writer.key("startPeriod");
+    write_json(writer, k.startPeriod);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingSchedulePeriod \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedulePeriod written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedulePeriod& k) {
@@ -685,6 +981,26 @@ void from_json(const json& j, CompositeSchedule& k) {
     }
 }
 
+/// \brief Writes the given CompositeSchedule \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CompositeSchedule& k) {
+    writer.start_object();
+    writer.key("chargingRateUnit");
+    writer.value(conversions::charging_rate_unit_enum_to_string(k.chargingRateUnit));
+    writer.key("chargingSchedulePeriod");
+    write_json(writer, k.chargingSchedulePeriod);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("duration");
+    write_json(writer, k.duration);
+    writer.key("evseId");
+    write_json(writer, k.evseId);
+    writer.key("scheduleStart");
+    write_json(writer, k.scheduleStart);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given CompositeSchedule \p k to the given output stream \p os
 /// \returns an output stream with the CompositeSchedule written to
 std::ostream& operator<<(std::ostream& os, const CompositeSchedule& k) {
@@ -731,6 +1047,24 @@ void from_json(const json& j, CertificateHashDataChain& k) {
     }
 }
 
+/// \brief Writes the given CertificateHashDataChain \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const CertificateHashDataChain& k) {
+    writer.start_object();
+    writer.key("certificateHashData");
+    write_json(writer, k.certificateHashData);
+    writer.key("certificateType");
+    writer.value(conversions::get_certificate_id_use_enum_to_string(k.certificateType));
+    if (k.childCertificateHashData) {
+        writer.key("childCertificateHashData");
+        write_json(writer, k.childCertificateHashData.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given CertificateHashDataChain \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataChain written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataChain& k) {
@@ -773,6 +1107,26 @@ void from_json(const json& j, LogParameters& k) {
     }
 }
 
+/// \brief Writes the given LogParameters \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const LogParameters& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.latestTimestamp) {
+        writer.key("latestTimestamp");
+        write_json(writer, k.latestTimestamp.value());
+    }
+    if (k.oldestTimestamp) {
+        writer.key("oldestTimestamp");
+        write_json(writer, k.oldestTimestamp.value());
+    }
+    writer.key("remoteLocation");
+    write_json(writer, k.remoteLocation);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given LogParameters \p k to the given output stream \p os
 /// \returns an output stream with the LogParameters written to
 std::ostream& operator<<(std::ostream& os, const LogParameters& k) {
@@ -815,6 +1169,26 @@ void from_json(const json& j, Component& k) {
     }
 }
 
+/// \brief Writes the given Component \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Component& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.evse) {
+        writer.key("evse");
+        write_json(writer, k.evse.value());
+    }
+    if (k.instance) {
+        writer.key("instance");
+        write_json(writer, k.instance.value());
+    }
+    writer.key("name");
+    write_json(writer, k.name);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Component \p k to the given output stream \p os
 /// \returns an output stream with the Component written to
 std::ostream& operator<<(std::ostream& os, const Component& k) {
@@ -851,6 +1225,22 @@ void from_json(const json& j, Variable& k) {
     }
 }
 
+/// \brief Writes the given Variable \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Variable& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.instance) {
+        writer.key("instance");
+        write_json(writer, k.instance.value());
+    }
+    writer.key("name");
+    write_json(writer, k.name);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Variable \p k to the given output stream \p os
 /// \returns an output stream with the Variable written to
 std::ostream& operator<<(std::ostream& os, const Variable& k) {
@@ -887,6 +1277,22 @@ void from_json(const json& j, ComponentVariable& k) {
     }
 }
 
+/// \brief Writes the given ComponentVariable \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ComponentVariable& k) {
+    writer.start_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.variable) {
+        writer.key("variable");
+        write_json(writer, k.variable.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ComponentVariable \p k to the given output stream \p os
 /// \returns an output stream with the ComponentVariable written to
 std::ostream& operator<<(std::ostream& os, const ComponentVariable& k) {
@@ -925,6 +1331,24 @@ void from_json(const json& j, GetVariableData& k) {
     }
 }
 
+/// \brief Writes the given GetVariableData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetVariableData& k) {
+    writer.start_object();
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given GetVariableData \p k to the given output stream \p os
 /// \returns an output stream with the GetVariableData written to
 std::ostream& operator<<(std::ostream& os, const GetVariableData& k) {
@@ -977,6 +1401,34 @@ void from_json(const json& j, GetVariableResult& k) {
     }
 }
 
+/// \brief Writes the given GetVariableResult \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const GetVariableResult& k) {
+    writer.start_object();
+    writer.key("attributeStatus");
+    writer.value(conversions::get_variable_status_enum_to_string(k.attributeStatus));
+    if (k.attributeStatusInfo) {
+        writer.key("attributeStatusInfo");
+        write_json(writer, k.attributeStatusInfo.value());
+    }
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    if (k.attributeValue) {
+        writer.key("attributeValue");
+        write_json(writer, k.attributeValue.value());
+    }
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given GetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the GetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const GetVariableResult& k) {
@@ -1013,6 +1465,24 @@ void from_json(const json& j, SignedMeterValue& k) {
     }
 }
 
+/// \brief Writes the given SignedMeterValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SignedMeterValue& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("encodingMethod");
+    write_json(writer, k.encodingMethod);
+    writer.key("publicKey");
+    write_json(writer, k.publicKey);
+    writer.key("signedMeterData");
+    write_json(writer, k.signedMeterData);
+    writer.key("signingMethod");
+    write_json(writer, k.signingMethod);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SignedMeterValue \p k to the given output stream \p os
 /// \returns an output stream with the SignedMeterValue written to
 std::ostream& operator<<(std::ostream& os, const SignedMeterValue& k) {
@@ -1052,6 +1522,24 @@ void from_json(const json& j, UnitOfMeasure& k) {
     }
 }
 
+/// \brief Writes the given UnitOfMeasure \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const UnitOfMeasure& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.multiplier) {
+        writer.key("multiplier");
+        write_json(writer, k.multiplier.value());
+    }
+    if (k.unit) {
+        writer.key("unit");
+        write_json(writer, k.unit.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given UnitOfMeasure \p k to the given output stream \p os
 /// \returns an output stream with the UnitOfMeasure written to
 std::ostream& operator<<(std::ostream& os, const UnitOfMeasure& k) {
@@ -1118,6 +1606,42 @@ void from_json(const json& j, SampledValue& k) {
     }
 }
 
+/// \brief Writes the given SampledValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SampledValue& k) {
+    writer.start_object();
+    if (k.context) {
+        writer.key("context");
+        writer.value(conversions::reading_context_enum_to_string(k.context.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.location) {
+        writer.key("location");
+        writer.value(conversions::location_enum_to_string(k.location.value()));
+    }
+    if (k.measurand) {
+        writer.key("measurand");
+        writer.value(conversions::measurand_enum_to_string(k.measurand.value()));
+    }
+    if (k.phase) {
+        writer.key("phase");
+        writer.value(conversions::phase_enum_to_string(k.phase.value()));
+    }
+    if (k.signedMeterValue) {
+        writer.key("signedMeterValue");
+        write_json(writer, k.signedMeterValue.value());
+    }
+    if (k.unitOfMeasure) {
+        writer.key("unitOfMeasure");
+        write_json(writer, k.unitOfMeasure.value());
+    }
+    writer.key("value");
+    write_json(writer, k.value);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
 /// \returns an output stream with the SampledValue written to
 std::ostream& operator<<(std::ostream& os, const SampledValue& k) {
@@ -1152,6 +1676,20 @@ void from_json(const json& j, MeterValue& k) {
     }
 }
 
+/// \brief Writes the given MeterValue \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MeterValue& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("sampledValue");
+    write_json(writer, k.sampledValue);
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given MeterValue \p k to the given output stream \p os
 /// \returns an output stream with the MeterValue written to
 std::ostream& operator<<(std::ostream& os, const MeterValue& k) {
@@ -1188,6 +1726,22 @@ void from_json(const json& j, RelativeTimeInterval& k) {
     }
 }
 
+/// \brief Writes the given RelativeTimeInterval \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const RelativeTimeInterval& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.duration) {
+        writer.key("duration");
+        write_json(writer, k.duration.value());
+    }
+    writer.key("start");
+    write_json(writer, k.start);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given RelativeTimeInterval \p k to the given output stream \p os
 /// \returns an output stream with the RelativeTimeInterval written to
 std::ostream& operator<<(std::ostream& os, const RelativeTimeInterval& k) {
@@ -1226,6 +1780,24 @@ void from_json(const json& j, Cost& k) {
     }
 }
 
+/// \brief Writes the given Cost \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Cost& k) {
+    writer.start_object();
+    writer.key("amount");
+    write_json(writer, k.amount);
+    if (k.amountMultiplier) {
+        writer.key("amountMultiplier");
+        write_json(writer, k.amountMultiplier.value());
+    }
+    writer.key("costKind");
+    writer.value(conversions::cost_kind_enum_to_string(k.costKind));
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Cost \p k to the given output stream \p os
 /// \returns an output stream with the Cost written to
 std::ostream& operator<<(std::ostream& os, const Cost& k) {
@@ -1260,6 +1832,20 @@ void from_json(const json& j, ConsumptionCost& k) {
     }
 }
 
+/// \brief Writes the given ConsumptionCost \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ConsumptionCost& k) {
+    writer.start_object();
+    writer.key("cost");
+    write_json(writer, k.cost);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("startValue");
+    write_json(writer, k.startValue);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ConsumptionCost \p k to the given output stream \p os
 /// \returns an output stream with the ConsumptionCost written to
 std::ostream& operator<<(std::ostream& os, const ConsumptionCost& k) {
@@ -1310,6 +1896,26 @@ void from_json(const json& j, SalesTariffEntry& k) {
     }
 }
 
+/// \brief Writes the given SalesTariffEntry \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SalesTariffEntry& k) {
+    writer.start_object();
+    if (k.consumptionCost) {
+        writer.key("consumptionCost");
+        write_json(writer, k.consumptionCost.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.ePriceLevel) {
+        writer.key("ePriceLevel");
+        write_json(writer, k.ePriceLevel.value());
+    }
+    writer.key("relativeTimeInterval");
+    write_json(writer, k.relativeTimeInterval);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SalesTariffEntry \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariffEntry written to
 std::ostream& operator<<(std::ostream& os, const SalesTariffEntry& k) {
@@ -1356,6 +1962,28 @@ void from_json(const json& j, SalesTariff& k) {
     }
 }
 
+/// \brief Writes the given SalesTariff \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SalesTariff& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("id");
+    write_json(writer, k.id);
+    if (k.numEPriceLevels) {
+        writer.key("numEPriceLevels");
+        write_json(writer, k.numEPriceLevels.value());
+    }
+    if (k.salesTariffDescription) {
+        writer.key("salesTariffDescription");
+        write_json(writer, k.salesTariffDescription.value());
+    }
+    writer.key("salesTariffEntry");
+    write_json(writer, k.salesTariffEntry);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SalesTariff \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariff written to
 std::ostream& operator<<(std::ostream& os, const SalesTariff& k) {
@@ -1416,6 +2044,38 @@ void from_json(const json& j, ChargingSchedule& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedule \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingSchedule& k) {
+    writer.start_object();
+    writer.key("chargingRateUnit");
+    writer.value(conversions::charging_rate_unit_enum_to_string(k.chargingRateUnit));
+    writer.key("chargingSchedulePeriod");
+    write_json(writer, k.chargingSchedulePeriod);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.duration) {
+        writer.key("duration");
+        write_json(writer, k.duration.value());
+    }
+    writer.key("id");
+    write_json(writer, k.id);
+    if (k.minChargingRate) {
+        writer.key("minChargingRate");
+        write_json(writer, k.minChargingRate.value());
+    }
+    if (k.salesTariff) {
+        writer.key("salesTariff");
+        write_json(writer, k.salesTariff.value());
+    }
+    if (k.startSchedule) {
+        writer.key("startSchedule");
+        write_json(writer, k.startSchedule.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingSchedule \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedule written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedule& k) {
@@ -1452,6 +2112,22 @@ void from_json(const json& j, ChargingLimit& k) {
     }
 }
 
+/// \brief Writes the given ChargingLimit \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingLimit& k) {
+    writer.start_object();
+    writer.key("chargingLimitSource");
+    writer.value(conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.isGridCritical) {
+        writer.key("isGridCritical");
+        write_json(writer, k.isGridCritical.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingLimit \p k to the given output stream \p os
 /// \returns an output stream with the ChargingLimit written to
 std::ostream& operator<<(std::ostream& os, const ChargingLimit& k) {
@@ -1516,6 +2192,42 @@ void from_json(const json& j, MessageInfo& k) {
     }
 }
 
+/// \brief Writes the given MessageInfo \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MessageInfo& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.display) {
+        writer.key("display");
+        write_json(writer, k.display.value());
+    }
+    if (k.endDateTime) {
+        writer.key("endDateTime");
+        write_json(writer, k.endDateTime.value());
+    }
+    writer.key("id");
+    write_json(writer, k.id);
+    writer.key("message");
+    write_json(writer, k.message);
+    writer.key("priority");
+    writer.value(conversions::message_priority_enum_to_string(k.priority));
+    if (k.startDateTime) {
+        writer.key("startDateTime");
+        write_json(writer, k.startDateTime.value());
+    }
+    if (k.state) {
+        writer.key("state");
+        writer.value(conversions::message_state_enum_to_string(k.state.value()));
+    }
+    if (k.transactionId) {
+        writer.key("transactionId");
+        write_json(writer, k.transactionId.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given MessageInfo \p k to the given output stream \p os
 /// \returns an output stream with the MessageInfo written to
 std::ostream& operator<<(std::ostream& os, const MessageInfo& k) {
@@ -1552,6 +2264,24 @@ void from_json(const json& j, ACChargingParameters& k) {
     }
 }
 
+/// \brief Writes the given ACChargingParameters \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ACChargingParameters& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("energyAmount");
+    write_json(writer, k.energyAmount);
+    writer.key("evMaxCurrent");
+    write_json(writer, k.evMaxCurrent);
+    writer.key("evMaxVoltage");
+    write_json(writer, k.evMaxVoltage);
+    writer.key("evMinCurrent");
+    write_json(writer, k.evMinCurrent);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ACChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the ACChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const ACChargingParameters& k) {
@@ -1620,6 +2350,44 @@ void from_json(const json& j, DCChargingParameters& k) {
     }
 }
 
+/// \brief Writes the given DCChargingParameters \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const DCChargingParameters& k) {
+    writer.start_object();
+    if (k.bulkSoC) {
+        writer.key("bulkSoC");
+        write_json(writer, k.bulkSoC.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.energyAmount) {
+        writer.key("energyAmount");
+        write_json(writer, k.energyAmount.value());
+    }
+    if (k.evEnergyCapacity) {
+        writer.key("evEnergyCapacity");
+        write_json(writer, k.evEnergyCapacity.value());
+    }
+    writer.key("evMaxCurrent");
+    write_json(writer, k.evMaxCurrent);
+    if (k.evMaxPower) {
+        writer.key("evMaxPower");
+        write_json(writer, k.evMaxPower.value());
+    }
+    writer.key("evMaxVoltage");
+    write_json(writer, k.evMaxVoltage);
+    if (k.fullSoC) {
+        writer.key("fullSoC");
+        write_json(writer, k.fullSoC.value());
+    }
+    if (k.stateOfCharge) {
+        writer.key("stateOfCharge");
+        write_json(writer, k.stateOfCharge.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given DCChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the DCChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const DCChargingParameters& k) {
@@ -1668,6 +2436,30 @@ void from_json(const json& j, ChargingNeeds& k) {
     }
 }
 
+/// \brief Writes the given ChargingNeeds \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingNeeds& k) {
+    writer.start_object();
+    if (k.acChargingParameters) {
+        writer.key("acChargingParameters");
+        write_json(writer, k.acChargingParameters.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.dcChargingParameters) {
+        writer.key("dcChargingParameters");
+        write_json(writer, k.dcChargingParameters.value());
+    }
+    if (k.departureTime) {
+        writer.key("departureTime");
+        write_json(writer, k.departureTime.value());
+    }
+    writer.key("requestedEnergyTransfer");
+    writer.value(conversions::energy_transfer_mode_enum_to_string(k.requestedEnergyTransfer));
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingNeeds \p k to the given output stream \p os
 /// \returns an output stream with the ChargingNeeds written to
 std::ostream& operator<<(std::ostream& os, const ChargingNeeds& k) {
@@ -1746,6 +2538,54 @@ void from_json(const json& j, EventData& k) {
     }
 }
 
+/// \brief Writes the given EventData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const EventData& k) {
+    writer.start_object();
+    writer.key("actualValue");
+    write_json(writer, k.actualValue);
+    if (k.cause) {
+        writer.key("cause");
+        write_json(writer, k.cause.value());
+    }
+    if (k.cleared) {
+        writer.key("cleared");
+        write_json(writer, k.cleared.value());
+    }
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("eventId");
+    write_json(writer, k.eventId);
+    writer.key("eventNotificationType");
+    writer.value(conversions::event_notification_enum_to_string(k.eventNotificationType));
+    if (k.techCode) {
+        writer.key("techCode");
+        write_json(writer, k.techCode.value());
+    }
+    if (k.techInfo) {
+        writer.key("techInfo");
+        write_json(writer, k.techInfo.value());
+    }
+    writer.key("timestamp");
+    write_json(writer, k.timestamp);
+    if (k.transactionId) {
+        writer.key("transactionId");
+        write_json(writer, k.transactionId.value());
+    }
+    writer.key("trigger");
+    writer.value(conversions::event_trigger_enum_to_string(k.trigger));
+    writer.key("variable");
+    write_json(writer, k.variable);
+    if (k.variableMonitoringId) {
+        writer.key("variableMonitoringId");
+        write_json(writer, k.variableMonitoringId.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given EventData \p k to the given output stream \p os
 /// \returns an output stream with the EventData written to
 std::ostream& operator<<(std::ostream& os, const EventData& k) {
@@ -1784,6 +2624,26 @@ void from_json(const json& j, VariableMonitoring& k) {
     }
 }
 
+/// \brief Writes the given VariableMonitoring \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const VariableMonitoring& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("id");
+    write_json(writer, k.id);
+    writer.key("severity");
+    write_json(writer, k.severity);
+    writer.key("transaction");
+    write_json(writer, k.transaction);
+    writer.key("type");
+    writer.value(conversions::monitor_enum_to_string(k.type));
+    writer.key("value");
+    write_json(writer, k.value);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given VariableMonitoring \p k to the given output stream \p os
 /// \returns an output stream with the VariableMonitoring written to
 std::ostream& operator<<(std::ostream& os, const VariableMonitoring& k) {
@@ -1820,6 +2680,22 @@ void from_json(const json& j, MonitoringData& k) {
     }
 }
 
+/// \brief Writes the given MonitoringData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const MonitoringData& k) {
+    writer.start_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.key("variableMonitoring");
+    write_json(writer, k.variableMonitoring);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given MonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the MonitoringData written to
 std::ostream& operator<<(std::ostream& os, const MonitoringData& k) {
@@ -1893,6 +2769,36 @@ void from_json(const json& j, VariableAttribute& k) {
     }
 }
 
+/// \brief Writes the given VariableAttribute \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const VariableAttribute& k) {
+    writer.start_object();
+    if (k.constant) {
+        writer.key("constant");
+        write_json(writer, k.constant.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.mutability) {
+        writer.key("mutability");
+        writer.value(conversions::mutability_enum_to_string(k.mutability.value()));
+    }
+    if (k.persistent) {
+        writer.key("persistent");
+        write_json(writer, k.persistent.value());
+    }
+    if (k.type) {
+        writer.key("type");
+        writer.value(conversions::attribute_enum_to_string(k.type.value()));
+    }
+    if (k.value) {
+        writer.key("value");
+        write_json(writer, k.value.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given VariableAttribute \p k to the given output stream \p os
 /// \returns an output stream with the VariableAttribute written to
 std::ostream& operator<<(std::ostream& os, const VariableAttribute& k) {
@@ -1949,6 +2855,36 @@ void from_json(const json& j, VariableCharacteristics& k) {
     }
 }
 
+/// \brief Writes the given VariableCharacteristics \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const VariableCharacteristics& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("dataType");
+    writer.value(conversions::data_enum_to_string(k.dataType));
+    if (k.maxLimit) {
+        writer.key("maxLimit");
+        write_json(writer, k.maxLimit.value());
+    }
+    if (k.minLimit) {
+        writer.key("minLimit");
+        write_json(writer, k.minLimit.value());
+    }
+    writer.key("supportsMonitoring");
+    write_json(writer, k.supportsMonitoring);
+    if (k.unit) {
+        writer.key("unit");
+        write_json(writer, k.unit.value());
+    }
+    if (k.valuesList) {
+        writer.key("valuesList");
+        write_json(writer, k.valuesList.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given VariableCharacteristics \p k to the given output stream \p os
 /// \returns an output stream with the VariableCharacteristics written to
 std::ostream& operator<<(std::ostream& os, const VariableCharacteristics& k) {
@@ -1991,6 +2927,26 @@ void from_json(const json& j, ReportData& k) {
     }
 }
 
+/// \brief Writes the given ReportData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ReportData& k) {
+    writer.start_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.key("variableAttribute");
+    write_json(writer, k.variableAttribute);
+    if (k.variableCharacteristics) {
+        writer.key("variableCharacteristics");
+        write_json(writer, k.variableCharacteristics.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ReportData \p k to the given output stream \p os
 /// \returns an output stream with the ReportData written to
 std::ostream& operator<<(std::ostream& os, const ReportData& k) {
@@ -2055,6 +3011,42 @@ void from_json(const json& j, ChargingProfile& k) {
     }
 }
 
+/// \brief Writes the given ChargingProfile \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const ChargingProfile& k) {
+    writer.start_object();
+    writer.key("chargingProfileKind");
+    writer.value(conversions::charging_profile_kind_enum_to_string(k.chargingProfileKind));
+    writer.key("chargingProfilePurpose");
+    writer.value(conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose));
+    writer.key("chargingSchedule");
+    write_json(writer, k.chargingSchedule);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("id");
+    write_json(writer, k.id);
+    if (k.recurrencyKind) {
+        writer.key("recurrencyKind");
+        writer.value(conversions::recurrency_kind_enum_to_string(k.recurrencyKind.value()));
+    }
+    writer.key("stackLevel");
+    write_json(writer, k.stackLevel);
+    if (k.transactionId) {
+        writer.key("transactionId");
+        write_json(writer, k.transactionId.value());
+    }
+    if (k.validFrom) {
+        writer.key("validFrom");
+        write_json(writer, k.validFrom.value());
+    }
+    if (k.validTo) {
+        writer.key("validTo");
+        write_json(writer, k.validTo.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfile& k) {
@@ -2091,6 +3083,22 @@ void from_json(const json& j, AuthorizationData& k) {
     }
 }
 
+/// \brief Writes the given AuthorizationData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const AuthorizationData& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("idToken");
+    write_json(writer, k.idToken);
+    if (k.idTokenInfo) {
+        writer.key("idTokenInfo");
+        write_json(writer, k.idTokenInfo.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given AuthorizationData \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizationData written to
 std::ostream& operator<<(std::ostream& os, const AuthorizationData& k) {
@@ -2153,6 +3161,40 @@ void from_json(const json& j, APN& k) {
     }
 }
 
+/// \brief Writes the given APN \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const APN& k) {
+    writer.start_object();
+    writer.key("apn");
+    write_json(writer, k.apn);
+    writer.key("apnAuthentication");
+    writer.value(conversions::apnauthentication_enum_to_string(k.apnAuthentication));
+    if (k.apnPassword) {
+        writer.key("apnPassword");
+        write_json(writer, k.apnPassword.value());
+    }
+    if (k.apnUserName) {
+        writer.key("apnUserName");
+        write_json(writer, k.apnUserName.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.preferredNetwork) {
+        writer.key("preferredNetwork");
+        write_json(writer, k.preferredNetwork.value());
+    }
+    if (k.simPin) {
+        writer.key("simPin");
+        write_json(writer, k.simPin.value());
+    }
+    if (k.useOnlyPreferredNetwork) {
+        writer.key("useOnlyPreferredNetwork");
+        write_json(writer, k.useOnlyPreferredNetwork.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given APN \p k to the given output stream \p os
 /// \returns an output stream with the APN written to
 std::ostream& operator<<(std::ostream& os, const APN& k) {
@@ -2197,6 +3239,30 @@ void from_json(const json& j, VPN& k) {
     }
 }
 
+/// \brief Writes the given VPN \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const VPN& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.group) {
+        writer.key("group");
+        write_json(writer, k.group.value());
+    }
+    writer.key("key");
+    write_json(writer, k.key);
+    writer.key("password");
+    write_json(writer, k.password);
+    writer.key("server");
+    write_json(writer, k.server);
+    writer.key("type");
+    writer.value(conversions::vpnenum_to_string(k.type));
+    writer.key("user");
+    write_json(writer, k.user);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given VPN \p k to the given output stream \p os
 /// \returns an output stream with the VPN written to
 std::ostream& operator<<(std::ostream& os, const VPN& k) {
@@ -2249,6 +3315,36 @@ void from_json(const json& j, NetworkConnectionProfile& k) {
     }
 }
 
+/// \brief Writes the given NetworkConnectionProfile \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const NetworkConnectionProfile& k) {
+    writer.start_object();
+    if (k.apn) {
+        writer.key("apn");
+        write_json(writer, k.apn.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("messageTimeout");
+    write_json(writer, k.messageTimeout);
+    writer.key("ocppCsmsUrl");
+    write_json(writer, k.ocppCsmsUrl);
+    writer.key("ocppInterface");
+    writer.value(conversions::ocppinterface_enum_to_string(k.ocppInterface));
+    writer.key("ocppTransport");
+    writer.value(conversions::ocpptransport_enum_to_string(k.ocppTransport));
+    writer.key("ocppVersion");
+    writer.value(conversions::ocppversion_enum_to_string(k.ocppVersion));
+    writer.key("securityProfile");
+    write_json(writer, k.securityProfile);
+    if (k.vpn) {
+        writer.key("vpn");
+        write_json(writer, k.vpn.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given NetworkConnectionProfile \p k to the given output stream \p os
 /// \returns an output stream with the NetworkConnectionProfile written to
 std::ostream& operator<<(std::ostream& os, const NetworkConnectionProfile& k) {
@@ -2297,6 +3393,34 @@ void from_json(const json& j, SetMonitoringData& k) {
     }
 }
 
+/// \brief Writes the given SetMonitoringData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringData& k) {
+    writer.start_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.id) {
+        writer.key("id");
+        write_json(writer, k.id.value());
+    }
+    writer.key("severity");
+    write_json(writer, k.severity);
+    if (k.transaction) {
+        writer.key("transaction");
+        write_json(writer, k.transaction.value());
+    }
+    writer.key("type");
+    writer.value(conversions::monitor_enum_to_string(k.type));
+    writer.key("value");
+    write_json(writer, k.value);
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SetMonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringData written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringData& k) {
@@ -2347,6 +3471,34 @@ void from_json(const json& j, SetMonitoringResult& k) {
     }
 }
 
+/// \brief Writes the given SetMonitoringResult \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetMonitoringResult& k) {
+    writer.start_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.id) {
+        writer.key("id");
+        write_json(writer, k.id.value());
+    }
+    writer.key("severity");
+    write_json(writer, k.severity);
+    writer.key("status");
+    writer.value(conversions::set_monitoring_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.key("type");
+    writer.value(conversions::monitor_enum_to_string(k.type));
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SetMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringResult& k) {
@@ -2387,6 +3539,26 @@ void from_json(const json& j, SetVariableData& k) {
     }
 }
 
+/// \brief Writes the given SetVariableData \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableData& k) {
+    writer.start_object();
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    writer.key("attributeValue");
+    write_json(writer, k.attributeValue);
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SetVariableData \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableData written to
 std::ostream& operator<<(std::ostream& os, const SetVariableData& k) {
@@ -2433,6 +3605,30 @@ void from_json(const json& j, SetVariableResult& k) {
     }
 }
 
+/// \brief Writes the given SetVariableResult \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const SetVariableResult& k) {
+    writer.start_object();
+    writer.key("attributeStatus");
+    writer.value(conversions::set_variable_status_enum_to_string(k.attributeStatus));
+    if (k.attributeStatusInfo) {
+        writer.key("attributeStatusInfo");
+        write_json(writer, k.attributeStatusInfo.value());
+    }
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const SetVariableResult& k) {
@@ -2487,6 +3683,34 @@ void from_json(const json& j, Transaction& k) {
     }
 }
 
+/// \brief Writes the given Transaction \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Transaction& k) {
+    writer.start_object();
+    if (k.chargingState) {
+        writer.key("chargingState");
+        writer.value(conversions::charging_state_enum_to_string(k.chargingState.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.remoteStartId) {
+        writer.key("remoteStartId");
+        write_json(writer, k.remoteStartId.value());
+    }
+    if (k.stoppedReason) {
+        writer.key("stoppedReason");
+        writer.value(conversions::reason_enum_to_string(k.stoppedReason.value()));
+    }
+    if (k.timeSpentCharging) {
+        writer.key("timeSpentCharging");
+        write_json(writer, k.timeSpentCharging.value());
+    }
+    writer.key("transactionId");
+    write_json(writer, k.transactionId);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Transaction \p k to the given output stream \p os
 /// \returns an output stream with the Transaction written to
 std::ostream& operator<<(std::ostream& os, const Transaction& k) {
@@ -2537,6 +3761,32 @@ void from_json(const json& j, Firmware& k) {
     }
 }
 
+/// \brief Writes the given Firmware \p k as JSON text to the given \p writer
+void write_json(JsonWriter& writer, const Firmware& k) {
+    writer.start_object();
+    if (k.customData) {
+        writer.key("customData");
+        write_json(writer, k.customData.value());
+    }
+    if (k.installDateTime) {
+        writer.key("installDateTime");
+        write_json(writer, k.installDateTime.value());
+    }
+    writer.key("location");
+    write_json(writer, k.location);
+    writer.key("retrieveDateTime");
+    write_json(writer, k.retrieveDateTime);
+    if (k.signature) {
+        writer.key("signature");
+        write_json(writer, k.signature.value());
+    }
+    if (k.signingCertificate) {
+        writer.key("signingCertificate");
+        write_json(writer, k.signingCertificate.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Firmware \p k to the given output stream \p os
 /// \returns an output stream with the Firmware written to
 std::ostream& operator<<(std::ostream& os, const Firmware& k) {
@@ -1,28 +1,85 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <ctime>
+#include <exception>
+#include <future>
+#include <optional>
+#include <set>
 #include <thread>
 
+#include <openssl/ocsp.h>
+
 #include <everest/logging.hpp>
+#include <websocketpp_utils/base64.hpp>
 
 #include <ocpp/v2/charge_point.hpp>
+#include <ocpp/v2/database_handler.hpp>
 #include <ocpp/v2/messages/GetCertificateStatus.hpp>
 #include <ocpp/v2/ocpp_types.hpp>
 #include <ocpp/v2/ocsp_updater.hpp>
 
 namespace ocpp::v2 {
 
+namespace {
+std::string get_certificate_key(const ocpp::OCSPRequestData& ocsp_request) {
+    return ocpp::conversions::hash_algorithm_enum_type_to_string(ocsp_request.hashAlgorithm) + ":" +
+           ocsp_request.issuerNameHash + ":" + ocsp_request.issuerKeyHash + ":" + ocsp_request.serialNumber;
+}
+
+/// \brief Returns the earliest nextUpdate of the single responses in the base64 encoded DER \p ocsp_result, or
+/// std::nullopt if it cannot be parsed or has no nextUpdate
+std::optional<std::chrono::time_point<date::utc_clock>> get_ocsp_next_update(const std::string& ocsp_result) {
+    const auto der = ocpp::base64_decode(ocsp_result);
+    auto der_data = reinterpret_cast<const unsigned char*>(der.data());
+    const std::unique_ptr<OCSP_RESPONSE, decltype(&OCSP_RESPONSE_free)> response(
+        d2i_OCSP_RESPONSE(nullptr, &der_data, static_cast<long>(der.size())), &OCSP_RESPONSE_free);
+    if (response == nullptr) {
+        return std::nullopt;
+    }
+    const std::unique_ptr<OCSP_BASICRESP, decltype(&OCSP_BASICRESP_free)> basic_response(
+        OCSP_response_get1_basic(response.get()), &OCSP_BASICRESP_free);
+    if (basic_response == nullptr) {
+        return std::nullopt;
+    }
+
+    std::optional<std::chrono::time_point<date::utc_clock>> earliest_next_update;
+    for (int i = 0; i < OCSP_resp_count(basic_response.get()); i++) {
+        ASN1_GENERALIZEDTIME* next_update = nullptr;
+        OCSP_single_get0_status(OCSP_resp_get0(basic_response.get(), i), nullptr, nullptr, nullptr, &next_update);
+        std::tm tm{};
+        if (next_update == nullptr or ASN1_TIME_to_tm(next_update, &tm) != 1) {
+            continue;
+        }
+        const auto time_point = date::utc_clock::from_sys(std::chrono::system_clock::from_time_t(timegm(&tm)));
+        if (!earliest_next_update.has_value() or time_point < earliest_next_update.value()) {
+            earliest_next_update = time_point;
+        }
+    }
+    return earliest_next_update;
+}
+} // namespace
+
 OcspUpdater::OcspUpdater(std::shared_ptr<EvseSecurity> evse_security, cert_status_func get_cert_status_from_csms,
                          std::chrono::seconds ocsp_cache_update_interval,
-                         std::chrono::seconds ocsp_cache_update_retry_interval) :
+                         std::chrono::seconds ocsp_cache_update_retry_interval,
+                         std::shared_ptr<DatabaseHandlerInterface> database_handler,
+                         std::size_t max_concurrent_requests, std::chrono::seconds ocsp_refresh_margin) :
     evse_security(std::move(evse_security)),
     get_cert_status_from_csms(std::move(get_cert_status_from_csms)),
     update_deadline(std::chrono::steady_clock::now()),
     ocsp_cache_update_interval(ocsp_cache_update_interval),
     ocsp_cache_update_retry_interval(ocsp_cache_update_retry_interval),
-    running(false) {
+    running(false),
+    database_handler(std::move(database_handler)),
+    max_concurrent_requests(std::max(max_concurrent_requests, std::size_t(1))),
+    ocsp_refresh_margin(ocsp_refresh_margin),
+    refresh_state_loaded(false),
+    refresh_all(false) {
 }
 
 void OcspUpdater::start() {
@@ -52,6 +109,8 @@ void OcspUpdater::trigger_ocsp_cache_update() {
     }
     // Move the deadline to "now" so the updater thread doesn't think this is a spurious wakeup
     this->update_deadline = std::chrono::steady_clock::now();
+    // E.g. a new certificate was installed, refresh everything instead of only the responses nearing expiry
+    this->refresh_all = true;
     // Wake up the updater thread
     this->explicit_update_trigger.notify_one();
 }
@@ -75,8 +134,8 @@ void OcspUpdater::updater_thread_loop() {
         // Perform the OCPP cache update
         try {
             this->execute_ocsp_update();
-            // Successful update, set the deadline at a week from now and go back to sleep
-            this->update_deadline = std::chrono::steady_clock::now() + this->ocsp_cache_update_interval;
+            // Successful update, sleep until the first response is due for a refresh
+            this->update_deadline = this->get_next_update_deadline();
         } catch (OcspUpdateFailedException& e) {
             // Unsuccessful update
             if (e.allows_retry()) {
@@ -96,55 +155,203 @@ void OcspUpdater::updater_thread_loop() {
 }
 
 void OcspUpdater::execute_ocsp_update() {
-    auto ocsp_request_list = this->evse_security->get_v2g_ocsp_request_data();
-    std::vector<std::pair<ocpp::CertificateHashDataType, std::string>> ocsp_responses;
+    const auto ocsp_request_list = this->evse_security->get_v2g_ocsp_request_data();
+    const auto now = date::utc_clock::now();
+    this->load_refresh_state();
 
-    EVLOG_info << "libocpp: Updating OCSP cache on " << ocsp_request_list.size() << " certificates";
+    // Only the responses of certificates that are new or nearing the expiry of their cached response are requested
+    std::vector<const ocpp::OCSPRequestData*> due_requests;
+    std::set<std::string> certificate_keys;
+    for (const auto& ocsp_request : ocsp_request_list) {
+        const auto certificate_key = get_certificate_key(ocsp_request);
+        certificate_keys.insert(certificate_key);
+        const auto next_refresh = this->next_refresh.find(certificate_key);
+        if (next_refresh == this->next_refresh.end() or next_refresh->second <= now) {
+            due_requests.push_back(&ocsp_request);
+        } else if (this->refresh_all) {
+            // Marked as due, so a retry after a failure still requests it until a new response is received
+            this->set_next_refresh(certificate_key, now);
+            due_requests.push_back(&ocsp_request);
+        }
+    }
+    this->refresh_all = false;
 
-    for (auto& ocsp_request : ocsp_request_list) {
-        GetCertificateStatusRequest request;
-        switch (ocsp_request.hashAlgorithm) {
-        case HashAlgorithmEnumType::SHA256:
-            request.ocspRequestData.hashAlgorithm = ocpp::v2::HashAlgorithmEnum::SHA256;
-            break;
-        case HashAlgorithmEnumType::SHA384:
-            request.ocspRequestData.hashAlgorithm = ocpp::v2::HashAlgorithmEnum::SHA384;
-            break;
-        case HashAlgorithmEnumType::SHA512:
-            request.ocspRequestData.hashAlgorithm = ocpp::v2::HashAlgorithmEnum::SHA512;
-            break;
+    // Forget the state of certificates that are no longer installed
+    std::vector<std::string> removed_certificate_keys;
+    for (const auto& [certificate_key, next_refresh] : this->next_refresh) {
+        if (certificate_keys.count(certificate_key) == 0) {
+            removed_certificate_keys.push_back(certificate_key);
         }
-        request.ocspRequestData.issuerKeyHash = ocsp_request.issuerKeyHash;
-        request.ocspRequestData.issuerNameHash = ocsp_request.issuerNameHash;
-        request.ocspRequestData.serialNumber = ocsp_request.serialNumber;
-        request.ocspRequestData.responderURL = ocsp_request.responderUrl;
+    }
+    for (const auto& certificate_key : removed_certificate_keys) {
+        this->delete_next_refresh(certificate_key);
+    }
 
-        const auto response = this->get_cert_status_from_csms(request);
+    EVLOG_info << "libocpp: Updating OCSP cache on " << due_requests.size() << " of " << ocsp_request_list.size()
+               << " certificates";
 
-        if (response.status != GetCertificateStatusEnum::Accepted) {
-            std::string error_msg = (response.statusInfo.has_value()) ? response.statusInfo.value().reasonCode.get()
-                                                                      : "(No status info provided)";
-            throw OcspUpdateFailedException(std::string("CSMS rejected certificate status update: ") + error_msg, true);
+    // Requests are sent by up to max_concurrent_requests workers. After the first failure no new requests are started.
+    std::vector<std::optional<std::string>> ocsp_results(due_requests.size());
+    std::atomic<std::size_t> next_request_index{0};
+    std::atomic_bool failed{false};
+    std::mutex failure_mutex;
+    std::exception_ptr failure;
+    const auto worker = [&]() {
+        while (!failed) {
+            const auto index = next_request_index++;
+            if (index >= due_requests.size()) {
+                break;
+            }
+            try {
+                ocsp_results.at(index) = this->request_ocsp_result(*due_requests.at(index));
+            } catch (...) {
+                std::lock_guard<std::mutex> lk(failure_mutex);
+                if (failure == nullptr) {
+                    failure = std::current_exception();
+                }
+                failed = true;
+            }
         }
+    };
 
-        if (!response.ocspResult.has_value()) {
-            throw OcspUpdateFailedException(
-                std::string("CSMS sent an Accepted GetCertificateStatusResponse with no ocspResult"), true);
-        }
+    const auto number_of_workers = std::min(this->max_concurrent_requests, due_requests.size());
+    std::vector<std::future<void>> workers;
+    for (std::size_t i = 1; i < number_of_workers; i++) {
+        workers.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& other_worker : workers) {
+        other_worker.wait();
+    }
 
+    // Responses received before a failure are kept, so a retry only requests the remaining certificates
+    const auto received = date::utc_clock::now();
+    for (std::size_t i = 0; i < due_requests.size(); i++) {
+        if (!ocsp_results.at(i).has_value()) {
+            continue;
+        }
+        const auto& ocsp_request = *due_requests.at(i);
         ocpp::CertificateHashDataType hash_data;
         hash_data.hashAlgorithm = ocsp_request.hashAlgorithm;
         hash_data.issuerNameHash = ocsp_request.issuerNameHash;
         hash_data.issuerKeyHash = ocsp_request.issuerKeyHash;
         hash_data.serialNumber = ocsp_request.serialNumber;
-        ocsp_responses.emplace_back(std::pair(hash_data, response.ocspResult.value()));
+        this->evse_security->update_ocsp_cache(hash_data, ocsp_results.at(i).value());
+        this->set_next_refresh(get_certificate_key(ocsp_request),
+                               this->get_next_refresh(ocsp_results.at(i).value(), received));
     }
 
-    for (auto& response : ocsp_responses) {
-        this->evse_security->update_ocsp_cache(response.first, response.second);
+    if (failure != nullptr) {
+        std::rethrow_exception(failure);
     }
 
     EVLOG_info << "libocpp: Done updating OCSP cache";
 }
 
+std::string OcspUpdater::request_ocsp_result(const ocpp::OCSPRequestData& ocsp_request) {
+    GetCertificateStatusRequest request;
+    switch (ocsp_request.hashAlgorithm) {
+    case HashAlgorithmEnumType::SHA256:
+        request.ocspRequestData.hashAlgorithm = ocpp::v2::HashAlgorithmEnum::SHA256;
+        break;
+    case HashAlgorithmEnumType::SHA384:
+        request.ocspRequestData.hashAlgorithm = ocpp::v2::HashAlgorithmEnum::SHA384;
+        break;
+    case HashAlgorithmEnumType::SHA512:
+        request.ocspRequestData.hashAlgorithm = ocpp::v2::HashAlgorithmEnum::SHA512;
+        break;
+    }
+    request.ocspRequestData.issuerKeyHash = ocsp_request.issuerKeyHash;
+    request.ocspRequestData.issuerNameHash = ocsp_request.issuerNameHash;
+    request.ocspRequestData.serialNumber = ocsp_request.serialNumber;
+    request.ocspRequestData.responderURL = ocsp_request.responderUrl;
+
+    const auto response = this->get_cert_status_from_csms(request);
+
+    if (response.status != GetCertificateStatusEnum::Accepted) {
+        std::string error_msg = (response.statusInfo.has_value()) ? response.statusInfo.value().reasonCode.get()
+                                                                  : "(No status info provided)";
+        throw OcspUpdateFailedException(std::string("CSMS rejected certificate status update: ") + error_msg, true);
+    }
+
+    if (!response.ocspResult.has_value()) {
+        throw OcspUpdateFailedException(
+            std::string("CSMS sent an Accepted GetCertificateStatusResponse with no ocspResult"), true);
+    }
+
+    return response.ocspResult.value();
+}
+
+std::chrono::time_point<date::utc_clock>
+OcspUpdater::get_next_refresh(const std::string& ocsp_result, std::chrono::time_point<date::utc_clock> now) const {
+    auto next_refresh = now + this->ocsp_cache_update_interval;
+    const auto next_update = get_ocsp_next_update(ocsp_result);
+    if (!next_update.has_value()) {
+        return next_refresh;
+    }
+
+    if (next_update.value() <= now) {
+        // The CSMS sent a response that is already outdated, try again later instead of asking for it over and over
+        return std::min(next_refresh, now + this->ocsp_cache_update_retry_interval);
+    }
+    auto refresh_before_expiry = next_update.value() - this->ocsp_refresh_margin;
+    if (refresh_before_expiry <= now) {
+        // The response is valid for less than the margin, refresh it halfway to its expiry
+        refresh_before_expiry = now + (next_update.value() - now) / 2;
+    }
+    return std::min(next_refresh, refresh_before_expiry);
+}
+
+std::chrono::time_point<std::chrono::steady_clock> OcspUpdater::get_next_update_deadline() const {
+    const auto now = date::utc_clock::now();
+    std::chrono::steady_clock::duration time_until_update = this->ocsp_cache_update_interval;
+    for (const auto& [certificate_key, next_refresh] : this->next_refresh) {
+        time_until_update = std::min(
+            time_until_update, std::chrono::duration_cast<std::chrono::steady_clock::duration>(next_refresh - now));
+    }
+    return std::chrono::steady_clock::now() + std::max(time_until_update, std::chrono::steady_clock::duration(0));
+}
+
+void OcspUpdater::load_refresh_state() {
+    if (this->refresh_state_loaded) {
+        return;
+    }
+    this->refresh_state_loaded = true;
+    if (this->database_handler == nullptr) {
+        return;
+    }
+    try {
+        for (const auto& [certificate_key, next_refresh] : this->database_handler->ocsp_refresh_state_get_all()) {
+            this->next_refresh[certificate_key] = next_refresh.to_time_point();
+        }
+    } catch (const std::exception& e) {
+        EVLOG_warning << "libocpp: Could not load OCSP refresh state, refreshing all certificates: " << e.what();
+    }
+}
+
+void OcspUpdater::set_next_refresh(const std::string& certificate_key,
+                                   std::chrono::time_point<date::utc_clock> next_refresh) {
+    this->next_refresh[certificate_key] = next_refresh;
+    if (this->database_handler == nullptr) {
+        return;
+    }
+    try {
+        this->database_handler->ocsp_refresh_state_insert_or_update(certificate_key, DateTime(next_refresh));
+    } catch (const std::exception& e) {
+        EVLOG_warning << "libocpp: Could not persist OCSP refresh state: " << e.what();
+    }
+}
+
+void OcspUpdater::delete_next_refresh(const std::string& certificate_key) {
+    this->next_refresh.erase(certificate_key);
+    if (this->database_handler == nullptr) {
+        return;
+    }
+    try {
+        this->database_handler->ocsp_refresh_state_delete(certificate_key);
+    } catch (const std::exception& e) {
+        EVLOG_warning << "libocpp: Could not delete OCSP refresh state: " << e.what();
+    }
+}
+
 } // namespace ocpp::v2
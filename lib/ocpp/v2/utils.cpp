@@ -28,29 +28,51 @@ std::vector<MeasurandEnum> get_measurands_vec(const std::string& measurands_csv)
     return measurands;
 }
 
+MeasurandMask get_measurands_mask(const std::vector<MeasurandEnum>& measurands) {
+    MeasurandMask mask;
+    for (const auto measurand : measurands) {
+        mask.set(static_cast<std::size_t>(measurand));
+    }
+    return mask;
+}
+
+MeasurandMask get_measurands_mask(const std::string& measurands_csv) {
+    return get_measurands_mask(get_measurands_vec(measurands_csv));
+}
+
 bool meter_value_has_any_measurand(const MeterValue& _meter_value, const std::vector<MeasurandEnum>& measurands) {
-    auto compare = [](const SampledValue& a, MeasurandEnum b) { return a.measurand == b; };
+    return meter_value_has_any_measurand(_meter_value, get_measurands_mask(measurands));
+}
 
-    return std::find_first_of(_meter_value.sampledValue.begin(), _meter_value.sampledValue.end(), measurands.begin(),
-                              measurands.end(), compare) != _meter_value.sampledValue.end();
+bool meter_value_has_any_measurand(const MeterValue& _meter_value, const MeasurandMask& measurands_mask) {
+    return std::any_of(_meter_value.sampledValue.begin(), _meter_value.sampledValue.end(),
+                       [&measurands_mask](const SampledValue& sampled_value) {
+                           return sampled_value.measurand.has_value() and
+                                  measurands_mask.test(static_cast<std::size_t>(sampled_value.measurand.value()));
+                       });
 }
 
 MeterValue get_meter_value_with_measurands_applied(const MeterValue& _meter_value,
                                                    const std::vector<MeasurandEnum>& measurands, bool include_signed) {
-    auto meter_value = _meter_value;
-    for (auto it = meter_value.sampledValue.begin(); it != meter_value.sampledValue.end();) {
-        auto measurand = it->measurand;
-        if (measurand.has_value()) {
-            if (std::find(measurands.begin(), measurands.end(), measurand.value()) == measurands.end()) {
-                it = meter_value.sampledValue.erase(it);
-            } else {
-                if (not include_signed) {
-                    it->signedMeterValue.reset();
-                }
-                ++it;
-            }
-        } else {
-            it = meter_value.sampledValue.erase(it);
+    return get_meter_value_with_measurands_applied(_meter_value, get_measurands_mask(measurands), include_signed);
+}
+
+MeterValue get_meter_value_with_measurands_applied(const MeterValue& _meter_value, const MeasurandMask& measurands_mask,
+                                                   bool include_signed) {
+    MeterValue meter_value;
+    meter_value.timestamp = _meter_value.timestamp;
+    meter_value.customData = _meter_value.customData;
+    meter_value.sampledValue.reserve(_meter_value.sampledValue.size());
+
+    for (const auto& sampled_value : _meter_value.sampledValue) {
+        // SampledValues without a measurand are omitted as well
+        if (!sampled_value.measurand.has_value() or
+            !measurands_mask.test(static_cast<std::size_t>(sampled_value.measurand.value()))) {
+            continue;
+        }
+        auto& added = meter_value.sampledValue.emplace_back(sampled_value);
+        if (not include_signed) {
+            added.signedMeterValue.reset();
         }
     }
 
@@ -61,6 +83,17 @@ std::vector<MeterValue> get_meter_values_with_measurands_applied(
     const std::vector<MeterValue>& meter_values, const std::vector<MeasurandEnum>& sampled_tx_ended_measurands,
     const std::vector<MeasurandEnum>& aligned_tx_ended_measurands, ocpp::DateTime max_timestamp,
     bool include_sampled_signed, bool include_aligned_signed) {
+    return get_meter_values_with_measurands_applied(meter_values, get_measurands_mask(sampled_tx_ended_measurands),
+                                                    get_measurands_mask(aligned_tx_ended_measurands), max_timestamp,
+                                                    include_sampled_signed, include_aligned_signed);
+}
+
+std::vector<MeterValue> get_meter_values_with_measurands_applied(const std::vector<MeterValue>& meter_values,
+                                                                 const MeasurandMask& sampled_tx_ended_measurands,
+                                                                 const MeasurandMask& aligned_tx_ended_measurands,
+                                                                 ocpp::DateTime max_timestamp,
+                                                                 bool include_sampled_signed,
+                                                                 bool include_aligned_signed) {
     std::vector<MeterValue> meter_values_result;
 
     for (const auto& meter_value : meter_values) {
@@ -111,19 +144,44 @@ MeterValue set_meter_value_reading_context(const MeterValue& meter_value, const
     return return_value;
 }
 
+/// \brief Appends the lower case hex encoding of the given \p bytes to \p result
+static void append_hex(std::string& result, const unsigned char* bytes, std::size_t size) {
+    static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+    result.reserve(result.size() + size * 2);
+    for (std::size_t i = 0; i < size; i++) {
+        result.push_back(HEX_DIGITS[bytes[i] >> 4]);
+        result.push_back(HEX_DIGITS[bytes[i] & 0x0F]);
+    }
+}
+
 std::string sha256(const std::string& str) {
     unsigned char hash[SHA256_DIGEST_LENGTH];
     EVP_Digest(str.c_str(), str.size(), hash, NULL, EVP_sha256(), NULL);
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    for (const auto& byte : hash) {
-        ss << std::setw(2) << (int)byte;
-    }
-    return ss.str();
+
+    std::string result;
+    append_hex(result, hash, SHA256_DIGEST_LENGTH);
+    return result;
 }
 
 std::string generate_token_hash(const IdToken& token) {
-    return sha256(conversions::id_token_enum_to_string(token.type) + token.idToken.get());
+    return to_hex_string(generate_token_hash_digest(token));
+}
+
+IdTokenHashDigest generate_token_hash_digest(const IdToken& token) {
+    static_assert(std::tuple_size<IdTokenHashDigest>::value == SHA256_DIGEST_LENGTH);
+
+    const auto data = conversions::id_token_enum_to_string(token.type) + token.idToken.get();
+
+    IdTokenHashDigest digest;
+    EVP_Digest(data.c_str(), data.size(), digest.data(), NULL, EVP_sha256(), NULL);
+    return digest;
+}
+
+std::string to_hex_string(const IdTokenHashDigest& digest) {
+    std::string result;
+    append_hex(result, digest.data(), digest.size());
+    return result;
 }
 
 ocpp::DateTime align_timestamp(const DateTime timestamp, std::chrono::seconds align_interval) {
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <ocpp/common/bloom_filter.hpp>
+
+using namespace ocpp;
+
+TEST(BloomFilterTest, InsertedKeysAreContained) {
+    BloomFilter filter(1000);
+    for (int i = 0; i < 1000; i++) {
+        filter.insert("key" + std::to_string(i));
+    }
+
+    EXPECT_EQ(filter.size(), 1000);
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_TRUE(filter.may_contain("key" + std::to_string(i)));
+    }
+}
+
+TEST(BloomFilterTest, FalsePositiveRateWithinCapacity) {
+    BloomFilter filter(1000);
+    for (int i = 0; i < 1000; i++) {
+        filter.insert("key" + std::to_string(i));
+    }
+
+    int false_positives = 0;
+    for (int i = 0; i < 10000; i++) {
+        if (filter.may_contain("other" + std::to_string(i))) {
+            false_positives++;
+        }
+    }
+    EXPECT_LT(false_positives, 300);
+}
+
+TEST(BloomFilterTest, DuplicateInsertsAreCountedOnce) {
+    BloomFilter filter(10);
+    EXPECT_TRUE(filter.insert("key"));
+    EXPECT_FALSE(filter.insert("key"));
+    EXPECT_TRUE(filter.insert("other"));
+
+    EXPECT_EQ(filter.size(), 2);
+}
+
+TEST(BloomFilterTest, Clear) {
+    BloomFilter filter(10);
+    filter.insert("key");
+    filter.clear();
+
+    EXPECT_EQ(filter.size(), 0);
+    EXPECT_EQ(filter.capacity(), 10);
+    EXPECT_FALSE(filter.may_contain("key"));
+}
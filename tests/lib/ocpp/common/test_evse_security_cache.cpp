@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <ocpp/common/evse_security_cache.hpp>
+
+namespace ocpp {
+
+TEST(EvseSecurityCacheTest, VerificationResultsAreKeyedByChainAndType) {
+    EvseSecurityCache cache(std::chrono::minutes(30), 10);
+
+    EXPECT_FALSE(cache.get_verification_result("chain", LeafCertificateType::MO).has_value());
+    cache.set_verification_result("chain", LeafCertificateType::MO, CertificateValidationResult::Valid,
+                                  cache.get_generation());
+    cache.set_verification_result("other chain", LeafCertificateType::MO, CertificateValidationResult::Expired,
+                                  cache.get_generation());
+
+    EXPECT_EQ(cache.get_verification_result("chain", LeafCertificateType::MO), CertificateValidationResult::Valid);
+    EXPECT_EQ(cache.get_verification_result("other chain", LeafCertificateType::MO),
+              CertificateValidationResult::Expired);
+    EXPECT_FALSE(cache.get_verification_result("chain", LeafCertificateType::V2G).has_value());
+
+    // Unknown results may be caused by a temporary error
+    cache.set_verification_result("unknown chain", LeafCertificateType::MO, CertificateValidationResult::Unknown,
+                                  cache.get_generation());
+    EXPECT_FALSE(cache.get_verification_result("unknown chain", LeafCertificateType::MO).has_value());
+}
+
+TEST(EvseSecurityCacheTest, Invalidate) {
+    EvseSecurityCache cache(std::chrono::minutes(30), 10);
+
+    GetCertificateInfoResult leaf_certificate_info;
+    leaf_certificate_info.status = GetCertificateInfoStatus::Accepted;
+    cache.set_verification_result("chain", LeafCertificateType::MO, CertificateValidationResult::Valid,
+                                  cache.get_generation());
+    cache.set_mo_ocsp_request_data("chain", {OCSPRequestData{}}, cache.get_generation());
+    cache.set_installed_certificates({CertificateType::V2GRootCertificate}, {CertificateHashDataChain{}},
+                                     cache.get_generation());
+    cache.set_leaf_certificate_info(CertificateSigningUseEnum::V2GCertificate, true, leaf_certificate_info,
+                                    cache.get_generation());
+
+    cache.invalidate_leaf_certificate_info();
+    EXPECT_FALSE(cache.get_leaf_certificate_info(CertificateSigningUseEnum::V2GCertificate, true).has_value());
+    EXPECT_TRUE(cache.get_verification_result("chain", LeafCertificateType::MO).has_value());
+    EXPECT_EQ(cache.get_mo_ocsp_request_data("chain").value().size(), 1);
+    EXPECT_EQ(cache.get_installed_certificates({CertificateType::V2GRootCertificate}).value().size(), 1);
+    EXPECT_FALSE(cache.get_installed_certificates({CertificateType::MORootCertificate}).has_value());
+
+    cache.invalidate();
+    EXPECT_FALSE(cache.get_verification_result("chain", LeafCertificateType::MO).has_value());
+    EXPECT_FALSE(cache.get_mo_ocsp_request_data("chain").has_value());
+    EXPECT_FALSE(cache.get_installed_certificates({CertificateType::V2GRootCertificate}).has_value());
+
+    // only successful results are cached
+    leaf_certificate_info.status = GetCertificateInfoStatus::NotFound;
+    cache.set_leaf_certificate_info(CertificateSigningUseEnum::V2GCertificate, false, leaf_certificate_info,
+                                    cache.get_generation());
+    EXPECT_FALSE(cache.get_leaf_certificate_info(CertificateSigningUseEnum::V2GCertificate, false).has_value());
+}
+
+TEST(EvseSecurityCacheTest, EntriesExpire) {
+    EvseSecurityCache cache(std::chrono::seconds(1), 10);
+    cache.set_verification_result("chain", LeafCertificateType::MO, CertificateValidationResult::Valid,
+                                  cache.get_generation());
+    EXPECT_TRUE(cache.get_verification_result("chain", LeafCertificateType::MO).has_value());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    EXPECT_FALSE(cache.get_verification_result("chain", LeafCertificateType::MO).has_value());
+
+    EvseSecurityCache disabled_cache(std::chrono::seconds(0), 10);
+    disabled_cache.set_verification_result("chain", LeafCertificateType::MO, CertificateValidationResult::Valid,
+                                           disabled_cache.get_generation());
+    EXPECT_FALSE(disabled_cache.get_verification_result("chain", LeafCertificateType::MO).has_value());
+}
+
+TEST(EvseSecurityCacheTest, NumberOfChainsIsLimited) {
+    EvseSecurityCache cache(std::chrono::minutes(30), 2);
+    cache.set_verification_result("first", LeafCertificateType::MO, CertificateValidationResult::Valid,
+                                  cache.get_generation());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    cache.set_verification_result("second", LeafCertificateType::MO, CertificateValidationResult::Valid,
+                                  cache.get_generation());
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    cache.set_verification_result("third", LeafCertificateType::MO, CertificateValidationResult::Valid,
+                                  cache.get_generation());
+
+    // the entry closest to its expiry is dropped first
+    EXPECT_FALSE(cache.get_verification_result("first", LeafCertificateType::MO).has_value());
+    EXPECT_TRUE(cache.get_verification_result("second", LeafCertificateType::MO).has_value());
+    EXPECT_TRUE(cache.get_verification_result("third", LeafCertificateType::MO).has_value());
+}
+
+TEST(EvseSecurityCacheTest, ResultsComputedBeforeAnInvalidationAreNotStored) {
+    EvseSecurityCache cache(std::chrono::minutes(30), 10);
+
+    // the certificates are replaced while the results of the previously installed ones are computed
+    auto generation = cache.get_generation();
+    cache.invalidate();
+    GetCertificateInfoResult leaf_certificate_info;
+    leaf_certificate_info.status = GetCertificateInfoStatus::Accepted;
+    cache.set_verification_result("chain", LeafCertificateType::MO, CertificateValidationResult::Valid, generation);
+    cache.set_mo_ocsp_request_data("chain", {OCSPRequestData{}}, generation);
+    cache.set_installed_certificates({CertificateType::V2GRootCertificate}, {CertificateHashDataChain{}}, generation);
+    cache.set_leaf_certificate_info(CertificateSigningUseEnum::V2GCertificate, true, leaf_certificate_info,
+                                    generation);
+    EXPECT_FALSE(cache.get_verification_result("chain", LeafCertificateType::MO).has_value());
+    EXPECT_FALSE(cache.get_mo_ocsp_request_data("chain").has_value());
+    EXPECT_FALSE(cache.get_installed_certificates({CertificateType::V2GRootCertificate}).has_value());
+    EXPECT_FALSE(cache.get_leaf_certificate_info(CertificateSigningUseEnum::V2GCertificate, true).has_value());
+
+    // the same applies to the leaf certificate info, e.g. when the OCSP cache is updated
+    generation = cache.get_generation();
+    cache.invalidate_leaf_certificate_info();
+    cache.set_leaf_certificate_info(CertificateSigningUseEnum::V2GCertificate, true, leaf_certificate_info,
+                                    generation);
+    EXPECT_FALSE(cache.get_leaf_certificate_info(CertificateSigningUseEnum::V2GCertificate, true).has_value());
+
+    // results computed after the invalidation are stored
+    generation = cache.get_generation();
+    cache.set_verification_result("chain", LeafCertificateType::MO, CertificateValidationResult::Valid, generation);
+    EXPECT_EQ(cache.get_verification_result("chain", LeafCertificateType::MO), CertificateValidationResult::Valid);
+}
+
+} // namespace ocpp
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <future>
+
+#include <ocpp/common/executor.hpp>
+
+namespace ocpp {
+
+class ExecutorTest : public ::testing::Test {
+protected:
+    boost::asio::io_context io_context;
+    std::unique_ptr<boost::asio::io_context::work> work;
+    std::unique_ptr<Executor> executor;
+
+    void SetUp() override {
+        this->work = std::make_unique<boost::asio::io_context::work>(this->io_context);
+    }
+
+    void TearDown() override {
+        this->work.reset();
+        this->io_context.stop();
+        this->executor.reset();
+    }
+};
+
+TEST_F(ExecutorTest, NumberOfThreads) {
+    this->executor = std::make_unique<Executor>(this->io_context, 0);
+    EXPECT_EQ(this->executor->get_number_of_threads(), 1);
+
+    this->executor->set_number_of_threads(4);
+    EXPECT_EQ(this->executor->get_number_of_threads(), 4);
+
+    // the pool is never shrunk
+    this->executor->set_number_of_threads(2);
+    EXPECT_EQ(this->executor->get_number_of_threads(), 4);
+
+    this->io_context.stop();
+    this->executor->join();
+    EXPECT_EQ(this->executor->get_number_of_threads(), 0);
+}
+
+TEST_F(ExecutorTest, StrandKeepsOrder) {
+    this->executor = std::make_unique<Executor>(this->io_context, 4);
+    constexpr int number_of_handlers = 1000;
+    std::vector<int> order;
+    std::promise<void> done;
+
+    for (int i = 0; i < number_of_handlers; i++) {
+        // the vector is not synchronized, the strand has to make sure handlers are not run concurrently
+        this->executor->post(1, [&order, &done, i]() {
+            order.push_back(i);
+            if (i == number_of_handlers - 1) {
+                done.set_value();
+            }
+        });
+    }
+
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(order.size(), number_of_handlers);
+    for (int i = 0; i < number_of_handlers; i++) {
+        EXPECT_EQ(order.at(i), i);
+    }
+}
+
+TEST_F(ExecutorTest, BlockedStrandDoesNotBlockOtherStrands) {
+    this->executor = std::make_unique<Executor>(this->io_context, 2);
+    EXPECT_EQ(this->executor->get_strand(1), this->executor->get_strand(1));
+    EXPECT_NE(this->executor->get_strand(1), this->executor->get_strand(2));
+
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::promise<void> other_strand_done;
+    std::promise<void> blocked_strand_done;
+    auto blocked_strand_continued = blocked_strand_done.get_future();
+
+    this->executor->post(1, [released]() { released.wait(); });
+    this->executor->post(1, [&blocked_strand_done]() { blocked_strand_done.set_value(); });
+    this->executor->post(2, [&other_strand_done]() { other_strand_done.set_value(); });
+
+    EXPECT_EQ(other_strand_done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(blocked_strand_continued.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+
+    release.set_value();
+    EXPECT_EQ(blocked_strand_continued.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
+
+} // namespace ocpp
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include <nlohmann/json.hpp>
+
+#include <ocpp/common/json_writer.hpp>
+
+namespace ocpp {
+
+TEST(JsonWriterTest, StringsAreEscapedLikeJsonDump) {
+    const std::vector<std::string> strings = {
+        "", "plain", "quote \" and backslash \\", "\b\f\n\r\t", std::string("\x01\x1f\x00", 3), "ümlaut €"};
+    for (const auto& string : strings) {
+        EXPECT_EQ(to_json_string(string), json(string).dump());
+    }
+}
+
+TEST(JsonWriterTest, InvalidUtf8ThrowsLikeJsonDump) {
+    const std::vector<std::string> strings = {
+        "\xff",             // never valid
+        "a\xc3",            // truncated sequence
+        "\xc0\xaf",         // overlong encoding
+        "\xed\xa0\x80",     // surrogate
+        "\xf4\x90\x80\x80", // above U+10FFFF
+        "\xe2\x82x",        // invalid continuation byte
+    };
+    for (const auto& string : strings) {
+        std::string expected_what;
+        try {
+            json(string).dump();
+        } catch (const json::type_error& e) {
+            expected_what = e.what();
+        }
+        ASSERT_FALSE(expected_what.empty());
+        try {
+            to_json_string(string);
+            ADD_FAILURE() << "no exception for invalid UTF-8";
+        } catch (const json::type_error& e) {
+            EXPECT_EQ(e.id, 316);
+            EXPECT_EQ(e.what(), expected_what);
+        }
+    }
+    EXPECT_EQ(to_json_string(std::string("\xf0\x9f\x94\x8c")), json("\xf0\x9f\x94\x8c").dump());
+}
+
+TEST(JsonWriterTest, NumbersAreWrittenLikeJsonDump) {
+    for (const int32_t value : {0, -1, 42, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()}) {
+        EXPECT_EQ(to_json_string(value), json(value).dump());
+    }
+    for (const float value : {0.0f, 5.0f, -0.5f, 0.1f, 230.7f, 1e20f, 3.4e-12f, 1e-5f, 0.001f, 123456.78f}) {
+        EXPECT_EQ(to_json_string(value), json(value).dump());
+        EXPECT_EQ(json::parse(to_json_string(value)), json(value));
+    }
+    EXPECT_EQ(to_json_string(std::numeric_limits<double>::quiet_NaN()), "null");
+    EXPECT_EQ(to_json_string(true), "true");
+}
+
+TEST(JsonWriterTest, NestedObjectsAndArrays) {
+    std::string buffer;
+    JsonWriter writer(buffer);
+    writer.start_object();
+    writer.key("a");
+    writer.start_array();
+    writer.value(1);
+    writer.start_object();
+    writer.end_object();
+    writer.start_array();
+    writer.end_array();
+    writer.value("b");
+    writer.end_array();
+    writer.key("c");
+    write_json(writer, json{{"d", nullptr}});
+    writer.key("e");
+    write_json(writer, std::vector<CiString<5>>{"x", "y"});
+    writer.end_object();
+
+    const json expected = {{"a", {1, json::object(), json::array(), "b"}}, {"c", {{"d", nullptr}}}, {"e", {"x", "y"}}};
+    EXPECT_EQ(buffer, expected.dump());
+}
+
+} // namespace ocpp
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <ocpp/common/latency_histogram.hpp>
+
+namespace ocpp {
+
+TEST(LatencyHistogramTest, BucketsCoverTheWholeRange) {
+    EXPECT_EQ(LatencyHistogram::get_bucket_index(0), 0);
+    EXPECT_EQ(LatencyHistogram::get_bucket_index(3), 3);
+    EXPECT_EQ(LatencyHistogram::get_bucket_index(4), 4);
+    EXPECT_EQ(LatencyHistogram::get_bucket_index(std::numeric_limits<uint64_t>::max()),
+              LatencyHistogram::NUMBER_OF_BUCKETS - 1);
+
+    // every value is recorded in the bucket whose upper bound is the first one not below the value
+    for (uint64_t value : {5, 9, 10, 100, 1000, 123456, 999999999}) {
+        const auto index = LatencyHistogram::get_bucket_index(value);
+        EXPECT_GE(LatencyHistogram::get_bucket_upper_bound(index).count(), value);
+        EXPECT_LT(LatencyHistogram::get_bucket_upper_bound(index - 1).count(), value);
+        // relative error of a bucket is at most 1 / SUB_BUCKETS
+        EXPECT_LE(LatencyHistogram::get_bucket_upper_bound(index).count() - value,
+                  value / LatencyHistogram::SUB_BUCKETS);
+    }
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.get_snapshot().percentile(0.5).count(), 0);
+
+    for (int i = 1; i <= 100; i++) {
+        histogram.record(std::chrono::milliseconds(i));
+    }
+    histogram.record(std::chrono::microseconds(-5));
+
+    const auto snapshot = histogram.get_snapshot();
+    EXPECT_EQ(snapshot.count, 101);
+    EXPECT_EQ(snapshot.max, std::chrono::milliseconds(100));
+    EXPECT_EQ(snapshot.sum, std::chrono::milliseconds(5050));
+    EXPECT_EQ(snapshot.buckets.at(0), 1);
+
+    const auto median = snapshot.percentile(0.5);
+    EXPECT_GE(median, std::chrono::milliseconds(50));
+    EXPECT_LE(median, std::chrono::milliseconds(50) * 5 / 4);
+    EXPECT_EQ(snapshot.percentile(1.0), snapshot.max);
+    EXPECT_EQ(snapshot.percentile(0.0), std::chrono::microseconds(0));
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecording) {
+    LatencyHistogram histogram;
+    constexpr int number_of_threads = 4;
+    constexpr int values_per_thread = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < number_of_threads; t++) {
+        threads.emplace_back([&histogram, t]() {
+            for (int i = 0; i < values_per_thread; i++) {
+                histogram.record(std::chrono::microseconds(t * values_per_thread + i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto snapshot = histogram.get_snapshot();
+    EXPECT_EQ(snapshot.count, number_of_threads * values_per_thread);
+    EXPECT_EQ(snapshot.max, std::chrono::microseconds(number_of_threads * values_per_thread - 1));
+    uint64_t bucket_sum = 0;
+    for (const auto bucket : snapshot.buckets) {
+        bucket_sum += bucket;
+    }
+    EXPECT_EQ(bucket_sum, snapshot.count);
+}
+
+} // namespace ocpp
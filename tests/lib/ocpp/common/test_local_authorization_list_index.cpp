@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include <ocpp/common/database/local_authorization_list_index.hpp>
+
+using namespace ocpp::common;
+
+class LocalAuthorizationListIndexTest : public ::testing::Test {
+protected:
+    std::vector<std::string> keys;
+    int loads = 0;
+    LocalAuthorizationListIndex index{[this]() {
+        this->loads++;
+        return this->keys;
+    }};
+
+    /// \brief Updates the index the way the database handlers do, \p keys is the committed state of the database
+    void update(const std::vector<std::string>& inserted_keys, const std::vector<std::string>& removed_keys) {
+        this->index.update(inserted_keys, removed_keys, [&]() {
+            for (const auto& key : inserted_keys) {
+                this->keys.push_back(key);
+            }
+        });
+    }
+};
+
+TEST_F(LocalAuthorizationListIndexTest, InsertedKeysAreContainedAfterCommit) {
+    EXPECT_FALSE(this->index.may_contain("key"));
+    EXPECT_EQ(this->loads, 1);
+
+    this->index.update({"key"}, {}, [this]() {
+        // the commit happens while the index is locked, so no lookup can see the committed key as absent
+        this->keys.push_back("key");
+    });
+    EXPECT_TRUE(this->index.may_contain("key"));
+    EXPECT_EQ(this->loads, 1);
+}
+
+TEST_F(LocalAuthorizationListIndexTest, FailedCommitInvalidatesIndex) {
+    EXPECT_FALSE(this->index.may_contain("key"));
+
+    EXPECT_THROW(this->index.update({"key"}, {},
+                                    [this]() {
+                                        this->keys.push_back("key");
+                                        throw std::runtime_error("commit failed");
+                                    }),
+                 std::runtime_error);
+
+    // the index does not know which part of the update was committed and is rebuilt from the database
+    EXPECT_TRUE(this->index.may_contain("key"));
+    EXPECT_EQ(this->loads, 2);
+}
+
+TEST_F(LocalAuthorizationListIndexTest, RepeatedUpdatesOfSameKeysDoNotCauseRebuild) {
+    std::vector<std::string> list;
+    for (int i = 0; i < 100; i++) {
+        list.push_back("key" + std::to_string(i));
+    }
+    update(list, {});
+    EXPECT_TRUE(this->index.may_contain("key0"));
+    EXPECT_EQ(this->loads, 1);
+
+    // updating the same entries many times does not fill up the filter
+    for (int i = 0; i < 50; i++) {
+        this->index.update(list, {}, []() {});
+    }
+    EXPECT_TRUE(this->index.may_contain("key0"));
+    EXPECT_EQ(this->loads, 1);
+}
@@ -127,6 +127,14 @@ template <> bool ControlMessage<TestMessageType>::is_transaction_update_message(
     return this->messageType == TestMessageType::TRANSACTIONAL_UPDATE;
 }
 
+template <> bool ControlMessage<TestMessageType>::is_periodic_transaction_update_message() const {
+    return this->is_transaction_update_message();
+}
+
+template <> std::string ControlMessage<TestMessageType>::get_transaction_key() const {
+    return "";
+}
+
 bool is_boot_notification_message(const TestMessageType message_type) {
     return message_type == TestMessageType::BootNotification;
 }
@@ -480,4 +488,221 @@ TEST_F(MessageQueueTest, test_clean_up_transactional_queue) {
     wait_for_calls(expected_sent_messages);
 }
 
+// \brief Test that sent messages and their in flight time are counted per message type
+TEST_F(MessageQueueTest, test_metrics_of_sent_messages) {
+    config.queues_total_size_threshold = 10;
+    restart_message_queue();
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).WillRepeatedly(MarkAndReturn(true, true));
+
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    push_message_call(TestMessageType::TRANSACTIONAL);
+    wait_for_calls(3);
+
+    // responses are received asynchronously
+    MessageQueueMetricsSnapshot metrics;
+    const auto number_of_responses = [&metrics]() {
+        return metrics.message_types["non_transactional"].in_flight_time.count +
+               metrics.message_types["transactional"].in_flight_time.count;
+    };
+    const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    do {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        metrics = message_queue->get_metrics();
+    } while (number_of_responses() < 3 and std::chrono::steady_clock::now() < end);
+
+    EXPECT_EQ(metrics.message_types.at("non_transactional").sent, 2);
+    EXPECT_EQ(metrics.message_types.at("non_transactional").in_flight_time.count, 2);
+    EXPECT_EQ(metrics.message_types.at("transactional").sent, 1);
+    EXPECT_EQ(metrics.message_types.at("transactional").in_flight_time.count, 1);
+    EXPECT_EQ(metrics.message_types.at("transactional").retries, 0);
+    EXPECT_EQ(metrics.normal_queue_size, 0);
+    EXPECT_EQ(metrics.transaction_queue_size, 0);
+    EXPECT_GE(metrics.max_normal_queue_size + metrics.max_transaction_queue_size, 1);
+}
+
+// \brief Test that messages dropped because of the queue size threshold are counted
+TEST_F(MessageQueueTest, test_metrics_of_dropped_messages) {
+    message_queue->pause();
+
+    push_message_call(TestMessageType::TRANSACTIONAL);
+    push_message_call(TestMessageType::TRANSACTIONAL_UPDATE);
+    push_message_call(TestMessageType::TRANSACTIONAL_UPDATE);
+    push_message_call(TestMessageType::TRANSACTIONAL);
+
+    const auto metrics = message_queue->get_metrics();
+    EXPECT_EQ(metrics.dropped_transaction_messages, 1);
+    EXPECT_EQ(metrics.dropped_normal_messages, 0);
+    EXPECT_EQ(metrics.message_types.at("transactional_update").dropped, 1);
+    EXPECT_EQ(metrics.transaction_queue_size, 3);
+    EXPECT_EQ(metrics.max_transaction_queue_size, 4);
+}
+
+// \brief Test that up to max_pipelined_calls CALLs of a pipelined message type are sent before a response is received
+TEST_F(MessageQueueTest, test_pipelining_of_non_transactional_messages) {
+    config.queues_total_size_threshold = 10;
+    config.max_pipelined_calls = 3;
+    config.pipelined_message_types = {TestMessageType::NON_TRANSACTIONAL};
+    restart_message_queue();
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).WillRepeatedly(MarkAndReturn(true));
+
+    const auto first_call = push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    wait_for_calls(3);
+
+    // the window is full, the fourth message waits for a response
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(get_call_count(), 3);
+
+    message_queue->receive(json{3, first_call, ""}.dump());
+    wait_for_calls(4);
+    EXPECT_EQ(message_queue->get_metrics().message_types.at("non_transactional").in_flight_time.count, 1);
+}
+
+// \brief Test that a transactional message is only sent once all pipelined CALLs have been answered
+TEST_F(MessageQueueTest, test_transactional_message_waits_for_pipelined_messages) {
+    config.queues_total_size_threshold = 10;
+    config.max_pipelined_calls = 3;
+    config.pipelined_message_types = {TestMessageType::NON_TRANSACTIONAL, TestMessageType::TRANSACTIONAL};
+    restart_message_queue();
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).WillRepeatedly(MarkAndReturn(true));
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, testing::_));
+
+    const auto first_call = push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    const auto second_call = push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    wait_for_calls(2);
+    push_message_call(TestMessageType::TRANSACTIONAL);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(get_call_count(), 2);
+
+    message_queue->receive(json{3, first_call, ""}.dump());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(get_call_count(), 2);
+
+    message_queue->receive(json{3, second_call, ""}.dump());
+    wait_for_calls(3);
+}
+
+
+// \brief Test that a message of a higher priority class is not delayed by a backlog of transactional messages
+TEST_F(MessageQueueTest, test_high_priority_message_overtakes_transactional_backlog) {
+    config.queues_total_size_threshold = 10;
+    config.priority_weights = parse_message_priority_values("High:8,Normal:4,Transaction:2,Low:1");
+    config.message_priorities = {{TestMessageType::NON_TRANSACTIONAL, MessagePriority::High}};
+    config.queue_all_messages = true;
+    restart_message_queue();
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, QueueType::Transaction)).Times(5);
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, QueueType::Transaction)).Times(5);
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, QueueType::Normal));
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, QueueType::Normal));
+
+    const auto message_type_is = [](const std::string& message_type) {
+        return testing::Truly([message_type](const json& message) { return message.at(2) == message_type; });
+    };
+    testing::Sequence s;
+    EXPECT_CALL(send_callback_mock, Call(message_type_is("non_transactional")))
+        .InSequence(s)
+        .WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock, Call(message_type_is("transactional")))
+        .Times(5)
+        .InSequence(s)
+        .WillRepeatedly(MarkAndReturn(true, true));
+
+    message_queue->pause();
+    for (int i = 0; i < 5; i++) {
+        push_message_call(TestMessageType::TRANSACTIONAL);
+    }
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    message_queue->resume(std::chrono::seconds(0));
+
+    wait_for_calls(6);
+}
+
+// \brief Test that the oldest messages of a priority class are dropped if the class exceeds its queue limit
+TEST_F(MessageQueueTest, test_priority_queue_limit) {
+    config.queues_total_size_threshold = 10;
+    config.priority_queue_limits = {{MessagePriority::Normal, 2}};
+    config.queue_all_messages = true;
+    restart_message_queue();
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, QueueType::Normal)).Times(4);
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, QueueType::Normal)).Times(2);
+    message_queue->pause();
+
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+
+    const auto metrics = message_queue->get_metrics();
+    EXPECT_EQ(metrics.dropped_normal_messages, 2);
+    EXPECT_EQ(metrics.message_types.at("non_transactional").dropped, 2);
+    EXPECT_EQ(metrics.normal_queue_size, 2);
+}
+
+// \brief Test that the periodic updates of a transaction are thinned out before the queue is resumed
+TEST_F(MessageQueueTest, test_compaction_of_transaction_updates) {
+    config.queues_total_size_threshold = 20;
+    config.transaction_update_compaction_interval_seconds = 60;
+    restart_message_queue();
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).WillRepeatedly(MarkAndReturn(true, true));
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, QueueType::Transaction)).Times(9);
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, QueueType::Transaction)).Times(9);
+
+    message_queue->pause();
+    push_message_call(TestMessageType::TRANSACTIONAL);
+    for (int i = 0; i < 5; i++) {
+        push_message_call(TestMessageType::TRANSACTIONAL_UPDATE);
+    }
+    push_message_call(TestMessageType::TRANSACTIONAL);
+    push_message_call(TestMessageType::TRANSACTIONAL_UPDATE);
+    push_message_call(TestMessageType::TRANSACTIONAL_UPDATE);
+    message_queue->resume(std::chrono::seconds(0));
+
+    // the first and the last update between two other transaction messages are kept
+    wait_for_calls(6);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(get_call_count(), 6);
+    const auto metrics = message_queue->get_metrics();
+    EXPECT_EQ(metrics.dropped_transaction_messages, 3);
+    EXPECT_EQ(metrics.message_types.at("transactional_update").dropped, 3);
+}
+
+// \brief Test that serialized call results are handed to the serialized send callback if there is one
+TEST_F(MessageQueueTest, test_serialized_call_result_is_sent) {
+    const std::string call_result = R"([3,"result_id",{"status":"Accepted"}])";
+    EXPECT_CALL(send_callback_mock, Call(json::parse(call_result))).WillOnce(MarkAndReturn(true));
+    message_queue->push_serialized_call_result(call_result, MessageId("result_id"));
+    wait_for_calls(1);
+
+    testing::MockFunction<bool(const std::string& message)> serialized_send_callback_mock;
+    EXPECT_CALL(serialized_send_callback_mock, Call(call_result)).WillOnce(testing::Return(true));
+    message_queue->set_serialized_send_callback(serialized_send_callback_mock.AsStdFunction());
+    message_queue->push_serialized_call_result(call_result, MessageId("result_id"));
+}
+
+// \brief Test that a call serialized when it is pushed is sent without serializing the json message again
+TEST_F(MessageQueueTest, test_serialized_call_is_sent) {
+    Call<TestRequest> call;
+    call.msg.type = TestMessageType::TRANSACTIONAL;
+    call.msg.data = "test_data";
+    call.uniqueId = "0";
+    const std::string serialized_call = R"([2,"0","transactional",{"data":"test_data"}])";
+
+    std::promise<void> sent;
+    testing::MockFunction<bool(const std::string& message)> serialized_send_callback_mock;
+    EXPECT_CALL(serialized_send_callback_mock, Call(serialized_call)).WillOnce([&sent](const std::string&) {
+        sent.set_value();
+        return true;
+    });
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).Times(0);
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, testing::_));
+    message_queue->set_serialized_send_callback(serialized_send_callback_mock.AsStdFunction());
+    message_queue->push_serialized_call(call, serialized_call);
+
+    EXPECT_EQ(sent.get_future().wait_for(std::chrono::seconds(3)), std::future_status::ready);
+}
+
 } // namespace ocpp
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <fstream>
+
+#include <ocpp/common/database/database_exceptions.hpp>
+#include <ocpp/common/message_queue_segment_log.hpp>
+
+namespace ocpp::common {
+
+class MessageQueueSegmentLogTest : public ::testing::Test {
+protected:
+    fs::path directory;
+
+    void SetUp() override {
+        const std::string test_name = testing::UnitTest::GetInstance()->current_test_info()->name();
+        this->directory = fs::temp_directory_path() / ("libocpp_segment_log_" + test_name);
+        fs::remove_all(this->directory);
+    }
+
+    void TearDown() override {
+        fs::remove_all(this->directory);
+    }
+
+    std::vector<fs::path> get_segments() {
+        std::vector<fs::path> segments;
+        for (const auto& entry : fs::directory_iterator(this->directory)) {
+            segments.push_back(entry.path());
+        }
+        std::sort(segments.begin(), segments.end());
+        return segments;
+    }
+
+    static DBTransactionMessage make_message(const std::string& unique_id) {
+        return DBTransactionMessage{json{2, unique_id, "MeterValues", json{{"connectorId", 1}}}, "MeterValues", 1,
+                                    DateTime(), unique_id};
+    }
+
+    static std::vector<std::string> get_unique_ids(const std::vector<DBTransactionMessage>& messages) {
+        std::vector<std::string> unique_ids;
+        for (const auto& message : messages) {
+            unique_ids.push_back(message.unique_id);
+        }
+        return unique_ids;
+    }
+};
+
+TEST_F(MessageQueueSegmentLogTest, MessagesAreRecoveredInInsertionOrder) {
+    {
+        MessageQueueSegmentLog log(this->directory);
+        log.insert_message_queue_message(make_message("1"));
+        log.insert_message_queue_message(make_message("2"));
+        log.insert_message_queue_message(make_message("3"));
+        log.insert_message_queue_message(make_message("4"), QueueType::Normal);
+        log.remove_message_queue_message("2");
+        EXPECT_THROW(log.insert_message_queue_message(make_message("1")), QueryExecutionException);
+    }
+
+    MessageQueueSegmentLog log(this->directory);
+    const auto messages = log.get_message_queue_messages();
+    EXPECT_EQ(get_unique_ids(messages), (std::vector<std::string>{"1", "3"}));
+    EXPECT_EQ(messages.at(0).json_message, make_message("1").json_message);
+    EXPECT_EQ(messages.at(0).message_type, "MeterValues");
+    EXPECT_EQ(messages.at(0).message_attempts, 1);
+    EXPECT_EQ(get_unique_ids(log.get_message_queue_messages(QueueType::Normal)), (std::vector<std::string>{"4"}));
+
+    log.clear_message_queue(QueueType::Normal);
+    EXPECT_TRUE(log.get_message_queue_messages(QueueType::Normal).empty());
+    EXPECT_EQ(log.get_message_queue_messages().size(), 2);
+}
+
+TEST_F(MessageQueueSegmentLogTest, TornRecordIsDiscarded) {
+    {
+        MessageQueueSegmentLog log(this->directory);
+        log.insert_message_queue_message(make_message("1"));
+        log.insert_message_queue_message(make_message("2"));
+    }
+    const auto segment = this->get_segments().back();
+    const auto size = fs::file_size(segment);
+    // cut the last record in half, like a power loss during the write would
+    fs::resize_file(segment, size - 10);
+
+    {
+        MessageQueueSegmentLog log(this->directory);
+        EXPECT_EQ(get_unique_ids(log.get_message_queue_messages()), (std::vector<std::string>{"1"}));
+        log.insert_message_queue_message(make_message("3"));
+    }
+
+    MessageQueueSegmentLog log(this->directory);
+    EXPECT_EQ(get_unique_ids(log.get_message_queue_messages()), (std::vector<std::string>{"1", "3"}));
+}
+
+TEST_F(MessageQueueSegmentLogTest, CorruptedRecordIsDiscarded) {
+    {
+        MessageQueueSegmentLog log(this->directory);
+        log.insert_message_queue_message(make_message("1"));
+        log.insert_message_queue_message(make_message("2"));
+    }
+    const auto segment = this->get_segments().back();
+    {
+        std::fstream file(segment, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(fs::file_size(segment) - 5);
+        file.put('x');
+    }
+
+    MessageQueueSegmentLog log(this->directory);
+    EXPECT_EQ(get_unique_ids(log.get_message_queue_messages()), (std::vector<std::string>{"1"}));
+}
+
+TEST_F(MessageQueueSegmentLogTest, LogIsCompacted) {
+    {
+        MessageQueueSegmentLog log(this->directory, 1024, false);
+        for (int i = 0; i < 100; i++) {
+            log.insert_message_queue_message(make_message(std::to_string(i)));
+            if (i % 10 != 0) {
+                log.remove_message_queue_message(std::to_string(i));
+            }
+        }
+    }
+
+    std::uintmax_t log_size = 0;
+    for (const auto& segment : this->get_segments()) {
+        log_size += fs::file_size(segment);
+    }
+    EXPECT_LT(log_size, 4 * 1024);
+
+    MessageQueueSegmentLog log(this->directory, 1024, false);
+    EXPECT_EQ(get_unique_ids(log.get_message_queue_messages()),
+              (std::vector<std::string>{"0", "10", "20", "30", "40", "50", "60", "70", "80", "90"}));
+}
+
+TEST_F(MessageQueueSegmentLogTest, MessagesAreMovedInOrder) {
+    MessageQueueSegmentLog source(this->directory / "source");
+    source.insert_message_queue_message(make_message("1"));
+    source.insert_message_queue_message(make_message("2"));
+    source.insert_message_queue_message(make_message("3"), QueueType::Normal);
+
+    // the message of an interrupted move is not inserted twice
+    MessageQueueSegmentLog destination(this->directory / "destination");
+    destination.insert_message_queue_message(make_message("1"));
+
+    EXPECT_EQ(move_message_queue_messages(source, destination), 2);
+    EXPECT_EQ(get_unique_ids(destination.get_message_queue_messages()), (std::vector<std::string>{"1", "2"}));
+    EXPECT_EQ(get_unique_ids(destination.get_message_queue_messages(QueueType::Normal)),
+              (std::vector<std::string>{"3"}));
+    EXPECT_TRUE(source.get_message_queue_messages().empty());
+    EXPECT_TRUE(source.get_message_queue_messages(QueueType::Normal).empty());
+}
+
+TEST_F(MessageQueueSegmentLogTest, QueuedMessagesAreMovedWhenStorageIsChanged) {
+    // a second log stands in for the database
+    const auto database = std::make_shared<MessageQueueSegmentLog>(this->directory / "database");
+    database->insert_message_queue_message(make_message("1"));
+    const auto segment_log_directory = this->directory / "segment_log";
+
+    {
+        const auto selection = open_message_queue_persistence(database, segment_log_directory, std::nullopt);
+        EXPECT_NE(selection.persistence, database);
+        EXPECT_EQ(selection.segment_log_directory, segment_log_directory);
+        EXPECT_TRUE(database->get_message_queue_messages().empty());
+        selection.persistence->insert_message_queue_message(make_message("2"));
+    }
+
+    // the configured directory is removed, the messages of the log used before are moved back to the database
+    const auto selection = open_message_queue_persistence(database, std::nullopt, segment_log_directory);
+    EXPECT_EQ(selection.persistence, database);
+    EXPECT_FALSE(selection.segment_log_directory.has_value());
+    EXPECT_EQ(get_unique_ids(database->get_message_queue_messages()), (std::vector<std::string>{"1", "2"}));
+}
+
+TEST_F(MessageQueueSegmentLogTest, DatabaseIsUsedIfLogCanNotBeOpened) {
+    const auto database = std::make_shared<MessageQueueSegmentLog>(this->directory / "database");
+    database->insert_message_queue_message(make_message("1"));
+    const auto segment_log_directory = this->directory / "file";
+    std::ofstream(segment_log_directory) << "not a directory";
+
+    // the directory is remembered, because the log may contain queued messages once it can be opened again
+    const auto selection = open_message_queue_persistence(database, segment_log_directory, std::nullopt);
+    EXPECT_EQ(selection.persistence, database);
+    EXPECT_EQ(selection.segment_log_directory, segment_log_directory);
+    EXPECT_EQ(get_unique_ids(database->get_message_queue_messages()), (std::vector<std::string>{"1"}));
+}
+
+} // namespace ocpp::common
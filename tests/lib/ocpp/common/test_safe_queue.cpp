@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ocpp/common/safe_queue.hpp>
+
+namespace ocpp {
+
+TEST(SafeQueueTest, DrainIntoAppendsAllElementsInOrder) {
+    SafeQueue<std::string> queue;
+    std::vector<std::string> elements{"pending"};
+
+    EXPECT_EQ(queue.drain_into(elements), 0);
+    EXPECT_EQ(elements.size(), 1);
+
+    queue.push("first");
+    queue.push("second");
+    queue.push("third");
+
+    EXPECT_EQ(queue.drain_into(elements), 3);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(elements, (std::vector<std::string>{"pending", "first", "second", "third"}));
+}
+
+TEST(SafeQueueTest, DrainIntoWhileProducing) {
+    SafeQueue<int> queue;
+    constexpr int number_of_elements = 10000;
+
+    std::thread producer([&queue]() {
+        for (int i = 0; i < number_of_elements; i++) {
+            queue.push(i);
+        }
+    });
+
+    std::vector<int> elements;
+    while (elements.size() < static_cast<std::size_t>(number_of_elements)) {
+        queue.wait_on_queue_element(std::chrono::milliseconds(100));
+        queue.drain_into(elements);
+    }
+    producer.join();
+
+    // the elements of a single producer keep their order across batches
+    for (int i = 0; i < number_of_elements; i++) {
+        ASSERT_EQ(elements.at(i), i);
+    }
+}
+
+} // namespace ocpp
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <ocpp/common/timer_service.hpp>
+
+namespace ocpp {
+
+class TimerServiceTest : public ::testing::Test {
+protected:
+    boost::asio::io_context io_context;
+    std::shared_ptr<TimerService> timer_service;
+
+    void SetUp() override {
+        this->timer_service = std::make_shared<TimerService>(this->io_context, std::chrono::milliseconds(10));
+    }
+
+    /// \brief Runs the io_context until \p done returns true or \p timeout has passed
+    bool run_until(const std::function<bool()>& done, std::chrono::milliseconds timeout = std::chrono::seconds(2)) {
+        const auto end = std::chrono::steady_clock::now() + timeout;
+        while (!done() and std::chrono::steady_clock::now() < end) {
+            this->io_context.run_one_for(std::chrono::milliseconds(10));
+        }
+        return done();
+    }
+};
+
+TEST_F(TimerServiceTest, TimeoutRunsOnceAfterDelay) {
+    int calls = 0;
+    const auto start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point called_at;
+    this->timer_service->timeout(
+        [&]() {
+            calls++;
+            called_at = std::chrono::steady_clock::now();
+        },
+        std::chrono::milliseconds(30));
+
+    ASSERT_TRUE(this->run_until([&]() { return calls == 1; }));
+    EXPECT_GE(called_at - start, std::chrono::milliseconds(30));
+
+    this->run_until([]() { return false; }, std::chrono::milliseconds(50));
+    EXPECT_EQ(calls, 1);
+}
+
+TEST_F(TimerServiceTest, IntervalRunsRepeatedly) {
+    int calls = 0;
+    const auto id = this->timer_service->interval([&]() { calls++; }, std::chrono::milliseconds(10));
+    ASSERT_TRUE(this->run_until([&]() { return calls >= 3; }));
+    EXPECT_TRUE(this->timer_service->is_scheduled(id));
+
+    this->timer_service->cancel(id);
+    const auto calls_after_cancel = calls;
+    this->run_until([]() { return false; }, std::chrono::milliseconds(50));
+    EXPECT_EQ(calls, calls_after_cancel);
+    EXPECT_FALSE(this->timer_service->is_scheduled(id));
+}
+
+TEST_F(TimerServiceTest, CancelledTimeoutDoesNotRun) {
+    bool called = false;
+    const auto id = this->timer_service->timeout([&]() { called = true; }, std::chrono::milliseconds(10));
+    this->timer_service->cancel(id);
+    this->run_until([]() { return false; }, std::chrono::milliseconds(50));
+    EXPECT_FALSE(called);
+}
+
+TEST_F(TimerServiceTest, TimersDueInTheSameTickShareOneWakeup) {
+    constexpr int number_of_timers = 100;
+    int calls = 0;
+    for (int i = 0; i < number_of_timers; i++) {
+        this->timer_service->timeout([&]() { calls++; }, std::chrono::milliseconds(100));
+    }
+
+    ASSERT_TRUE(this->run_until([&]() { return calls == number_of_timers; }));
+    const auto metrics = this->timer_service->get_metrics();
+    EXPECT_EQ(metrics.callbacks, number_of_timers);
+    // all timers are scheduled within a few microseconds, so they end up in at most two ticks
+    EXPECT_LE(metrics.wakeups, 2);
+    EXPECT_GE(metrics.total_lag.count(), 0);
+}
+
+TEST_F(TimerServiceTest, CallbackCanCancelTimerDueInTheSameWakeup) {
+    bool second_called = false;
+    TimerService::TimerId second_id = 0;
+    this->timer_service->timeout([&]() { this->timer_service->cancel(second_id); }, std::chrono::milliseconds(20));
+    second_id = this->timer_service->timeout([&]() { second_called = true; }, std::chrono::milliseconds(20));
+
+    this->run_until([]() { return false; }, std::chrono::milliseconds(80));
+    EXPECT_FALSE(second_called);
+}
+
+TEST_F(TimerServiceTest, CallbacksRunOnTheirStrand) {
+    const auto strand = std::make_shared<Strand>(this->io_context.get_executor());
+    std::optional<bool> on_strand;
+    this->timer_service->timeout([&]() { on_strand = strand->running_in_this_thread(); }, std::chrono::milliseconds(10),
+                                 strand);
+
+    ASSERT_TRUE(this->run_until([&]() { return on_strand.has_value(); }));
+    EXPECT_TRUE(on_strand.value());
+}
+
+TEST_F(TimerServiceTest, CallbacksWithoutStrandRunOnTheDefaultStrand) {
+    const auto default_strand = std::make_shared<Strand>(this->io_context.get_executor());
+    const auto timer_service =
+        std::make_shared<TimerService>(this->io_context, std::chrono::milliseconds(10), default_strand);
+    std::optional<bool> on_strand;
+    timer_service->timeout([&]() { on_strand = default_strand->running_in_this_thread(); },
+                           std::chrono::milliseconds(10));
+
+    ASSERT_TRUE(this->run_until([&]() { return on_strand.has_value(); }));
+    EXPECT_TRUE(on_strand.value());
+}
+
+TEST_F(TimerServiceTest, BatchedTimer) {
+    int calls = 0;
+    auto timer = std::make_unique<BatchedTimer>(this->timer_service, [&]() { calls++; });
+    EXPECT_FALSE(timer->is_running());
+
+    timer->interval(std::chrono::milliseconds(10));
+    EXPECT_TRUE(timer->is_running());
+    ASSERT_TRUE(this->run_until([&]() { return calls >= 2; }));
+
+    // restarting replaces the running interval
+    timer->timeout(std::chrono::milliseconds(10));
+    const auto calls_before_timeout = calls;
+    ASSERT_TRUE(this->run_until([&]() { return calls == calls_before_timeout + 1; }));
+    EXPECT_FALSE(timer->is_running());
+
+    // destroying the timer stops it
+    timer->interval(std::chrono::milliseconds(10));
+    timer.reset();
+    const auto calls_after_reset = calls;
+    this->run_until([]() { return false; }, std::chrono::milliseconds(50));
+    EXPECT_EQ(calls, calls_after_reset);
+}
+
+} // namespace ocpp
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <ocpp/common/websocket/websocket_libwebsockets.hpp>
+
+using namespace ocpp;
+
+class TlsSessionKeyTest : public ::testing::Test {
+protected:
+    std::filesystem::path dir;
+    WebsocketConnectionOptions options;
+
+    void SetUp() override {
+        this->dir = std::filesystem::temp_directory_path() / "libocpp_tls_session_key_test";
+        std::filesystem::remove_all(this->dir);
+        std::filesystem::create_directories(this->dir);
+        this->options.csms_uri = Uri::parse_and_validate("wss://csms.example.com:443/ocpp", "cp001", 3);
+        this->options.security_profile = 3;
+        this->options.use_ssl_default_verify_paths = false;
+        this->options.verify_csms_common_name = true;
+        this->options.verify_csms_allow_wildcards = false;
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(this->dir);
+    }
+
+    std::string write_file(const std::string& name, const std::string& content) {
+        const auto path = this->dir / name;
+        std::ofstream ofs(path);
+        ofs << content;
+        return path.string();
+    }
+};
+
+TEST(WebsocketLibwebsocketsTest, SmallMessagesSkipPermessageDeflate) {
+    EXPECT_TRUE(skip_permessage_deflate(1, 256));
+    EXPECT_TRUE(skip_permessage_deflate(255, 256));
+}
+
+TEST(WebsocketLibwebsocketsTest, LargeMessagesArePermessageDeflated) {
+    EXPECT_FALSE(skip_permessage_deflate(256, 256));
+    EXPECT_FALSE(skip_permessage_deflate(65000, 256));
+}
+
+TEST(WebsocketLibwebsocketsTest, AllMessagesArePermessageDeflatedWithoutMinMessageSize) {
+    EXPECT_FALSE(skip_permessage_deflate(1, 0));
+    EXPECT_FALSE(skip_permessage_deflate(65000, 0));
+}
+
+TEST(WebsocketLibwebsocketsTest, DrainingIsAlwaysPassedToPermessageDeflate) {
+    // the extension is called with an empty input to flush its pending compressed output
+    EXPECT_FALSE(skip_permessage_deflate(0, 256));
+}
+
+TEST(WebsocketLibwebsocketsTest, TlsSessionResumptionIsDisabledByDefault) {
+    WebsocketConnectionOptions options;
+    EXPECT_FALSE(options.enable_tls_session_resumption);
+    EXPECT_FALSE(options.tls_session_file.has_value());
+}
+
+TEST_F(TlsSessionKeyTest, KeyChangesWithCaBundleContent) {
+    const auto ca_bundle = write_file("ca.pem", "first trust anchor");
+    const auto key = get_tls_session_key(this->options, "", ca_bundle);
+    EXPECT_EQ(get_tls_session_key(this->options, "", ca_bundle), key);
+
+    // the trust anchor is replaced at the same location
+    write_file("ca.pem", "second trust anchor");
+    EXPECT_NE(get_tls_session_key(this->options, "", ca_bundle), key);
+}
+
+TEST_F(TlsSessionKeyTest, KeyChangesWhenCaBundleIsDeleted) {
+    const auto ca_bundle = write_file("ca.pem", "trust anchor");
+    const auto key = get_tls_session_key(this->options, "", ca_bundle);
+
+    std::filesystem::remove(ca_bundle);
+    EXPECT_NE(get_tls_session_key(this->options, "", ca_bundle), key);
+    EXPECT_NE(get_tls_session_key(this->options, "", std::nullopt), key);
+}
+
+TEST_F(TlsSessionKeyTest, KeyChangesWithCaDirectoryContent) {
+    std::filesystem::create_directories(this->dir / "certs");
+    write_file("certs/a.pem", "first trust anchor");
+    const auto ca_directory = (this->dir / "certs").string();
+    const auto key = get_tls_session_key(this->options, "", ca_directory);
+
+    write_file("certs/b.pem", "second trust anchor");
+    const auto key_added = get_tls_session_key(this->options, "", ca_directory);
+    EXPECT_NE(key_added, key);
+
+    write_file("certs/a.pem", "replaced trust anchor");
+    EXPECT_NE(get_tls_session_key(this->options, "", ca_directory), key_added);
+}
+
+TEST_F(TlsSessionKeyTest, KeyChangesWithClientCertificate) {
+    const auto ca_bundle = write_file("ca.pem", "trust anchor");
+    const auto chain = write_file("chain.pem", "client certificate");
+    const auto key = get_tls_session_key(this->options, chain, ca_bundle);
+
+    // a renewed certificate written to the same path
+    std::filesystem::last_write_time(chain, std::filesystem::last_write_time(chain) + std::chrono::seconds(10));
+    EXPECT_NE(get_tls_session_key(this->options, chain, ca_bundle), key);
+}
+
+TEST_F(TlsSessionKeyTest, KeyChangesWithVerificationSettings) {
+    const auto ca_bundle = write_file("ca.pem", "trust anchor");
+    const auto key = get_tls_session_key(this->options, "", ca_bundle);
+
+    auto options = this->options;
+    options.verify_csms_common_name = !options.verify_csms_common_name;
+    EXPECT_NE(get_tls_session_key(options, "", ca_bundle), key);
+
+    options = this->options;
+    options.csms_uri = Uri::parse_and_validate("wss://other.example.com:443/ocpp", "cp001", 3);
+    EXPECT_NE(get_tls_session_key(options, "", ca_bundle), key);
+}
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
+#include <fstream>
 #include <gtest/gtest.h>
 #include <ocpp/common/utils.hpp>
 
@@ -87,5 +88,53 @@ TEST(Utils, test_trim_string) {
     EXPECT_EQ(trim_string("only space at end  "), "only space at end");
 }
 
+TEST(Utils, test_write_file_atomically) {
+    const auto path = fs::temp_directory_path() / "utils_test_write_file_atomically.json";
+    ASSERT_TRUE(write_file_atomically(path, "{\"a\":1}"));
+    ASSERT_TRUE(write_file_atomically(path, "{\"b\":2}"));
+
+    std::ifstream ifs(path);
+    const std::string content((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+    EXPECT_EQ(content, "{\"b\":2}");
+    EXPECT_FALSE(fs::exists(path.string() + ".tmp"));
+    fs::remove(path);
+
+    EXPECT_FALSE(write_file_atomically(fs::path("/nonexistent_directory/file.json"), "{}"));
+}
+
+TEST(Utils, test_write_file_atomically_keeps_permissions) {
+    const auto path = fs::temp_directory_path() / "utils_test_write_file_atomically_permissions.json";
+    fs::remove(path);
+
+    // new files are only accessible by the owner
+    ASSERT_TRUE(write_file_atomically(path, "{}"));
+    EXPECT_EQ(fs::status(path).permissions(), fs::perms::owner_read | fs::perms::owner_write);
+
+    const auto permissions = fs::perms::owner_read | fs::perms::owner_write | fs::perms::group_read;
+    fs::permissions(path, permissions);
+    ASSERT_TRUE(write_file_atomically(path, "{\"a\":1}"));
+    EXPECT_EQ(fs::status(path).permissions(), permissions);
+    fs::remove(path);
+}
+
+TEST(Utils, test_write_file_atomically_follows_symlink) {
+    const auto target = fs::temp_directory_path() / "utils_test_write_file_atomically_target.json";
+    const auto link = fs::temp_directory_path() / "utils_test_write_file_atomically_link.json";
+    fs::remove(target);
+    fs::remove(link);
+    ASSERT_TRUE(write_file_atomically(target, "{}"));
+    fs::create_symlink(target.filename(), link);
+
+    ASSERT_TRUE(write_file_atomically(link, "{\"a\":1}"));
+    EXPECT_TRUE(fs::is_symlink(link));
+    std::ifstream ifs(target);
+    const std::string content((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+    EXPECT_EQ(content, "{\"a\":1}");
+    EXPECT_FALSE(fs::exists(link.string() + ".tmp"));
+
+    fs::remove(link);
+    fs::remove(target);
+}
+
 } // namespace common
 } // namespace ocpp
@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <ocpp/v16/database_handler.hpp>
+#include <ocpp/v16/transaction.hpp>
 #include <optional>
 #include <thread>
 
@@ -54,14 +55,27 @@ public:
     DatabaseTest() {
         auto database_connection = std::make_unique<common::DatabaseConnection>("file::memory:?cache=shared");
         database_connection->open_connection(); // Open connection so memory stays shared
-        this->db_handler = std::make_unique<DatabaseHandler>(std::move(database_connection),
+        this->db_handler = std::make_shared<DatabaseHandler>(std::move(database_connection),
                                                              std::filesystem::path(MIGRATION_FILES_LOCATION_V16), 2);
         this->db_handler->open_connection();
     }
 
-    std::unique_ptr<DatabaseHandler> db_handler;
+    std::shared_ptr<DatabaseHandler> db_handler;
 };
 
+MeterValue get_sample_meter_value(int32_t energy_Wh) {
+    SampledValue sampled_value;
+    sampled_value.value = std::to_string(energy_Wh);
+    sampled_value.context.emplace(ReadingContext::Sample_Periodic);
+    sampled_value.measurand.emplace(Measurand::Energy_Active_Import_Register);
+    sampled_value.unit.emplace(UnitOfMeasure::Wh);
+
+    MeterValue meter_value;
+    meter_value.timestamp = DateTime("2024-01-01T12:00:00.000Z");
+    meter_value.sampledValue.push_back(sampled_value);
+    return meter_value;
+}
+
 TEST_F(DatabaseTest, test_init_connector_table) {
     auto availability_type = this->db_handler->get_connector_availability(1);
     ASSERT_EQ(AvailabilityType::Operative, availability_type);
@@ -158,6 +172,52 @@ TEST_F(DatabaseTest, test_local_authorization_list) {
     ASSERT_EQ(std::nullopt, received_id_tag_info);
 }
 
+TEST_F(DatabaseTest, test_local_authorization_list_full_and_differential_update) {
+
+    IdTagInfo accepted;
+    accepted.status = AuthorizationStatus::Accepted;
+    accepted.parentIdTag = CiString<20>("PARENT");
+
+    IdTagInfo blocked;
+    blocked.status = AuthorizationStatus::Blocked;
+
+    // full update with more entries than the in-memory index is initially sized for
+    std::vector<LocalAuthorizationList> local_authorization_list;
+    for (int i = 0; i < 2000; i++) {
+        LocalAuthorizationList entry;
+        entry.idTag = CiString<20>("TAG" + std::to_string(i));
+        entry.idTagInfo = (i % 2 == 0) ? accepted : blocked;
+        local_authorization_list.push_back(entry);
+    }
+
+    this->db_handler->clear_local_authorization_list();
+    this->db_handler->insert_or_update_local_authorization_list(local_authorization_list);
+    ASSERT_EQ(this->db_handler->get_local_authorization_list_number_of_entries(), 2000);
+
+    for (int i = 0; i < 2000; i++) {
+        const auto id_tag = CiString<20>("TAG" + std::to_string(i));
+        const auto exp_status = (i % 2 == 0) ? AuthorizationStatus::Accepted : AuthorizationStatus::Blocked;
+        auto id_tag_info = this->db_handler->get_local_authorization_list_entry(id_tag);
+        ASSERT_TRUE(id_tag_info.has_value());
+        ASSERT_EQ(id_tag_info.value().status, exp_status);
+        // optional columns must not leak from the previous entry of the same update
+        ASSERT_EQ(id_tag_info.value().parentIdTag.has_value(), i % 2 == 0);
+    }
+    ASSERT_EQ(std::nullopt, this->db_handler->get_local_authorization_list_entry(CiString<20>("UNKNOWN")));
+
+    // differential update removing one entry and adding another
+    LocalAuthorizationList removed_entry;
+    removed_entry.idTag = CiString<20>("TAG0");
+    LocalAuthorizationList added_entry;
+    added_entry.idTag = CiString<20>("NEWTAG");
+    added_entry.idTagInfo = accepted;
+    this->db_handler->insert_or_update_local_authorization_list({removed_entry, added_entry});
+
+    ASSERT_EQ(std::nullopt, this->db_handler->get_local_authorization_list_entry(CiString<20>("TAG0")));
+    ASSERT_TRUE(this->db_handler->get_local_authorization_list_entry(CiString<20>("NEWTAG")).has_value());
+    ASSERT_TRUE(this->db_handler->get_local_authorization_list_entry(CiString<20>("TAG1")).has_value());
+}
+
 TEST_F(DatabaseTest, test_clear_authorization_list) {
 
     const auto id_tag = CiString<20>("DEADBEEF");
@@ -307,6 +367,41 @@ TEST_F(DatabaseTest, test_insert_and_get_transaction_without_id_tag) {
     ASSERT_FALSE(transaction.id_tag_end);
 }
 
+TEST_F(DatabaseTest, test_insert_get_and_delete_transaction_meter_values) {
+    this->db_handler->insert_transaction_meter_values("id-42", {get_sample_meter_value(1), get_sample_meter_value(2)});
+    this->db_handler->insert_transaction_meter_values("id-43", {get_sample_meter_value(10)});
+    this->db_handler->insert_transaction_meter_values("id-42", {get_sample_meter_value(3)});
+
+    auto meter_values = this->db_handler->get_transaction_meter_values("id-42");
+    ASSERT_EQ(meter_values.size(), 3);
+    for (size_t i = 0; i < meter_values.size(); i++) {
+        EXPECT_EQ(meter_values.at(i).sampledValue.at(0).value, std::to_string(i + 1));
+        EXPECT_EQ(meter_values.at(i).sampledValue.at(0).measurand, Measurand::Energy_Active_Import_Register);
+    }
+
+    this->db_handler->delete_transaction_meter_values("id-42");
+    EXPECT_TRUE(this->db_handler->get_transaction_meter_values("id-42").empty());
+    EXPECT_EQ(this->db_handler->get_transaction_meter_values("id-43").size(), 1);
+}
+
+TEST_F(DatabaseTest, test_transaction_meter_values_spilling) {
+    Transaction transaction(-1, 1, "id-42", CiString<20>("DEADBEEF"), 0, std::nullopt, DateTime(), nullptr);
+    transaction.enable_meter_values_spilling(this->db_handler, 4);
+
+    for (int32_t i = 0; i < 11; i++) {
+        transaction.add_meter_value(get_sample_meter_value(i));
+    }
+
+    // at most 4 meter values are kept in memory, the older ones have been moved to the database
+    EXPECT_GE(this->db_handler->get_transaction_meter_values("id-42").size(), 7);
+
+    const auto transaction_data = transaction.get_transaction_data();
+    ASSERT_EQ(transaction_data.size(), 11);
+    for (size_t i = 0; i < transaction_data.size(); i++) {
+        EXPECT_EQ(transaction_data.at(i).sampledValue.at(0).value, std::to_string(i));
+    }
+}
+
 TEST_F(DatabaseTest, test_insert_and_get_profiles) {
     // TODO enable again on fixing https://github.com/EVerest/libocpp/issues/384
     GTEST_SKIP() << "validFrom/validTo checks are failing. See https://github.com/EVerest/libocpp/issues/384";
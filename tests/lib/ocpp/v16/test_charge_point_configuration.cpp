@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <fstream>
+#include <gtest/gtest.h>
+
+#include <ocpp/v16/charge_point_configuration.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+class ChargePointConfigurationTest : public ::testing::Test {
+protected:
+    fs::path user_config_path;
+    std::unique_ptr<ChargePointConfiguration> configuration;
+
+    json config;
+
+    void SetUp() override {
+        // work on a copy of the user config since set() writes to it
+        this->user_config_path = fs::temp_directory_path() / "charge_point_configuration_test_user_config.json";
+        fs::copy_file(USER_CONFIG_FILE_LOCATION_V16, this->user_config_path, fs::copy_options::overwrite_existing);
+
+        std::ifstream ifs(CONFIG_FILE_LOCATION_V16);
+        this->config = json::parse(ifs);
+        this->configuration =
+            std::make_unique<ChargePointConfiguration>(this->config.dump(), CONFIG_DIR_V16, this->user_config_path);
+    }
+
+    void TearDown() override {
+        this->configuration.reset();
+        fs::remove(this->user_config_path);
+    }
+};
+
+TEST_F(ChargePointConfigurationTest, GetIsCaseInsensitive) {
+    const auto key_value = this->configuration->get(CiString<50>("heartbeatINTERVAL"));
+    ASSERT_TRUE(key_value.has_value());
+    EXPECT_EQ(key_value->key.get(), "HeartbeatInterval");
+    EXPECT_EQ(key_value->value.value().get(), "86400");
+}
+
+TEST_F(ChargePointConfigurationTest, GetUnknownKey) {
+    EXPECT_FALSE(this->configuration->get(CiString<50>("UnknownKey")).has_value());
+    // AuthorizationKey can be written but not read
+    EXPECT_FALSE(this->configuration->get(CiString<50>("AuthorizationKey")).has_value());
+}
+
+TEST_F(ChargePointConfigurationTest, GetChecksFeatureProfile) {
+    EXPECT_TRUE(this->configuration->get(CiString<50>("ISO15118PnCEnabled")).has_value());
+
+    this->config.erase("PnC");
+    ChargePointConfiguration configuration_without_pnc(this->config.dump(), CONFIG_DIR_V16, this->user_config_path);
+    EXPECT_FALSE(configuration_without_pnc.get(CiString<50>("ISO15118PnCEnabled")).has_value());
+    EXPECT_TRUE(configuration_without_pnc.get(CiString<50>("ChargeProfileMaxStackLevel")).has_value());
+}
+
+TEST_F(ChargePointConfigurationTest, SetIsCaseInsensitive) {
+    EXPECT_EQ(this->configuration->set(CiString<50>("heartbeatinterval"), CiString<500>("120")),
+              ConfigurationStatus::Accepted);
+    EXPECT_EQ(this->configuration->getHeartbeatInterval(), 120);
+
+    EXPECT_EQ(this->configuration->set(CiString<50>("HeartbeatInterval"), CiString<500>("invalid")),
+              ConfigurationStatus::Rejected);
+    EXPECT_EQ(this->configuration->getHeartbeatInterval(), 120);
+}
+
+TEST_F(ChargePointConfigurationTest, GetAllKeyValueMatchesGet) {
+    const auto all = this->configuration->get_all_key_value();
+    ASSERT_FALSE(all.empty());
+    for (const auto& key_value : all) {
+        const auto single = this->configuration->get(key_value.key);
+        ASSERT_TRUE(single.has_value()) << key_value.key;
+        EXPECT_EQ(single->value, key_value.value) << key_value.key;
+        EXPECT_EQ(single->readonly, key_value.readonly) << key_value.key;
+    }
+}
+
+TEST_F(ChargePointConfigurationTest, SnapshotIsRepublishedOnSet) {
+    const auto old_snapshot = this->configuration->get_snapshot();
+    const auto old_interval = old_snapshot->meter_value_sample_interval;
+
+    EXPECT_EQ(this->configuration->set(CiString<50>("MeterValueSampleInterval"), CiString<500>("17")),
+              ConfigurationStatus::Accepted);
+    EXPECT_EQ(this->configuration->set(CiString<50>("MeterValuesSampledData"), CiString<500>("Voltage,Current.Import")),
+              ConfigurationStatus::Accepted);
+
+    const auto snapshot = this->configuration->get_snapshot();
+    EXPECT_NE(snapshot, old_snapshot);
+    EXPECT_EQ(snapshot->meter_value_sample_interval, 17);
+    ASSERT_FALSE(snapshot->meter_values_sampled_data.empty());
+    EXPECT_EQ(snapshot->meter_values_sampled_data.front().measurand, Measurand::Voltage);
+    EXPECT_EQ(snapshot->meter_values_sampled_data.back().measurand, Measurand::Current_Import);
+    EXPECT_EQ(this->configuration->getMeterValueSampleInterval(), 17);
+
+    // readers holding the previous snapshot keep seeing the old values
+    EXPECT_EQ(old_snapshot->meter_value_sample_interval, old_interval);
+}
+
+TEST_F(ChargePointConfigurationTest, SnapshotUnchangedOnRejectedSet) {
+    const auto old_snapshot = this->configuration->get_snapshot();
+    EXPECT_EQ(this->configuration->set(CiString<50>("MeterValuesSampledData"), CiString<500>("NoMeasurand")),
+              ConfigurationStatus::Rejected);
+    EXPECT_EQ(this->configuration->get_snapshot(), old_snapshot);
+}
+
+TEST_F(ChargePointConfigurationTest, UserConfigIsWrittenOnFlush) {
+    EXPECT_EQ(this->configuration->set(CiString<50>("HeartbeatInterval"), CiString<500>("120")),
+              ConfigurationStatus::Accepted);
+    EXPECT_EQ(this->configuration->set(CiString<50>("MeterValueSampleInterval"), CiString<500>("17")),
+              ConfigurationStatus::Accepted);
+    EXPECT_EQ(this->configuration->set(CiString<50>("HeartbeatInterval"), CiString<500>("240")),
+              ConfigurationStatus::Accepted);
+    this->configuration->flush_user_config();
+
+    std::ifstream ifs(this->user_config_path);
+    const auto user_config = json::parse(ifs);
+    EXPECT_EQ(user_config.at("Core").at("HeartbeatInterval"), 240);
+    EXPECT_EQ(user_config.at("Core").at("MeterValueSampleInterval"), 17);
+    EXPECT_FALSE(fs::exists(this->user_config_path.string() + ".tmp"));
+}
+
+TEST_F(ChargePointConfigurationTest, UserConfigIsWrittenOnDestruction) {
+    EXPECT_EQ(this->configuration->set(CiString<50>("HeartbeatInterval"), CiString<500>("120")),
+              ConfigurationStatus::Accepted);
+    this->configuration.reset();
+
+    std::ifstream ifs(this->user_config_path);
+    const auto user_config = json::parse(ifs);
+    EXPECT_EQ(user_config.at("Core").at("HeartbeatInterval"), 120);
+}
+
+} // namespace v16
+} // namespace ocpp
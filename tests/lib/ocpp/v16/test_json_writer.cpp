@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+
+#include <ocpp/common/call_types.hpp>
+#include <ocpp/v16/messages/BootNotification.hpp>
+#include <ocpp/v16/messages/GetConfiguration.hpp>
+#include <ocpp/v16/messages/MeterValues.hpp>
+#include <ocpp/v16/messages/StartTransaction.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+/// \brief Checks that the generated write_json function of \p message writes the dump of its to_json function
+template <typename T> void expect_equal_to_json_dump(const T& message) {
+    const auto serialized = to_json_string(message);
+    EXPECT_EQ(serialized, json(message).dump());
+    EXPECT_EQ(json::parse(serialized), json(message));
+}
+
+TEST(JsonWriterTest, MeterValuesRequest) {
+    SampledValue energy;
+    energy.value = "1234.5";
+    energy.context = ReadingContext::Sample_Periodic;
+    energy.measurand = Measurand::Energy_Active_Import_Register;
+    energy.unit = UnitOfMeasure::Wh;
+    SampledValue current;
+    current.value = "16";
+    current.phase = Phase::L1;
+    current.location = Location::Outlet;
+    current.format = ValueFormat::Raw;
+
+    MeterValuesRequest request;
+    request.connectorId = 1;
+    request.meterValue = {MeterValue{DateTime("2024-01-01T12:00:00Z"), {energy, current}},
+                          MeterValue{DateTime("2024-01-01T12:01:00Z"), {}}};
+    expect_equal_to_json_dump(request);
+
+    request.transactionId = 42;
+    expect_equal_to_json_dump(request);
+    expect_equal_to_json_dump(Call<MeterValuesRequest>(request));
+}
+
+TEST(JsonWriterTest, ResponsesWithOptionalMembers) {
+    GetConfigurationResponse get_configuration_response;
+    expect_equal_to_json_dump(get_configuration_response);
+    get_configuration_response.configurationKey = std::vector<KeyValue>{{"HeartbeatInterval", false, {"300"}},
+                                                                        {"AuthorizationKey", true, std::nullopt}};
+    get_configuration_response.unknownKey = std::vector<CiString<50>>{"Unknown \"key\""};
+    expect_equal_to_json_dump(get_configuration_response);
+    expect_equal_to_json_dump(CallResult<GetConfigurationResponse>(get_configuration_response, MessageId("1")));
+
+    StartTransactionResponse start_transaction_response;
+    start_transaction_response.transactionId = 7;
+    start_transaction_response.idTagInfo.status = AuthorizationStatus::Accepted;
+    start_transaction_response.idTagInfo.expiryDate = DateTime("2024-01-01T12:00:00Z");
+    start_transaction_response.idTagInfo.parentIdTag = "PARENT";
+    expect_equal_to_json_dump(start_transaction_response);
+
+    BootNotificationResponse boot_notification_response;
+    boot_notification_response.currentTime = DateTime("2024-01-01T12:00:00Z");
+    boot_notification_response.interval = 300;
+    boot_notification_response.status = RegistrationStatus::Accepted;
+    expect_equal_to_json_dump(boot_notification_response);
+}
+
+} // namespace v16
+} // namespace ocpp
@@ -57,5 +57,34 @@ TEST_F(ControlMessageV16Test, test_is_transactional_update) {
                      .is_transaction_update_message());
 }
 
+TEST_F(ControlMessageV16Test, test_is_periodic_transaction_update) {
+    v16::MeterValuesRequest meter_values_request;
+    meter_values_request.connectorId = 1;
+    meter_values_request.transactionId = 42;
+    v16::MeterValue meter_value;
+    v16::SampledValue sampled_value;
+    sampled_value.value = "100";
+    meter_value.sampledValue.push_back(sampled_value);
+    sampled_value.context = v16::ReadingContext::Sample_Clock;
+    meter_value.sampledValue.push_back(sampled_value);
+    meter_values_request.meterValue.push_back(meter_value);
+
+    ControlMessage<v16::MessageType> periodic_message{Call<v16::MeterValuesRequest>{meter_values_request}};
+    EXPECT_TRUE(periodic_message.is_periodic_transaction_update_message());
+    EXPECT_EQ(periodic_message.get_transaction_key(), "1:42");
+
+    meter_values_request.meterValue.at(0).sampledValue.at(0).context = v16::ReadingContext::Trigger;
+    EXPECT_FALSE((ControlMessage<v16::MessageType>{Call<v16::MeterValuesRequest>{meter_values_request}})
+                     .is_periodic_transaction_update_message());
+
+    meter_values_request.meterValue.at(0).sampledValue.at(0).context = v16::ReadingContext::Sample_Periodic;
+    meter_values_request.meterValue.at(0).sampledValue.at(0).format = v16::ValueFormat::SignedData;
+    EXPECT_FALSE((ControlMessage<v16::MessageType>{Call<v16::MeterValuesRequest>{meter_values_request}})
+                     .is_periodic_transaction_update_message());
+
+    EXPECT_FALSE((ControlMessage<v16::MessageType>{Call<v16::StartTransactionRequest>{v16::StartTransactionRequest{}}})
+                     .is_periodic_transaction_update_message());
+}
+
 } // namespace v16
 } // namespace ocpp
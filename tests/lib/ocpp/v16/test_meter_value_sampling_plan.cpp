@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <ocpp/v16/meter_value_sampling_plan.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+class MeterValueSamplingPlanTest : public ::testing::Test {
+protected:
+    Measurement measurement;
+
+    void SetUp() override {
+        this->measurement.power_meter.timestamp = "2024-01-01T12:00:00.000Z";
+        this->measurement.power_meter.energy_Wh_import = {1000.0F, 300.0F, 400.0F, std::nullopt};
+        Voltage voltage;
+        voltage.DC = 400.0F;
+        voltage.L1 = 230.0F;
+        this->measurement.power_meter.voltage_V = voltage;
+    }
+
+    MeterValue sample(const std::vector<MeasurandWithPhase>& measurands,
+                      ReadingContext context = ReadingContext::Sample_Periodic) {
+        const MeterValueSamplingPlan plan(measurands);
+        return plan.sample({this->measurement, 32.0, 22000.0}, context);
+    }
+};
+
+TEST_F(MeterValueSamplingPlanTest, SamplesConfiguredMeasurandsInOrder) {
+    const auto meter_value = this->sample({{Measurand::Voltage, std::nullopt},
+                                           {Measurand::Energy_Active_Import_Register, std::nullopt},
+                                           {Measurand::Current_Offered, std::nullopt}},
+                                          ReadingContext::Sample_Clock);
+
+    EXPECT_EQ(meter_value.timestamp.to_rfc3339(), ocpp::DateTime("2024-01-01T12:00:00.000Z").to_rfc3339());
+    ASSERT_EQ(meter_value.sampledValue.size(), 3);
+
+    const auto& voltage = meter_value.sampledValue.at(0);
+    EXPECT_EQ(voltage.measurand, Measurand::Voltage);
+    EXPECT_EQ(voltage.value, ocpp::conversions::double_to_string(400.0));
+    EXPECT_EQ(voltage.unit, UnitOfMeasure::V);
+    EXPECT_EQ(voltage.location, Location::Outlet);
+    EXPECT_EQ(voltage.context, ReadingContext::Sample_Clock);
+    EXPECT_EQ(voltage.format, ValueFormat::Raw);
+    EXPECT_FALSE(voltage.phase.has_value());
+
+    const auto& energy = meter_value.sampledValue.at(1);
+    EXPECT_EQ(energy.measurand, Measurand::Energy_Active_Import_Register);
+    EXPECT_EQ(energy.value, ocpp::conversions::double_to_string(1000.0));
+    EXPECT_EQ(energy.unit, UnitOfMeasure::Wh);
+
+    const auto& current_offered = meter_value.sampledValue.at(2);
+    EXPECT_EQ(current_offered.measurand, Measurand::Current_Offered);
+    EXPECT_EQ(current_offered.value, ocpp::conversions::double_to_string(32.0));
+    EXPECT_EQ(current_offered.unit, UnitOfMeasure::A);
+}
+
+TEST_F(MeterValueSamplingPlanTest, SamplesPhases) {
+    const auto meter_value = this->sample({{Measurand::Energy_Active_Import_Register, Phase::L1},
+                                           {Measurand::Energy_Active_Import_Register, Phase::L2},
+                                           {Measurand::Energy_Active_Import_Register, Phase::L3},
+                                           {Measurand::Voltage, Phase::L1}});
+
+    ASSERT_EQ(meter_value.sampledValue.size(), 3);
+    EXPECT_EQ(meter_value.sampledValue.at(0).phase, Phase::L1);
+    EXPECT_EQ(meter_value.sampledValue.at(0).value, ocpp::conversions::double_to_string(300.0));
+    EXPECT_EQ(meter_value.sampledValue.at(1).phase, Phase::L2);
+    EXPECT_EQ(meter_value.sampledValue.at(1).value, ocpp::conversions::double_to_string(400.0));
+    EXPECT_EQ(meter_value.sampledValue.at(2).measurand, Measurand::Voltage);
+    EXPECT_EQ(meter_value.sampledValue.at(2).phase, Phase::L1);
+    EXPECT_EQ(meter_value.sampledValue.at(2).value, ocpp::conversions::double_to_string(230.0));
+}
+
+TEST_F(MeterValueSamplingPlanTest, DropsMeasurandsThatCanNotBeSampled) {
+    const MeterValueSamplingPlan plan({{Measurand::Energy_Active_Import_Register, Phase::N},
+                                       {Measurand::Frequency, std::nullopt},
+                                       {Measurand::Power_Factor, std::nullopt},
+                                       {Measurand::Power_Active_Import, std::nullopt}});
+    EXPECT_EQ(plan.size(), 1);
+
+    // power_W is not part of the measurement
+    EXPECT_TRUE(plan.sample({this->measurement, 0.0, 0.0}, ReadingContext::Trigger).sampledValue.empty());
+}
+
+TEST_F(MeterValueSamplingPlanTest, SamplesMeasurementLocations) {
+    this->measurement.soc_Percent = StateOfCharge{55.0F, std::nullopt};
+    this->measurement.temperature_C = {{20.0F, std::string("Body")}, {30.0F, std::nullopt}};
+
+    const auto meter_value = this->sample(
+        {{Measurand::SoC, std::nullopt}, {Measurand::Temperature, std::nullopt}, {Measurand::RPM, std::nullopt}});
+
+    ASSERT_EQ(meter_value.sampledValue.size(), 3);
+    EXPECT_EQ(meter_value.sampledValue.at(0).unit, UnitOfMeasure::Percent);
+    EXPECT_EQ(meter_value.sampledValue.at(0).location, Location::EV);
+    EXPECT_EQ(meter_value.sampledValue.at(1).unit, UnitOfMeasure::Celsius);
+    EXPECT_EQ(meter_value.sampledValue.at(1).location, Location::Body);
+    EXPECT_EQ(meter_value.sampledValue.at(2).value, ocpp::conversions::double_to_string(30.0));
+    EXPECT_FALSE(meter_value.sampledValue.at(2).location.has_value());
+}
+
+} // namespace v16
+} // namespace ocpp
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <ocpp/v16/utils.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+namespace {
+ocpp::Call<StopTransactionRequest> get_stop_transaction_call(int32_t number_of_entries) {
+    StopTransactionRequest req;
+    req.meterStop = 1000;
+    req.timestamp = DateTime("2024-01-01T12:00:00.000Z");
+    req.transactionId = 1;
+
+    std::vector<TransactionData> transaction_data;
+    for (int32_t i = 0; i < number_of_entries; i++) {
+        SampledValue sampled_value;
+        // all entries have the same size
+        sampled_value.value = std::to_string(1000 + i);
+        sampled_value.measurand.emplace(Measurand::Energy_Active_Import_Register);
+
+        TransactionData entry;
+        entry.timestamp = DateTime("2024-01-01T12:00:00.000Z");
+        entry.sampledValue.push_back(sampled_value);
+        transaction_data.push_back(entry);
+    }
+    req.transactionData.emplace(transaction_data);
+
+    return ocpp::Call<StopTransactionRequest>(req, MessageId("1"));
+}
+} // namespace
+
+TEST(V16UtilsTest, DropTransactionDataKeepsMessageThatFits) {
+    auto call = get_stop_transaction_call(10);
+    const auto message_size = utils::get_message_size(call);
+
+    utils::drop_transaction_data(message_size, call);
+    EXPECT_EQ(call.msg.transactionData.value().size(), 10);
+}
+
+TEST(V16UtilsTest, DropTransactionDataKeepsEvenlySpacedEntries) {
+    auto call = get_stop_transaction_call(100);
+    const auto entry_size = json(call.msg.transactionData.value().front()).dump().length() + 1;
+    const auto max_message_size = utils::get_message_size(call) - 60 * entry_size;
+
+    utils::drop_transaction_data(max_message_size, call);
+
+    const auto& transaction_data = call.msg.transactionData.value();
+    EXPECT_LE(utils::get_message_size(call), max_message_size);
+    // exactly the 40 entries that fit are kept
+    ASSERT_EQ(transaction_data.size(), 40);
+    EXPECT_EQ(transaction_data.front().sampledValue.at(0).value, "1000");
+    EXPECT_EQ(transaction_data.back().sampledValue.at(0).value, "1099");
+
+    int previous = 999;
+    for (const auto& entry : transaction_data) {
+        const auto value = std::stoi(entry.sampledValue.at(0).value);
+        EXPECT_GT(value, previous);
+        EXPECT_LE(value - previous, 3);
+        previous = value;
+    }
+}
+
+TEST(V16UtilsTest, DropTransactionDataKeepsFirstAndLastEntry) {
+    auto call = get_stop_transaction_call(50);
+
+    utils::drop_transaction_data(1, call);
+
+    const auto& transaction_data = call.msg.transactionData.value();
+    ASSERT_EQ(transaction_data.size(), 2);
+    EXPECT_EQ(transaction_data.front().sampledValue.at(0).value, "1000");
+    EXPECT_EQ(transaction_data.back().sampledValue.at(0).value, "1049");
+}
+
+} // namespace v16
+} // namespace ocpp
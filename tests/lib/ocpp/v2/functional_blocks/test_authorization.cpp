@@ -9,6 +9,7 @@
 #include <ocpp/v2/ctrlr_component_variables.hpp>
 #include <ocpp/v2/device_model.hpp>
 #include <ocpp/v2/functional_blocks/functional_block_context.hpp>
+#include <ocpp/v2/utils.hpp>
 
 #include "component_state_manager_mock.hpp"
 #include "connectivity_manager_mock.hpp"
@@ -882,6 +883,94 @@ TEST_F(AuthorizationTest, validate_token_auth_cache_accepted) {
               AuthorizationStatusEnum::Accepted);
 }
 
+TEST_F(AuthorizationTest, validate_token_auth_cache_served_from_memory) {
+    // Enable auth cache.
+    this->set_auth_cache_enabled(this->device_model, true);
+    // Disable local auth list.
+    this->set_local_auth_list_ctrlr_enabled(this->device_model, false);
+    // Set auth cache lifetime to some high value
+    this->set_auth_cache_lifetime(this->device_model, 5000);
+    // Allow local pre authorize.
+    this->set_local_pre_authorize(this->device_model, true);
+
+    AuthorizationCacheEntry authorization_cache_entry =
+        create_authorization_cache_entry(AuthorizationStatusEnum::Accepted, true, false, false, 5000);
+
+    // The entry is only read from the database once, afterwards it is served from memory.
+    EXPECT_CALL(this->database_handler_mock, authorization_cache_get_entry(_))
+        .WillOnce(Return(authorization_cache_entry));
+    // Without the cleanup thread running, the last used timestamp is written directly.
+    EXPECT_CALL(this->database_handler_mock, authorization_cache_update_last_used(_)).Times(2);
+
+    IdToken id_token = get_id_token("test_token", IdTokenEnum::ISO14443);
+
+    EXPECT_EQ(authorization->validate_token(id_token, std::nullopt, std::nullopt).idTokenInfo.status,
+              AuthorizationStatusEnum::Accepted);
+    EXPECT_EQ(authorization->validate_token(id_token, std::nullopt, std::nullopt).idTokenInfo.status,
+              AuthorizationStatusEnum::Accepted);
+}
+
+TEST_F(AuthorizationTest, validate_token_auth_cache_last_used_written_back_by_cleanup_thread) {
+    // Enable auth cache.
+    this->set_auth_cache_enabled(this->device_model, true);
+    // Disable local auth list.
+    this->set_local_auth_list_ctrlr_enabled(this->device_model, false);
+    // Set auth cache lifetime to some high value
+    this->set_auth_cache_lifetime(this->device_model, 5000);
+    // Allow local pre authorize.
+    this->set_local_pre_authorize(this->device_model, true);
+
+    AuthorizationCacheEntry authorization_cache_entry =
+        create_authorization_cache_entry(AuthorizationStatusEnum::Accepted, true, false, false, 5000);
+
+    IdToken id_token = get_id_token("test_token", IdTokenEnum::ISO14443);
+    const auto id_token_hash = ocpp::v2::utils::generate_token_hash(id_token);
+
+    EXPECT_CALL(this->database_handler_mock, authorization_cache_get_entry(id_token_hash))
+        .WillOnce(Return(authorization_cache_entry));
+    // While the cleanup thread is running, cache hits do not write to the database.
+    EXPECT_CALL(this->database_handler_mock, authorization_cache_update_last_used(_)).Times(0);
+
+    this->authorization->start_auth_cache_cleanup_thread();
+    EXPECT_EQ(authorization->validate_token(id_token, std::nullopt, std::nullopt).idTokenInfo.status,
+              AuthorizationStatusEnum::Accepted);
+    EXPECT_EQ(authorization->validate_token(id_token, std::nullopt, std::nullopt).idTokenInfo.status,
+              AuthorizationStatusEnum::Accepted);
+    testing::Mock::VerifyAndClearExpectations(&this->database_handler_mock);
+
+    // Both hits are written back once when the pending timestamps are flushed.
+    EXPECT_CALL(this->database_handler_mock, authorization_cache_update_last_used(id_token_hash)).Times(1);
+    this->authorization = nullptr;
+}
+
+TEST_F(AuthorizationTest, validate_token_auth_cache_deleted_entry_not_served_from_memory) {
+    // Enable auth cache.
+    this->set_auth_cache_enabled(this->device_model, true);
+    // Disable local auth list.
+    this->set_local_auth_list_ctrlr_enabled(this->device_model, false);
+    // Set auth cache lifetime to some high value
+    this->set_auth_cache_lifetime(this->device_model, 5000);
+    // Allow local pre authorize.
+    this->set_local_pre_authorize(this->device_model, true);
+
+    AuthorizationCacheEntry authorization_cache_entry =
+        create_authorization_cache_entry(AuthorizationStatusEnum::Accepted, true, false, false, 5000);
+
+    // After deleting the entry, it must be requested from the database again.
+    EXPECT_CALL(this->database_handler_mock, authorization_cache_get_entry(_))
+        .Times(2)
+        .WillRepeatedly(Return(authorization_cache_entry));
+    EXPECT_CALL(this->database_handler_mock, authorization_cache_delete_entry(_)).Times(1);
+
+    IdToken id_token = get_id_token("test_token", IdTokenEnum::ISO14443);
+
+    EXPECT_EQ(authorization->validate_token(id_token, std::nullopt, std::nullopt).idTokenInfo.status,
+              AuthorizationStatusEnum::Accepted);
+    authorization->authorization_cache_delete_entry(ocpp::v2::utils::generate_token_hash(id_token));
+    EXPECT_EQ(authorization->validate_token(id_token, std::nullopt, std::nullopt).idTokenInfo.status,
+              AuthorizationStatusEnum::Accepted);
+}
+
 TEST_F(AuthorizationTest, validate_token_auth_local_pre_authorize_disabled) {
     // Enable auth cache.
     this->set_auth_cache_enabled(this->device_model, true);
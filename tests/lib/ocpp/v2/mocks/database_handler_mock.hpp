@@ -44,6 +44,8 @@ public:
                 (const std::string& transaction_id, const MeterValue& meter_value));
     MOCK_METHOD(std::vector<MeterValue>, transaction_metervalues_get_all, (const std::string& transaction_id),
                 (override));
+    MOCK_METHOD(std::vector<MeterValue>, transaction_metervalues_get_tx_ended,
+                (const std::string& transaction_id, const utils::TxEndedMeterValueFilter& filter), (override));
     MOCK_METHOD(void, transaction_metervalues_clear, (const std::string& transaction_id));
     MOCK_METHOD(void, transaction_insert, (const EnhancedTransaction& transaction, int32_t evse_id));
     MOCK_METHOD(std::unique_ptr<EnhancedTransaction>, transaction_get, (const int32_t evse_id));
@@ -70,6 +72,10 @@ public:
     typedef std::map<int32_t, std::vector<ChargingProfile>> charging_profiles_grouped_by_evse;
     MOCK_METHOD(charging_profiles_grouped_by_evse, get_all_charging_profiles_group_by_evse, ());
     MOCK_METHOD(ChargingLimitSourceEnum, get_charging_limit_source_for_profile, (const int profile_id));
+    MOCK_METHOD(void, ocsp_refresh_state_insert_or_update,
+                (const std::string& certificate_key, const DateTime& next_refresh));
+    MOCK_METHOD((std::map<std::string, DateTime>), ocsp_refresh_state_get_all, ());
+    MOCK_METHOD(void, ocsp_refresh_state_delete, (const std::string& certificate_key));
     MOCK_METHOD(std::unique_ptr<common::SQLiteStatementInterface>, new_statement, (const std::string& sql));
 };
 } // namespace ocpp::v2
@@ -0,0 +1,293 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ocpp/common/ocpp_logging.hpp>
+#include <ocpp/v2/connectivity_manager.hpp>
+#include <ocpp/v2/ctrlr_component_variables.hpp>
+#include <ocpp/v2/device_model.hpp>
+
+#include "device_model_test_helper.hpp"
+
+using namespace ocpp;
+using namespace ocpp::v2;
+using ::testing::_;
+using ::testing::MockFunction;
+
+namespace {
+const std::string NETWORK_CONNECTION_PROFILES =
+    R"([{"configurationSlot": 1, "connectionData": {"messageTimeout": 30, "ocppCsmsUrl": "ws://localhost:9000", )"
+    R"("ocppInterface": "Wired0", "ocppTransport": "JSON", "ocppVersion": "OCPP20", "securityProfile": 1}}, )"
+    R"({"configurationSlot": 2, "connectionData": {"messageTimeout": 30, "ocppCsmsUrl": "ws://localhost:9001", )"
+    R"("ocppInterface": "Wired0", "ocppTransport": "JSON", "ocppVersion": "OCPP20", "securityProfile": 1}}])";
+
+/// \brief What a FakeWebsocket has been asked to do, it outlives the websocket that is destroyed by the manager
+struct FakeWebsocketState {
+    std::mutex mutex;
+    std::string csms_uri;
+    std::vector<std::string> sent_messages;
+    std::atomic_int start_connecting_calls{0};
+    std::atomic_bool closed{false};
+};
+
+/// \brief Websocket whose connection state is controlled by the test
+class FakeWebsocket : public WebsocketBase {
+public:
+    explicit FakeWebsocket(std::shared_ptr<FakeWebsocketState> state) : state(state) {
+    }
+
+    bool start_connecting() override {
+        this->state->start_connecting_calls++;
+        return true;
+    }
+
+    void set_connection_options(const WebsocketConnectionOptions& connection_options) override {
+        this->set_connection_options_base(connection_options);
+        std::lock_guard<std::mutex> lock(this->state->mutex);
+        this->state->csms_uri = this->connection_options.csms_uri.string();
+    }
+
+    void reconnect(long /*delay*/) override {
+    }
+
+    void close(const WebsocketCloseReason /*code*/, const std::string& /*reason*/) override {
+        this->m_is_connected = false;
+        this->state->closed = true;
+    }
+
+    bool send(const std::string& message) override {
+        std::lock_guard<std::mutex> lock(this->state->mutex);
+        this->state->sent_messages.push_back(message);
+        return this->m_is_connected;
+    }
+
+    void on_connected() {
+        this->m_is_connected = true;
+        this->connected_callback(OcppProtocolVersion::v201);
+    }
+
+    void on_disconnected() {
+        this->m_is_connected = false;
+        this->disconnected_callback();
+    }
+
+    void on_message(const std::string& message) {
+        this->message_callback(message);
+    }
+
+protected:
+    void ping() override {
+    }
+
+private:
+    std::shared_ptr<FakeWebsocketState> state;
+};
+
+/// \brief Creates FakeWebsockets instead of connecting to a CSMS
+class TestConnectivityManager : public ConnectivityManager {
+public:
+    using ConnectivityManager::ConnectivityManager;
+
+    std::mutex mutex;
+    /// created websockets in order of creation, they are owned by the manager and only valid while in use
+    std::vector<FakeWebsocket*> websockets;
+    std::vector<std::shared_ptr<FakeWebsocketState>> states;
+
+    std::size_t get_websocket_count() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->websockets.size();
+    }
+
+protected:
+    std::unique_ptr<Websocket> make_websocket(const WebsocketConnectionOptions& connection_options) override {
+        auto state = std::make_shared<FakeWebsocketState>();
+        auto websocket = std::make_unique<FakeWebsocket>(state);
+        websocket->set_connection_options(connection_options);
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->websockets.push_back(websocket.get());
+            this->states.push_back(state);
+        }
+        return std::make_unique<Websocket>(std::move(websocket), this->test_logging);
+    }
+
+private:
+    std::shared_ptr<MessageLogging> test_logging = std::make_shared<MessageLogging>(
+        false, "/tmp", "test_connectivity_manager", false, false, false, false, false, false, nullptr);
+};
+
+/// \brief Waits until \p condition is true
+bool wait_for(const std::function<bool()>& condition) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+} // namespace
+
+class ConnectivityManagerTest : public ::testing::Test {
+protected:
+    DeviceModelTestHelper device_model_test_helper;
+    DeviceModel* device_model;
+    MockFunction<void(const std::string& message)> message_callback_mock;
+    MockFunction<void(int configuration_slot, const NetworkConnectionProfile& network_connection_profile,
+                      OcppProtocolVersion version)>
+        connected_callback_mock;
+    MockFunction<void(int configuration_slot, const NetworkConnectionProfile& network_connection_profile,
+                      OcppProtocolVersion version)>
+        disconnected_callback_mock;
+    std::unique_ptr<TestConnectivityManager> connectivity_manager;
+
+    ConnectivityManagerTest() :
+        device_model_test_helper(), device_model(device_model_test_helper.get_device_model()) {
+    }
+
+    void SetUp() override {
+        set_value(ControllerComponentVariables::NetworkConnectionProfiles, NETWORK_CONNECTION_PROFILES);
+        set_value(ControllerComponentVariables::NetworkConfigurationPriority, "1,2");
+        set_value(ControllerComponentVariables::NetworkProfileWarmStandby, "Connect");
+
+        this->connectivity_manager = std::make_unique<TestConnectivityManager>(
+            *this->device_model, nullptr, nullptr, this->message_callback_mock.AsStdFunction());
+        this->connectivity_manager->set_websocket_connected_callback(this->connected_callback_mock.AsStdFunction());
+        this->connectivity_manager->set_websocket_disconnected_callback(
+            this->disconnected_callback_mock.AsStdFunction());
+    }
+
+    void TearDown() override {
+        // stops the preparation of a new standby
+        this->connectivity_manager->disconnect();
+        this->connectivity_manager.reset();
+    }
+
+    void set_value(const ComponentVariable& component_variable, const std::string& value) {
+        ASSERT_EQ(this->device_model->set_value(component_variable.component, component_variable.variable.value(),
+                                                AttributeEnum::Actual, value, "test", true),
+                  SetVariableStatusEnum::Accepted);
+    }
+
+    FakeWebsocket* get_websocket(std::size_t index) {
+        std::lock_guard<std::mutex> lock(this->connectivity_manager->mutex);
+        return this->connectivity_manager->websockets.at(index);
+    }
+
+    std::shared_ptr<FakeWebsocketState> get_state(std::size_t index) {
+        std::lock_guard<std::mutex> lock(this->connectivity_manager->mutex);
+        return this->connectivity_manager->states.at(index);
+    }
+
+    /// \brief Connects the active websocket of configuration slot 1 and the standby websocket of slot 2
+    void connect_with_standby() {
+        EXPECT_CALL(this->connected_callback_mock, Call(1, _, OcppProtocolVersion::v201));
+        this->connectivity_manager->connect();
+        ASSERT_EQ(this->connectivity_manager->get_websocket_count(), 1);
+        EXPECT_EQ(get_state(0)->csms_uri, "ws://localhost:9000/cp001");
+        EXPECT_EQ(get_state(0)->start_connecting_calls, 1);
+        get_websocket(0)->on_connected();
+
+        // the standby is prepared on the standby timer after the active websocket is connected
+        ASSERT_TRUE(wait_for([this]() { return this->connectivity_manager->get_websocket_count() == 2; }));
+        EXPECT_EQ(get_state(1)->csms_uri, "ws://localhost:9001/cp001");
+        ASSERT_TRUE(wait_for([this]() { return get_state(1)->start_connecting_calls == 1; }));
+        get_websocket(1)->on_connected();
+        testing::Mock::VerifyAndClearExpectations(&this->connected_callback_mock);
+    }
+};
+
+TEST_F(ConnectivityManagerTest, standby_websocket_takes_over_when_active_websocket_disconnects) {
+    connect_with_standby();
+
+    std::atomic_bool switched_over{false};
+    EXPECT_CALL(this->disconnected_callback_mock, Call(1, _, _));
+    EXPECT_CALL(this->connected_callback_mock, Call(2, _, OcppProtocolVersion::v201)).WillOnce([&]() {
+        switched_over = true;
+    });
+    const auto active_state = get_state(0);
+    get_websocket(0)->on_disconnected();
+    ASSERT_TRUE(wait_for([&]() { return switched_over.load(); }));
+
+    // the replaced websocket is closed and messages are sent over the former standby
+    EXPECT_TRUE(active_state->closed);
+    EXPECT_TRUE(this->connectivity_manager->is_websocket_connected());
+    EXPECT_TRUE(this->connectivity_manager->send_to_websocket("message"));
+    const auto standby_state = get_state(1);
+    std::lock_guard<std::mutex> lock(standby_state->mutex);
+    EXPECT_EQ(standby_state->sent_messages, std::vector<std::string>{"message"});
+    EXPECT_EQ(this->device_model->get_optional_value<int>(ControllerComponentVariables::ActiveNetworkProfile), 2);
+}
+
+TEST_F(ConnectivityManagerTest, messages_of_standby_websocket_are_dropped) {
+    connect_with_standby();
+
+    EXPECT_CALL(this->message_callback_mock, Call(_)).Times(0);
+    get_websocket(1)->on_message("message");
+    testing::Mock::VerifyAndClearExpectations(&this->message_callback_mock);
+
+    EXPECT_CALL(this->message_callback_mock, Call("message"));
+    get_websocket(0)->on_message("message");
+}
+
+TEST_F(ConnectivityManagerTest, no_switch_over_to_standby_websocket_that_is_not_connected) {
+    EXPECT_CALL(this->connected_callback_mock, Call(1, _, _));
+    this->connectivity_manager->connect();
+    get_websocket(0)->on_connected();
+    ASSERT_TRUE(wait_for([this]() { return this->connectivity_manager->get_websocket_count() == 2; }));
+
+    EXPECT_CALL(this->disconnected_callback_mock, Call(1, _, _));
+    EXPECT_CALL(this->connected_callback_mock, Call(2, _, _)).Times(0);
+    get_websocket(0)->on_disconnected();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_FALSE(get_state(0)->closed);
+    EXPECT_FALSE(this->connectivity_manager->is_websocket_connected());
+    EXPECT_EQ(this->device_model->get_optional_value<int>(ControllerComponentVariables::ActiveNetworkProfile), 1);
+}
+
+TEST_F(ConnectivityManagerTest, websocket_can_be_used_while_switching_over) {
+    connect_with_standby();
+
+    std::atomic_bool switched_over{false};
+    EXPECT_CALL(this->disconnected_callback_mock, Call(1, _, _));
+    EXPECT_CALL(this->connected_callback_mock, Call(2, _, _)).WillOnce([&]() { switched_over = true; });
+
+    // the websocket is used by other threads while it is replaced on the standby timer
+    std::atomic_bool stop{false};
+    std::thread sender([&]() {
+        while (!stop) {
+            this->connectivity_manager->send_to_websocket("message");
+            this->connectivity_manager->is_websocket_connected();
+        }
+    });
+
+    get_websocket(0)->on_disconnected();
+    EXPECT_TRUE(wait_for([&]() { return switched_over.load(); }));
+    stop = true;
+    sender.join();
+
+    EXPECT_TRUE(this->connectivity_manager->send_to_websocket("message"));
+}
+
+TEST_F(ConnectivityManagerTest, standby_websocket_is_prepared_again_with_new_connection_options) {
+    connect_with_standby();
+
+    this->connectivity_manager->set_websocket_connection_options_without_reconnect();
+
+    // the standby prepared with the previous options is closed and a new one is connected
+    EXPECT_TRUE(get_state(1)->closed);
+    ASSERT_TRUE(wait_for([this]() { return this->connectivity_manager->get_websocket_count() == 3; }));
+    EXPECT_EQ(get_state(2)->csms_uri, "ws://localhost:9001/cp001");
+    ASSERT_TRUE(wait_for([this]() { return get_state(2)->start_connecting_calls == 1; }));
+    EXPECT_FALSE(get_state(0)->closed);
+    EXPECT_TRUE(this->connectivity_manager->is_websocket_connected());
+}
@@ -1278,4 +1278,125 @@ TEST_F(DatabaseHandlerTest, GetChargingProfilesMatchingCriteria_OnlyEVSEIDSet_Re
     EXPECT_EQ(sut.size(), 1);
 
     EXPECT_THAT(sut, testing::Contains(testing::FieldsAre(profile1, DEFAULT_EVSE_ID, ChargingLimitSourceEnum::CSO)));
-}
\ No newline at end of file
+}
+TEST_F(DatabaseHandlerTest, LocalAuthorizationList_FullAndDifferentialUpdate) {
+    IdTokenInfo accepted;
+    accepted.status = AuthorizationStatusEnum::Accepted;
+
+    std::vector<AuthorizationData> local_authorization_list;
+    for (int i = 0; i < 10; i++) {
+        AuthorizationData entry;
+        entry.idToken = {"TOKEN" + std::to_string(i), IdTokenEnum::ISO14443};
+        entry.idTokenInfo = accepted;
+        local_authorization_list.push_back(entry);
+    }
+
+    this->database_handler.clear_local_authorization_list();
+    this->database_handler.insert_or_update_local_authorization_list(local_authorization_list);
+    EXPECT_EQ(this->database_handler.get_local_authorization_list_number_of_entries(), 10);
+
+    for (const auto& entry : local_authorization_list) {
+        auto id_token_info = this->database_handler.get_local_authorization_list_entry(entry.idToken);
+        ASSERT_TRUE(id_token_info.has_value());
+        EXPECT_EQ(id_token_info->status, AuthorizationStatusEnum::Accepted);
+    }
+    EXPECT_FALSE(this->database_handler.get_local_authorization_list_entry({"UNKNOWN", IdTokenEnum::ISO14443}));
+    // same token value with a different type is a different entry
+    EXPECT_FALSE(this->database_handler.get_local_authorization_list_entry({"TOKEN0", IdTokenEnum::Central}));
+
+    AuthorizationData removed_entry;
+    removed_entry.idToken = {"TOKEN0", IdTokenEnum::ISO14443};
+    AuthorizationData added_entry;
+    added_entry.idToken = {"NEWTOKEN", IdTokenEnum::ISO14443};
+    added_entry.idTokenInfo = accepted;
+    this->database_handler.insert_or_update_local_authorization_list({removed_entry, added_entry});
+
+    EXPECT_FALSE(this->database_handler.get_local_authorization_list_entry(removed_entry.idToken));
+    EXPECT_TRUE(this->database_handler.get_local_authorization_list_entry(added_entry.idToken));
+    EXPECT_TRUE(this->database_handler.get_local_authorization_list_entry({"TOKEN1", IdTokenEnum::ISO14443}));
+
+    this->database_handler.clear_local_authorization_list();
+    EXPECT_FALSE(this->database_handler.get_local_authorization_list_entry(added_entry.idToken));
+}
+
+TEST_F(DatabaseHandlerTest, TransactionMeterValuesGetTxEndedAppliesFilterWhileReading) {
+    const auto make_meter_value = [](const std::string& timestamp, ReadingContextEnum context,
+                                     const std::vector<std::optional<MeasurandEnum>>& measurands) {
+        MeterValue meter_value;
+        meter_value.timestamp = DateTime(timestamp);
+        for (std::size_t i = 0; i < measurands.size(); i++) {
+            SampledValue sampled_value;
+            sampled_value.value = 100.0 + i;
+            sampled_value.context = context;
+            sampled_value.measurand = measurands.at(i);
+            SignedMeterValue signed_meter_value;
+            signed_meter_value.signedMeterData = "data";
+            signed_meter_value.signingMethod = "method";
+            signed_meter_value.encodingMethod = "encoding";
+            signed_meter_value.publicKey = "key";
+            sampled_value.signedMeterValue = signed_meter_value;
+            meter_value.sampledValue.push_back(sampled_value);
+        }
+        return meter_value;
+    };
+
+    const std::vector<MeterValue> meter_values = {
+        make_meter_value("2024-01-01T12:00:00Z", ReadingContextEnum::Transaction_Begin,
+                         {MeasurandEnum::Energy_Active_Import_Register, MeasurandEnum::Voltage}),
+        make_meter_value("2024-01-01T12:01:00Z", ReadingContextEnum::Sample_Periodic,
+                         {MeasurandEnum::Voltage, std::nullopt, MeasurandEnum::Power_Active_Import}),
+        make_meter_value("2024-01-01T12:02:00Z", ReadingContextEnum::Sample_Clock,
+                         {MeasurandEnum::Energy_Active_Import_Register, MeasurandEnum::Voltage}),
+        make_meter_value("2024-01-01T12:03:00Z", ReadingContextEnum::Trigger,
+                         {MeasurandEnum::Energy_Active_Import_Register}),
+        make_meter_value("2024-01-01T12:04:00Z", ReadingContextEnum::Sample_Periodic, {MeasurandEnum::Voltage}),
+        make_meter_value("2024-01-01T12:05:00Z", ReadingContextEnum::Transaction_End,
+                         {MeasurandEnum::Energy_Active_Import_Register}),
+        make_meter_value("2024-01-01T12:06:00Z", ReadingContextEnum::Sample_Periodic,
+                         {MeasurandEnum::Energy_Active_Import_Register}),
+    };
+    for (const auto& meter_value : meter_values) {
+        this->database_handler.transaction_metervalues_insert("txId", meter_value);
+    }
+    this->database_handler.transaction_metervalues_insert("otherTxId", meter_values.front());
+
+    const auto all = this->database_handler.transaction_metervalues_get_all("txId");
+    EXPECT_EQ(json(all), json(meter_values));
+
+    utils::TxEndedMeterValueFilter filter;
+    filter.sampled_measurands =
+        utils::get_measurands_mask({MeasurandEnum::Energy_Active_Import_Register, MeasurandEnum::Power_Active_Import});
+    filter.aligned_measurands = utils::get_measurands_mask({MeasurandEnum::Voltage});
+    filter.max_timestamp = DateTime("2024-01-01T12:05:00Z");
+    filter.include_aligned_signed = false;
+
+    const auto tx_ended = this->database_handler.transaction_metervalues_get_tx_ended("txId", filter);
+    const auto expected = utils::get_meter_values_with_measurands_applied(
+        all, filter.sampled_measurands, filter.aligned_measurands, filter.max_timestamp, filter.include_sampled_signed,
+        filter.include_aligned_signed);
+
+    ASSERT_EQ(tx_ended.size(), 4);
+    EXPECT_EQ(json(tx_ended), json(expected));
+    EXPECT_FALSE(tx_ended.at(2).sampledValue.at(0).signedMeterValue.has_value());
+    EXPECT_TRUE(tx_ended.at(3).sampledValue.at(0).signedMeterValue.has_value());
+}
+
+TEST_F(DatabaseHandlerTest, OcspRefreshStateInsertGetAndDelete) {
+    EXPECT_TRUE(this->database_handler.ocsp_refresh_state_get_all().empty());
+
+    const DateTime first_refresh{"2024-07-15T08:01:02Z"};
+    const DateTime second_refresh{"2024-07-16T08:01:02Z"};
+    this->database_handler.ocsp_refresh_state_insert_or_update("SHA256:name:key:serial1", first_refresh);
+    this->database_handler.ocsp_refresh_state_insert_or_update("SHA256:name:key:serial2", first_refresh);
+    this->database_handler.ocsp_refresh_state_insert_or_update("SHA256:name:key:serial2", second_refresh);
+
+    auto refresh_state = this->database_handler.ocsp_refresh_state_get_all();
+    ASSERT_EQ(refresh_state.size(), 2);
+    EXPECT_EQ(refresh_state.at("SHA256:name:key:serial1"), first_refresh);
+    EXPECT_EQ(refresh_state.at("SHA256:name:key:serial2"), second_refresh);
+
+    this->database_handler.ocsp_refresh_state_delete("SHA256:name:key:serial1");
+    refresh_state = this->database_handler.ocsp_refresh_state_get_all();
+    ASSERT_EQ(refresh_state.size(), 1);
+    EXPECT_EQ(refresh_state.count("SHA256:name:key:serial2"), 1);
+}
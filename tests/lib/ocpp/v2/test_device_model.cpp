@@ -276,5 +276,78 @@ TEST_F(DeviceModelTest, test_clear_monitors) {
     dm->clear_monitors(hardwired_monitor_ids, true);
 }
 
+TEST_F(DeviceModelTest, test_monitor_listeners) {
+    EVSE evse;
+    evse.id = 2;
+    evse.connectorId = 3;
+
+    Component component;
+    component.name = "UnitTestCtrlr";
+    component.evse = evse;
+
+    Variable variable;
+    variable.name = "UnitTestPropertyAName";
+
+    std::vector<int32_t> updated_monitor_ids;
+    std::vector<int32_t> cleared_monitor_ids;
+
+    dm->register_monitor_listener([&updated_monitor_ids](const VariableMonitoringMeta& updated_monitor,
+                                                         const Component&, const Variable&,
+                                                         const VariableCharacteristics&, const VariableAttribute&,
+                                                         const std::string&) {
+        updated_monitor_ids.push_back(updated_monitor.monitor.id);
+    });
+    dm->register_monitor_cleared_listener(
+        [&cleared_monitor_ids](const int32_t monitor_id) { cleared_monitor_ids.push_back(monitor_id); });
+
+    SetMonitoringData request;
+    request.value = 30.0;
+    request.type = MonitorEnum::Periodic;
+    request.severity = 7;
+    request.component = component;
+    request.variable = variable;
+
+    // A new monitor must be reported to the listener
+    auto results = dm->set_monitors({request});
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_EQ(results[0].status, SetMonitoringStatusEnum::Accepted);
+    ASSERT_TRUE(results[0].id.has_value());
+
+    const auto monitor_id = results[0].id.value();
+    ASSERT_EQ(updated_monitor_ids.size(), 1);
+    ASSERT_EQ(updated_monitor_ids[0], monitor_id);
+
+    // An update of the existing monitor must be reported as well
+    request.id = monitor_id;
+    request.value = 60.0;
+    results = dm->set_monitors({request});
+    ASSERT_EQ(results[0].status, SetMonitoringStatusEnum::Accepted);
+    ASSERT_EQ(updated_monitor_ids.size(), 2);
+    ASSERT_EQ(updated_monitor_ids[1], monitor_id);
+
+    // Clearing the monitor must be reported to the cleared listener
+    auto clear_results = dm->clear_monitors({monitor_id});
+    ASSERT_EQ(clear_results.size(), 1);
+    ASSERT_EQ(clear_results[0].status, ClearMonitoringStatusEnum::Accepted);
+    ASSERT_EQ(cleared_monitor_ids.size(), 1);
+    ASSERT_EQ(cleared_monitor_ids[0], monitor_id);
+}
+
+TEST(DeviceModelNumericValueTest, test_parse_numeric_value) {
+    // Integers keep their exact value, 2^53 + 1 can not be represented as double
+    const auto large_integer = parse_numeric_value(DataEnum::integer, "9007199254740993");
+    ASSERT_TRUE(large_integer.has_value());
+    EXPECT_EQ(std::get<std::int64_t>(large_integer.value()), 9007199254740993);
+    EXPECT_EQ(std::get<std::int64_t>(parse_numeric_value(DataEnum::integer, "+12").value()), 12);
+    EXPECT_EQ(std::get<double>(parse_numeric_value(DataEnum::decimal, "-1.5").value()), -1.5);
+
+    EXPECT_FALSE(parse_numeric_value(DataEnum::integer, "1.5").has_value());
+    EXPECT_FALSE(parse_numeric_value(DataEnum::integer, "-").has_value());
+    EXPECT_FALSE(parse_numeric_value(DataEnum::integer, "99999999999999999999").has_value());
+    EXPECT_FALSE(parse_numeric_value(DataEnum::decimal, "1e5").has_value());
+    EXPECT_FALSE(parse_numeric_value(DataEnum::decimal, ".").has_value());
+    EXPECT_FALSE(parse_numeric_value(DataEnum::string, "1").has_value());
+}
+
 } // namespace v2
 } // namespace ocpp
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+
+#include <ocpp/common/call_types.hpp>
+#include <ocpp/v2/messages/GetInstalledCertificateIds.hpp>
+#include <ocpp/v2/messages/GetVariables.hpp>
+#include <ocpp/v2/messages/NotifyReport.hpp>
+#include <ocpp/v2/messages/TransactionEvent.hpp>
+
+namespace ocpp {
+namespace v2 {
+
+/// \brief Checks that the generated write_json function of \p message writes the dump of its to_json function
+template <typename T> void expect_equal_to_json_dump(const T& message) {
+    const auto serialized = to_json_string(message);
+    EXPECT_EQ(serialized, json(message).dump());
+    EXPECT_EQ(json::parse(serialized), json(message));
+}
+
+TEST(JsonWriterTest, TransactionEventRequest) {
+    TransactionEventRequest request;
+    request.eventType = TransactionEventEnum::Updated;
+    request.timestamp = DateTime("2024-01-01T12:00:00Z");
+    request.triggerReason = TriggerReasonEnum::MeterValuePeriodic;
+    request.seqNo = 3;
+    request.transactionInfo.transactionId = "transaction";
+    expect_equal_to_json_dump(request);
+
+    SampledValue sampled_value;
+    sampled_value.value = 1234.5f;
+    sampled_value.measurand = MeasurandEnum::Energy_Active_Import_Register;
+    sampled_value.context = ReadingContextEnum::Sample_Periodic;
+    sampled_value.unitOfMeasure = UnitOfMeasure{std::nullopt, {"kWh"}, 3};
+    MeterValue meter_value;
+    meter_value.timestamp = DateTime("2024-01-01T12:00:00Z");
+    meter_value.sampledValue = {sampled_value, sampled_value};
+    request.meterValue = std::vector<MeterValue>{meter_value};
+    request.transactionInfo.chargingState = ChargingStateEnum::Charging;
+    request.evse = EVSE{1, std::nullopt, 1};
+    request.idToken = IdToken{"token", IdTokenEnum::ISO14443, std::nullopt,
+                              std::vector<AdditionalInfo>{{"additional", "type", std::nullopt}}};
+    request.offline = false;
+    request.customData = json{{"vendorId", "vendor"}, {"values", {1, 2.5, "three"}}};
+    expect_equal_to_json_dump(request);
+    expect_equal_to_json_dump(Call<TransactionEventRequest>(request));
+}
+
+TEST(JsonWriterTest, ReportsAndResults) {
+    VariableAttribute variable_attribute;
+    variable_attribute.type = AttributeEnum::Actual;
+    variable_attribute.value = "line\nbreak";
+    variable_attribute.mutability = MutabilityEnum::ReadWrite;
+    VariableCharacteristics variable_characteristics;
+    variable_characteristics.dataType = DataEnum::decimal;
+    variable_characteristics.supportsMonitoring = true;
+    variable_characteristics.minLimit = -0.5f;
+    variable_characteristics.maxLimit = 32.0f;
+    ReportData report_data;
+    report_data.component.name = "EVSE";
+    report_data.component.evse = EVSE{1, std::nullopt, std::nullopt};
+    report_data.variable.name = "Power";
+    report_data.variableAttribute = {variable_attribute};
+    report_data.variableCharacteristics = variable_characteristics;
+
+    NotifyReportRequest notify_report_request;
+    notify_report_request.requestId = 1;
+    notify_report_request.generatedAt = DateTime("2024-01-01T12:00:00Z");
+    notify_report_request.seqNo = 0;
+    notify_report_request.tbc = true;
+    notify_report_request.reportData = std::vector<ReportData>{report_data, report_data};
+    expect_equal_to_json_dump(notify_report_request);
+
+    GetVariableResult get_variable_result;
+    get_variable_result.attributeStatus = GetVariableStatusEnum::UnknownVariable;
+    get_variable_result.component.name = "Component";
+    get_variable_result.variable.name = "Variable";
+    get_variable_result.attributeStatusInfo = StatusInfo{"NotFound", std::nullopt, std::nullopt};
+    GetVariablesResponse get_variables_response;
+    get_variables_response.getVariableResult = {get_variable_result};
+    expect_equal_to_json_dump(get_variables_response);
+    expect_equal_to_json_dump(CallResult<GetVariablesResponse>(get_variables_response, MessageId("1")));
+
+    GetInstalledCertificateIdsRequest get_installed_certificate_ids_request;
+    expect_equal_to_json_dump(get_installed_certificate_ids_request);
+    get_installed_certificate_ids_request.certificateType =
+        std::vector<GetCertificateIdUseEnum>{GetCertificateIdUseEnum::V2GRootCertificate,
+                                             GetCertificateIdUseEnum::CSMSRootCertificate};
+    expect_equal_to_json_dump(get_installed_certificate_ids_request);
+}
+
+} // namespace v2
+} // namespace ocpp
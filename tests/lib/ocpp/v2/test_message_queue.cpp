@@ -45,5 +45,33 @@ TEST_F(ControlMessageV2Test, test_is_transactional_update) {
                       .is_transaction_update_message()));
 }
 
+TEST_F(ControlMessageV2Test, test_is_periodic_transaction_update) {
+    v2::TransactionEventRequest transaction_event_request{};
+    transaction_event_request.eventType = v2::TransactionEventEnum::Updated;
+    transaction_event_request.triggerReason = v2::TriggerReasonEnum::MeterValuePeriodic;
+    transaction_event_request.transactionInfo.transactionId = "transaction";
+    v2::MeterValue meter_value;
+    meter_value.sampledValue.push_back(v2::SampledValue{});
+    transaction_event_request.meterValue.emplace({meter_value});
+
+    ControlMessage<v2::MessageType> periodic_message{Call<v2::TransactionEventRequest>{transaction_event_request}};
+    EXPECT_TRUE(periodic_message.is_periodic_transaction_update_message());
+    EXPECT_EQ(periodic_message.get_transaction_key(), "transaction");
+
+    transaction_event_request.transactionInfo.chargingState = v2::ChargingStateEnum::SuspendedEV;
+    EXPECT_FALSE((ControlMessage<v2::MessageType>{Call<v2::TransactionEventRequest>{transaction_event_request}})
+                     .is_periodic_transaction_update_message());
+
+    transaction_event_request.transactionInfo.chargingState.reset();
+    transaction_event_request.meterValue.value().at(0).sampledValue.at(0).signedMeterValue.emplace();
+    EXPECT_FALSE((ControlMessage<v2::MessageType>{Call<v2::TransactionEventRequest>{transaction_event_request}})
+                     .is_periodic_transaction_update_message());
+
+    transaction_event_request.meterValue.reset();
+    transaction_event_request.triggerReason = v2::TriggerReasonEnum::ChargingStateChanged;
+    EXPECT_FALSE((ControlMessage<v2::MessageType>{Call<v2::TransactionEventRequest>{transaction_event_request}})
+                     .is_periodic_transaction_update_message());
+}
+
 } // namespace v2
 } // namespace ocpp
@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright Pionix GmbH and Contributors to EVerest
+
+#include <chrono>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ocpp/v2/ctrlr_component_variables.hpp>
+#include <ocpp/v2/device_model.hpp>
+#include <ocpp/v2/monitoring_updater.hpp>
+
+#include "device_model_test_helper.hpp"
+
+using ::testing::_;
+using ::testing::MockFunction;
+
+namespace ocpp::v2 {
+
+class MonitoringUpdaterTest : public ::testing::Test {
+protected:
+    DeviceModelTestHelper device_model_test_helper;
+    DeviceModel* device_model;
+    MockFunction<void(const std::vector<EventData>&)> notify_events_mock;
+    std::unique_ptr<MonitoringUpdater> monitoring_updater;
+
+    const RequiredComponentVariable monitored_variable = ControllerComponentVariables::SampledDataTxUpdatedInterval;
+    const RequiredComponentVariable monitored_decimal_variable = ControllerComponentVariables::LimitChangeSignificance;
+
+    MonitoringUpdaterTest() : device_model_test_helper(), device_model(device_model_test_helper.get_device_model()) {
+    }
+
+    void SetUp() override {
+        this->monitoring_updater = std::make_unique<MonitoringUpdater>(
+            *this->device_model, this->notify_events_mock.AsStdFunction(), []() { return false; });
+
+        // Register the listeners without starting the monitoring timer, the tests process the monitors themselves
+        this->monitoring_updater->start_monitoring();
+        set_value(ControllerComponentVariables::MonitoringCtrlrEnabled, "true");
+    }
+
+    void set_value(const ComponentVariable& component_variable, const std::string& value) {
+        ASSERT_EQ(this->device_model->set_value(component_variable.component, component_variable.variable.value(),
+                                                AttributeEnum::Actual, value, "test", true),
+                  SetVariableStatusEnum::Accepted);
+    }
+
+    int32_t set_monitor(MonitorEnum type, float value, int32_t severity = 0,
+                        const std::optional<int32_t>& id = std::nullopt) {
+        return set_monitor(this->monitored_variable, type, value, severity, id);
+    }
+
+    int32_t set_monitor(const ComponentVariable& component_variable, MonitorEnum type, float value,
+                        int32_t severity = 0, const std::optional<int32_t>& id = std::nullopt) {
+        SetMonitoringData request;
+        request.value = value;
+        request.type = type;
+        request.severity = severity;
+        request.component = component_variable.component;
+        request.variable = component_variable.variable.value();
+        request.id = id;
+
+        const auto results = this->device_model->set_monitors({request});
+        EXPECT_EQ(results.size(), 1);
+        EXPECT_EQ(results.at(0).status, SetMonitoringStatusEnum::Accepted);
+        return results.at(0).id.value_or(0);
+    }
+
+    void process_periodic_monitors() {
+        this->monitoring_updater->process_monitors_internal(true, false);
+    }
+
+    std::size_t get_schedule_size() {
+        return this->monitoring_updater->periodic_monitors_schedule.size();
+    }
+
+    std::chrono::time_point<std::chrono::steady_clock> get_next_scheduled_trigger() {
+        return this->monitoring_updater->periodic_monitors_schedule.top().next_trigger;
+    }
+
+    void on_variable_changed(const std::unordered_map<int64_t, VariableMonitoringMeta>& monitors,
+                             const Component& component, const Variable& variable,
+                             const VariableCharacteristics& characteristics, const VariableAttribute& attribute,
+                             const std::string& value_old, const std::string& value_current) {
+        this->monitoring_updater->on_variable_changed(monitors, component, variable, characteristics, attribute,
+                                                      value_old, value_current,
+                                                      parse_numeric_value(characteristics.dataType, value_current));
+    }
+};
+
+TEST_F(MonitoringUpdaterTest, periodic_monitor_is_processed_once_per_interval) {
+    set_monitor(MonitorEnum::Periodic, 1);
+    EXPECT_EQ(get_schedule_size(), 1);
+
+    // Not due yet
+    EXPECT_CALL(this->notify_events_mock, Call(_)).Times(0);
+    process_periodic_monitors();
+    testing::Mock::VerifyAndClearExpectations(&this->notify_events_mock);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    EXPECT_CALL(this->notify_events_mock, Call(_)).WillOnce([](const std::vector<EventData>& events) {
+        ASSERT_EQ(events.size(), 1);
+        EXPECT_EQ(events.at(0).trigger, EventTriggerEnum::Periodic);
+        EXPECT_EQ(events.at(0).actualValue, "120");
+    });
+    process_periodic_monitors();
+    testing::Mock::VerifyAndClearExpectations(&this->notify_events_mock);
+
+    // Rescheduled for the next interval
+    EXPECT_CALL(this->notify_events_mock, Call(_)).Times(0);
+    process_periodic_monitors();
+    EXPECT_GT(get_next_scheduled_trigger(), std::chrono::steady_clock::now());
+}
+
+TEST_F(MonitoringUpdaterTest, inactive_due_periodic_monitor_is_rescheduled_in_the_future) {
+    // The monitor severity exceeds the active monitoring level, so it is never triggered
+    set_value(ControllerComponentVariables::ActiveMonitoringLevel, "0");
+    set_monitor(MonitorEnum::Periodic, 1, 5);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    EXPECT_CALL(this->notify_events_mock, Call(_)).Times(0);
+    process_periodic_monitors();
+
+    // The monitor must not stay due and be popped again on every tick
+    EXPECT_EQ(get_schedule_size(), 1);
+    EXPECT_GT(get_next_scheduled_trigger(), std::chrono::steady_clock::now());
+}
+
+TEST_F(MonitoringUpdaterTest, inactive_due_clock_aligned_monitor_is_rescheduled_in_the_future) {
+    // The monitor severity exceeds the active monitoring level, so it is never triggered
+    set_value(ControllerComponentVariables::ActiveMonitoringLevel, "0");
+    set_monitor(MonitorEnum::PeriodicClockAligned, 1, 5);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    EXPECT_CALL(this->notify_events_mock, Call(_)).Times(0);
+    process_periodic_monitors();
+
+    // The monitor is moved to its next aligned point instead of being popped again on every tick
+    EXPECT_EQ(get_schedule_size(), 1);
+    const auto next_trigger = get_next_scheduled_trigger();
+    EXPECT_GT(next_trigger, std::chrono::steady_clock::now());
+    process_periodic_monitors();
+    EXPECT_EQ(get_schedule_size(), 1);
+    EXPECT_EQ(get_next_scheduled_trigger(), next_trigger);
+    testing::Mock::VerifyAndClearExpectations(&this->notify_events_mock);
+
+    // Once active, no stale event of the skipped aligned point is sent
+    set_value(ControllerComponentVariables::ActiveMonitoringLevel, "9");
+    EXPECT_CALL(this->notify_events_mock, Call(_)).Times(0);
+    process_periodic_monitors();
+}
+
+TEST_F(MonitoringUpdaterTest, cleared_periodic_monitor_is_not_processed) {
+    const auto monitor_id = set_monitor(MonitorEnum::Periodic, 1);
+    const auto results = this->device_model->clear_monitors({monitor_id});
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results.at(0).status, ClearMonitoringStatusEnum::Accepted);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    // The stale schedule entry is dropped when it is popped
+    EXPECT_CALL(this->notify_events_mock, Call(_)).Times(0);
+    process_periodic_monitors();
+    EXPECT_EQ(get_schedule_size(), 0);
+}
+
+TEST_F(MonitoringUpdaterTest, updated_periodic_monitor_is_rescheduled) {
+    const auto monitor_id = set_monitor(MonitorEnum::Periodic, 3600);
+    set_monitor(MonitorEnum::Periodic, 1, 0, monitor_id);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    // Only the entry of the new interval triggers, the entry of the old interval is skipped
+    EXPECT_CALL(this->notify_events_mock, Call(_)).Times(1);
+    process_periodic_monitors();
+    EXPECT_EQ(get_schedule_size(), 2);
+}
+
+TEST_F(MonitoringUpdaterTest, threshold_monitor_triggers_and_returns_to_normal) {
+    set_monitor(this->monitored_decimal_variable, MonitorEnum::UpperThreshold, 50);
+
+    EXPECT_CALL(this->notify_events_mock, Call(_)).WillOnce([](const std::vector<EventData>& events) {
+        ASSERT_EQ(events.size(), 1);
+        EXPECT_EQ(events.at(0).trigger, EventTriggerEnum::Alerting);
+        EXPECT_EQ(events.at(0).actualValue, "60.5");
+        EXPECT_FALSE(events.at(0).cleared.value_or(false));
+    });
+    set_value(this->monitored_decimal_variable, "60.5");
+    this->monitoring_updater->process_triggered_monitors();
+    testing::Mock::VerifyAndClearExpectations(&this->notify_events_mock);
+
+    EXPECT_CALL(this->notify_events_mock, Call(_)).WillOnce([](const std::vector<EventData>& events) {
+        ASSERT_EQ(events.size(), 1);
+        EXPECT_EQ(events.at(0).actualValue, "40");
+        EXPECT_TRUE(events.at(0).cleared.value_or(false));
+    });
+    set_value(this->monitored_decimal_variable, "40");
+    this->monitoring_updater->process_triggered_monitors();
+}
+
+TEST_F(MonitoringUpdaterTest, delta_monitor_triggers_on_difference_to_reference) {
+    // The reference value is the current value 42
+    set_monitor(this->monitored_decimal_variable, MonitorEnum::Delta, 5);
+
+    EXPECT_CALL(this->notify_events_mock, Call(_)).Times(0);
+    set_value(this->monitored_decimal_variable, "46.5");
+    this->monitoring_updater->process_triggered_monitors();
+    testing::Mock::VerifyAndClearExpectations(&this->notify_events_mock);
+
+    EXPECT_CALL(this->notify_events_mock, Call(_)).WillOnce([](const std::vector<EventData>& events) {
+        ASSERT_EQ(events.size(), 1);
+        EXPECT_EQ(events.at(0).trigger, EventTriggerEnum::Delta);
+        EXPECT_EQ(events.at(0).actualValue, "36");
+    });
+    set_value(this->monitored_decimal_variable, "36");
+    this->monitoring_updater->process_triggered_monitors();
+}
+
+TEST_F(MonitoringUpdaterTest, delta_monitor_on_large_integer_values_is_exact) {
+    Component component;
+    component.name = "TestComponent";
+    Variable variable;
+    variable.name = "Counter";
+    VariableCharacteristics characteristics;
+    characteristics.dataType = DataEnum::integer;
+    characteristics.supportsMonitoring = true;
+    VariableAttribute attribute;
+    attribute.type = AttributeEnum::Actual;
+    attribute.mutability = MutabilityEnum::ReadOnly;
+
+    VariableMonitoringMeta monitor_meta;
+    monitor_meta.monitor.id = 1000;
+    monitor_meta.monitor.transaction = false;
+    monitor_meta.monitor.value = 0.5;
+    monitor_meta.monitor.type = MonitorEnum::Delta;
+    monitor_meta.monitor.severity = 0;
+    monitor_meta.type = VariableMonitorType::CustomMonitor;
+    // 2^53 + 1 can not be represented as double, it is rounded to 2^53
+    monitor_meta.reference_value = "9007199254740993";
+
+    const std::unordered_map<int64_t, VariableMonitoringMeta> monitors{{monitor_meta.monitor.id, monitor_meta}};
+
+    EXPECT_CALL(this->notify_events_mock, Call(_)).Times(0);
+    on_variable_changed(monitors, component, variable, characteristics, attribute, "9007199254740992",
+                        "9007199254740993");
+    this->monitoring_updater->process_triggered_monitors();
+    testing::Mock::VerifyAndClearExpectations(&this->notify_events_mock);
+
+    EXPECT_CALL(this->notify_events_mock, Call(_)).WillOnce([](const std::vector<EventData>& events) {
+        ASSERT_EQ(events.size(), 1);
+        EXPECT_EQ(events.at(0).variableMonitoringId, 1000);
+        EXPECT_EQ(events.at(0).actualValue, "9007199254740992");
+    });
+    on_variable_changed(monitors, component, variable, characteristics, attribute, "9007199254740993",
+                        "9007199254740992");
+    this->monitoring_updater->process_triggered_monitors();
+}
+
+} // namespace ocpp::v2
@@ -9,6 +9,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <database_handler_mock.hpp>
 #include <evse_security_mock.hpp>
 #include <ocpp/v2/ocsp_updater.hpp>
 
@@ -161,7 +162,8 @@ TEST_F(OcspUpdaterTest, test_success_boot_many) {
     ocsp_updater->stop();
 }
 
-/// \brief Tests retry logic on CSMS failure to update, multiple certs
+/// \brief Tests retry logic on CSMS failure to update, multiple certs. Responses received before a failure are kept,
+/// the retry only requests the remaining certificates
 TEST_F(OcspUpdaterTest, test_retry_boot_many) {
     auto ocsp_updater = std::make_unique<v2::OcspUpdater>(this->evse_security, this->status_update,
                                                           std::chrono::hours(167), std::chrono::seconds(0));
@@ -196,15 +198,15 @@ TEST_F(OcspUpdaterTest, test_retry_boot_many) {
         .Times(1)
         .InSequence(seq)
         .WillOnce(testing::Return(response_fail_empty));
+    EXPECT_CALL(*this->evse_security, update_ocsp_cache(this->example_hash_data[0], "EXAMPLE OCSP RESULT"))
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(testing::Return());
 
     EXPECT_CALL(*this->evse_security, get_v2g_ocsp_request_data())
         .Times(1)
         .InSequence(seq)
         .WillOnce(testing::Return(this->example_ocsp_data));
-    EXPECT_CALL(*this->charge_point, get_certificate_status(this->example_status_requests[0]))
-        .Times(1)
-        .InSequence(seq)
-        .WillOnce(testing::Return(response_success));
     EXPECT_CALL(*this->charge_point, get_certificate_status(this->example_status_requests[1]))
         .Times(1)
         .InSequence(seq)
@@ -214,10 +216,6 @@ TEST_F(OcspUpdaterTest, test_retry_boot_many) {
         .InSequence(seq)
         .WillOnce(testing::Return(response_success));
 
-    EXPECT_CALL(*this->evse_security, update_ocsp_cache(this->example_hash_data[0], "EXAMPLE OCSP RESULT"))
-        .Times(1)
-        .InSequence(seq)
-        .WillOnce(testing::Return());
     EXPECT_CALL(*this->evse_security, update_ocsp_cache(this->example_hash_data[1], "EXAMPLE OCSP RESULT"))
         .Times(1)
         .InSequence(seq)
@@ -331,6 +329,176 @@ TEST_F(OcspUpdaterTest, test_trigger) {
     ocsp_updater->stop();
 }
 
+/// \brief Tests a triggered update that fails partway, the retry only requests the certificates without a new response
+TEST_F(OcspUpdaterTest, test_trigger_retry_many) {
+    auto ocsp_updater = std::make_unique<v2::OcspUpdater>(this->evse_security, this->status_update,
+                                                          std::chrono::hours(167), std::chrono::seconds(0));
+
+    testing::Sequence seq;
+    v2::GetCertificateStatusResponse response_success;
+    response_success.ocspResult = "EXAMPLE OCSP RESULT";
+    response_success.status = v2::GetCertificateStatusEnum::Accepted;
+    v2::GetCertificateStatusResponse response_fail_status;
+    response_fail_status.status = v2::GetCertificateStatusEnum::Failed;
+
+    EXPECT_CALL(*this->evse_security, get_v2g_ocsp_request_data())
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(testing::Return(this->example_ocsp_data));
+    EXPECT_CALL(*this->charge_point, get_certificate_status(testing::_))
+        .Times(3)
+        .InSequence(seq)
+        .WillRepeatedly(testing::Return(response_success));
+    EXPECT_CALL(*this->evse_security, update_ocsp_cache(testing::_, "EXAMPLE OCSP RESULT"))
+        .Times(2)
+        .InSequence(seq)
+        .WillRepeatedly(testing::Return());
+    EXPECT_CALL(*this->evse_security, update_ocsp_cache(testing::_, "EXAMPLE OCSP RESULT"))
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(SignalCallsCompleteVoid(&this->calls_complete));
+
+    EXPECT_CALL(*this->evse_security, get_v2g_ocsp_request_data())
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(testing::Return(this->example_ocsp_data));
+    EXPECT_CALL(*this->charge_point, get_certificate_status(this->example_status_requests[0]))
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(testing::Return(response_success));
+    EXPECT_CALL(*this->charge_point, get_certificate_status(this->example_status_requests[1]))
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(testing::Return(response_fail_status));
+    EXPECT_CALL(*this->evse_security, update_ocsp_cache(this->example_hash_data[0], "EXAMPLE OCSP RESULT"))
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(testing::Return());
+
+    EXPECT_CALL(*this->evse_security, get_v2g_ocsp_request_data())
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(testing::Return(this->example_ocsp_data));
+    EXPECT_CALL(*this->charge_point, get_certificate_status(this->example_status_requests[1]))
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(testing::Return(response_success));
+    EXPECT_CALL(*this->charge_point, get_certificate_status(this->example_status_requests[2]))
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(testing::Return(response_success));
+    EXPECT_CALL(*this->evse_security, update_ocsp_cache(this->example_hash_data[1], "EXAMPLE OCSP RESULT"))
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(testing::Return());
+    EXPECT_CALL(*this->evse_security, update_ocsp_cache(this->example_hash_data[2], "EXAMPLE OCSP RESULT"))
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(SignalCallsCompleteVoid(&this->calls_complete));
+
+    ocsp_updater->start();
+    this->calls_complete.timed_wait(boost::posix_time::second_clock::universal_time() + boost::posix_time::seconds(5));
+    ocsp_updater->trigger_ocsp_cache_update();
+    this->calls_complete.timed_wait(boost::posix_time::second_clock::universal_time() + boost::posix_time::seconds(5));
+    ocsp_updater->stop();
+}
+
+/// \brief Tests only certificates without a persisted refresh state or with a due refresh are requested, and the
+/// state of certificates that are no longer installed is removed
+TEST_F(OcspUpdaterTest, test_refresh_only_due_certificates) {
+    auto database_handler = std::make_shared<testing::NiceMock<v2::DatabaseHandlerMock>>();
+    auto ocsp_updater = std::make_unique<v2::OcspUpdater>(this->evse_security, this->status_update,
+                                                          std::chrono::hours(167), std::chrono::hours(24),
+                                                          database_handler, 3);
+
+    const auto now = date::utc_clock::now();
+    std::map<std::string, DateTime> refresh_state;
+    refresh_state.emplace("SHA256:issuerHash1:issuerKey1:serial1", DateTime(now - std::chrono::hours(1)));
+    refresh_state.emplace("SHA384:issuerHash2:issuerKey2:serial2", DateTime(now + std::chrono::hours(1)));
+    refresh_state.emplace("SHA256:removed:removed:removed", DateTime(now + std::chrono::hours(1)));
+    ON_CALL(*database_handler, ocsp_refresh_state_get_all()).WillByDefault(testing::Return(refresh_state));
+
+    v2::GetCertificateStatusResponse response_success;
+    response_success.ocspResult = "EXAMPLE OCSP RESULT";
+    response_success.status = v2::GetCertificateStatusEnum::Accepted;
+
+    EXPECT_CALL(*this->evse_security, get_v2g_ocsp_request_data())
+        .Times(1)
+        .WillOnce(testing::Return(this->example_ocsp_data));
+    EXPECT_CALL(*database_handler, ocsp_refresh_state_delete("SHA256:removed:removed:removed")).Times(1);
+    EXPECT_CALL(*this->charge_point, get_certificate_status(this->example_status_requests[0]))
+        .Times(1)
+        .WillOnce(testing::Return(response_success));
+    EXPECT_CALL(*this->charge_point, get_certificate_status(this->example_status_requests[1])).Times(0);
+    EXPECT_CALL(*this->charge_point, get_certificate_status(this->example_status_requests[2]))
+        .Times(1)
+        .WillOnce(testing::Return(response_success));
+
+    testing::Sequence seq;
+    EXPECT_CALL(*this->evse_security, update_ocsp_cache(this->example_hash_data[0], "EXAMPLE OCSP RESULT"))
+        .Times(1)
+        .InSequence(seq);
+    EXPECT_CALL(*database_handler,
+                ocsp_refresh_state_insert_or_update("SHA256:issuerHash1:issuerKey1:serial1", testing::_))
+        .Times(1)
+        .InSequence(seq);
+    EXPECT_CALL(*this->evse_security, update_ocsp_cache(this->example_hash_data[2], "EXAMPLE OCSP RESULT"))
+        .Times(1)
+        .InSequence(seq);
+    EXPECT_CALL(*database_handler,
+                ocsp_refresh_state_insert_or_update("SHA512:issuerHash3:issuerKey3:serial3", testing::_))
+        .Times(1)
+        .InSequence(seq)
+        .WillOnce(SignalCallsCompleteVoid(&this->calls_complete));
+
+    ocsp_updater->start();
+    this->calls_complete.timed_wait(boost::posix_time::second_clock::universal_time() + boost::posix_time::seconds(5));
+    ocsp_updater->stop();
+}
+
+/// \brief Tests GetCertificateStatus requests are sent concurrently up to the given limit
+TEST_F(OcspUpdaterTest, test_concurrent_requests) {
+    auto ocsp_updater = std::make_unique<v2::OcspUpdater>(this->evse_security, this->status_update,
+                                                          std::chrono::hours(167), std::chrono::hours(24), nullptr, 3);
+
+    v2::GetCertificateStatusResponse response_success;
+    response_success.ocspResult = "EXAMPLE OCSP RESULT";
+    response_success.status = v2::GetCertificateStatusEnum::Accepted;
+
+    // every request waits until all three are in flight, which only happens if they are sent concurrently
+    std::mutex in_flight_mutex;
+    std::condition_variable in_flight_cv;
+    int in_flight = 0;
+    bool all_in_flight = false;
+
+    EXPECT_CALL(*this->evse_security, get_v2g_ocsp_request_data())
+        .Times(1)
+        .WillOnce(testing::Return(this->example_ocsp_data));
+    EXPECT_CALL(*this->charge_point, get_certificate_status(testing::_))
+        .Times(3)
+        .WillRepeatedly([&](auto) {
+            std::unique_lock<std::mutex> lk(in_flight_mutex);
+            in_flight++;
+            in_flight_cv.notify_all();
+            if (in_flight_cv.wait_for(lk, std::chrono::seconds(5), [&]() { return in_flight == 3; })) {
+                all_in_flight = true;
+            }
+            return response_success;
+        });
+    EXPECT_CALL(*this->evse_security, update_ocsp_cache(testing::_, "EXAMPLE OCSP RESULT"))
+        .Times(3)
+        .WillOnce(testing::Return())
+        .WillOnce(testing::Return())
+        .WillOnce(SignalCallsCompleteVoid(&this->calls_complete));
+
+    ocsp_updater->start();
+    this->calls_complete.timed_wait(boost::posix_time::second_clock::universal_time() + boost::posix_time::seconds(10));
+    ocsp_updater->stop();
+
+    std::lock_guard<std::mutex> lk(in_flight_mutex);
+    EXPECT_TRUE(all_in_flight);
+}
+
 /// \brief Triggering while the updater is not running should throw an exception
 TEST_F(OcspUpdaterTest, test_exception_trigger_when_not_running) {
     auto ocsp_updater = std::make_unique<v2::OcspUpdater>(this->evse_security, this->status_update);
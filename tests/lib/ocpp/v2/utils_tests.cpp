@@ -44,6 +44,14 @@ TEST_F(V2UtilsTest, test_valid_generate_token_hash) {
               ocpp::v2::utils::generate_token_hash(valid_iso15693_token));
 }
 
+TEST_F(V2UtilsTest, test_generate_token_hash_digest) {
+    ocpp::v2::IdToken valid_iso14443_token = {"ABAD1DEA", ocpp::v2::IdTokenEnum::ISO14443};
+
+    const auto digest = ocpp::v2::utils::generate_token_hash_digest(valid_iso14443_token);
+    ASSERT_EQ(ocpp::v2::utils::to_hex_string(digest), ocpp::v2::utils::generate_token_hash(valid_iso14443_token));
+    ASSERT_NE(digest, ocpp::v2::utils::generate_token_hash_digest(valid_central_token));
+}
+
 TEST_F(V2UtilsTest, test_is_critical_security_event) {
     EXPECT_TRUE(ocpp::v2::utils::is_critical(ocpp::security_events::FIRMWARE_UPDATED));
     EXPECT_TRUE(ocpp::v2::utils::is_critical(ocpp::security_events::SETTINGSYSTEMTIME));
@@ -68,5 +76,49 @@ TEST_F(V2UtilsTest, test_is_critical_security_event) {
     EXPECT_FALSE(ocpp::v2::utils::is_critical(ocpp::security_events::ATTEMPTEDREPLAYATTACKS));
 }
 
+TEST_F(V2UtilsTest, test_get_measurands_mask) {
+    const auto mask = ocpp::v2::utils::get_measurands_mask("Energy.Active.Import.Register,Voltage,Invalid");
+    EXPECT_EQ(mask.count(), 2);
+    EXPECT_TRUE(mask.test(static_cast<std::size_t>(ocpp::v2::MeasurandEnum::Energy_Active_Import_Register)));
+    EXPECT_TRUE(mask.test(static_cast<std::size_t>(ocpp::v2::MeasurandEnum::Voltage)));
+    EXPECT_TRUE(ocpp::v2::utils::get_measurands_mask("").none());
+}
+
+TEST_F(V2UtilsTest, test_get_meter_value_with_measurands_mask_applied) {
+    ocpp::v2::MeterValue meter_value;
+    ocpp::v2::SampledValue energy;
+    energy.value = 100;
+    energy.measurand = ocpp::v2::MeasurandEnum::Energy_Active_Import_Register;
+    energy.signedMeterValue = ocpp::v2::SignedMeterValue{"data", "method", "encoding"};
+    ocpp::v2::SampledValue voltage;
+    voltage.value = 230;
+    voltage.measurand = ocpp::v2::MeasurandEnum::Voltage;
+    ocpp::v2::SampledValue no_measurand;
+    no_measurand.value = 1;
+    meter_value.sampledValue = {voltage, energy, no_measurand, voltage};
+
+    const auto mask = ocpp::v2::utils::get_measurands_mask(
+        std::vector<ocpp::v2::MeasurandEnum>{ocpp::v2::MeasurandEnum::Energy_Active_Import_Register});
+    EXPECT_TRUE(ocpp::v2::utils::meter_value_has_any_measurand(meter_value, mask));
+
+    const auto filtered = ocpp::v2::utils::get_meter_value_with_measurands_applied(meter_value, mask, false);
+    ASSERT_EQ(filtered.sampledValue.size(), 1);
+    EXPECT_EQ(filtered.sampledValue.at(0).measurand, ocpp::v2::MeasurandEnum::Energy_Active_Import_Register);
+    EXPECT_FALSE(filtered.sampledValue.at(0).signedMeterValue.has_value());
+    EXPECT_EQ(filtered.timestamp, meter_value.timestamp);
+
+    // Must give the same result as the overload taking the measurands as a vector
+    const auto filtered_vec = ocpp::v2::utils::get_meter_value_with_measurands_applied(
+        meter_value, {ocpp::v2::MeasurandEnum::Voltage, ocpp::v2::MeasurandEnum::Energy_Active_Import_Register});
+    ASSERT_EQ(filtered_vec.sampledValue.size(), 3);
+    EXPECT_EQ(filtered_vec.sampledValue.at(0).measurand, ocpp::v2::MeasurandEnum::Voltage);
+    EXPECT_TRUE(filtered_vec.sampledValue.at(1).signedMeterValue.has_value());
+    EXPECT_EQ(filtered_vec.sampledValue.at(2).measurand, ocpp::v2::MeasurandEnum::Voltage);
+
+    EXPECT_FALSE(ocpp::v2::utils::meter_value_has_any_measurand(
+        meter_value, ocpp::v2::utils::get_measurands_mask(std::vector<ocpp::v2::MeasurandEnum>{
+                         ocpp::v2::MeasurandEnum::Current_Import})));
+}
+
 } // namespace common
 } // namespace ocpp
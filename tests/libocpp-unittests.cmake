@@ -61,6 +61,8 @@ set(LIBOCPP_TEST_INCLUDE_COMMON_SOURCES ${LIBOCPP_LIB_PATH}/ocpp/common/types.cp
                                         ${LIBOCPP_LIB_PATH}/ocpp/common/database/database_handler_common.cpp
                                         ${LIBOCPP_LIB_PATH}/ocpp/common/database/sqlite_statement.cpp
                                         ${LIBOCPP_LIB_PATH}/ocpp/common/database/database_schema_updater.cpp
+                                        ${LIBOCPP_LIB_PATH}/ocpp/common/database/local_authorization_list_index.cpp
+                                        ${LIBOCPP_LIB_PATH}/ocpp/common/bloom_filter.cpp
 )
 
 # If the test is not linked against the ocpp library, those default sources for ocpp v2.0.1 can be linked against, they